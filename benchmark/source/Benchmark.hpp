@@ -0,0 +1,108 @@
+#pragma once
+
+
+
+#include <VaultedVulkan.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+
+
+namespace Benchmark
+{
+	using namespace VV::V3;
+
+	using Clock = std::chrono::steady_clock;
+
+	/**
+	@brief A headless device on the first physical device with a graphics queue. (No layers or extensions are enabled so validation does not skew timings)
+	*/
+	struct Device
+	{
+		AppInstance                  Instance       ;
+		DynamicArray<PhysicalDevice> PhysicalDevices;
+		LogicalDevice                Logical        ;
+		LogicalDevice::Queue         Queue          ;
+
+		bool Create(RoCStr _name)
+		{
+			AppInstance::AppInfo appInfo;
+
+			appInfo.AppName     = _name             ;
+			appInfo.API_Version = EAPI_Version::_1_1;
+
+			AppInstance::CreateInfo instanceInfo;
+
+			instanceInfo.AppInfo = &appInfo;
+
+			if (Instance.Create(instanceInfo) != EResult::Success) return Fail("Failed to create the application instance.");
+
+			if (Instance.GetAvailablePhysicalDevices(PhysicalDevices) != EResult::Success || PhysicalDevices.empty())
+				return Fail("No physical device available.");
+
+			const PhysicalDevice& physicalDevice = PhysicalDevices.front();
+
+			DynamicArray<PhysicalDevice::QueueFamilyProperties> families = physicalDevice.GetAvailableQueueFamilies();
+
+			ui32 family = 0;
+
+			while (family < families.size() && !families[family].QueueFlags.HasFlag(EQueueFlag::Graphics)) family++;
+
+			if (family == families.size()) return Fail("No graphics queue family available.");
+
+			const float priority = 1.0f;
+
+			LogicalDevice::Queue::CreateInfo queueInfo;
+
+			queueInfo.QueueFamilyIndex = family   ;
+			queueInfo.QueueCount       = 1        ;
+			queueInfo.QueuePriorities  = &priority;
+
+			LogicalDevice::CreateInfo deviceInfo;
+
+			deviceInfo.QueueCreateInfoCount = 1         ;
+			deviceInfo.QueueCreateInfos     = &queueInfo;
+
+			if (Logical.Create(physicalDevice, deviceInfo) != EResult::Success) return Fail("Failed to create the logical device.");
+
+			Queue.Assign(Logical, family, 0, EQueueFlag::Graphics);
+
+			Queue.Retrieve();
+
+			std::printf("%s: %s\n\n", _name, physicalDevice.GetProperties().Name);
+
+			return true;
+		}
+
+		static bool Fail(RoCStr _message)
+		{
+			std::printf("%s\n", _message);
+
+			return false;
+		}
+	};
+
+	/**
+	@brief Runs the function the amount of times specified and provides the median duration of a run in microseconds.
+	*/
+	template<typename Function>
+	double MedianMicroseconds(ui32 _runs, Function&& _function)
+	{
+		DynamicArray<double> durations(_runs);
+
+		for (double& duration : durations)
+		{
+			const Clock::time_point start = Clock::now();
+
+			_function();
+
+			duration = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+		}
+
+		std::sort(durations.begin(), durations.end());
+
+		return durations[_runs / 2];
+	}
+}
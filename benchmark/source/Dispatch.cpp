@@ -0,0 +1,121 @@
+// Measures the cost of a device level call through the loader exports, the device's table, and the MagmaChamber's entry points
+// (with the device's table found first, and last of MaxDevices registered).
+
+#define VT_Vault_MagmaChamber_Open
+
+#include "Benchmark.hpp"
+
+
+
+using namespace Benchmark;
+
+
+
+namespace
+{
+	constexpr ui32 CallCount = 100000;
+	constexpr ui32 Runs      = 25    ;
+
+	/**
+	@brief Records the viewport calls with the procedure specified and provides the median time taken per call in nanoseconds.
+	*/
+	template<typename Procedure>
+	double MeasureCalls(CommandBufferRing& _ring, const Procedure& _setViewport)
+	{
+		CommandBuffer::BeginInfo beginInfo;
+
+		beginInfo.Flags.Set(ECommandBufferUsageFlag::OneTimeSubmit);
+
+		const double run = MedianMicroseconds(Runs, [&]()
+		{
+			_ring.BeginFrame(0);
+
+			CommandBuffer commandBuffer;
+
+			_ring.Acquire(commandBuffer);
+
+			commandBuffer.BeginRecord(beginInfo);
+
+			const CommandBuffer::Handle handle = commandBuffer;
+
+			for (ui32 call = 0; call < CallCount; call++)
+			{
+				VkViewport viewport {};
+
+				viewport.width    = float(1 + call % 1024);
+				viewport.height   = float(1 + call % 768 );
+				viewport.maxDepth = 1.0f;
+
+				_setViewport(handle, 0, 1, &viewport);
+			}
+
+			commandBuffer.EndRecord();
+		});
+
+		return run * 1000.0 / CallCount;
+	}
+
+	/**
+	@brief Stands in for a dispatchable object of another device, its dispatch key is its own address.
+	*/
+	struct OtherDevice
+	{
+		const void* Key = this;
+
+		VkDevice GetHandle() { return reinterpret_cast<VkDevice>(this); }
+	};
+}
+
+int main()
+{
+	Device device;
+
+	if (!device.Create("VV Benchmark: Dispatch")) return 1;
+
+	CommandBufferRing ring(device.Logical);
+
+	if (ring.Create(device.Queue, 1) != EResult::Success)
+	{
+		Device::Fail("Failed to create the command pool.");
+
+		return 1;
+	}
+
+	if (!VV::Vault_MagmaChamber::IsRegistered(device.Logical))
+	{
+		Device::Fail("The device's table was not registered.");
+
+		return 1;
+	}
+
+	const PFN_vkCmdSetViewport tableProcedure = device.Logical.GetDispatchTable().vkCmdSetViewport;
+
+	std::printf("%u vkCmdSetViewport calls, median of %u runs\n\n", CallCount, Runs);
+	std::printf("Path            Call (ns)\n");
+
+	const double loader = MeasureCalls(ring, ::vkCmdSetViewport                              );
+	const double table  = MeasureCalls(ring, tableProcedure                                  );
+	const double entry  = MeasureCalls(ring, VV::Vault_MagmaChamber::Entries::vkCmdSetViewport);
+
+	// Register the tables of other devices ahead of the device's, so its lookups scan every slot.
+	using VV::Vault_MagmaChamber::MaxDevices;
+
+	OtherDevice others[MaxDevices - 1];
+
+	VV::Vault_MagmaChamber::UnregisterDevice(device.Logical);
+
+	for (OtherDevice& other : others) VV::Vault_MagmaChamber::RegisterDevice(device.Logical.GetDispatchTable(), other.GetHandle());
+
+	VV::Vault_MagmaChamber::RegisterDevice(device.Logical.GetDispatchTable(), device.Logical);
+
+	const double lastEntry = MeasureCalls(ring, VV::Vault_MagmaChamber::Entries::vkCmdSetViewport);
+
+	for (OtherDevice& other : others) VV::Vault_MagmaChamber::UnregisterDevice(other.GetHandle());
+
+	std::printf("Loader export   %9.2f\n", loader   );
+	std::printf("Device table    %9.2f\n", table    );
+	std::printf("Entry point     %9.2f\n", entry    );
+	std::printf("Entry, %u slots  %9.2f\n", MaxDevices, lastEntry);
+
+	return 0;
+}
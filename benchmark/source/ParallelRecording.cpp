@@ -0,0 +1,116 @@
+// Measures how recording a fixed amount of work with ParallelRecorder scales from 1 to N threads.
+
+#include "Benchmark.hpp"
+
+#include <thread>
+
+
+
+using namespace Benchmark;
+
+
+
+namespace
+{
+	constexpr ui32 ItemCount    = 100000;
+	constexpr ui32 ItemsPerTask = 500   ;
+	constexpr ui32 Runs         = 25    ;
+
+	/**
+	@brief Records a frame's worth of items into the primary buffer of the ring and provides the median time taken.
+	*/
+	double MeasureFrame(CommandBufferRing& _primaries, ParallelRecorder& _recorder)
+	{
+		CommandBuffer::InheritanceWindow inheritance;
+
+		CommandBuffer::BeginInfo beginInfo;
+
+		beginInfo.Flags.Set(ECommandBufferUsageFlag::OneTimeSubmit);
+
+		// Dynamic state is valid outside of a render pass, so no render targets are needed to exercise the recording.
+		const ParallelRecorder::RecordFunction record = [](const CommandBuffer& _secondary, ui32 _firstItem, ui32 _itemCount, ui32)
+		{
+			for (ui32 item = _firstItem; item < _firstItem + _itemCount; item++)
+			{
+				Viewport viewport {};
+				Rect2D   scissor  {};
+
+				viewport.Width    = f32(1 + item % 1024);
+				viewport.Height   = f32(1 + item % 768 );
+				viewport.MaxDepth = 1.0f;
+
+				scissor.Extent.Width  = 1 + item % 1024;
+				scissor.Extent.Height = 1 + item % 768 ;
+
+				_secondary.SetViewport(viewport);
+				_secondary.SetScissor (scissor );
+			}
+		};
+
+		return MedianMicroseconds(Runs, [&]()
+		{
+			_primaries.BeginFrame(0);
+			_recorder .BeginFrame(0);
+
+			CommandBuffer primary;
+
+			_primaries.Acquire(primary);
+
+			primary.BeginRecord(beginInfo);
+
+			_recorder.Record(primary, inheritance, ItemCount, ItemsPerTask, record);
+
+			primary.EndRecord();
+		});
+	}
+}
+
+int main()
+{
+	Device device;
+
+	if (!device.Create("VV Benchmark: Parallel Recording")) return 1;
+
+	CommandBufferRing primaries(device.Logical);
+
+	if (primaries.Create(device.Queue, 1) != EResult::Success)
+	{
+		Device::Fail("Failed to create the primary command pool.");
+
+		return 1;
+	}
+
+	const ui32 maxThreads = (std::max)(std::thread::hardware_concurrency(), 1u);
+
+	std::printf("%u items, %u items per task, median of %u frames\n\n", ItemCount, ItemsPerTask, Runs);
+	std::printf("Threads   Frame (us)   Speedup\n");
+
+	// Powers of two up to the hardware concurrency, which is always measured even when it is not a power of two.
+	DynamicArray<ui32> threadCounts;
+
+	for (ui32 threadCount = 1; threadCount < maxThreads; threadCount *= 2) threadCounts.push_back(threadCount);
+
+	threadCounts.push_back(maxThreads);
+
+	double singleThreaded = 0.0;
+
+	for (ui32 threadCount : threadCounts)
+	{
+		ParallelRecorder recorder(device.Logical);
+
+		if (recorder.Create(device.Queue, threadCount, 1) != EResult::Success)
+		{
+			Device::Fail("Failed to create the recorder.");
+
+			return 1;
+		}
+
+		const double frame = MeasureFrame(primaries, recorder);
+
+		if (threadCount == 1) singleThreaded = frame;
+
+		std::printf("%7u   %10.1f   %6.2fx\n", threadCount, frame, singleThreaded / frame);
+	}
+
+	return 0;
+}
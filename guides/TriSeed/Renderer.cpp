@@ -165,26 +165,47 @@ namespace Backend
     {
 		LOG("Creating Vulkan GPU backend.");
 
-		StartCommunication();
+		// Open the trace before anything else, so the backend's setup is on its timeline. (View it with chrome://tracing or the Perfetto UI)
+		if (trace.Open("TriSeed.trace.json", 4096)) LOG("Tracing to TriSeed.trace.json");
 
-		EngageSuitableDevice(_window);
+	#ifdef VV_Option__Instrument_Calls
+		trace.TraceCalls(TraceSink::ECallTracing::Synchronization);   // Submissions, waits, acquires and presents.
+	#endif
+
+		{
+			TraceSink::Scope scope(trace, "Backend", "StartCommunication");
+
+			StartCommunication();
+		}
+
+		{
+			TraceSink::Scope scope(trace, "Backend", "EngageSuitableDevice");
+
+			EngageSuitableDevice(_window);
+		}
 
         // InitalizeResources();
 
         // SetupCommands();
 
-        start = std::chrono::high_resolution_clock::now();
+		trace.Instant("Backend", "Ready");
     }
 
     VKGPU::~VKGPU()
     {
-        device.WaitUntilIdle();   
+		{
+			TraceSink::Scope scope(trace, "Backend", "Shutdown");
 
-        // DestroyCommands();
+			device.WaitUntilIdle();   
 
-        // DestroyResources();
+			// DestroyCommands();
+
+			// DestroyResources();
+
+			CeaseCommunication();
+		}
 
-        CeaseCommunication();
+		trace.Close();   // Write the events left before the file is read.
     }
 
     void VKGPU::StartCommunication()
@@ -176,9 +176,7 @@ namespace Backend
 
 		// Timing
 
-		std::chrono::time_point<std::chrono::steady_clock> start, end;   // 
-
-		std::chrono::duration<double> elapsedTime;
+		TraceSink trace;   // Timeline of the backend's host events (and its synchronization calls when instrumented), declared first so it outlives the rest.
 		
 		// GPU Commmunication
 
@@ -16,6 +16,12 @@ VV_Option__Use_Forced_Inlining
 STL Exceptions (Note: right now the library does not STL exceptions but may in the future...):
 VV_Option__Use_STL_Exceptions
 
+Host side call instrumentation (call counts and latency histograms per API procedure, see VV_Instrumentation.hpp):
+#define VV_Option__Instrument_Calls
+
+API call capture and replay (records the calls of a frame's workload to a file to replay them, see VV_Capture.hpp):
+#define VV_Option__Capture_Calls
+
 Defining your own containers:
 
 #define VV_Option__Use_Custom_Containers
@@ -101,7 +107,11 @@ Features that would be nice to have:
 #include "VaultedVulkan/VV_Vaults.hpp"
 #include "VaultedVulkan/VV_APISpecGroups.hpp"
 #include "VaultedVulkan/VV_Platform.hpp"
+#include "VaultedVulkan/VV_MagmaChamber.hpp"
 #include "VaultedVulkan/VV_CPP_STL.hpp"
+#include "VaultedVulkan/VV_Instrumentation.hpp"
+#include "VaultedVulkan/VV_Capture.hpp"
+#include "VaultedVulkan/VV_FileIO.hpp"
 #include "VaultedVulkan/VV_Enums.hpp"
 #include "VaultedVulkan/VV_Backend.hpp"
 #include "VaultedVulkan/VV_Types.hpp"
@@ -113,11 +123,22 @@ Features that would be nice to have:
 #include "VaultedVulkan/VV_Memory.hpp"
 #include "VaultedVulkan/VV_Sampler.hpp"
 #include "VaultedVulkan/VV_Resource.hpp"
+#include "VaultedVulkan/VV_MemoryAllocator.hpp"
 #include "VaultedVulkan/VV_SyncAndCacheControl.hpp"
+#include "VaultedVulkan/VV_Query.hpp"
 #include "VaultedVulkan/VV_Shaders.hpp"
 #include "VaultedVulkan/VV_Pipelines.hpp"
+#include "VaultedVulkan/VV_PipelineCompiler.hpp"
 #include "VaultedVulkan/VV_RenderPass.hpp"
+#include "VaultedVulkan/VV_StructHash.hpp"
+#include "VaultedVulkan/VV_ObjectCache.hpp"
+#include "VaultedVulkan/VV_ShaderLibrary.hpp"
+#include "VaultedVulkan/VV_ShaderReflection.hpp"
 #include "VaultedVulkan/VV_Command.hpp"
+#include "VaultedVulkan/VV_CommandStream.hpp"
+#include "VaultedVulkan/VV_ParallelRecording.hpp"
+#include "VaultedVulkan/VV_Profiler.hpp"
+#include "VaultedVulkan/VV_Trace.hpp"
 #include "VaultedVulkan/VV_Surface.hpp"
 #include "VaultedVulkan/VV_SwapChain.hpp"
 #include "VaultedVulkan/VV_Debug.hpp"
@@ -18,6 +18,7 @@
 #include "VV_Platform.hpp"
 #include "VV_CPP_STL.hpp"
 #include "VV_Enums.hpp"
+#include "VV_Instrumentation.hpp"
 
 
 
@@ -11,13 +11,28 @@
 
 
 // C++
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <new>
 #include <set>
 #include <stdexcept>
+#include <thread>
+#include <tuple>
 #include <typeinfo>
 #include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
 
 // VV
 #include "VV_Vaults.hpp"
@@ -0,0 +1,2472 @@
+/*!
+@file VV_Capture.hpp
+
+@brief Vaulted Vulkan: Capture
+
+@details Capture of the API calls made by the vaults into a binary stream, and replay of the stream against a device.
+
+Only active when VV_Option__Capture_Calls is defined. (Which also defines VV_Option__Instrument_Calls: the calls are intercepted by the instrumentation's wrappers)
+
+The calls captured are those of a frame's workload: command buffer recording, queue submission and synchronization,
+descriptor updates, and swapchain acquires and presents. Their structure arguments are captured with their Next chains.
+(Chained structures that are not supported are skipped and counted)
+
+Handles are not captured by value but by their creation ordinal: the order in which the calls that create or retrieve handles returned them.
+Object creation is not replayed, the application replaying is expected to create its objects the same way it did when capturing
+(ex: by running the same initialization), so that the ordinals resolve to the objects of the replay. Memory contents are not captured.
+
+The stream is a header (magic, version), followed by records: [record type: u16][payload size: u32][payload].
+Records are flushed to the file as the capture goes, and the replayer reads the file through a memory mapping.
+*/
+
+
+
+#pragma once
+
+
+
+// VV
+#include "VV_Vaults.hpp"
+#include "VV_APISpecGroups.hpp"
+#include "VV_Platform.hpp"
+#include "VV_CPP_STL.hpp"
+#include "VV_FileIO.hpp"
+
+
+
+#ifdef VV_Option__Capture_Calls
+
+#ifndef VV_Option__Use_Long_Namespace
+namespace VV
+#else
+namespace VaultedVulkan
+#endif
+{
+	namespace Capture
+	{
+		/**
+		@addtogroup Capture
+		@{
+		*/
+
+		static_assert(sizeof(void*) == 8, "Call capture requires 64-bit handles.");
+
+		constexpr u32 Magic   = 0x50435656;   ///< "VVCP"
+		constexpr u32 Version = 2         ;
+
+		/**
+		@brief The records of the stream. (Append only, the values are part of the format)
+		*/
+		enum class ERecord : u16
+		{
+			Frame,
+
+			vkAcquireNextImageKHR    ,
+			vkBeginCommandBuffer     ,
+			vkCmdBeginQuery          ,
+			vkCmdBeginRenderPass     ,
+			vkCmdBindDescriptorSets  ,
+			vkCmdBindIndexBuffer     ,
+			vkCmdBindPipeline        ,
+			vkCmdBindVertexBuffers   ,
+			vkCmdBlitImage           ,
+			vkCmdCopyBuffer          ,
+			vkCmdCopyBufferToImage   ,
+			vkCmdCopyQueryPoolResults,
+			vkCmdDraw                ,
+			vkCmdDrawIndexed         ,
+			vkCmdEndQuery            ,
+			vkCmdEndRenderPass       ,
+			vkCmdExecuteCommands     ,
+			vkCmdPipelineBarrier     ,
+			vkCmdPushConstants       ,
+			vkCmdResetEvent          ,
+			vkCmdResetQueryPool      ,
+			vkCmdSetDeviceMask       ,
+			vkCmdSetEvent            ,
+			vkCmdSetScissor          ,
+			vkCmdSetViewport         ,
+			vkCmdWaitEvents          ,
+			vkCmdWriteTimestamp      ,
+			vkDeviceWaitIdle         ,
+			vkEndCommandBuffer       ,
+			vkQueuePresentKHR        ,
+			vkQueueSubmit            ,
+			vkQueueWaitIdle          ,
+			vkResetCommandBuffer     ,
+			vkResetCommandPool       ,
+			vkResetFences            ,
+			vkUpdateDescriptorSets   ,
+			vkWaitForFences
+		};
+
+		template<typename Type, typename = void>
+		struct IsComplete : std::false_type {};
+
+		template<typename Type>
+		struct IsComplete<Type, std::void_t<decltype(sizeof(Type))>> : std::true_type {};
+
+		/**
+		@brief Handles are pointers to types the API never defines.
+		*/
+		template<typename Type>
+		constexpr bool IsHandle =
+			std::is_pointer<Type>::value                                &&
+			std::is_class  <std::remove_pointer_t<Type>>::value         &&
+			! IsComplete   <std::remove_pointer_t<Type>>::value;
+
+		/**
+		@brief Keeps the handles created or retrieved, in the order they were.
+
+		@details An ordinal of 0 is a null handle.
+		*/
+		class HandleRegistry
+		{
+		public:
+
+			static constexpr u32 Untracked = UINT32_MAX;   ///< Ordinal of a handle that was never tracked.
+
+			/**
+			@brief Provides the handle of an ordinal. (0 if the ordinal was never given)
+			*/
+			u64 GetHandle(u32 _ordinal)
+			{
+				std::lock_guard<std::mutex> guard(lock);
+
+				return _ordinal != 0 && _ordinal <= handles.size() ? handles[_ordinal - 1] : 0;
+			}
+
+			/**
+			@brief Forget the handles tracked. (ex: To replay in the process that captured, after its objects were created again)
+			*/
+			void Reset()
+			{
+				std::lock_guard<std::mutex> guard(lock);
+
+				ordinals   .clear();
+				handles    .clear();
+				secondaries.clear();
+			}
+
+			/**
+			@brief Provides the ordinal of the last object created with the handle. (Untracked if not tracked)
+			*/
+			u32 GetOrdinal(u64 _handle)
+			{
+				std::lock_guard<std::mutex> guard(lock);
+
+				auto found = ordinals.find(_handle);
+
+				return found != ordinals.end() ? found->second : Untracked;
+			}
+
+			/**
+			@brief Provides the amount of handles tracked.
+			*/
+			u32 GetCount()
+			{
+				std::lock_guard<std::mutex> guard(lock);
+
+				return u32(handles.size());
+			}
+
+			/**
+			@brief Checks to see if the command buffer was allocated as a secondary one.
+			*/
+			bool IsSecondary(VkCommandBuffer _commandBuffer)
+			{
+				std::lock_guard<std::mutex> guard(lock);
+
+				return secondaries.count(u64(reinterpret_cast<std::uintptr_t>(_commandBuffer))) != 0;
+			}
+
+			/**
+			@brief Keep the level of the command buffers specified. (A handle may be reused by a buffer of another level)
+			*/
+			void SetLevel(const VkCommandBuffer* _commandBuffers, u32 _count, VkCommandBufferLevel _level)
+			{
+				std::lock_guard<std::mutex> guard(lock);
+
+				for (u32 index = 0; index < _count; index++)
+				{
+					u64 handle = u64(reinterpret_cast<std::uintptr_t>(_commandBuffers[index]));
+
+					if (_level == VK_COMMAND_BUFFER_LEVEL_SECONDARY) secondaries.insert(handle);
+					else                                             secondaries.erase (handle);
+				}
+			}
+
+			/**
+			@brief Give the next ordinals to the handles specified.
+			*/
+			template<typename HandleType>
+			void Track(const HandleType* _handles, u32 _count)
+			{
+				std::lock_guard<std::mutex> guard(lock);
+
+				for (u32 index = 0; index < _count; index++)
+				{
+					u64 handle = u64(reinterpret_cast<std::uintptr_t>(_handles[index]));
+
+					handles.push_back(handle);
+
+					ordinals[handle] = u32(handles.size());
+				}
+			}
+
+		protected:
+
+			std::mutex lock;
+
+			std::unordered_map<u64, u32> ordinals;
+
+			DynamicArray<u64> handles;
+
+			std::unordered_set<u64> secondaries;   ///< Command buffers allocated as secondary.
+		};
+
+		inline HandleRegistry& GetRegistry()
+		{
+			static HandleRegistry registry;
+
+			return registry;
+		}
+
+		/**
+		@brief Bump allocator for the arrays decoded from a record. (Reset per record)
+		*/
+		class Arena
+		{
+		public:
+
+			static constexpr std::size_t ChunkSize = 64 * 1024;
+
+			Arena() : chunk(0), offset(0)
+			{}
+
+			void* Allocate(std::size_t _size)
+			{
+				_size = (_size + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+
+				if (_size > ChunkSize)
+				{
+					large.emplace_back(new u8[_size]());
+
+					return large.back().get();
+				}
+
+				if (chunk == chunks.size() || offset + _size > ChunkSize)
+				{
+					if (chunk < chunks.size()) chunk++;
+
+					if (chunk == chunks.size()) chunks.emplace_back(new u8[ChunkSize]);
+
+					offset = 0;
+				}
+
+				void* memory = chunks[chunk].get() + offset;
+
+				offset += _size;
+
+				std::memset(memory, 0, _size);
+
+				return memory;
+			}
+
+			void Reset()
+			{
+				large.clear();
+
+				chunk  = 0;
+				offset = 0;
+			}
+
+		protected:
+
+			DynamicArray<std::unique_ptr<u8[]>> chunks;
+
+			DynamicArray<std::unique_ptr<u8[]>> large;
+
+			std::size_t chunk;
+
+			std::size_t offset;
+		};
+
+		inline std::size_t GetChainedSize(VkStructureType _type);
+
+		template<typename Archive>
+		void SerializeChained(Archive& _archive, VkStructureType _type, void* _structure);
+
+		/**
+		@brief Encodes the arguments of a call into a record's payload.
+		*/
+		class Writer
+		{
+		public:
+
+			static constexpr bool Reading = false;
+
+			explicit Writer(DynamicArray<u8>& _buffer) : buffer(&_buffer), unresolved(0), skipped(0)
+			{}
+
+			template<typename... Types>
+			void operator() (Types&... _values)
+			{
+				(Serialize(*this, _values), ...);
+			}
+
+			/**
+			@brief A pointer to an array of the count given. (The count is transferred separately)
+			*/
+			template<typename Type>
+			void Array(const Type*& _array, u32 _count)
+			{
+				u8 present = _array != nullptr;
+
+				Raw(present);
+
+				if (!present) return;
+
+				for (u32 index = 0; index < _count; index++) Serialize(*this, const_cast<Type&>(_array[index]));
+			}
+
+			/**
+			@brief A pointer to opaque data of the size given.
+			*/
+			void Bytes(const void*& _data, std::size_t _size)
+			{
+				u8 present = _data != nullptr;
+
+				Raw(present);
+
+				if (!present) return;
+
+				const u8* data = static_cast<const u8*>(_data);
+
+				buffer->insert(buffer->end(), data, data + _size);
+			}
+
+			/**
+			@brief A Next chain: the first supported structure, which transfers the rest of the chain itself.
+			*/
+			void Chain(const void*& _next)
+			{
+				const VkBaseInStructure* next = static_cast<const VkBaseInStructure*>(_next);
+
+				while (next != nullptr && GetChainedSize(next->sType) == 0)
+				{
+					skipped++;
+
+					next = next->pNext;
+				}
+
+				VkStructureType type = next != nullptr ? next->sType : VK_STRUCTURE_TYPE_MAX_ENUM;
+
+				Raw(type);
+
+				if (next != nullptr) SerializeChained(*this, type, const_cast<VkBaseInStructure*>(next));
+			}
+
+			template<typename HandleType>
+			void Handle(HandleType& _handle)
+			{
+				u32 ordinal = 0;
+
+				if (_handle != VK_NULL_HANDLE)
+				{
+					ordinal = GetRegistry().GetOrdinal(u64(reinterpret_cast<std::uintptr_t>(_handle)));
+
+					if (ordinal == HandleRegistry::Untracked) unresolved++;
+				}
+
+				Raw(ordinal);
+			}
+
+			template<typename Type>
+			void Pointer(const Type*& _pointer)
+			{
+				Array(_pointer, 1);
+			}
+
+			template<typename Type>
+			void Raw(const Type& _value)
+			{
+				const u8* bytes = reinterpret_cast<const u8*>(&_value);
+
+				buffer->insert(buffer->end(), bytes, bytes + sizeof(Type));
+			}
+
+			u32 GetSkippedCount   () const { return skipped   ; }
+			u32 GetUnresolvedCount() const { return unresolved; }
+
+		protected:
+
+			DynamicArray<u8>* buffer;
+
+			u32 unresolved;   ///< Handles that were never tracked.
+
+			u32 skipped;   ///< Chained structures not supported.
+		};
+
+		/**
+		@brief Decodes the arguments of a call from a record's payload.
+
+		@details Arrays are decoded into the arena, opaque data points into the payload.
+		*/
+		class Reader
+		{
+		public:
+
+			static constexpr bool Reading = true;
+
+			Reader(const u8* _data, std::size_t _size, Arena& _arena) :
+				cursor(_data), end(_data + _size), arena(&_arena), unresolved(0), failed(false)
+			{}
+
+			template<typename... Types>
+			void operator() (Types&... _values)
+			{
+				(Serialize(*this, _values), ...);
+			}
+
+			template<typename Type>
+			void Array(const Type*& _array, u32 _count)
+			{
+				u8 present = 0;
+
+				Raw(present);
+
+				// Each element takes at least a byte, a larger count can only come from a corrupt stream.
+				if (!present || failed || _count > std::size_t(end - cursor))
+				{
+					failed  = failed || (present && _count > std::size_t(end - cursor));
+					_array  = nullptr;
+
+					return;
+				}
+
+				Type* array = static_cast<Type*>(arena->Allocate(sizeof(Type) * _count));
+
+				for (u32 index = 0; index < _count; index++) Serialize(*this, array[index]);
+
+				_array = array;
+			}
+
+			void Bytes(const void*& _data, std::size_t _size)
+			{
+				u8 present = 0;
+
+				Raw(present);
+
+				if (!present || failed || _size > std::size_t(end - cursor))
+				{
+					failed = failed || (present && _size > std::size_t(end - cursor));
+					_data  = nullptr;
+
+					return;
+				}
+
+				_data = cursor;
+
+				cursor += _size;
+			}
+
+			void Chain(const void*& _next)
+			{
+				VkStructureType type = VK_STRUCTURE_TYPE_MAX_ENUM;
+
+				Raw(type);
+
+				_next = nullptr;
+
+				if (type == VK_STRUCTURE_TYPE_MAX_ENUM || failed) return;
+
+				std::size_t size = GetChainedSize(type);
+
+				if (size == 0)
+				{
+					failed = true;
+
+					return;
+				}
+
+				void* structure = arena->Allocate(size);
+
+				SerializeChained(*this, type, structure);
+
+				_next = structure;
+			}
+
+			template<typename HandleType>
+			void Handle(HandleType& _handle)
+			{
+				u32 ordinal = 0;
+
+				Raw(ordinal);
+
+				u64 handle = GetRegistry().GetHandle(ordinal);
+
+				if (ordinal != 0 && handle == 0) unresolved++;
+
+				_handle = reinterpret_cast<HandleType>(std::uintptr_t(handle));
+			}
+
+			template<typename Type>
+			void Pointer(const Type*& _pointer)
+			{
+				Array(_pointer, 1);
+			}
+
+			template<typename Type>
+			void Raw(Type& _value)
+			{
+				if (failed || std::size_t(end - cursor) < sizeof(Type))
+				{
+					failed = true;
+
+					return;
+				}
+
+				std::memcpy(&_value, cursor, sizeof(Type));
+
+				cursor += sizeof(Type);
+			}
+
+			u32  GetUnresolvedCount() const { return unresolved   ; }
+			bool HasFailed         () const { return failed       ; }
+			bool IsAtEnd           () const { return cursor == end; }
+
+		protected:
+
+			const u8* cursor;
+
+			const u8* end;
+
+			Arena* arena;
+
+			u32 unresolved;   ///< Ordinals with no handle in this process.
+
+			bool failed;
+		};
+
+		#pragma region Serialization
+
+		/**
+		@brief Values are transferred as is, handles by ordinal.
+		*/
+		template<typename Archive, typename Type>
+		void Serialize(Archive& _archive, Type& _value)
+		{
+			if constexpr (IsHandle<Type>)
+			{
+				_archive.Handle(_value);
+			}
+			else
+			{
+				static_assert(!std::is_pointer<Type>::value, "Pointers must be transferred as arrays, bytes or chains.");
+
+				_archive.Raw(_value);
+			}
+		}
+
+		template<typename Archive>
+		void Serialize(Archive& _archive, VkBufferMemoryBarrier& _barrier)
+		{
+			_archive(_barrier.sType);
+
+			_archive.Chain(_barrier.pNext);
+
+			_archive
+			(
+				_barrier.srcAccessMask      , _barrier.dstAccessMask      ,
+				_barrier.srcQueueFamilyIndex, _barrier.dstQueueFamilyIndex,
+				_barrier.buffer             , _barrier.offset             , _barrier.size
+			);
+		}
+
+		template<typename Archive>
+		void Serialize(Archive& _archive, VkCommandBufferInheritanceInfo& _info)
+		{
+			_archive(_info.sType);
+
+			_archive.Chain(_info.pNext);
+
+			_archive
+			(
+				_info.renderPass, _info.subpass, _info.framebuffer, _info.occlusionQueryEnable, _info.queryFlags, _info.pipelineStatistics
+			);
+		}
+
+		template<typename Archive>
+		void Serialize(Archive& _archive, VkCommandBufferBeginInfo& _info)
+		{
+			_archive(_info.sType);
+
+			_archive.Chain(_info.pNext);
+
+			_archive(_info.flags);
+
+			// Only read for secondary command buffers: transferred by the record, which knows the level.
+			if constexpr (Archive::Reading) _info.pInheritanceInfo = nullptr;
+		}
+
+		template<typename Archive>
+		void Serialize(Archive& _archive, VkCopyDescriptorSet& _copy)
+		{
+			_archive(_copy.sType);
+
+			_archive.Chain(_copy.pNext);
+
+			_archive
+			(
+				_copy.srcSet, _copy.srcBinding, _copy.srcArrayElement,
+				_copy.dstSet, _copy.dstBinding, _copy.dstArrayElement,
+				_copy.descriptorCount
+			);
+		}
+
+		template<typename Archive>
+		void Serialize(Archive& _archive, VkDescriptorBufferInfo& _info)
+		{
+			_archive(_info.buffer, _info.offset, _info.range);
+		}
+
+		template<typename Archive>
+		void Serialize(Archive& _archive, VkDescriptorImageInfo& _info)
+		{
+			_archive(_info.sampler, _info.imageView, _info.imageLayout);
+		}
+
+		template<typename Archive>
+		void Serialize(Archive& _archive, VkImageMemoryBarrier& _barrier)
+		{
+			_archive(_barrier.sType);
+
+			_archive.Chain(_barrier.pNext);
+
+			_archive
+			(
+				_barrier.srcAccessMask      , _barrier.dstAccessMask      ,
+				_barrier.oldLayout          , _barrier.newLayout          ,
+				_barrier.srcQueueFamilyIndex, _barrier.dstQueueFamilyIndex,
+				_barrier.image              , _barrier.subresourceRange
+			);
+		}
+
+		template<typename Archive>
+		void Serialize(Archive& _archive, VkMemoryBarrier& _barrier)
+		{
+			_archive(_barrier.sType);
+
+			_archive.Chain(_barrier.pNext);
+
+			_archive(_barrier.srcAccessMask, _barrier.dstAccessMask);
+		}
+
+		template<typename Archive>
+		void Serialize(Archive& _archive, VkPresentInfoKHR& _info)
+		{
+			_archive(_info.sType);
+
+			_archive.Chain(_info.pNext);
+
+			_archive(_info.waitSemaphoreCount);
+
+			_archive.Array(_info.pWaitSemaphores, _info.waitSemaphoreCount);
+
+			_archive(_info.swapchainCount);
+
+			_archive.Array(_info.pSwapchains  , _info.swapchainCount);
+			_archive.Array(_info.pImageIndices, _info.swapchainCount);
+
+			// The results are an output.
+			if constexpr (Archive::Reading) _info.pResults = nullptr;
+		}
+
+		template<typename Archive>
+		void Serialize(Archive& _archive, VkRenderPassAttachmentBeginInfo& _info)
+		{
+			_archive(_info.sType);
+
+			_archive.Chain(_info.pNext);
+
+			_archive(_info.attachmentCount);
+
+			_archive.Array(_info.pAttachments, _info.attachmentCount);
+		}
+
+		template<typename Archive>
+		void Serialize(Archive& _archive, VkRenderPassBeginInfo& _info)
+		{
+			_archive(_info.sType);
+
+			_archive.Chain(_info.pNext);
+
+			_archive(_info.renderPass, _info.framebuffer, _info.renderArea, _info.clearValueCount);
+
+			_archive.Array(_info.pClearValues, _info.clearValueCount);
+		}
+
+		template<typename Archive>
+		void Serialize(Archive& _archive, VkSubmitInfo& _info)
+		{
+			_archive(_info.sType);
+
+			_archive.Chain(_info.pNext);
+
+			_archive(_info.waitSemaphoreCount);
+
+			_archive.Array(_info.pWaitSemaphores  , _info.waitSemaphoreCount);
+			_archive.Array(_info.pWaitDstStageMask, _info.waitSemaphoreCount);
+
+			_archive(_info.commandBufferCount);
+
+			_archive.Array(_info.pCommandBuffers, _info.commandBufferCount);
+
+			_archive(_info.signalSemaphoreCount);
+
+			_archive.Array(_info.pSignalSemaphores, _info.signalSemaphoreCount);
+		}
+
+		template<typename Archive>
+		void Serialize(Archive& _archive, VkTimelineSemaphoreSubmitInfo& _info)
+		{
+			_archive(_info.sType);
+
+			_archive.Chain(_info.pNext);
+
+			_archive(_info.waitSemaphoreValueCount);
+
+			_archive.Array(_info.pWaitSemaphoreValues, _info.waitSemaphoreValueCount);
+
+			_archive(_info.signalSemaphoreValueCount);
+
+			_archive.Array(_info.pSignalSemaphoreValues, _info.signalSemaphoreValueCount);
+		}
+
+		template<typename Archive>
+		void Serialize(Archive& _archive, VkWriteDescriptorSet& _write)
+		{
+			_archive(_write.sType);
+
+			_archive.Chain(_write.pNext);
+
+			_archive(_write.dstSet, _write.dstBinding, _write.dstArrayElement, _write.descriptorCount, _write.descriptorType);
+
+			// Only the array of the descriptor type is valid, the others may be left dangling.
+			switch (_write.descriptorType)
+			{
+				case VK_DESCRIPTOR_TYPE_SAMPLER               :
+				case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+				case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE         :
+				case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE         :
+				case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT      :
+				{
+					_archive.Array(_write.pImageInfo, _write.descriptorCount);
+
+					break;
+				}
+				case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER        :
+				case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER        :
+				case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+				case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+				{
+					_archive.Array(_write.pBufferInfo, _write.descriptorCount);
+
+					break;
+				}
+				case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+				case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+				{
+					_archive.Array(_write.pTexelBufferView, _write.descriptorCount);
+
+					break;
+				}
+				default:
+				{
+					break;
+				}
+			}
+		}
+
+		/**
+		@brief Provides the size of a structure supported in Next chains. (0 if not supported)
+		*/
+		inline std::size_t GetChainedSize(VkStructureType _type)
+		{
+			switch (_type)
+			{
+				case VK_STRUCTURE_TYPE_RENDER_PASS_ATTACHMENT_BEGIN_INFO: return sizeof(VkRenderPassAttachmentBeginInfo);
+				case VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO   : return sizeof(VkTimelineSemaphoreSubmitInfo  );
+
+				default: return 0;
+			}
+		}
+
+		template<typename Archive>
+		void SerializeChained(Archive& _archive, VkStructureType _type, void* _structure)
+		{
+			switch (_type)
+			{
+				case VK_STRUCTURE_TYPE_RENDER_PASS_ATTACHMENT_BEGIN_INFO:
+				{
+					Serialize(_archive, *static_cast<VkRenderPassAttachmentBeginInfo*>(_structure));
+
+					break;
+				}
+				case VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO:
+				{
+					Serialize(_archive, *static_cast<VkTimelineSemaphoreSubmitInfo*>(_structure));
+
+					break;
+				}
+				default:
+				{
+					break;
+				}
+			}
+		}
+
+		#pragma endregion Serialization
+
+		/**
+		@brief The procedures the records issue. (The MagmaChamber's entry points when it is open)
+		*/
+		#ifdef VT_Vault_MagmaChamber_Open
+			#define VV_Capture_Target(_PROCEDURE) Vault_MagmaChamber::Entries::_PROCEDURE
+		#else
+			#define VV_Capture_Target(_PROCEDURE) ::_PROCEDURE
+		#endif
+
+		#pragma region Records
+
+		/**
+		@brief Each record holds the arguments of a call: transfers them, and issues the call with them.
+		*/
+		namespace Records
+		{
+			struct Frame
+			{
+				static constexpr ERecord Type = ERecord::Frame;
+
+				template<typename Archive> void Transfer(Archive&) {}
+
+				void Issue() {}
+			};
+
+			struct AcquireNextImageKHR
+			{
+				static constexpr ERecord Type = ERecord::vkAcquireNextImageKHR;
+
+				VkDevice       Device        ;
+				VkSwapchainKHR Swapchain     ;
+				uint64_t       Timeout       ;
+				VkSemaphore    Semaphore     ;
+				VkFence        Fence         ;
+				uint32_t*      ImageIndex    ;
+				uint32_t       AcquiredIndex ;   ///< The index acquired when capturing.
+				uint32_t       ReplayedIndex ;   ///< The index acquired by the replay.
+
+				template<typename Archive> void Transfer(Archive& _archive)
+				{
+					_archive(Device, Swapchain, Timeout, Semaphore, Fence, AcquiredIndex);
+
+					// The image index is an output, the replayer maps the index captured to it for the presents.
+					if constexpr (Archive::Reading) ImageIndex = &ReplayedIndex;
+				}
+
+				VkResult Issue() { return VV_Capture_Target(vkAcquireNextImageKHR)(Device, Swapchain, Timeout, Semaphore, Fence, ImageIndex); }
+			};
+
+			struct BeginCommandBuffer
+			{
+				static constexpr ERecord Type = ERecord::vkBeginCommandBuffer;
+
+				      VkCommandBuffer           CommandBuffer;
+				const VkCommandBufferBeginInfo* BeginInfo    ;
+
+				template<typename Archive> void Transfer(Archive& _archive)
+				{
+					// The inheritance info of a primary command buffer is ignored, and may be garbage.
+					u8 secondary = 0;
+
+					if constexpr (!Archive::Reading) secondary = GetRegistry().IsSecondary(CommandBuffer);
+
+					_archive(CommandBuffer, secondary);
+
+					_archive.Pointer(BeginInfo);
+
+					if (secondary && BeginInfo != nullptr) _archive.Pointer(const_cast<VkCommandBufferBeginInfo*>(BeginInfo)->pInheritanceInfo);
+				}
+
+				VkResult Issue() { return VV_Capture_Target(vkBeginCommandBuffer)(CommandBuffer, BeginInfo); }
+			};
+
+			struct CmdBeginQuery
+			{
+				static constexpr ERecord Type = ERecord::vkCmdBeginQuery;
+
+				VkCommandBuffer     CommandBuffer;
+				VkQueryPool         QueryPool    ;
+				uint32_t            Query        ;
+				VkQueryControlFlags Flags        ;
+
+				template<typename Archive> void Transfer(Archive& _archive) { _archive(CommandBuffer, QueryPool, Query, Flags); }
+
+				void Issue() { VV_Capture_Target(vkCmdBeginQuery)(CommandBuffer, QueryPool, Query, Flags); }
+			};
+
+			struct CmdBeginRenderPass
+			{
+				static constexpr ERecord Type = ERecord::vkCmdBeginRenderPass;
+
+				      VkCommandBuffer        CommandBuffer;
+				const VkRenderPassBeginInfo* BeginInfo    ;
+				      VkSubpassContents      Contents     ;
+
+				template<typename Archive> void Transfer(Archive& _archive) { _archive(CommandBuffer, Contents); _archive.Pointer(BeginInfo); }
+
+				void Issue() { VV_Capture_Target(vkCmdBeginRenderPass)(CommandBuffer, BeginInfo, Contents); }
+			};
+
+			struct CmdBindDescriptorSets
+			{
+				static constexpr ERecord Type = ERecord::vkCmdBindDescriptorSets;
+
+				      VkCommandBuffer     CommandBuffer     ;
+				      VkPipelineBindPoint BindPoint         ;
+				      VkPipelineLayout    Layout            ;
+				      uint32_t            FirstSet          ;
+				      uint32_t            SetCount          ;
+				const VkDescriptorSet*    Sets              ;
+				      uint32_t            DynamicOffsetCount;
+				const uint32_t*           DynamicOffsets    ;
+
+				template<typename Archive> void Transfer(Archive& _archive)
+				{
+					_archive(CommandBuffer, BindPoint, Layout, FirstSet, SetCount, DynamicOffsetCount);
+
+					_archive.Array(Sets          , SetCount          );
+					_archive.Array(DynamicOffsets, DynamicOffsetCount);
+				}
+
+				void Issue() { VV_Capture_Target(vkCmdBindDescriptorSets)(CommandBuffer, BindPoint, Layout, FirstSet, SetCount, Sets, DynamicOffsetCount, DynamicOffsets); }
+			};
+
+			struct CmdBindIndexBuffer
+			{
+				static constexpr ERecord Type = ERecord::vkCmdBindIndexBuffer;
+
+				VkCommandBuffer CommandBuffer;
+				VkBuffer        Buffer       ;
+				VkDeviceSize    Offset       ;
+				VkIndexType     IndexType    ;
+
+				template<typename Archive> void Transfer(Archive& _archive) { _archive(CommandBuffer, Buffer, Offset, IndexType); }
+
+				void Issue() { VV_Capture_Target(vkCmdBindIndexBuffer)(CommandBuffer, Buffer, Offset, IndexType); }
+			};
+
+			struct CmdBindPipeline
+			{
+				static constexpr ERecord Type = ERecord::vkCmdBindPipeline;
+
+				VkCommandBuffer     CommandBuffer;
+				VkPipelineBindPoint BindPoint    ;
+				VkPipeline          Pipeline     ;
+
+				template<typename Archive> void Transfer(Archive& _archive) { _archive(CommandBuffer, BindPoint, Pipeline); }
+
+				void Issue() { VV_Capture_Target(vkCmdBindPipeline)(CommandBuffer, BindPoint, Pipeline); }
+			};
+
+			struct CmdBindVertexBuffers
+			{
+				static constexpr ERecord Type = ERecord::vkCmdBindVertexBuffers;
+
+				      VkCommandBuffer CommandBuffer;
+				      uint32_t        FirstBinding ;
+				      uint32_t        BindingCount ;
+				const VkBuffer*       Buffers      ;
+				const VkDeviceSize*   Offsets      ;
+
+				template<typename Archive> void Transfer(Archive& _archive)
+				{
+					_archive(CommandBuffer, FirstBinding, BindingCount);
+
+					_archive.Array(Buffers, BindingCount);
+					_archive.Array(Offsets, BindingCount);
+				}
+
+				void Issue() { VV_Capture_Target(vkCmdBindVertexBuffers)(CommandBuffer, FirstBinding, BindingCount, Buffers, Offsets); }
+			};
+
+			struct CmdBlitImage
+			{
+				static constexpr ERecord Type = ERecord::vkCmdBlitImage;
+
+				      VkCommandBuffer CommandBuffer ;
+				      VkImage         SourceImage   ;
+				      VkImageLayout   SourceLayout  ;
+				      VkImage         DestImage     ;
+				      VkImageLayout   DestLayout    ;
+				      uint32_t        RegionCount   ;
+				const VkImageBlit*    Regions       ;
+				      VkFilter        Filter        ;
+
+				template<typename Archive> void Transfer(Archive& _archive)
+				{
+					_archive(CommandBuffer, SourceImage, SourceLayout, DestImage, DestLayout, RegionCount, Filter);
+
+					_archive.Array(Regions, RegionCount);
+				}
+
+				void Issue() { VV_Capture_Target(vkCmdBlitImage)(CommandBuffer, SourceImage, SourceLayout, DestImage, DestLayout, RegionCount, Regions, Filter); }
+			};
+
+			struct CmdCopyBuffer
+			{
+				static constexpr ERecord Type = ERecord::vkCmdCopyBuffer;
+
+				      VkCommandBuffer CommandBuffer;
+				      VkBuffer        SourceBuffer ;
+				      VkBuffer        DestBuffer   ;
+				      uint32_t        RegionCount  ;
+				const VkBufferCopy*   Regions      ;
+
+				template<typename Archive> void Transfer(Archive& _archive)
+				{
+					_archive(CommandBuffer, SourceBuffer, DestBuffer, RegionCount);
+
+					_archive.Array(Regions, RegionCount);
+				}
+
+				void Issue() { VV_Capture_Target(vkCmdCopyBuffer)(CommandBuffer, SourceBuffer, DestBuffer, RegionCount, Regions); }
+			};
+
+			struct CmdCopyBufferToImage
+			{
+				static constexpr ERecord Type = ERecord::vkCmdCopyBufferToImage;
+
+				      VkCommandBuffer    CommandBuffer;
+				      VkBuffer           SourceBuffer ;
+				      VkImage            DestImage    ;
+				      VkImageLayout      DestLayout   ;
+				      uint32_t           RegionCount  ;
+				const VkBufferImageCopy* Regions      ;
+
+				template<typename Archive> void Transfer(Archive& _archive)
+				{
+					_archive(CommandBuffer, SourceBuffer, DestImage, DestLayout, RegionCount);
+
+					_archive.Array(Regions, RegionCount);
+				}
+
+				void Issue() { VV_Capture_Target(vkCmdCopyBufferToImage)(CommandBuffer, SourceBuffer, DestImage, DestLayout, RegionCount, Regions); }
+			};
+
+			struct CmdCopyQueryPoolResults
+			{
+				static constexpr ERecord Type = ERecord::vkCmdCopyQueryPoolResults;
+
+				VkCommandBuffer    CommandBuffer;
+				VkQueryPool        QueryPool    ;
+				uint32_t           FirstQuery   ;
+				uint32_t           QueryCount   ;
+				VkBuffer           DestBuffer   ;
+				VkDeviceSize       DestOffset   ;
+				VkDeviceSize       Stride       ;
+				VkQueryResultFlags Flags        ;
+
+				template<typename Archive> void Transfer(Archive& _archive)
+				{
+					_archive(CommandBuffer, QueryPool, FirstQuery, QueryCount, DestBuffer, DestOffset, Stride, Flags);
+				}
+
+				void Issue() { VV_Capture_Target(vkCmdCopyQueryPoolResults)(CommandBuffer, QueryPool, FirstQuery, QueryCount, DestBuffer, DestOffset, Stride, Flags); }
+			};
+
+			struct CmdDraw
+			{
+				static constexpr ERecord Type = ERecord::vkCmdDraw;
+
+				VkCommandBuffer CommandBuffer;
+				uint32_t        VertexCount  ;
+				uint32_t        InstanceCount;
+				uint32_t        FirstVertex  ;
+				uint32_t        FirstInstance;
+
+				template<typename Archive> void Transfer(Archive& _archive) { _archive(CommandBuffer, VertexCount, InstanceCount, FirstVertex, FirstInstance); }
+
+				void Issue() { VV_Capture_Target(vkCmdDraw)(CommandBuffer, VertexCount, InstanceCount, FirstVertex, FirstInstance); }
+			};
+
+			struct CmdDrawIndexed
+			{
+				static constexpr ERecord Type = ERecord::vkCmdDrawIndexed;
+
+				VkCommandBuffer CommandBuffer;
+				uint32_t        IndexCount   ;
+				uint32_t        InstanceCount;
+				uint32_t        FirstIndex   ;
+				int32_t         VertexOffset ;
+				uint32_t        FirstInstance;
+
+				template<typename Archive> void Transfer(Archive& _archive) { _archive(CommandBuffer, IndexCount, InstanceCount, FirstIndex, VertexOffset, FirstInstance); }
+
+				void Issue() { VV_Capture_Target(vkCmdDrawIndexed)(CommandBuffer, IndexCount, InstanceCount, FirstIndex, VertexOffset, FirstInstance); }
+			};
+
+			struct CmdEndQuery
+			{
+				static constexpr ERecord Type = ERecord::vkCmdEndQuery;
+
+				VkCommandBuffer CommandBuffer;
+				VkQueryPool     QueryPool    ;
+				uint32_t        Query        ;
+
+				template<typename Archive> void Transfer(Archive& _archive) { _archive(CommandBuffer, QueryPool, Query); }
+
+				void Issue() { VV_Capture_Target(vkCmdEndQuery)(CommandBuffer, QueryPool, Query); }
+			};
+
+			struct CmdEndRenderPass
+			{
+				static constexpr ERecord Type = ERecord::vkCmdEndRenderPass;
+
+				VkCommandBuffer CommandBuffer;
+
+				template<typename Archive> void Transfer(Archive& _archive) { _archive(CommandBuffer); }
+
+				void Issue() { VV_Capture_Target(vkCmdEndRenderPass)(CommandBuffer); }
+			};
+
+			struct CmdExecuteCommands
+			{
+				static constexpr ERecord Type = ERecord::vkCmdExecuteCommands;
+
+				      VkCommandBuffer  CommandBuffer     ;
+				      uint32_t         SecondaryCount    ;
+				const VkCommandBuffer* SecondaryBuffers  ;
+
+				template<typename Archive> void Transfer(Archive& _archive)
+				{
+					_archive(CommandBuffer, SecondaryCount);
+
+					_archive.Array(SecondaryBuffers, SecondaryCount);
+				}
+
+				void Issue() { VV_Capture_Target(vkCmdExecuteCommands)(CommandBuffer, SecondaryCount, SecondaryBuffers); }
+			};
+
+			struct CmdPipelineBarrier
+			{
+				static constexpr ERecord Type = ERecord::vkCmdPipelineBarrier;
+
+				      VkCommandBuffer        CommandBuffer     ;
+				      VkPipelineStageFlags   SourceStages      ;
+				      VkPipelineStageFlags   DestStages        ;
+				      VkDependencyFlags      DependencyFlags   ;
+				      uint32_t               MemoryBarrierCount;
+				const VkMemoryBarrier*       MemoryBarriers    ;
+				      uint32_t               BufferBarrierCount;
+				const VkBufferMemoryBarrier* BufferBarriers    ;
+				      uint32_t               ImageBarrierCount ;
+				const VkImageMemoryBarrier*  ImageBarriers     ;
+
+				template<typename Archive> void Transfer(Archive& _archive)
+				{
+					_archive(CommandBuffer, SourceStages, DestStages, DependencyFlags, MemoryBarrierCount, BufferBarrierCount, ImageBarrierCount);
+
+					_archive.Array(MemoryBarriers, MemoryBarrierCount);
+					_archive.Array(BufferBarriers, BufferBarrierCount);
+					_archive.Array(ImageBarriers , ImageBarrierCount );
+				}
+
+				void Issue()
+				{
+					VV_Capture_Target(vkCmdPipelineBarrier)
+					(
+						CommandBuffer, SourceStages, DestStages, DependencyFlags,
+						MemoryBarrierCount, MemoryBarriers, BufferBarrierCount, BufferBarriers, ImageBarrierCount, ImageBarriers
+					);
+				}
+			};
+
+			struct CmdPushConstants
+			{
+				static constexpr ERecord Type = ERecord::vkCmdPushConstants;
+
+				      VkCommandBuffer    CommandBuffer;
+				      VkPipelineLayout   Layout       ;
+				      VkShaderStageFlags Stages       ;
+				      uint32_t           Offset       ;
+				      uint32_t           Size         ;
+				const void*              Values       ;
+
+				template<typename Archive> void Transfer(Archive& _archive)
+				{
+					_archive(CommandBuffer, Layout, Stages, Offset, Size);
+
+					_archive.Bytes(Values, Size);
+				}
+
+				void Issue() { VV_Capture_Target(vkCmdPushConstants)(CommandBuffer, Layout, Stages, Offset, Size, Values); }
+			};
+
+			struct CmdResetEvent
+			{
+				static constexpr ERecord Type = ERecord::vkCmdResetEvent;
+
+				VkCommandBuffer      CommandBuffer;
+				VkEvent              Event        ;
+				VkPipelineStageFlags Stages       ;
+
+				template<typename Archive> void Transfer(Archive& _archive) { _archive(CommandBuffer, Event, Stages); }
+
+				void Issue() { VV_Capture_Target(vkCmdResetEvent)(CommandBuffer, Event, Stages); }
+			};
+
+			struct CmdResetQueryPool
+			{
+				static constexpr ERecord Type = ERecord::vkCmdResetQueryPool;
+
+				VkCommandBuffer CommandBuffer;
+				VkQueryPool     QueryPool    ;
+				uint32_t        FirstQuery   ;
+				uint32_t        QueryCount   ;
+
+				template<typename Archive> void Transfer(Archive& _archive) { _archive(CommandBuffer, QueryPool, FirstQuery, QueryCount); }
+
+				void Issue() { VV_Capture_Target(vkCmdResetQueryPool)(CommandBuffer, QueryPool, FirstQuery, QueryCount); }
+			};
+
+			struct CmdSetDeviceMask
+			{
+				static constexpr ERecord Type = ERecord::vkCmdSetDeviceMask;
+
+				VkCommandBuffer CommandBuffer;
+				uint32_t        DeviceMask   ;
+
+				template<typename Archive> void Transfer(Archive& _archive) { _archive(CommandBuffer, DeviceMask); }
+
+				void Issue() { VV_Capture_Target(vkCmdSetDeviceMask)(CommandBuffer, DeviceMask); }
+			};
+
+			struct CmdSetEvent
+			{
+				static constexpr ERecord Type = ERecord::vkCmdSetEvent;
+
+				VkCommandBuffer      CommandBuffer;
+				VkEvent              Event        ;
+				VkPipelineStageFlags Stages       ;
+
+				template<typename Archive> void Transfer(Archive& _archive) { _archive(CommandBuffer, Event, Stages); }
+
+				void Issue() { VV_Capture_Target(vkCmdSetEvent)(CommandBuffer, Event, Stages); }
+			};
+
+			struct CmdSetScissor
+			{
+				static constexpr ERecord Type = ERecord::vkCmdSetScissor;
+
+				      VkCommandBuffer CommandBuffer;
+				      uint32_t        FirstScissor ;
+				      uint32_t        ScissorCount ;
+				const VkRect2D*       Scissors     ;
+
+				template<typename Archive> void Transfer(Archive& _archive)
+				{
+					_archive(CommandBuffer, FirstScissor, ScissorCount);
+
+					_archive.Array(Scissors, ScissorCount);
+				}
+
+				void Issue() { VV_Capture_Target(vkCmdSetScissor)(CommandBuffer, FirstScissor, ScissorCount, Scissors); }
+			};
+
+			struct CmdSetViewport
+			{
+				static constexpr ERecord Type = ERecord::vkCmdSetViewport;
+
+				      VkCommandBuffer CommandBuffer;
+				      uint32_t        FirstViewport;
+				      uint32_t        ViewportCount;
+				const VkViewport*     Viewports    ;
+
+				template<typename Archive> void Transfer(Archive& _archive)
+				{
+					_archive(CommandBuffer, FirstViewport, ViewportCount);
+
+					_archive.Array(Viewports, ViewportCount);
+				}
+
+				void Issue() { VV_Capture_Target(vkCmdSetViewport)(CommandBuffer, FirstViewport, ViewportCount, Viewports); }
+			};
+
+			struct CmdWaitEvents
+			{
+				static constexpr ERecord Type = ERecord::vkCmdWaitEvents;
+
+				      VkCommandBuffer        CommandBuffer     ;
+				      uint32_t               EventCount        ;
+				const VkEvent*               Events            ;
+				      VkPipelineStageFlags   SourceStages      ;
+				      VkPipelineStageFlags   DestStages        ;
+				      uint32_t               MemoryBarrierCount;
+				const VkMemoryBarrier*       MemoryBarriers    ;
+				      uint32_t               BufferBarrierCount;
+				const VkBufferMemoryBarrier* BufferBarriers    ;
+				      uint32_t               ImageBarrierCount ;
+				const VkImageMemoryBarrier*  ImageBarriers     ;
+
+				template<typename Archive> void Transfer(Archive& _archive)
+				{
+					_archive(CommandBuffer, EventCount, SourceStages, DestStages, MemoryBarrierCount, BufferBarrierCount, ImageBarrierCount);
+
+					_archive.Array(Events        , EventCount        );
+					_archive.Array(MemoryBarriers, MemoryBarrierCount);
+					_archive.Array(BufferBarriers, BufferBarrierCount);
+					_archive.Array(ImageBarriers , ImageBarrierCount );
+				}
+
+				void Issue()
+				{
+					VV_Capture_Target(vkCmdWaitEvents)
+					(
+						CommandBuffer, EventCount, Events, SourceStages, DestStages,
+						MemoryBarrierCount, MemoryBarriers, BufferBarrierCount, BufferBarriers, ImageBarrierCount, ImageBarriers
+					);
+				}
+			};
+
+			struct CmdWriteTimestamp
+			{
+				static constexpr ERecord Type = ERecord::vkCmdWriteTimestamp;
+
+				VkCommandBuffer         CommandBuffer;
+				VkPipelineStageFlagBits Stage        ;
+				VkQueryPool             QueryPool    ;
+				uint32_t                Query        ;
+
+				template<typename Archive> void Transfer(Archive& _archive) { _archive(CommandBuffer, Stage, QueryPool, Query); }
+
+				void Issue() { VV_Capture_Target(vkCmdWriteTimestamp)(CommandBuffer, Stage, QueryPool, Query); }
+			};
+
+			struct DeviceWaitIdle
+			{
+				static constexpr ERecord Type = ERecord::vkDeviceWaitIdle;
+
+				VkDevice Device;
+
+				template<typename Archive> void Transfer(Archive& _archive) { _archive(Device); }
+
+				VkResult Issue() { return VV_Capture_Target(vkDeviceWaitIdle)(Device); }
+			};
+
+			struct EndCommandBuffer
+			{
+				static constexpr ERecord Type = ERecord::vkEndCommandBuffer;
+
+				VkCommandBuffer CommandBuffer;
+
+				template<typename Archive> void Transfer(Archive& _archive) { _archive(CommandBuffer); }
+
+				VkResult Issue() { return VV_Capture_Target(vkEndCommandBuffer)(CommandBuffer); }
+			};
+
+			struct QueuePresentKHR
+			{
+				static constexpr ERecord Type = ERecord::vkQueuePresentKHR;
+
+				      VkQueue           Queue      ;
+				const VkPresentInfoKHR* PresentInfo;
+
+				template<typename Archive> void Transfer(Archive& _archive) { _archive(Queue); _archive.Pointer(PresentInfo); }
+
+				VkResult Issue() { return VV_Capture_Target(vkQueuePresentKHR)(Queue, PresentInfo); }
+			};
+
+			struct QueueSubmit
+			{
+				static constexpr ERecord Type = ERecord::vkQueueSubmit;
+
+				      VkQueue       Queue      ;
+				      uint32_t      SubmitCount;
+				const VkSubmitInfo* Submits    ;
+				      VkFence       Fence      ;
+
+				template<typename Archive> void Transfer(Archive& _archive)
+				{
+					_archive(Queue, SubmitCount, Fence);
+
+					_archive.Array(Submits, SubmitCount);
+				}
+
+				VkResult Issue() { return VV_Capture_Target(vkQueueSubmit)(Queue, SubmitCount, Submits, Fence); }
+			};
+
+			struct QueueWaitIdle
+			{
+				static constexpr ERecord Type = ERecord::vkQueueWaitIdle;
+
+				VkQueue Queue;
+
+				template<typename Archive> void Transfer(Archive& _archive) { _archive(Queue); }
+
+				VkResult Issue() { return VV_Capture_Target(vkQueueWaitIdle)(Queue); }
+			};
+
+			struct ResetCommandBuffer
+			{
+				static constexpr ERecord Type = ERecord::vkResetCommandBuffer;
+
+				VkCommandBuffer           CommandBuffer;
+				VkCommandBufferResetFlags Flags        ;
+
+				template<typename Archive> void Transfer(Archive& _archive) { _archive(CommandBuffer, Flags); }
+
+				VkResult Issue() { return VV_Capture_Target(vkResetCommandBuffer)(CommandBuffer, Flags); }
+			};
+
+			struct ResetCommandPool
+			{
+				static constexpr ERecord Type = ERecord::vkResetCommandPool;
+
+				VkDevice                Device     ;
+				VkCommandPool           CommandPool;
+				VkCommandPoolResetFlags Flags      ;
+
+				template<typename Archive> void Transfer(Archive& _archive) { _archive(Device, CommandPool, Flags); }
+
+				VkResult Issue() { return VV_Capture_Target(vkResetCommandPool)(Device, CommandPool, Flags); }
+			};
+
+			struct ResetFences
+			{
+				static constexpr ERecord Type = ERecord::vkResetFences;
+
+				      VkDevice Device    ;
+				      uint32_t FenceCount;
+				const VkFence* Fences    ;
+
+				template<typename Archive> void Transfer(Archive& _archive)
+				{
+					_archive(Device, FenceCount);
+
+					_archive.Array(Fences, FenceCount);
+				}
+
+				VkResult Issue() { return VV_Capture_Target(vkResetFences)(Device, FenceCount, Fences); }
+			};
+
+			struct UpdateDescriptorSets
+			{
+				static constexpr ERecord Type = ERecord::vkUpdateDescriptorSets;
+
+				      VkDevice              Device    ;
+				      uint32_t              WriteCount;
+				const VkWriteDescriptorSet* Writes    ;
+				      uint32_t              CopyCount ;
+				const VkCopyDescriptorSet*  Copies    ;
+
+				template<typename Archive> void Transfer(Archive& _archive)
+				{
+					_archive(Device, WriteCount, CopyCount);
+
+					_archive.Array(Writes, WriteCount);
+					_archive.Array(Copies, CopyCount );
+				}
+
+				void Issue() { VV_Capture_Target(vkUpdateDescriptorSets)(Device, WriteCount, Writes, CopyCount, Copies); }
+			};
+
+			struct WaitForFences
+			{
+				static constexpr ERecord Type = ERecord::vkWaitForFences;
+
+				      VkDevice Device    ;
+				      uint32_t FenceCount;
+				const VkFence* Fences    ;
+				      VkBool32 WaitAll   ;
+				      uint64_t Timeout   ;
+
+				template<typename Archive> void Transfer(Archive& _archive)
+				{
+					_archive(Device, FenceCount, WaitAll, Timeout);
+
+					_archive.Array(Fences, FenceCount);
+				}
+
+				VkResult Issue() { return VV_Capture_Target(vkWaitForFences)(Device, FenceCount, Fences, WaitAll, Timeout); }
+			};
+		}
+
+		#pragma endregion Records
+
+		/**
+		@brief Writes the records of the calls made while capturing to a file.
+
+		@details Records are written in the order their calls were made, across all threads. (Recording serializes the threads capturing)
+		*/
+		class Session
+		{
+		public:
+
+			static constexpr std::size_t FlushSize = 1024 * 1024;   ///< Size of the records buffered before they are written to the file.
+
+			Session() : file(nullptr), recordCount(0), unresolvedCount(0), skippedCount(0), capturing(false)
+			{}
+
+			~Session()
+			{
+				Stop();
+			}
+
+			/**
+			@brief Provides the amount of records captured.
+			*/
+			u64 GetRecordCount()
+			{
+				std::lock_guard<std::mutex> guard(lock);
+
+				return recordCount;
+			}
+
+			/**
+			@brief Provides the amount of chained structures that were skipped, because they are not supported.
+			*/
+			u64 GetSkippedCount()
+			{
+				std::lock_guard<std::mutex> guard(lock);
+
+				return skippedCount;
+			}
+
+			/**
+			@brief Provides the amount of handles captured that were not tracked. (Replayed as unresolved)
+			*/
+			u64 GetUnresolvedCount()
+			{
+				std::lock_guard<std::mutex> guard(lock);
+
+				return unresolvedCount;
+			}
+
+			bool IsCapturing() const
+			{
+				return capturing.load(std::memory_order_acquire);
+			}
+
+			/**
+			@brief Mark the end of a frame. (Replay can be done frame by frame)
+			*/
+			void MarkFrame()
+			{
+				Records::Frame frame;
+
+				Write(frame);
+			}
+
+			/**
+			@brief Create the file and start capturing. Returns false if already capturing or the file could not be created.
+			*/
+			bool Start(RoCStr _path)
+			{
+				std::lock_guard<std::mutex> guard(lock);
+
+				if (file != nullptr) return false;
+
+				file = std::fopen(_path, "wb");
+
+				if (file == nullptr) return false;
+
+				buffer.clear();
+
+				Writer header(buffer);
+
+				header.Raw(Magic  );
+				header.Raw(Version);
+
+				recordCount     = 0;
+				unresolvedCount = 0;
+				skippedCount    = 0;
+
+				capturing.store(true, std::memory_order_release);
+
+				return true;
+			}
+
+			/**
+			@brief Stop capturing, and write the records left to the file.
+			*/
+			void Stop()
+			{
+				capturing.store(false, std::memory_order_release);
+
+				std::lock_guard<std::mutex> guard(lock);
+
+				if (file == nullptr) return;
+
+				Flush();
+
+				std::fclose(file);
+
+				file = nullptr;
+			}
+
+			/**
+			@brief Append the record of a call.
+			*/
+			template<typename Record>
+			void Write(Record& _record)
+			{
+				std::lock_guard<std::mutex> guard(lock);
+
+				if (file == nullptr) return;
+
+				Writer writer(buffer);
+
+				writer.Raw(u16(Record::Type));
+
+				std::size_t sizeOffset = buffer.size();
+
+				writer.Raw(u32(0));
+
+				_record.Transfer(writer);
+
+				u32 size = u32(buffer.size() - sizeOffset - sizeof(u32));
+
+				std::memcpy(buffer.data() + sizeOffset, &size, sizeof(u32));
+
+				recordCount++;
+
+				unresolvedCount += writer.GetUnresolvedCount();
+				skippedCount    += writer.GetSkippedCount   ();
+
+				if (buffer.size() >= FlushSize) Flush();
+			}
+
+		protected:
+
+			void Flush()
+			{
+				if (!buffer.empty()) std::fwrite(buffer.data(), 1, buffer.size(), file);
+
+				buffer.clear();
+
+				std::fflush(file);
+			}
+
+			std::mutex lock;
+
+			std::FILE* file;
+
+			DynamicArray<u8> buffer;
+
+			u64 recordCount;
+
+			u64 unresolvedCount;
+
+			u64 skippedCount;
+
+			std::atomic<bool> capturing;
+		};
+
+		inline Session& GetSession()
+		{
+			static Session session;
+
+			return session;
+		}
+
+		/**
+		@brief Start capturing to the file at the path given.
+		*/
+		inline bool Start(RoCStr _path)
+		{
+			return GetSession().Start(_path);
+		}
+
+		/**
+		@brief Stop capturing.
+		*/
+		inline void Stop()
+		{
+			GetSession().Stop();
+		}
+
+		/**
+		@brief Mark the end of a frame in the capture.
+		*/
+		inline void MarkFrame()
+		{
+			if (GetSession().IsCapturing()) GetSession().MarkFrame();
+		}
+
+		/**
+		@brief Records the call if capturing, then issues it.
+		*/
+		template<typename Record>
+		auto Intercept(Record&& _record) -> decltype(_record.Issue())
+		{
+			Session& session = GetSession();
+
+			if (session.IsCapturing()) session.Write(_record);
+
+			return _record.Issue();
+		}
+
+		/**
+		@brief Tracks the handles returned by a call that succeeded.
+		*/
+		template<typename HandleType>
+		VkResult Track(VkResult _result, const HandleType* _handles, u32 _count)
+		{
+			if ((_result == VK_SUCCESS || _result == VK_INCOMPLETE) && _handles != nullptr) GetRegistry().Track(_handles, _count);
+
+			return _result;
+		}
+
+		/**
+		@brief Replays a capture against the objects of this process.
+
+		@details
+		The objects must have been created the same way they were when capturing, before replaying. (See the file's details)
+		A call whose handles do not resolve to objects of this process is skipped.
+
+		The images acquired by the replay may not be those acquired when capturing: presents are given the index the replay acquired
+		for the index captured, and are skipped if the replay did not acquire the image.
+		*/
+		class Replayer
+		{
+		public:
+
+			static constexpr std::size_t HeaderSize = sizeof(u32) * 2;
+			static constexpr std::size_t RecordSize = sizeof(u16) + sizeof(u32);   ///< Size of a record's type and payload size.
+
+			Replayer() : position(0), skippedCount(0), failed(false)
+			{}
+
+			/**
+			@brief Unmap the capture.
+			*/
+			void Close()
+			{
+				file.Close();
+
+				position = 0;
+			}
+
+			/**
+			@brief Provides the amount of calls skipped because their handles did not resolve, or their record is unknown.
+			*/
+			u64 GetSkippedCount() const
+			{
+				return skippedCount;
+			}
+
+			/**
+			@brief Checks to see if the stream was found corrupt.
+			*/
+			bool HasFailed() const
+			{
+				return failed;
+			}
+
+			/**
+			@brief Map the capture at the path given. Returns false if it could not be mapped or is not a capture of this version.
+			*/
+			bool Open(RoCStr _path)
+			{
+				if (!file.Open(_path) || file.GetSize() < HeaderSize) return false;
+
+				u32 magic, version;
+
+				std::memcpy(&magic  , file.GetData()              , sizeof(u32));
+				std::memcpy(&version, file.GetData() + sizeof(u32), sizeof(u32));
+
+				if (magic != Magic || version != Version)
+				{
+					file.Close();
+
+					return false;
+				}
+
+				Rewind();
+
+				return true;
+			}
+
+			/**
+			@brief Replay every frame left.
+
+			@return The amount of frames replayed.
+			*/
+			ui32 Replay()
+			{
+				ui32 frames = 0;
+
+				while (ReplayFrame()) frames++;
+
+				return frames;
+			}
+
+			/**
+			@brief Replay the calls up to the end of the next frame.
+
+			@return False if the end of the capture was reached (or the stream is corrupt) before the end of a frame.
+			*/
+			bool ReplayFrame()
+			{
+				const u8* data = file.GetData();
+
+				while (!failed && file.GetSize() - position >= RecordSize)
+				{
+					u16 type; u32 size;
+
+					std::memcpy(&type, data + position              , sizeof(u16));
+					std::memcpy(&size, data + position + sizeof(u16), sizeof(u32));
+
+					position += RecordSize;
+
+					if (file.GetSize() - position < size)
+					{
+						failed = true;
+
+						break;
+					}
+
+					Reader reader(data + position, size, arena);
+
+					position += size;
+
+					if (ERecord(type) == ERecord::Frame)
+					{
+						failed = size != 0;
+
+						return !failed;
+					}
+
+					Dispatch(ERecord(type), reader);
+
+					arena.Reset();
+				}
+
+				// Bytes left that do not make a record: the capture was cut short.
+				failed = failed || position != file.GetSize();
+
+				return false;
+			}
+
+			/**
+			@brief Start over from the first record.
+			*/
+			void Rewind()
+			{
+				position     = HeaderSize;
+				skippedCount = 0         ;
+				failed       = false     ;
+
+				acquiredImages.clear();
+			}
+
+		protected:
+
+			/**
+			@brief A swapchain image acquired by the replay and not yet presented.
+			*/
+			struct AcquiredImage
+			{
+				VkSwapchainKHR Swapchain    ;
+				uint32_t       CapturedIndex;
+				uint32_t       ReplayedIndex;
+			};
+
+			AcquiredImage* FindAcquired(VkSwapchainKHR _swapchain, uint32_t _capturedIndex)
+			{
+				for (AcquiredImage& image : acquiredImages)
+				{
+					if (image.Swapchain == _swapchain && image.CapturedIndex == _capturedIndex) return &image;
+				}
+
+				return nullptr;
+			}
+
+			template<typename Record>
+			void Issue(Record& _record)
+			{
+				_record.Issue();
+			}
+
+			/**
+			@brief Acquire, and keep the index the replay got for the index captured.
+			*/
+			void Issue(Records::AcquireNextImageKHR& _record)
+			{
+				VkResult result = _record.Issue();
+
+				if (result != VK_SUCCESS && result != VK_SUBOPTIMAL_KHR) return;
+
+				AcquiredImage* image = FindAcquired(_record.Swapchain, _record.AcquiredIndex);
+
+				if (image != nullptr)
+				{
+					image->ReplayedIndex = _record.ReplayedIndex;
+				}
+				else
+				{
+					acquiredImages.push_back({ _record.Swapchain, _record.AcquiredIndex, _record.ReplayedIndex });
+				}
+			}
+
+			/**
+			@brief Present the images the replay acquired in place of those captured. (Skipped if one of them was not acquired by the replay)
+			*/
+			void Issue(Records::QueuePresentKHR& _record)
+			{
+				const VkPresentInfoKHR* info = _record.PresentInfo;
+
+				if (info == nullptr || info->pSwapchains == nullptr || info->pImageIndices == nullptr)
+				{
+					skippedCount++;
+
+					return;
+				}
+
+				for (uint32_t index = 0; index < info->swapchainCount; index++)
+				{
+					if (FindAcquired(info->pSwapchains[index], info->pImageIndices[index]) == nullptr)
+					{
+						skippedCount++;
+
+						return;
+					}
+				}
+
+				// The indices were decoded into the arena: they are remapped in place.
+				uint32_t* imageIndices = const_cast<uint32_t*>(info->pImageIndices);
+
+				for (uint32_t index = 0; index < info->swapchainCount; index++)
+				{
+					AcquiredImage* image = FindAcquired(info->pSwapchains[index], imageIndices[index]);
+
+					// A swapchain listed twice (invalid, from a corrupt stream) was already released.
+					if (image == nullptr) continue;
+
+					imageIndices[index] = image->ReplayedIndex;
+
+					// Presenting releases the image.
+					*image = acquiredImages.back();
+
+					acquiredImages.pop_back();
+				}
+
+				_record.Issue();
+			}
+
+			template<typename Record>
+			void Replay(Reader& _reader)
+			{
+				Record record {};
+
+				record.Transfer(_reader);
+
+				// Bytes left in the payload: the record's counts do not match its arrays.
+				if (_reader.HasFailed() || !_reader.IsAtEnd())
+				{
+					failed = true;
+
+					return;
+				}
+
+				if (_reader.GetUnresolvedCount() != 0)
+				{
+					skippedCount++;
+
+					return;
+				}
+
+				Issue(record);
+			}
+
+			void Dispatch(ERecord _type, Reader& _reader)
+			{
+				using namespace Records;
+
+				switch (_type)
+				{
+					case ERecord::vkAcquireNextImageKHR    : Replay<AcquireNextImageKHR    >(_reader); break;
+					case ERecord::vkBeginCommandBuffer     : Replay<BeginCommandBuffer     >(_reader); break;
+					case ERecord::vkCmdBeginQuery          : Replay<CmdBeginQuery          >(_reader); break;
+					case ERecord::vkCmdBeginRenderPass     : Replay<CmdBeginRenderPass     >(_reader); break;
+					case ERecord::vkCmdBindDescriptorSets  : Replay<CmdBindDescriptorSets  >(_reader); break;
+					case ERecord::vkCmdBindIndexBuffer     : Replay<CmdBindIndexBuffer     >(_reader); break;
+					case ERecord::vkCmdBindPipeline        : Replay<CmdBindPipeline        >(_reader); break;
+					case ERecord::vkCmdBindVertexBuffers   : Replay<CmdBindVertexBuffers   >(_reader); break;
+					case ERecord::vkCmdBlitImage           : Replay<CmdBlitImage           >(_reader); break;
+					case ERecord::vkCmdCopyBuffer          : Replay<CmdCopyBuffer          >(_reader); break;
+					case ERecord::vkCmdCopyBufferToImage   : Replay<CmdCopyBufferToImage   >(_reader); break;
+					case ERecord::vkCmdCopyQueryPoolResults: Replay<CmdCopyQueryPoolResults>(_reader); break;
+					case ERecord::vkCmdDraw                : Replay<CmdDraw                >(_reader); break;
+					case ERecord::vkCmdDrawIndexed         : Replay<CmdDrawIndexed         >(_reader); break;
+					case ERecord::vkCmdEndQuery            : Replay<CmdEndQuery            >(_reader); break;
+					case ERecord::vkCmdEndRenderPass       : Replay<CmdEndRenderPass       >(_reader); break;
+					case ERecord::vkCmdExecuteCommands     : Replay<CmdExecuteCommands     >(_reader); break;
+					case ERecord::vkCmdPipelineBarrier     : Replay<CmdPipelineBarrier     >(_reader); break;
+					case ERecord::vkCmdPushConstants       : Replay<CmdPushConstants       >(_reader); break;
+					case ERecord::vkCmdResetEvent          : Replay<CmdResetEvent          >(_reader); break;
+					case ERecord::vkCmdResetQueryPool      : Replay<CmdResetQueryPool      >(_reader); break;
+					case ERecord::vkCmdSetDeviceMask       : Replay<CmdSetDeviceMask       >(_reader); break;
+					case ERecord::vkCmdSetEvent            : Replay<CmdSetEvent            >(_reader); break;
+					case ERecord::vkCmdSetScissor          : Replay<CmdSetScissor          >(_reader); break;
+					case ERecord::vkCmdSetViewport         : Replay<CmdSetViewport         >(_reader); break;
+					case ERecord::vkCmdWaitEvents          : Replay<CmdWaitEvents          >(_reader); break;
+					case ERecord::vkCmdWriteTimestamp      : Replay<CmdWriteTimestamp      >(_reader); break;
+					case ERecord::vkDeviceWaitIdle         : Replay<DeviceWaitIdle         >(_reader); break;
+					case ERecord::vkEndCommandBuffer       : Replay<EndCommandBuffer       >(_reader); break;
+					case ERecord::vkQueuePresentKHR        : Replay<QueuePresentKHR        >(_reader); break;
+					case ERecord::vkQueueSubmit            : Replay<QueueSubmit            >(_reader); break;
+					case ERecord::vkQueueWaitIdle          : Replay<QueueWaitIdle          >(_reader); break;
+					case ERecord::vkResetCommandBuffer     : Replay<ResetCommandBuffer     >(_reader); break;
+					case ERecord::vkResetCommandPool       : Replay<ResetCommandPool       >(_reader); break;
+					case ERecord::vkResetFences            : Replay<ResetFences            >(_reader); break;
+					case ERecord::vkUpdateDescriptorSets   : Replay<UpdateDescriptorSets   >(_reader); break;
+					case ERecord::vkWaitForFences          : Replay<WaitForFences          >(_reader); break;
+
+					default: skippedCount++; break;
+				}
+			}
+
+			V0::MappedFile file;
+
+			std::size_t position;
+
+			Arena arena;
+
+			DynamicArray<AcquiredImage> acquiredImages;
+
+			u64 skippedCount;
+
+			bool failed;
+		};
+
+		/**
+		@brief The procedures called by the instrumentation's wrappers: captured calls are recorded, and the calls that create or retrieve handles track them.
+		*/
+		namespace Calls
+		{
+			using namespace Records;
+
+			#pragma region Captured
+
+			inline VkResult vkAcquireNextImageKHR(VkDevice _device, VkSwapchainKHR _swapchain, uint64_t _timeout, VkSemaphore _semaphore, VkFence _fence, uint32_t* _imageIndex)
+			{
+				AcquireNextImageKHR record { _device, _swapchain, _timeout, _semaphore, _fence, _imageIndex, 0, 0 };
+
+				// The index is only known once the call returned, so the record is written after it. (A failed acquire signals nothing: it is not recorded)
+				VkResult result = record.Issue();
+
+				Session& session = GetSession();
+
+				if (session.IsCapturing() && (result == VK_SUCCESS || result == VK_SUBOPTIMAL_KHR))
+				{
+					record.AcquiredIndex = *_imageIndex;
+
+					session.Write(record);
+				}
+
+				return result;
+			}
+
+			inline VkResult vkBeginCommandBuffer(VkCommandBuffer _commandBuffer, const VkCommandBufferBeginInfo* _beginInfo)
+			{
+				return Intercept(BeginCommandBuffer { _commandBuffer, _beginInfo });
+			}
+
+			inline void vkCmdBeginQuery(VkCommandBuffer _commandBuffer, VkQueryPool _queryPool, uint32_t _query, VkQueryControlFlags _flags)
+			{
+				Intercept(CmdBeginQuery { _commandBuffer, _queryPool, _query, _flags });
+			}
+
+			inline void vkCmdBeginRenderPass(VkCommandBuffer _commandBuffer, const VkRenderPassBeginInfo* _beginInfo, VkSubpassContents _contents)
+			{
+				Intercept(CmdBeginRenderPass { _commandBuffer, _beginInfo, _contents });
+			}
+
+			inline void vkCmdBindDescriptorSets
+			(
+				      VkCommandBuffer     _commandBuffer     ,
+				      VkPipelineBindPoint _bindPoint         ,
+				      VkPipelineLayout    _layout            ,
+				      uint32_t            _firstSet          ,
+				      uint32_t            _setCount          ,
+				const VkDescriptorSet*    _sets              ,
+				      uint32_t            _dynamicOffsetCount,
+				const uint32_t*           _dynamicOffsets
+			)
+			{
+				Intercept(CmdBindDescriptorSets { _commandBuffer, _bindPoint, _layout, _firstSet, _setCount, _sets, _dynamicOffsetCount, _dynamicOffsets });
+			}
+
+			inline void vkCmdBindIndexBuffer(VkCommandBuffer _commandBuffer, VkBuffer _buffer, VkDeviceSize _offset, VkIndexType _indexType)
+			{
+				Intercept(CmdBindIndexBuffer { _commandBuffer, _buffer, _offset, _indexType });
+			}
+
+			inline void vkCmdBindPipeline(VkCommandBuffer _commandBuffer, VkPipelineBindPoint _bindPoint, VkPipeline _pipeline)
+			{
+				Intercept(CmdBindPipeline { _commandBuffer, _bindPoint, _pipeline });
+			}
+
+			inline void vkCmdBindVertexBuffers(VkCommandBuffer _commandBuffer, uint32_t _firstBinding, uint32_t _bindingCount, const VkBuffer* _buffers, const VkDeviceSize* _offsets)
+			{
+				Intercept(CmdBindVertexBuffers { _commandBuffer, _firstBinding, _bindingCount, _buffers, _offsets });
+			}
+
+			inline void vkCmdBlitImage
+			(
+				      VkCommandBuffer _commandBuffer,
+				      VkImage         _sourceImage  ,
+				      VkImageLayout   _sourceLayout ,
+				      VkImage         _destImage    ,
+				      VkImageLayout   _destLayout   ,
+				      uint32_t        _regionCount  ,
+				const VkImageBlit*    _regions      ,
+				      VkFilter        _filter
+			)
+			{
+				Intercept(CmdBlitImage { _commandBuffer, _sourceImage, _sourceLayout, _destImage, _destLayout, _regionCount, _regions, _filter });
+			}
+
+			inline void vkCmdCopyBuffer(VkCommandBuffer _commandBuffer, VkBuffer _sourceBuffer, VkBuffer _destBuffer, uint32_t _regionCount, const VkBufferCopy* _regions)
+			{
+				Intercept(CmdCopyBuffer { _commandBuffer, _sourceBuffer, _destBuffer, _regionCount, _regions });
+			}
+
+			inline void vkCmdCopyBufferToImage
+			(
+				      VkCommandBuffer    _commandBuffer,
+				      VkBuffer           _sourceBuffer ,
+				      VkImage            _destImage    ,
+				      VkImageLayout      _destLayout   ,
+				      uint32_t           _regionCount  ,
+				const VkBufferImageCopy* _regions
+			)
+			{
+				Intercept(CmdCopyBufferToImage { _commandBuffer, _sourceBuffer, _destImage, _destLayout, _regionCount, _regions });
+			}
+
+			inline void vkCmdCopyQueryPoolResults
+			(
+				VkCommandBuffer    _commandBuffer,
+				VkQueryPool        _queryPool    ,
+				uint32_t           _firstQuery   ,
+				uint32_t           _queryCount   ,
+				VkBuffer           _destBuffer   ,
+				VkDeviceSize       _destOffset   ,
+				VkDeviceSize       _stride       ,
+				VkQueryResultFlags _flags
+			)
+			{
+				Intercept(CmdCopyQueryPoolResults { _commandBuffer, _queryPool, _firstQuery, _queryCount, _destBuffer, _destOffset, _stride, _flags });
+			}
+
+			inline void vkCmdDraw(VkCommandBuffer _commandBuffer, uint32_t _vertexCount, uint32_t _instanceCount, uint32_t _firstVertex, uint32_t _firstInstance)
+			{
+				Intercept(CmdDraw { _commandBuffer, _vertexCount, _instanceCount, _firstVertex, _firstInstance });
+			}
+
+			inline void vkCmdDrawIndexed
+			(
+				VkCommandBuffer _commandBuffer,
+				uint32_t        _indexCount   ,
+				uint32_t        _instanceCount,
+				uint32_t        _firstIndex   ,
+				int32_t         _vertexOffset ,
+				uint32_t        _firstInstance
+			)
+			{
+				Intercept(CmdDrawIndexed { _commandBuffer, _indexCount, _instanceCount, _firstIndex, _vertexOffset, _firstInstance });
+			}
+
+			inline void vkCmdEndQuery(VkCommandBuffer _commandBuffer, VkQueryPool _queryPool, uint32_t _query)
+			{
+				Intercept(CmdEndQuery { _commandBuffer, _queryPool, _query });
+			}
+
+			inline void vkCmdEndRenderPass(VkCommandBuffer _commandBuffer)
+			{
+				Intercept(CmdEndRenderPass { _commandBuffer });
+			}
+
+			inline void vkCmdExecuteCommands(VkCommandBuffer _commandBuffer, uint32_t _secondaryCount, const VkCommandBuffer* _secondaryBuffers)
+			{
+				Intercept(CmdExecuteCommands { _commandBuffer, _secondaryCount, _secondaryBuffers });
+			}
+
+			inline void vkCmdPipelineBarrier
+			(
+				      VkCommandBuffer        _commandBuffer     ,
+				      VkPipelineStageFlags   _sourceStages      ,
+				      VkPipelineStageFlags   _destStages        ,
+				      VkDependencyFlags      _dependencyFlags   ,
+				      uint32_t               _memoryBarrierCount,
+				const VkMemoryBarrier*       _memoryBarriers    ,
+				      uint32_t               _bufferBarrierCount,
+				const VkBufferMemoryBarrier* _bufferBarriers    ,
+				      uint32_t               _imageBarrierCount ,
+				const VkImageMemoryBarrier*  _imageBarriers
+			)
+			{
+				Intercept
+				(
+					CmdPipelineBarrier
+					{
+						_commandBuffer, _sourceStages, _destStages, _dependencyFlags,
+						_memoryBarrierCount, _memoryBarriers, _bufferBarrierCount, _bufferBarriers, _imageBarrierCount, _imageBarriers
+					}
+				);
+			}
+
+			inline void vkCmdPushConstants
+			(
+				      VkCommandBuffer    _commandBuffer,
+				      VkPipelineLayout   _layout       ,
+				      VkShaderStageFlags _stages       ,
+				      uint32_t           _offset       ,
+				      uint32_t           _size         ,
+				const void*              _values
+			)
+			{
+				Intercept(CmdPushConstants { _commandBuffer, _layout, _stages, _offset, _size, _values });
+			}
+
+			inline void vkCmdResetEvent(VkCommandBuffer _commandBuffer, VkEvent _event, VkPipelineStageFlags _stages)
+			{
+				Intercept(CmdResetEvent { _commandBuffer, _event, _stages });
+			}
+
+			inline void vkCmdResetQueryPool(VkCommandBuffer _commandBuffer, VkQueryPool _queryPool, uint32_t _firstQuery, uint32_t _queryCount)
+			{
+				Intercept(CmdResetQueryPool { _commandBuffer, _queryPool, _firstQuery, _queryCount });
+			}
+
+			inline void vkCmdSetDeviceMask(VkCommandBuffer _commandBuffer, uint32_t _deviceMask)
+			{
+				Intercept(CmdSetDeviceMask { _commandBuffer, _deviceMask });
+			}
+
+			inline void vkCmdSetEvent(VkCommandBuffer _commandBuffer, VkEvent _event, VkPipelineStageFlags _stages)
+			{
+				Intercept(CmdSetEvent { _commandBuffer, _event, _stages });
+			}
+
+			inline void vkCmdSetScissor(VkCommandBuffer _commandBuffer, uint32_t _firstScissor, uint32_t _scissorCount, const VkRect2D* _scissors)
+			{
+				Intercept(CmdSetScissor { _commandBuffer, _firstScissor, _scissorCount, _scissors });
+			}
+
+			inline void vkCmdSetViewport(VkCommandBuffer _commandBuffer, uint32_t _firstViewport, uint32_t _viewportCount, const VkViewport* _viewports)
+			{
+				Intercept(CmdSetViewport { _commandBuffer, _firstViewport, _viewportCount, _viewports });
+			}
+
+			inline void vkCmdWaitEvents
+			(
+				      VkCommandBuffer        _commandBuffer     ,
+				      uint32_t               _eventCount        ,
+				const VkEvent*               _events            ,
+				      VkPipelineStageFlags   _sourceStages      ,
+				      VkPipelineStageFlags   _destStages        ,
+				      uint32_t               _memoryBarrierCount,
+				const VkMemoryBarrier*       _memoryBarriers    ,
+				      uint32_t               _bufferBarrierCount,
+				const VkBufferMemoryBarrier* _bufferBarriers    ,
+				      uint32_t               _imageBarrierCount ,
+				const VkImageMemoryBarrier*  _imageBarriers
+			)
+			{
+				Intercept
+				(
+					CmdWaitEvents
+					{
+						_commandBuffer, _eventCount, _events, _sourceStages, _destStages,
+						_memoryBarrierCount, _memoryBarriers, _bufferBarrierCount, _bufferBarriers, _imageBarrierCount, _imageBarriers
+					}
+				);
+			}
+
+			inline void vkCmdWriteTimestamp(VkCommandBuffer _commandBuffer, VkPipelineStageFlagBits _stage, VkQueryPool _queryPool, uint32_t _query)
+			{
+				Intercept(CmdWriteTimestamp { _commandBuffer, _stage, _queryPool, _query });
+			}
+
+			inline VkResult vkDeviceWaitIdle(VkDevice _device)
+			{
+				return Intercept(DeviceWaitIdle { _device });
+			}
+
+			inline VkResult vkEndCommandBuffer(VkCommandBuffer _commandBuffer)
+			{
+				return Intercept(EndCommandBuffer { _commandBuffer });
+			}
+
+			inline VkResult vkQueuePresentKHR(VkQueue _queue, const VkPresentInfoKHR* _presentInfo)
+			{
+				return Intercept(QueuePresentKHR { _queue, _presentInfo });
+			}
+
+			inline VkResult vkQueueSubmit(VkQueue _queue, uint32_t _submitCount, const VkSubmitInfo* _submits, VkFence _fence)
+			{
+				return Intercept(QueueSubmit { _queue, _submitCount, _submits, _fence });
+			}
+
+			inline VkResult vkQueueWaitIdle(VkQueue _queue)
+			{
+				return Intercept(QueueWaitIdle { _queue });
+			}
+
+			inline VkResult vkResetCommandBuffer(VkCommandBuffer _commandBuffer, VkCommandBufferResetFlags _flags)
+			{
+				return Intercept(ResetCommandBuffer { _commandBuffer, _flags });
+			}
+
+			inline VkResult vkResetCommandPool(VkDevice _device, VkCommandPool _commandPool, VkCommandPoolResetFlags _flags)
+			{
+				return Intercept(ResetCommandPool { _device, _commandPool, _flags });
+			}
+
+			inline VkResult vkResetFences(VkDevice _device, uint32_t _fenceCount, const VkFence* _fences)
+			{
+				return Intercept(ResetFences { _device, _fenceCount, _fences });
+			}
+
+			inline void vkUpdateDescriptorSets
+			(
+				      VkDevice              _device    ,
+				      uint32_t              _writeCount,
+				const VkWriteDescriptorSet* _writes    ,
+				      uint32_t              _copyCount ,
+				const VkCopyDescriptorSet*  _copies
+			)
+			{
+				Intercept(UpdateDescriptorSets { _device, _writeCount, _writes, _copyCount, _copies });
+			}
+
+			inline VkResult vkWaitForFences(VkDevice _device, uint32_t _fenceCount, const VkFence* _fences, VkBool32 _waitAll, uint64_t _timeout)
+			{
+				return Intercept(WaitForFences { _device, _fenceCount, _fences, _waitAll, _timeout });
+			}
+
+			#pragma endregion Captured
+
+			#pragma region Tracked
+
+			/**
+			@brief Defines a device level creation procedure that tracks the handle created.
+			*/
+			#define VV_Capture_Create(_PROCEDURE, _INFO, _HANDLE)                                                                     \
+			inline VkResult _PROCEDURE(VkDevice _device, const _INFO* _info, const VkAllocationCallbacks* _allocator, _HANDLE* _handle) \
+			{                                                                                                                           \
+				return Track(VV_Capture_Target(_PROCEDURE)(_device, _info, _allocator, _handle), _handle, 1);                           \
+			}
+
+			VV_Capture_Create(vkAllocateMemory                , VkMemoryAllocateInfo                , VkDeviceMemory            )
+			VV_Capture_Create(vkCreateBuffer                  , VkBufferCreateInfo                  , VkBuffer                  )
+			VV_Capture_Create(vkCreateBufferView              , VkBufferViewCreateInfo              , VkBufferView              )
+			VV_Capture_Create(vkCreateCommandPool             , VkCommandPoolCreateInfo             , VkCommandPool             )
+			VV_Capture_Create(vkCreateDescriptorPool          , VkDescriptorPoolCreateInfo          , VkDescriptorPool          )
+			VV_Capture_Create(vkCreateDescriptorSetLayout     , VkDescriptorSetLayoutCreateInfo     , VkDescriptorSetLayout     )
+			VV_Capture_Create(vkCreateDescriptorUpdateTemplate, VkDescriptorUpdateTemplateCreateInfo, VkDescriptorUpdateTemplate)
+			VV_Capture_Create(vkCreateEvent                   , VkEventCreateInfo                   , VkEvent                   )
+			VV_Capture_Create(vkCreateFence                   , VkFenceCreateInfo                   , VkFence                   )
+			VV_Capture_Create(vkCreateFramebuffer             , VkFramebufferCreateInfo             , VkFramebuffer             )
+			VV_Capture_Create(vkCreateImage                   , VkImageCreateInfo                   , VkImage                   )
+			VV_Capture_Create(vkCreateImageView               , VkImageViewCreateInfo               , VkImageView               )
+			VV_Capture_Create(vkCreatePipelineCache           , VkPipelineCacheCreateInfo           , VkPipelineCache           )
+			VV_Capture_Create(vkCreatePipelineLayout          , VkPipelineLayoutCreateInfo          , VkPipelineLayout          )
+			VV_Capture_Create(vkCreateQueryPool               , VkQueryPoolCreateInfo               , VkQueryPool               )
+			VV_Capture_Create(vkCreateRenderPass              , VkRenderPassCreateInfo              , VkRenderPass              )
+			VV_Capture_Create(vkCreateSampler                 , VkSamplerCreateInfo                 , VkSampler                 )
+			VV_Capture_Create(vkCreateSemaphore               , VkSemaphoreCreateInfo               , VkSemaphore               )
+			VV_Capture_Create(vkCreateShaderModule            , VkShaderModuleCreateInfo            , VkShaderModule            )
+			VV_Capture_Create(vkCreateSwapchainKHR            , VkSwapchainCreateInfoKHR            , VkSwapchainKHR            )
+
+			#undef VV_Capture_Create
+
+			inline VkResult vkAllocateCommandBuffers(VkDevice _device, const VkCommandBufferAllocateInfo* _info, VkCommandBuffer* _commandBuffers)
+			{
+				VkResult result = Track(VV_Capture_Target(vkAllocateCommandBuffers)(_device, _info, _commandBuffers), _commandBuffers, _info->commandBufferCount);
+
+				if (result == VK_SUCCESS) GetRegistry().SetLevel(_commandBuffers, _info->commandBufferCount, _info->level);
+
+				return result;
+			}
+
+			inline VkResult vkAllocateDescriptorSets(VkDevice _device, const VkDescriptorSetAllocateInfo* _info, VkDescriptorSet* _descriptorSets)
+			{
+				return Track(VV_Capture_Target(vkAllocateDescriptorSets)(_device, _info, _descriptorSets), _descriptorSets, _info->descriptorSetCount);
+			}
+
+			inline VkResult vkCreateComputePipelines
+			(
+				      VkDevice                     _device       ,
+				      VkPipelineCache              _cache        ,
+				      uint32_t                     _count        ,
+				const VkComputePipelineCreateInfo* _infos        ,
+				const VkAllocationCallbacks*       _allocator    ,
+				      VkPipeline*                  _pipelines
+			)
+			{
+				return Track(VV_Capture_Target(vkCreateComputePipelines)(_device, _cache, _count, _infos, _allocator, _pipelines), _pipelines, _count);
+			}
+
+			inline VkResult vkCreateDevice(VkPhysicalDevice _physicalDevice, const VkDeviceCreateInfo* _info, const VkAllocationCallbacks* _allocator, VkDevice* _device)
+			{
+				return Track(::vkCreateDevice(_physicalDevice, _info, _allocator, _device), _device, 1);
+			}
+
+			inline VkResult vkCreateGraphicsPipelines
+			(
+				      VkDevice                      _device       ,
+				      VkPipelineCache               _cache        ,
+				      uint32_t                      _count        ,
+				const VkGraphicsPipelineCreateInfo* _infos        ,
+				const VkAllocationCallbacks*        _allocator    ,
+				      VkPipeline*                   _pipelines
+			)
+			{
+				return Track(VV_Capture_Target(vkCreateGraphicsPipelines)(_device, _cache, _count, _infos, _allocator, _pipelines), _pipelines, _count);
+			}
+
+			inline void vkGetDeviceQueue(VkDevice _device, uint32_t _familyIndex, uint32_t _queueIndex, VkQueue* _queue)
+			{
+				VV_Capture_Target(vkGetDeviceQueue)(_device, _familyIndex, _queueIndex, _queue);
+
+				Track(VK_SUCCESS, _queue, 1);
+			}
+
+			inline void vkGetDeviceQueue2(VkDevice _device, const VkDeviceQueueInfo2* _info, VkQueue* _queue)
+			{
+				VV_Capture_Target(vkGetDeviceQueue2)(_device, _info, _queue);
+
+				Track(VK_SUCCESS, _queue, 1);
+			}
+
+			inline VkResult vkGetSwapchainImagesKHR(VkDevice _device, VkSwapchainKHR _swapchain, uint32_t* _count, VkImage* _images)
+			{
+				return Track(VV_Capture_Target(vkGetSwapchainImagesKHR)(_device, _swapchain, _count, _images), _images, *_count);
+			}
+
+			#pragma endregion Tracked
+		}
+
+		#undef VV_Capture_Target
+
+		/** @} */	// Capture
+	}
+}
+
+#endif
@@ -31,6 +31,7 @@
 #include "VV_Sampler.hpp"
 #include "VV_Resource.hpp"
 #include "VV_SyncAndCacheControl.hpp"
+#include "VV_Query.hpp"
 #include "VV_Shaders.hpp"
 #include "VV_Pipelines.hpp"
 #include "VV_RenderPass.hpp"
@@ -170,7 +171,7 @@ namespace VaultedVulkan
 
 				@ingroup APISpec_Command_Buffers
 				*/
-				struct TimelineSemaphore : V0::VKStruct_Base<VkTimelineSemaphoreSubmitInfo>
+				struct TimelineSemaphore : V0::VKStruct_Base<VkTimelineSemaphoreSubmitInfo, EStructureType::TimelineSemaphore_SubmitInfo>
 				{
 					      EType SType                     = STypeEnum;
 					const void* Next                      = nullptr  ;
@@ -271,6 +272,16 @@ namespace VaultedVulkan
 			};
 
 
+			/**
+			@brief <a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#vkCmdBeginQuery">Specification</a>
+
+			@ingroup APISpec_Queries
+			*/
+			static void BeginQuery(Handle _commandBuffer, QueryPool::Handle _queryPool, ui32 _query, QueryControlFlags _flags)
+			{
+				vkCmdBeginQuery(_commandBuffer, _queryPool, _query, _flags);
+			}
+
 			/**
 			@brief <a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#vkBeginCommandBuffer">Specification</a> 
 			
@@ -443,6 +454,26 @@ namespace VaultedVulkan
 				vkCmdCopyBufferToImage(_commandBuffer, _srcBuffer, _dstImage, VkImageLayout(_dstImageLayout), _regionCount, *_regions);
 			}
 
+			/**
+			@brief <a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#vkCmdCopyQueryPoolResults">Specification</a>
+
+			@ingroup APISpec_Queries
+			*/
+			static void CopyQueryPoolResults
+			(
+				Handle                 _commandBuffer,
+				QueryPool::Handle      _queryPool    ,
+				ui32                   _firstQuery   ,
+				ui32                   _queryCount   ,
+				Buffer::Handle         _dstBuffer    ,
+				DeviceSize             _dstOffset    ,
+				DeviceSize             _stride       ,
+				QueryPool::ResultFlags _flags
+			)
+			{
+				vkCmdCopyQueryPoolResults(_commandBuffer, _queryPool, _firstQuery, _queryCount, _dstBuffer, _dstOffset, _stride, _flags);
+			}
+
 			/**
 			 * @brief <a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#vkCmdDraw">Specification</a> 
 			 * 
@@ -463,6 +494,16 @@ namespace VaultedVulkan
 				vkCmdDrawIndexed(_commandBuffer, _indexCount, _instanceCount, _firstIndex, _vertexOffset, _firstInstance);
 			}
 
+			/**
+			@brief <a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#vkCmdEndQuery">Specification</a>
+
+			@ingroup APISpec_Queries
+			*/
+			static void EndQuery(Handle _commandBuffer, QueryPool::Handle _queryPool, ui32 _query)
+			{
+				vkCmdEndQuery(_commandBuffer, _queryPool, _query);
+			}
+
 			/**
 			 * @brief <a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#vkEndCommandBuffer">Specification</a> 
 			 * 
@@ -503,6 +544,24 @@ namespace VaultedVulkan
 				vkCmdExecuteCommands(_primaryCommandBuffer, _secondaryBufferCount, _secondaryBuffers);
 			}
 
+			/**
+			@brief <a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#vkCmdPushConstants">Specification</a>
+
+			@ingroup APISpec_Resource_Descriptors
+			*/
+			static void PushConstants
+			(
+				      Handle                     _commandBuffer,
+				      Pipeline::Layout::Handle   _layout       ,
+				      Pipeline::ShaderStageFlags _stageFlags   ,
+				      ui32                       _offset       ,
+				      ui32                       _size         ,
+				const void*                      _values
+			)
+			{
+				vkCmdPushConstants(_commandBuffer, _layout, _stageFlags, _offset, _size, _values);
+			}
+
 			/**
 			 * @brief <a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#vkResetCommandBuffer">Specification</a> 
 			 * 
@@ -527,6 +586,16 @@ namespace VaultedVulkan
 				vkCmdResetEvent(_commandBuffer, _event, _stageMask);
 			}
 
+			/**
+			@brief <a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#vkCmdResetQueryPool">Specification</a>
+
+			@ingroup APISpec_Queries
+			*/
+			static void ResetQueryPool(Handle _commandBuffer, QueryPool::Handle _queryPool, ui32 _firstQuery, ui32 _queryCount)
+			{
+				vkCmdResetQueryPool(_commandBuffer, _queryPool, _firstQuery, _queryCount);
+			}
+
 			/**
 			* @brief <a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#vkCmdSetDeviceMask">Specification</a> 
 			* 
@@ -634,6 +703,16 @@ namespace VaultedVulkan
 					*_imageMemoryBarriers
 				);
 			}
+
+			/**
+			@brief <a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#vkCmdWriteTimestamp">Specification</a>
+
+			@ingroup APISpec_Queries
+			*/
+			static void WriteTimestamp(Handle _commandBuffer, EPipelineStageFlag _stage, QueryPool::Handle _queryPool, ui32 _query)
+			{
+				vkCmdWriteTimestamp(_commandBuffer, VkPipelineStageFlagBits(_stage), _queryPool, _query);
+			}
 		};
 
 		/**
@@ -954,6 +1033,37 @@ namespace VaultedVulkan
 
 			using Parent::CopyBuffer;
 
+			/** 
+			@brief Update the values of push constants with an object. (At the offset specified)
+
+			@details The type must be trivially copyable and a multiple of 4 bytes in size, as push constant updates are. Pointers are rejected, pass the object they point to.
+			*/
+			template<typename Type>
+			static void PushConstants
+			(
+				      Handle                     _commandBuffer,
+				      Pipeline::Layout::Handle   _layout       ,
+				      Pipeline::ShaderStageFlags _stageFlags   ,
+				      ui32                       _offset       ,
+				const Type&                      _values
+			)
+			{
+				static_assert(!std::is_pointer<Type>::value          , "Push constants must be passed as the object, not a pointer to it.");
+				static_assert(std::is_trivially_copyable<Type>::value, "Push constants must be trivially copyable.");
+				static_assert(sizeof(Type) % 4 == 0                  , "Push constants must be a multiple of 4 bytes in size.");
+
+				Parent::PushConstants(_commandBuffer, _layout, _stageFlags, _offset, ui32(sizeof(Type)), &_values);
+			}
+
+			/** @brief Update the values of push constants with an object. (At the start of the push constant range) */
+			template<typename Type>
+			static void PushConstants(Handle _commandBuffer, Pipeline::Layout::Handle _layout, Pipeline::ShaderStageFlags _stageFlags, const Type& _values)
+			{
+				PushConstants(_commandBuffer, _layout, _stageFlags, 0, _values);
+			}
+
+			using Parent::PushConstants;
+
 			/** @brief Set scissor rectangles dynamically. (Single scissor) */
 			static void SetScissor(Handle _commandBuffer, const Rect2D& _scissors)
 			{
@@ -1193,6 +1303,14 @@ namespace VaultedVulkan
 				handle = Null<Handle>;
 			}
 
+			/**
+			@brief Begin a query. (Occlusion or pipeline statistics)
+			*/
+			void BeginQuery(const QueryPool& _queryPool, ui32 _query, QueryControlFlags _flags) const
+			{
+				Parent::BeginQuery(handle, _queryPool, _query, _flags);
+			}
+
 			/**
 			@brief Begin recording commands to the buffer.
 
@@ -1308,6 +1426,23 @@ namespace VaultedVulkan
 				Parent::CopyBufferToImage(handle, _srcBuffer, _dstImage, _dstImageLayout, _regionCount, _regions);
 			}
 
+			/**
+			@brief Copy the results of a range of queries to a buffer object.
+			*/
+			void CopyQueryPoolResults
+			(
+				const QueryPool&             _queryPool ,
+				      ui32                   _firstQuery,
+				      ui32                   _queryCount,
+				const Buffer&                _dstBuffer ,
+				      DeviceSize             _dstOffset ,
+				      DeviceSize             _stride    ,
+				      QueryPool::ResultFlags _flags
+			) const
+			{
+				Parent::CopyQueryPoolResults(handle, _queryPool, _firstQuery, _queryCount, _dstBuffer, _dstOffset, _stride, _flags);
+			}
+
 			/**
 			@brief Record a non-indexed draw.
 			*/
@@ -1331,6 +1466,14 @@ namespace VaultedVulkan
 				Parent::DrawIndexed(handle, _indexCount, _instanceCount, _firstIndex, _vertexOffset, _firstInstance);
 			}
 
+			/**
+			@brief End a query.
+			*/
+			void EndQuery(const QueryPool& _queryPool, ui32 _query) const
+			{
+				Parent::EndQuery(handle, _queryPool, _query);
+			}
+
 			/**
 			@brief complete recording of a command buffer.
 			*/
@@ -1356,6 +1499,32 @@ namespace VaultedVulkan
 				Parent::Execute(handle, _secondaryBufferCount, _secondaryBuffers);
 			}
 
+			/**
+			@brief Update the values of push constants.
+			*/
+			void PushConstants(Pipeline::Layout::Handle _layout, Pipeline::ShaderStageFlags _stageFlags, ui32 _offset, ui32 _size, const void* _values) const
+			{
+				Parent::PushConstants(handle, _layout, _stageFlags, _offset, _size, _values);
+			}
+
+			/**
+			@brief Update the values of push constants with an object. (At the offset specified)
+			*/
+			template<typename Type>
+			void PushConstants(Pipeline::Layout::Handle _layout, Pipeline::ShaderStageFlags _stageFlags, ui32 _offset, const Type& _values) const
+			{
+				Parent::PushConstants(handle, _layout, _stageFlags, _offset, _values);
+			}
+
+			/**
+			@brief Update the values of push constants with an object. (At the start of the push constant range)
+			*/
+			template<typename Type>
+			void PushConstants(Pipeline::Layout::Handle _layout, Pipeline::ShaderStageFlags _stageFlags, const Type& _values) const
+			{
+				Parent::PushConstants(handle, _layout, _stageFlags, 0, _values);
+			}
+
 			/**
 			@brief Set the state of an event to unsignaled from a device.
 			*/
@@ -1364,6 +1533,14 @@ namespace VaultedVulkan
 				Parent::ResetEvent(handle, _event, _stageMask);
 			}
 
+			/**
+			@brief Reset a range of queries from a device. (Must be recorded outside of a render pass)
+			*/
+			void ResetQueryPool(const QueryPool& _queryPool, ui32 _firstQuery, ui32 _queryCount) const
+			{
+				Parent::ResetQueryPool(handle, _queryPool, _firstQuery, _queryCount);
+			}
+
 			/**
 			@brief Update the current device bitfield of a command buffer.
 			*/
@@ -1636,6 +1813,14 @@ namespace VaultedVulkan
 
 		#pragma endregion WaitForEvents_OO
 
+			/**
+			@brief Write a device timestamp into a query once all previous commands have completed the specified pipeline stage.
+			*/
+			void WriteTimestamp(EPipelineStageFlag _stage, const QueryPool& _queryPool, ui32 _query) const
+			{
+				Parent::WriteTimestamp(handle, _stage, _queryPool, _query);
+			}
+
 			/**
 			@brief Implicit conversion to give a reference to its handle.
 			*/
@@ -1676,422 +1861,2168 @@ namespace VaultedVulkan
 		};
 
 		/**
-		@ingroup APISpec_Command_Buffers
-		@brief Command pools are opaque objects that command buffer memory is allocated from,
-		and which allow the implementation to amortize the cost of resource creation across multiple command buffers.
+		@brief Tracks the state bound to a command buffer to identify redundant binds and dynamic state changes.
 
 		@details
-		Command pools are externally synchronized, meaning that a command pool must not be used concurrently in multiple threads.
-		That includes use via recording commands on any command buffers allocated from the pool, as well as operations that allocate,
-		free, and reset command buffers or the pool itself.
+		Each Track function returns true if the state changed (the command must be recorded), and false if the command is redundant.
+		Redundant commands are counted by the statistics.
 
-		This object represents a device created object on the host. As such ownership is tied to this host object.
-		Due to this design, the object has no copy-construction allowed. Instead, default move constructor and assignment has been defined.
+		The cache does not record any commands itself (See FilteredCommandBuffer).
+		Ranges beyond the tracked limits are never treated as redundant.
 		*/
-		class CommandPool : public V2::CommandPool
+		class CommandStateCache
 		{
 		public:
-			using Parent = V2::CommandPool;
 
-			/**
-			@brief Default constructor.
-			*/
-			CommandPool() : handle(Null<Handle>), allocator(Memory::DefaultAllocator), device(nullptr)
-			{}
+			static constexpr ui32 MaxDescriptorSets   = 8 ;
+			static constexpr ui32 MaxDynamicOffsets   = 16;
+			static constexpr ui32 MaxVertexBindings   = 16;
+			static constexpr ui32 MaxViewports        = 16;
 
 			/**
-			@brief Default constructor, logical device defined.
+			@brief Amount of commands that were redundant, by command.
 			*/
-			CommandPool(const LogicalDevice& _device) : handle(Null<Handle>),  allocator(Memory::DefaultAllocator), device(&_device)
-			{}
+			struct Statistics
+			{
+				ui32 BindPipeline       = 0;
+				ui32 BindDescriptorSets = 0;
+				ui32 BindIndexBuffer    = 0;
+				ui32 BindVertexBuffers  = 0;
+				ui32 SetScissor         = 0;
+				ui32 SetViewport        = 0;
 
-			/**
-			@brief Default constructor, logical device and allocator defined.
-			*/
-			CommandPool(const LogicalDevice& _device, const Memory::AllocationCallbacks& _allocator) : 
-				handle(Null<Handle>), allocator(&_allocator), device(&_device)
-			{}
+				ui32 GetTotal() const
+				{
+					return BindPipeline + BindDescriptorSets + BindIndexBuffer + BindVertexBuffers + SetScissor + SetViewport;
+				}
+			};
 
 			/**
-			@brief Performs a move operation to transfer ownership of the device object to this host object.
+			@brief Default constructor.
 			*/
-			CommandPool(CommandPool&& _poolToMove) noexcept : 
-				handle(std::move(_poolToMove.handle)), allocator(std::move(_poolToMove.allocator)), device(std::move(_poolToMove.device))
+			CommandStateCache()
 			{
-				_poolToMove.handle    = Null<Handle>            ;
-				_poolToMove.allocator = Memory::DefaultAllocator;
-				_poolToMove.device    = nullptr                 ;
+				Invalidate();
 			}
 
 			/**
-			@brief Call the destroy for the device object if the host object's handle is not null.
+			@brief Provides the amount of redundant commands encountered since the last ResetStatistics.
 			*/
-			~CommandPool()
+			const Statistics& GetStatistics() const
 			{
-				if (handle != Null<Handle>) Destroy();
+				return elided;
 			}
 
 			/**
-			@brief Allocate a command buffer.
+			@brief Forget all tracked state. (Must be done when the command buffer state becomes undefined: begin of recording, executing secondary buffers)
 			*/
-			EResult Allocate(CommandBuffer& _buffer)
+			void Invalidate()
 			{
-				CommandBuffer::Handle bufferHandle;
+				for (BindPointState& state : bindPoints)
+				{
+					state.BoundPipeline = Null<Pipeline::Handle>;
+					state.BoundLayout   = Null<Pipeline::Layout::Handle>;
 
-				AllocateInfo info; info.Pool = handle;
+					state.PipelineValid = false;
+					state.LayoutValid   = false;
 
-				EResult returnCode = Parent::Allocate(*device, info, &bufferHandle);
+					state.SetsValid.fill(false);
 
-				if (returnCode != EResult::Success) return returnCode;
+					state.DynamicFirstSet    = 0;
+					state.DynamicSetCount    = 0;
+					state.DynamicOffsetCount = 0;
+				}
 
-				_buffer.Assign(*device, bufferHandle);
+				vertexBuffersValid.fill(false);
+				viewportsValid    .fill(false);
+				scissorsValid     .fill(false);
 
-				return returnCode;
+				indexBufferValid = false;
 			}
 
-			/**
-			@brief Allocate a command buffer with the specified allocation info.
-			*/
-			EResult Allocate(AllocateInfo& _info, CommandBuffer& _buffer)
+			void ResetStatistics()
 			{
-				CommandBuffer::Handle bufferHandle;
-
-				EResult returnCode = Parent::Allocate(*device, _info, &bufferHandle);
-
-				if (returnCode != EResult::Success) return returnCode;
-
-				_buffer.Assign(*device, bufferHandle);
-
-				return returnCode;
+				elided = Statistics();
 			}
 
 			/**
-			@brief Allocate command buffers based on the allocate info.
+			@brief Track a descriptor set bind. The sets are redundant if the layout, the sets, and the dynamic offsets are the same as bound.
 			*/
-			EResult Allocate(AllocateInfo& _info, CommandBuffer::Handle* _buffers)
+			bool TrackBindDescriptorSets
+			(
+				      EPipelineBindPoint       _bindPoint         ,
+				      Pipeline::Layout::Handle _layout            ,
+				      ui32                     _firstSet          ,
+				      ui32                     _descriptorSetCount,
+				const DescriptorSet::Handle*   _descriptorSets    ,
+				      ui32                     _dynamicOffsetCount,
+				const ui32*                    _dynamicOffsets
+			)
 			{
-				EResult returnCode = Parent::Allocate(*device, _info, _buffers);
+				BindPointState& state = bindPoints[BindPointIndex(_bindPoint)];
 
-				return returnCode;
-			}
+				const bool trackable = 
+					_firstSet + _descriptorSetCount <= MaxDescriptorSets && 
+					_dynamicOffsetCount             <= MaxDynamicOffsets   ;
 
-			/**
-			@brief Allocate command buffers with the specified count and level.
-			*/
-			EResult Allocate(ECommandBufferLevel _level, ui32 _count, CommandBuffer::Handle* _buffers)
-			{
-				AllocateInfo allocInfo; 
+				if (trackable && state.LayoutValid && state.BoundLayout == _layout)
+				{
+					bool redundant = true;
+
+					for (ui32 index = 0; index < _descriptorSetCount && redundant; index++)
+					{
+						const ui32 set = _firstSet + index;
+
+						redundant = state.SetsValid[set] && state.Sets[set] == _descriptorSets[index];
+					}
+
+					if (redundant && _dynamicOffsetCount != 0)
+					{
+						redundant = 
+							state.DynamicFirstSet    == _firstSet           && 
+							state.DynamicSetCount    == _descriptorSetCount && 
+							state.DynamicOffsetCount == _dynamicOffsetCount &&
+							memcmp(state.DynamicOffsets.data(), _dynamicOffsets, sizeof(ui32) * _dynamicOffsetCount) == 0;
+					}
+
+					if (redundant)
+					{
+						elided.BindDescriptorSets++;
+
+						return false;
+					}
+				}
 
-				allocInfo.Level       = _level;
-				allocInfo.Pool        = handle;
-				allocInfo.BufferCount = _count;
+				// Sets bound with a different layout may disturb the others, so they are no longer assumed to be bound.
+				if (!state.LayoutValid || state.BoundLayout != _layout) state.SetsValid.fill(false);
 
-				EResult returnCode = Parent::Allocate(*device, allocInfo, _buffers);
+				state.BoundLayout = _layout;
+				state.LayoutValid = trackable;
 
-				return returnCode;
-			}
+				for (ui32 index = 0; index < _descriptorSetCount; index++)
+				{
+					const ui32 set = _firstSet + index;
 
-/**
-			@brief Allocate command buffers and their handles into dynamic arrays. based on the count provided and the level desired.
-			*/
-			EResult Allocate
-			(
-				ECommandBufferLevel          _level         ,
-				ui32                         _count         ,
-				DynamicArray<CommandBuffer>& _commandBuffers
-			)
-			{
-				AllocateInfo allocInfo; 
-				
-				allocInfo.Level       = _level;
-				allocInfo.Pool        = handle;
-				allocInfo.BufferCount = _count;
+					if (set >= MaxDescriptorSets) break;
 
-				DynamicArray<CommandBuffer::Handle> handles(_count);
+					state.Sets     [set] = _descriptorSets[index];
+					state.SetsValid[set] = trackable;
+				}
 
-				_commandBuffers.resize(_count);
+				if (_dynamicOffsetCount != 0 && trackable)
+				{
+					state.DynamicFirstSet    = _firstSet          ;
+					state.DynamicSetCount    = _descriptorSetCount;
+					state.DynamicOffsetCount = _dynamicOffsetCount;
 
-				EResult returnCode = Parent::Allocate(*device, allocInfo, handles.data());
+					memcpy(state.DynamicOffsets.data(), _dynamicOffsets, sizeof(ui32) * _dynamicOffsetCount);
+				}
+				else
+				{
+					state.DynamicSetCount    = 0;
+					state.DynamicOffsetCount = 0;
+				}
 
-				if (returnCode != EResult::Success) return returnCode;
+				return true;
+			}
 
-				for (DeviceSize index = 0; index < _count; index++)
+			/**
+			@brief Track an index buffer bind.
+			*/
+			bool TrackBindIndexBuffer(Buffer::Handle _buffer, DeviceSize _offset, EIndexType _indexType)
+			{
+				if (indexBufferValid && indexBuffer == _buffer && indexOffset == _offset && indexType == _indexType)
 				{
-					_commandBuffers[index].Assign(*device, handles[index]);
+					elided.BindIndexBuffer++;
+
+					return false;
 				}
 
-				return returnCode;
+				indexBuffer      = _buffer   ;
+				indexOffset      = _offset   ;
+				indexType        = _indexType;
+				indexBufferValid = true      ;
+
+				return true;
 			}
 
 			/**
-			@brief Allocate command buffers and their handles into dynamic arrays. based on the count provided and the level desired.
+			@brief Track a pipeline bind. 
+			
+			@details A bound pipeline applies its static state, so the viewports and scissors are no longer assumed to be set when it changes.
 			*/
-			EResult Allocate
-			(
-				ECommandBufferLevel                  _level         ,
-				ui32                                 _count         ,
-				DynamicArray<CommandBuffer>&         _commandBuffers,
-				DynamicArray<CommandBuffer::Handle>& _handles
-			)
+			bool TrackBindPipeline(EPipelineBindPoint _bindPoint, Pipeline::Handle _pipeline)
 			{
-				AllocateInfo allocInfo; 
-				
-				allocInfo.Level       = _level;
-				allocInfo.Pool        = handle;
-				allocInfo.BufferCount = _count;
+				BindPointState& state = bindPoints[BindPointIndex(_bindPoint)];
 
-				_commandBuffers.resize(_count); _handles.resize(_count);
+				if (state.PipelineValid && state.BoundPipeline == _pipeline)
+				{
+					elided.BindPipeline++;
 
-				EResult returnCode = Parent::Allocate(*device, allocInfo, _handles.data());
+					return false;
+				}
 
-				if (returnCode != EResult::Success) return returnCode;
+				state.BoundPipeline = _pipeline;
+				state.PipelineValid = true;
 
-				for (DeviceSize index = 0; index < _count; index++)
+				if (_bindPoint == EPipelineBindPoint::Graphics)
 				{
-					_commandBuffers[index].Assign(*device, _handles[index]);
+					viewportsValid.fill(false);
+					scissorsValid .fill(false);
 				}
 
-				return returnCode;
+				return true;
 			}
 
 			/**
-			@brief Create a command pool.
+			@brief Track a vertex buffer bind.
 			*/
-			EResult Create(const CreateInfo& _info)
+			bool TrackBindVertexBuffers(ui32 _firstBinding, ui32 _bindingCount, const Buffer::Handle* _buffers, const DeviceSize* _offsets)
 			{
-				if (device == nullptr) return EResult::Not_Ready;
-
-				return Parent::Create(*device, _info, allocator, handle);
+				return TrackRange
+				(
+					_firstBinding, _bindingCount, vertexBuffersValid, elided.BindVertexBuffers,
+					[&](ui32 _slot, ui32 _index) { return vertexBuffers[_slot] == _buffers[_index] && vertexOffsets[_slot] == _offsets[_index]; },
+					[&](ui32 _slot, ui32 _index) { vertexBuffers[_slot] = _buffers[_index]; vertexOffsets[_slot] = _offsets[_index]; }
+				);
 			}
 
 			/**
-			@brief Create a command pool (device specified).
+			@brief Track a change of scissors.
 			*/
-			EResult Create(const LogicalDevice& _device, const CreateInfo& _info)
+			bool TrackSetScissor(ui32 _firstScissor, ui32 _scissorCount, const Rect2D* _scissors)
 			{
-				device = &_device;
-
-				return Parent::Create(*device, _info, handle);	
+				return TrackRange
+				(
+					_firstScissor, _scissorCount, scissorsValid, elided.SetScissor,
+					[&](ui32 _slot, ui32 _index) { return memcmp(&scissors[_slot], &_scissors[_index], sizeof(Rect2D)) == 0; },
+					[&](ui32 _slot, ui32 _index) { scissors[_slot] = _scissors[_index]; }
+				);
 			}
 
 			/**
-			@brief Create a command pool (device and allocator specified).
+			@brief Track a change of viewports.
 			*/
-			EResult Create(const LogicalDevice& _device, CreateInfo& _info, const Memory::AllocationCallbacks& _allocator)
+			bool TrackSetViewport(ui32 _firstViewport, ui32 _viewportCount, const Viewport* _viewports)
+			{
+				return TrackRange
+				(
+					_firstViewport, _viewportCount, viewportsValid, elided.SetViewport,
+					[&](ui32 _slot, ui32 _index) { return memcmp(&viewports[_slot], &_viewports[_index], sizeof(Viewport)) == 0; },
+					[&](ui32 _slot, ui32 _index) { viewports[_slot] = _viewports[_index]; }
+				);
+			}
+
+		protected:
+
+			static constexpr ui32 BindPointCount = 2;
+
+			struct BindPointState
+			{
+				Pipeline::Handle         BoundPipeline;
+				Pipeline::Layout::Handle BoundLayout  ;
+
+				bool PipelineValid;
+				bool LayoutValid  ;
+
+				std::array<DescriptorSet::Handle, MaxDescriptorSets> Sets     ;
+				std::array<bool                 , MaxDescriptorSets> SetsValid;
+
+				ui32 DynamicFirstSet   ;
+				ui32 DynamicSetCount   ;
+				ui32 DynamicOffsetCount;
+
+				std::array<ui32, MaxDynamicOffsets> DynamicOffsets;
+			};
+
+			static ui32 BindPointIndex(EPipelineBindPoint _bindPoint)
+			{
+				return _bindPoint == EPipelineBindPoint::Compute ? 1 : 0;
+			}
+
+			template<std::size_t SlotCount, typename CompareFunction, typename AssignFunction>
+			/**
+			@brief Tracks a range of slots (bindings, viewports, scissors): redundant only if every slot of the range is known and the same.
+			*/
+			static bool TrackRange
+			(
+				ui32                         _first  ,
+				ui32                         _count  ,
+				std::array<bool, SlotCount>& _valid  ,
+				ui32&                        _elided ,
+				CompareFunction              _compare,
+				AssignFunction               _assign
+			)
+			{
+				if (_first + _count <= SlotCount)
+				{
+					bool redundant = true;
+
+					for (ui32 index = 0; index < _count && redundant; index++)
+					{
+						redundant = _valid[_first + index] && _compare(_first + index, index);
+					}
+
+					if (redundant)
+					{
+						_elided++;
+
+						return false;
+					}
+				}
+
+				for (ui32 index = 0; index < _count; index++)
+				{
+					const ui32 slot = _first + index;
+
+					if (slot >= SlotCount) break;
+
+					_assign(slot, index);
+
+					_valid[slot] = true;
+				}
+
+				return true;
+			}
+
+			std::array<BindPointState, BindPointCount> bindPoints;
+
+			std::array<Buffer::Handle, MaxVertexBindings> vertexBuffers     ;
+			std::array<DeviceSize    , MaxVertexBindings> vertexOffsets     ;
+			std::array<bool          , MaxVertexBindings> vertexBuffersValid;
+
+			Buffer::Handle indexBuffer     ;
+			DeviceSize     indexOffset     ;
+			EIndexType     indexType       ;
+			bool           indexBufferValid;
+
+			std::array<Viewport, MaxViewports> viewports     ;
+			std::array<bool    , MaxViewports> viewportsValid;
+			std::array<Rect2D  , MaxViewports> scissors      ;
+			std::array<bool    , MaxViewports> scissorsValid ;
+
+			Statistics elided;
+		};
+
+		/**
+		@brief A command buffer that drops binds and dynamic state changes that would not change the state already recorded.
+
+		@details
+		Opt-in alternative to CommandBuffer: the filtered commands hide those of CommandBuffer, all others are recorded as is.
+		The tracked state is invalidated on BeginRecord and Execute, as the state of the command buffer is undefined after either.
+
+		State changes recorded through the handle directly (outside of this object) are not seen by the filter, and must be followed by InvalidateState.
+		*/
+		class FilteredCommandBuffer : public CommandBuffer
+		{
+		public:
+
+			using Parent = CommandBuffer;
+
+			/**
+			@brief Default constructor.
+			*/
+			FilteredCommandBuffer() : Parent()
+			{}
+
+			/**
+			@brief Constructor with logical device and handle specified (acts as an Assign() call)
+			*/
+			FilteredCommandBuffer(const LogicalDevice& _device, Handle& _handle) : Parent(_device, _handle)
+			{}
+
+			/**
+			@brief Begin recording commands to the buffer. (Invalidates the tracked state)
+			*/
+			EResult BeginRecord(const BeginInfo& _info)
+			{
+				cache.Invalidate();
+
+				return Parent::BeginRecord(_info);
+			}
+
+			/**
+			@brief Bind one or more descriptor sets to a command buffer. (No dynamic offsets, skipped if redundant)
+			*/
+			void BindDescriptorSets
+			(
+				      EPipelineBindPoint       _bindPoint         ,
+				      Pipeline::Layout::Handle _layout            ,
+				      ui32                     _firstSet          ,
+				      ui32                     _descriptorSetCount,
+				const DescriptorSet::Handle*   _descriptorSets
+			)
+			{
+				BindDescriptorSets(_bindPoint, _layout, _firstSet, _descriptorSetCount, _descriptorSets, 0, nullptr);
+			}
+
+			/**
+			@brief Bind one or more descriptor sets to a command buffer. (Skipped if redundant)
+			*/
+			void BindDescriptorSets
+			(
+				      EPipelineBindPoint       _bindPoint         ,
+				      Pipeline::Layout::Handle _layout            ,
+				      ui32                     _firstSet          ,
+				      ui32                     _descriptorSetCount,
+				const DescriptorSet::Handle*   _descriptorSets    ,
+				      ui32                     _dynamicOffsetCount,
+				const ui32*                    _dynamicOffsets
+			)
+			{
+				if (!cache.TrackBindDescriptorSets(_bindPoint, _layout, _firstSet, _descriptorSetCount, _descriptorSets, _dynamicOffsetCount, _dynamicOffsets)) return;
+
+				V1::CommandBuffer::BindDescriptorSets(handle, _bindPoint, _layout, _firstSet, _descriptorSetCount, _descriptorSets, _dynamicOffsetCount, _dynamicOffsets);
+			}
+
+			/**
+			@brief Bind an index buffer to a command buffer. (Skipped if redundant)
+			*/
+			void BindIndexBuffer(Buffer::Handle _buffer, DeviceSize _offset, EIndexType _type)
+			{
+				if (!cache.TrackBindIndexBuffer(_buffer, _offset, _type)) return;
+
+				V1::CommandBuffer::BindIndexBuffer(handle, _buffer, _offset, _type);
+			}
+
+			/**
+			@brief Bind a pipeline to a command buffer for use in subsequent commands. (Skipped if redundant)
+			*/
+			void BindPipeline(EPipelineBindPoint _bindPoint, Pipeline::Handle _pipeline)
+			{
+				if (!cache.TrackBindPipeline(_bindPoint, _pipeline)) return;
+
+				V1::CommandBuffer::BindPipeline(handle, _bindPoint, _pipeline);
+			}
+
+			/**
+			@brief Bind vertex buffers to a command buffer for use in subsequent draw commands. (No offsets, skipped if redundant)
+			*/
+			void BindVertexBuffers(ui32 _firstBinding, ui32 _bindingCount, const Buffer::Handle* _buffers)
+			{
+				static const DeviceSize offsets[CommandStateCache::MaxVertexBindings] = {};
+
+				if (_bindingCount > CommandStateCache::MaxVertexBindings)
+				{
+					DynamicArray<DeviceSize> zeroOffsets(_bindingCount, 0);
+
+					BindVertexBuffers(_firstBinding, _bindingCount, _buffers, zeroOffsets.data());
+				}
+				else
+				{
+					BindVertexBuffers(_firstBinding, _bindingCount, _buffers, offsets);
+				}
+			}
+
+			/**
+			@brief Bind vertex buffers to a command buffer for use in subsequent draw commands. (Skipped if redundant)
+			*/
+			void BindVertexBuffers(ui32 _firstBinding, ui32 _bindingCount, const Buffer::Handle* _buffers, const DeviceSize* _offsets)
+			{
+				if (!cache.TrackBindVertexBuffers(_firstBinding, _bindingCount, _buffers, _offsets)) return;
+
+				Parent::BindVertexBuffers(_firstBinding, _bindingCount, _buffers, _offsets);
+			}
+
+			/**
+			@brief Execute secondary command buffers. (Invalidates the tracked state)
+			*/
+			void Execute(ui32 _secondaryBufferCount, const Handle* _secondaryBuffers)
+			{
+				Parent::Execute(_secondaryBufferCount, _secondaryBuffers);
+
+				cache.Invalidate();
+			}
+
+			/**
+			@brief Provides the amount of redundant commands that were skipped.
+			*/
+			const CommandStateCache::Statistics& GetElided() const
+			{
+				return cache.GetStatistics();
+			}
+
+			/**
+			@brief Provides the state cache of the command buffer.
+			*/
+			CommandStateCache& GetStateCache()
+			{
+				return cache;
+			}
+
+			/**
+			@brief Forget the tracked state. (For when commands were recorded to the handle outside of this object)
+			*/
+			void InvalidateState()
+			{
+				cache.Invalidate();
+			}
+
+			/** @brief Set scissor rectangles dynamically. (Skipped if redundant) */
+			void SetScissor(ui32 _firstScissor, ui32 _scissorCount, const Rect2D* _scissors)
+			{
+				if (!cache.TrackSetScissor(_firstScissor, _scissorCount, _scissors)) return;
+
+				Parent::SetScissor(_firstScissor, _scissorCount, _scissors);
+			}
+
+			/** @brief Set scissor rectangles dynamically. (Skipped if redundant) */
+			void SetScissor(const DynamicArray<Rect2D>& _scissors)
+			{
+				SetScissor(0, static_cast<ui32>(_scissors.size()), _scissors.data());
+			}
+
+			/** @brief Set scissor rectangles dynamically. (Single scissor, skipped if redundant) */
+			void SetScissor(const Rect2D& _scissor)
+			{
+				SetScissor(0, 1, &_scissor);
+			}
+
+			/** @brief Set viewport transformation parameters dynamically. (Skipped if redundant) */
+			void SetViewport(ui32 _firstViewport, ui32 _viewportCount, const Viewport* _viewports)
+			{
+				if (!cache.TrackSetViewport(_firstViewport, _viewportCount, _viewports)) return;
+
+				Parent::SetViewport(_firstViewport, _viewportCount, _viewports);
+			}
+
+			/** @brief Set viewport transformation parameters dynamically. (Skipped if redundant) */
+			void SetViewport(const DynamicArray<Viewport>& _viewports)
+			{
+				SetViewport(0, static_cast<ui32>(_viewports.size()), _viewports.data());
+			}
+
+			/** @brief Set viewport transformation parameters dynamically. (Single viewport, skipped if redundant) */
+			void SetViewport(const Viewport& _viewport)
+			{
+				SetViewport(0, 1, &_viewport);
+			}
+
+		protected:
+
+			CommandStateCache cache;
+		};
+
+		/**
+		@ingroup APISpec_Command_Buffers
+		@brief Command pools are opaque objects that command buffer memory is allocated from,
+		and which allow the implementation to amortize the cost of resource creation across multiple command buffers.
+
+		@details
+		Command pools are externally synchronized, meaning that a command pool must not be used concurrently in multiple threads.
+		That includes use via recording commands on any command buffers allocated from the pool, as well as operations that allocate,
+		free, and reset command buffers or the pool itself.
+
+		This object represents a device created object on the host. As such ownership is tied to this host object.
+		Due to this design, the object has no copy-construction allowed. Instead, default move constructor and assignment has been defined.
+		*/
+		class CommandPool : public V2::CommandPool
+		{
+		public:
+			using Parent = V2::CommandPool;
+
+			/**
+			@brief Default constructor.
+			*/
+			CommandPool() : handle(Null<Handle>), allocator(Memory::DefaultAllocator), device(nullptr)
+			{}
+
+			/**
+			@brief Default constructor, logical device defined.
+			*/
+			CommandPool(const LogicalDevice& _device) : handle(Null<Handle>),  allocator(Memory::DefaultAllocator), device(&_device)
+			{}
+
+			/**
+			@brief Default constructor, logical device and allocator defined.
+			*/
+			CommandPool(const LogicalDevice& _device, const Memory::AllocationCallbacks& _allocator) : 
+				handle(Null<Handle>), allocator(&_allocator), device(&_device)
+			{}
+
+			/**
+			@brief Performs a move operation to transfer ownership of the device object to this host object.
+			*/
+			CommandPool(CommandPool&& _poolToMove) noexcept : 
+				handle(std::move(_poolToMove.handle)), allocator(std::move(_poolToMove.allocator)), device(std::move(_poolToMove.device))
+			{
+				_poolToMove.handle    = Null<Handle>            ;
+				_poolToMove.allocator = Memory::DefaultAllocator;
+				_poolToMove.device    = nullptr                 ;
+			}
+
+			/**
+			@brief Call the destroy for the device object if the host object's handle is not null.
+			*/
+			~CommandPool()
+			{
+				if (handle != Null<Handle>) Destroy();
+			}
+
+			/**
+			@brief Allocate a command buffer.
+			*/
+			EResult Allocate(CommandBuffer& _buffer)
+			{
+				CommandBuffer::Handle bufferHandle;
+
+				AllocateInfo info; info.Pool = handle;
+
+				EResult returnCode = Parent::Allocate(*device, info, &bufferHandle);
+
+				if (returnCode != EResult::Success) return returnCode;
+
+				_buffer.Assign(*device, bufferHandle);
+
+				return returnCode;
+			}
+
+			/**
+			@brief Allocate a command buffer with the specified allocation info.
+			*/
+			EResult Allocate(AllocateInfo& _info, CommandBuffer& _buffer)
+			{
+				CommandBuffer::Handle bufferHandle;
+
+				EResult returnCode = Parent::Allocate(*device, _info, &bufferHandle);
+
+				if (returnCode != EResult::Success) return returnCode;
+
+				_buffer.Assign(*device, bufferHandle);
+
+				return returnCode;
+			}
+
+			/**
+			@brief Allocate command buffers based on the allocate info.
+			*/
+			EResult Allocate(AllocateInfo& _info, CommandBuffer::Handle* _buffers)
+			{
+				EResult returnCode = Parent::Allocate(*device, _info, _buffers);
+
+				return returnCode;
+			}
+
+			/**
+			@brief Allocate command buffers with the specified count and level.
+			*/
+			EResult Allocate(ECommandBufferLevel _level, ui32 _count, CommandBuffer::Handle* _buffers)
+			{
+				AllocateInfo allocInfo; 
+
+				allocInfo.Level       = _level;
+				allocInfo.Pool        = handle;
+				allocInfo.BufferCount = _count;
+
+				EResult returnCode = Parent::Allocate(*device, allocInfo, _buffers);
+
+				return returnCode;
+			}
+
+/**
+			@brief Allocate command buffers and their handles into dynamic arrays. based on the count provided and the level desired.
+			*/
+			EResult Allocate
+			(
+				ECommandBufferLevel          _level         ,
+				ui32                         _count         ,
+				DynamicArray<CommandBuffer>& _commandBuffers
+			)
+			{
+				AllocateInfo allocInfo; 
+				
+				allocInfo.Level       = _level;
+				allocInfo.Pool        = handle;
+				allocInfo.BufferCount = _count;
+
+				DynamicArray<CommandBuffer::Handle> handles(_count);
+
+				_commandBuffers.resize(_count);
+
+				EResult returnCode = Parent::Allocate(*device, allocInfo, handles.data());
+
+				if (returnCode != EResult::Success) return returnCode;
+
+				for (DeviceSize index = 0; index < _count; index++)
+				{
+					_commandBuffers[index].Assign(*device, handles[index]);
+				}
+
+				return returnCode;
+			}
+
+			/**
+			@brief Allocate command buffers and their handles into dynamic arrays. based on the count provided and the level desired.
+			*/
+			EResult Allocate
+			(
+				ECommandBufferLevel                  _level         ,
+				ui32                                 _count         ,
+				DynamicArray<CommandBuffer>&         _commandBuffers,
+				DynamicArray<CommandBuffer::Handle>& _handles
+			)
+			{
+				AllocateInfo allocInfo; 
+				
+				allocInfo.Level       = _level;
+				allocInfo.Pool        = handle;
+				allocInfo.BufferCount = _count;
+
+				_commandBuffers.resize(_count); _handles.resize(_count);
+
+				EResult returnCode = Parent::Allocate(*device, allocInfo, _handles.data());
+
+				if (returnCode != EResult::Success) return returnCode;
+
+				for (DeviceSize index = 0; index < _count; index++)
+				{
+					_commandBuffers[index].Assign(*device, _handles[index]);
+				}
+
+				return returnCode;
+			}
+
+			/**
+			@brief Create a command pool.
+			*/
+			EResult Create(const CreateInfo& _info)
+			{
+				if (device == nullptr) return EResult::Not_Ready;
+
+				return Parent::Create(*device, _info, allocator, handle);
+			}
+
+			/**
+			@brief Create a command pool (device specified).
+			*/
+			EResult Create(const LogicalDevice& _device, const CreateInfo& _info)
+			{
+				device = &_device;
+
+				return Parent::Create(*device, _info, handle);	
+			}
+
+			/**
+			@brief Create a command pool (device and allocator specified).
+			*/
+			EResult Create(const LogicalDevice& _device, CreateInfo& _info, const Memory::AllocationCallbacks& _allocator)
 			{
 				device    = &_device   ;
 				allocator = &_allocator;
 
-				return Parent::Create(*device, _info, allocator, handle);	
+				return Parent::Create(*device, _info, allocator, handle);	
+			}
+
+			/**
+			@brief Destroy a command pool.
+			*/
+			void Destroy()
+			{
+				Parent::Destroy(*device, handle, allocator);
+
+				handle    = Null<Handle>;
+				allocator = nullptr     ;
+				device    = nullptr     ;
+			}
+
+			/**
+			@brief Free the command buffers based on the count and handle container provided.
+			*/
+			void Free(ui32 _bufferCount, const CommandBuffer::Handle* _commandBuffers)
+			{
+				Parent::Free(*device, handle, _bufferCount, _commandBuffers);
+			}
+
+			/**
+			@brief Free the command buffers based on the allocate info and handle container provided.
+			*/
+			void Free(const AllocateInfo& _info, const CommandBuffer::Handle* _commandBuffers)
+			{
+				Parent::Free(*device, handle, _info.BufferCount, _commandBuffers);	
+			}
+
+			/**
+			@brief Free a command buffer.
+			*/
+			void Free(CommandBuffer& _commandBuffer)
+			{
+				Parent::Free(*device, handle, 1, _commandBuffer);
+			}
+
+			/**
+			@brief Resetting a command pool recycles all of the resources from all of the command buffers allocated from the command pool back to the command pool. 
+			All command buffers that have been allocated from the command pool are put in the initial state.
+			*/
+			EResult Reset(ResetFlags _flags)
+			{
+				return Parent::Reset(*device, handle, _flags);
+			}
+
+			/**
+			@brief Trimming a command pool recycles unused memory from the command pool back to the system. 
+			Command buffers allocated from the pool are not affected by the command.
+			*/
+			void Trim(TrimFlags _flags)
+			{
+				Parent::Trim(*device, handle, _flags);
+			}
+
+		#pragma region SingleTimeCommands
+
+			/**
+			* @brief Will auto-allocate a command buffer on the specified pool and begin recording commands on the buffer. 
+			* 
+			* @details
+			* The handle to the command buffer will be returned.
+			* 
+			* Expected to be used with the EndSingleTimeCommands function (defined below it).
+			*/
+			CommandBuffer BeginSingleTimeCommands(EResult& _result)
+			{
+				AllocateInfo allocationInfo;
+
+				allocationInfo.Pool = handle;
+
+				CommandBuffer::Handle bufferHandle;
+
+				_result = Allocate(allocationInfo, &bufferHandle);
+
+				if (_result != EResult::Success) return CommandBuffer();
+
+				CommandBuffer::BeginInfo beginInfo;
+
+				beginInfo.Flags = ECommandBufferUsageFlag::OneTimeSubmit;
+
+				_result = CommandBuffer::Parent::BeginRecord(bufferHandle, beginInfo);
+
+				return CommandBuffer(*device, bufferHandle);
+			}
+
+			/**
+			* @brief Will end the recording and submit the command buffer created with the BeginSingleTimeCommands function.
+			* 
+			* @details
+			* Will wait until the queue is idle that the commands were submitted to. Will also free the command buffer after completion.
+			* For many uploads prefer a TransferBatcher, which does not stall the queue per submission.
+			* 
+			* Expected to be used with the BeginSingleTimeCommands function (defined above it).
+			*/
+			EResult EndSingleTimeCommands
+			(
+				      CommandBuffer&        _commandBuffer, 
+				const LogicalDevice::Queue& _queue
+			) 
+			{
+				EResult result = EResult::Incomplete;
+
+				result = _commandBuffer.EndRecord();
+
+				if (result != EResult::Success) return result;
+
+				CommandBuffer::SubmitInfo submitInfo;
+
+				submitInfo.CommandBufferCount = 1             ;
+				submitInfo.CommandBuffers     = _commandBuffer;
+
+				result = _queue.SubmitToQueue(1, submitInfo, Null<Fence::Handle>);
+
+				if (result != EResult::Success) return result;
+
+				result = _queue.WaitUntilIdle();
+
+				if (result != EResult::Success) return result;
+
+				Free(_commandBuffer);
+
+				return result;
+			}
+
+			/**
+			@brief Uses a single time command buffer to copy a buffer with the provided queue and copy info.
+			*/
+			EResult CopyBuffer
+			(
+				      Buffer&               _sourceBuffer     , 
+				      Buffer&               _destinationBuffer, 
+				      Buffer::CopyInfo&     _regionInfo       ,
+				const LogicalDevice::Queue& _queue
+			) 
+			{
+				EResult result;
+
+				CommandBuffer commandBuffer = BeginSingleTimeCommands(result);
+
+				if (result != EResult::Success) return result;
+
+				commandBuffer.CopyBuffer(_sourceBuffer, _destinationBuffer, 1, &_regionInfo);
+
+				result = EndSingleTimeCommands(commandBuffer, _queue);
+
+				return result;
+			}
+
+		#pragma endregion SingleTimeCommands
+
+			/**
+			@brief Implicit conversion to give a reference to its handle.
+			*/
+			operator Handle&()
+			{
+				return handle;
+			}
+
+			/**
+			@brief Implicit conversion to give a readonly reference to its handle.
+			*/
+			operator const Handle&() const
+			{
+				return handle;
+			}
+
+			/**
+			@brief Implicit conversion to give a pointer to its handle.
+			*/
+			operator const Handle*() const
+			{
+				return &handle;
+			}
+
+			/**
+			@brief Checks to see if its the same object by checking to see if its the same handle.
+			*/
+			bool operator== (const CommandPool& _other) const
+			{
+				return handle == _other.handle;
+			}
+
+			/**
+			@brief Performs a move assignment operation to transfer ownership of the device object to this host object.
+			*/
+			CommandPool& operator= (CommandPool&& _other) noexcept
+			{
+				if (this == &_other)
+					return *this;
+
+				handle    = std::move(_other.handle   );
+				allocator = std::move(_other.allocator);
+				device    = std::move(_other.device   );
+
+				_other.handle    = Null<Handle>            ;
+				_other.allocator = Memory::DefaultAllocator;
+				_other.device    = nullptr                 ;
+
+				return *this;
+			}
+
+		protected:
+
+			Handle handle;
+
+			const Memory::AllocationCallbacks* allocator;
+
+			const LogicalDevice* device;
+		};
+
+		/**
+		@brief A command pool whose command buffers are recycled as a whole with a single pool reset, instead of being reset or freed individually.
+
+		@details
+		Command buffers acquired from the pool are kept in a list per level. After a reset they are handed out again in the same order,
+		so once the pool has reached its working size no command buffers are allocated or freed.
+
+		All command buffers acquired must no longer be pending execution when the pool is reset.
+		Like the command pool it owns, it is externally synchronized (use one per recording thread).
+		*/
+		class FrameCommandPool
+		{
+		public:
+
+			/**
+			@brief Default constructor.
+			*/
+			FrameCommandPool() : primariesUsed(0), secondariesUsed(0), device(nullptr)
+			{}
+
+			/**
+			@brief Constructor with logical device specified.
+			*/
+			FrameCommandPool(const LogicalDevice& _device) : pool(_device), primariesUsed(0), secondariesUsed(0), device(&_device)
+			{}
+
+			/**
+			@brief Performs a move operation to transfer ownership of the pool and its command buffers to this object.
+			*/
+			FrameCommandPool(FrameCommandPool&& _other) noexcept :
+				pool           (std::move(_other.pool       )),
+				primaries      (std::move(_other.primaries  )),
+				secondaries    (std::move(_other.secondaries)),
+				primariesUsed  (_other.primariesUsed        ),
+				secondariesUsed(_other.secondariesUsed      ),
+				device         (_other.device               )
+			{
+				_other.primariesUsed   = 0      ;
+				_other.secondariesUsed = 0      ;
+				_other.device          = nullptr;
+			}
+
+			/**
+			@brief Provides a command buffer of the level specified, allocating one only if all of the pool's buffers of that level are in use.
+			*/
+			EResult Acquire(ECommandBufferLevel _level, CommandBuffer::Handle& _buffer)
+			{
+				DynamicArray<CommandBuffer::Handle>& buffers = _level == ECommandBufferLevel::Primary ? primaries     : secondaries    ;
+				ui32&                                used    = _level == ECommandBufferLevel::Primary ? primariesUsed : secondariesUsed;
+
+				if (used < buffers.size())
+				{
+					_buffer = buffers[used++];
+
+					return EResult::Success;
+				}
+
+				EResult returnCode = pool.Allocate(_level, 1, &_buffer);
+
+				if (returnCode != EResult::Success) return returnCode;
+
+				buffers.push_back(_buffer);
+
+				used++;
+
+				return EResult::Success;
+			}
+
+			/**
+			@brief Provides a command buffer of the level specified, allocating one only if all of the pool's buffers of that level are in use.
+			*/
+			EResult Acquire(ECommandBufferLevel _level, CommandBuffer& _buffer)
+			{
+				CommandBuffer::Handle bufferHandle;
+
+				EResult returnCode = Acquire(_level, bufferHandle);
+
+				if (returnCode != EResult::Success) return returnCode;
+
+				_buffer.Assign(*device, bufferHandle);
+
+				return EResult::Success;
+			}
+
+			/**
+			@brief Create the command pool for the queue's family.
+
+			@details The pool is transient: its command buffers are expected to be re-recorded every time the pool is reset.
+			*/
+			EResult Create(const LogicalDevice::Queue& _queue)
+			{
+				if (device == nullptr) return EResult::Not_Ready;
+
+				CommandPool::CreateInfo info;
+
+				info.Flags.Set(ECommandPoolCreateFlag::Transient);
+
+				info.QueueFamilyIndex = _queue.GetFamilyIndex();
+
+				return pool.Create(*device, info);
+			}
+
+			/**
+			@brief Create the command pool for the queue's family (logical device specified).
+			*/
+			EResult Create(const LogicalDevice& _device, const LogicalDevice::Queue& _queue)
+			{
+				device = &_device;
+
+				return Create(_queue);
+			}
+
+			/**
+			@brief Destroys the command pool, which frees all of its command buffers.
+			*/
+			void Destroy()
+			{
+				pool.Destroy();
+
+				primaries  .clear();
+				secondaries.clear();
+
+				primariesUsed   = 0;
+				secondariesUsed = 0;
+			}
+
+			/**
+			@brief Provides the amount of command buffers allocated from the pool.
+			*/
+			ui32 GetAllocatedCount() const
+			{
+				return ui32(primaries.size() + secondaries.size());
+			}
+
+			/**
+			@brief Provides the amount of command buffers acquired since the last reset.
+			*/
+			ui32 GetUsedCount() const
+			{
+				return primariesUsed + secondariesUsed;
+			}
+
+			/**
+			@brief Resets the command pool, putting all of its command buffers back into the initial state and making them available to acquire.
+			*/
+			EResult Reset()
+			{
+				EResult returnCode = pool.Reset(CommandPool::ResetFlags());
+
+				if (returnCode != EResult::Success) return returnCode;
+
+				primariesUsed   = 0;
+				secondariesUsed = 0;
+
+				return EResult::Success;
+			}
+
+			/**
+			@brief Performs a move assignment operation to transfer ownership of the pool and its command buffers to this object.
+			*/
+			FrameCommandPool& operator= (FrameCommandPool&& _other) noexcept
+			{
+				if (this == &_other)
+					return *this;
+
+				pool            = std::move(_other.pool       );
+				primaries       = std::move(_other.primaries  );
+				secondaries     = std::move(_other.secondaries);
+				primariesUsed   = _other.primariesUsed         ;
+				secondariesUsed = _other.secondariesUsed       ;
+				device          = _other.device                ;
+
+				_other.primariesUsed   = 0      ;
+				_other.secondariesUsed = 0      ;
+				_other.device          = nullptr;
+
+				return *this;
+			}
+
+		protected:
+
+			CommandPool pool;
+
+			DynamicArray<CommandBuffer::Handle> primaries;
+
+			DynamicArray<CommandBuffer::Handle> secondaries;
+
+			ui32 primariesUsed;
+
+			ui32 secondariesUsed;
+
+			const LogicalDevice* device;
+		};
+
+		/**
+		@brief A ring of frame command pools, one per frame in flight.
+
+		@details
+		Beginning a frame resets the pool of that frame with a single call, after which command buffers are acquired from it.
+		Buffers for a swapchain image (or any per frame work) are re-recorded each frame from the recycled ones,
+		so in steady state no command buffers are allocated, reset individually, or freed.
+
+		The submission of a frame must have completed before the frame is begun again (wait for its fence beforehand).
+		*/
+		class CommandBufferRing
+		{
+		public:
+
+			/**
+			@brief Default constructor.
+			*/
+			CommandBufferRing() : frameIndex(0), device(nullptr)
+			{}
+
+			/**
+			@brief Constructor with logical device specified.
+			*/
+			CommandBufferRing(const LogicalDevice& _device) : frameIndex(0), device(&_device)
+			{}
+
+			/**
+			@brief Performs a move operation to transfer ownership of the frame pools to this object.
+			*/
+			CommandBufferRing(CommandBufferRing&& _other) noexcept :
+				frames(std::move(_other.frames)), frameIndex(_other.frameIndex), device(_other.device)
+			{
+				_other.frameIndex = 0      ;
+				_other.device     = nullptr;
+			}
+
+			/**
+			@brief Provides a command buffer of the level specified from the current frame's pool.
+			*/
+			EResult Acquire(ECommandBufferLevel _level, CommandBuffer& _buffer)
+			{
+				if (frames.empty()) return EResult::Error_InitalizationFailed;
+
+				return frames[frameIndex].Acquire(_level, _buffer);
+			}
+
+			/**
+			@brief Provides a primary command buffer from the current frame's pool.
+			*/
+			EResult Acquire(CommandBuffer& _buffer)
+			{
+				if (frames.empty()) return EResult::Error_InitalizationFailed;
+
+				return frames[frameIndex].Acquire(ECommandBufferLevel::Primary, _buffer);
+			}
+
+			/**
+			@brief Makes the frame specified current and resets its pool. (The frame index wraps around the amount of frames)
+
+			@details Fails with EResult::Error_InitalizationFailed if the ring has not been created.
+			*/
+			EResult BeginFrame(ui32 _frameIndex)
+			{
+				if (frames.empty()) return EResult::Error_InitalizationFailed;
+
+				frameIndex = _frameIndex % ui32(frames.size());
+
+				return frames[frameIndex].Reset();
+			}
+
+			/**
+			@brief Create a frame command pool per frame in flight for the queue's family.
+			*/
+			EResult Create(const LogicalDevice::Queue& _queue, ui32 _frameCount)
+			{
+				if (device == nullptr) return EResult::Not_Ready;
+
+				frames.clear();
+
+				frames.reserve(_frameCount);
+
+				for (ui32 index = 0; index < _frameCount; index++)
+				{
+					frames.emplace_back(*device);
+
+					EResult returnCode = frames.back().Create(_queue);
+
+					if (returnCode != EResult::Success)
+					{
+						Destroy();
+
+						return returnCode;
+					}
+				}
+
+				frameIndex = 0;
+
+				return EResult::Success;
+			}
+
+			/**
+			@brief Create a frame command pool per frame in flight for the queue's family (logical device specified).
+			*/
+			EResult Create(const LogicalDevice& _device, const LogicalDevice::Queue& _queue, ui32 _frameCount)
+			{
+				device = &_device;
+
+				return Create(_queue, _frameCount);
+			}
+
+			/**
+			@brief Destroys the pools of every frame. (Their command buffers must no longer be pending execution)
+			*/
+			void Destroy()
+			{
+				for (FrameCommandPool& frame : frames) frame.Destroy();
+
+				frames.clear();
+
+				frameIndex = 0;
+			}
+
+			ui32 GetFrameCount() const
+			{
+				return ui32(frames.size());
+			}
+
+			ui32 GetFrameIndex() const
+			{
+				return frameIndex;
+			}
+
+			/**
+			@brief Provides the pool of the current frame.
+			*/
+			FrameCommandPool& GetFramePool()
+			{
+				return frames[frameIndex];
+			}
+
+			/**
+			@brief Performs a move assignment operation to transfer ownership of the frame pools to this object.
+			*/
+			CommandBufferRing& operator= (CommandBufferRing&& _other) noexcept
+			{
+				if (this == &_other)
+					return *this;
+
+				frames     = std::move(_other.frames);
+				frameIndex = _other.frameIndex        ;
+				device     = _other.device            ;
+
+				_other.frameIndex = 0      ;
+				_other.device     = nullptr;
+
+				return *this;
+			}
+
+		protected:
+
+			DynamicArray<FrameCommandPool> frames;
+
+			ui32 frameIndex;
+
+			const LogicalDevice* device;
+		};
+
+		/**
+		@brief Records the copies of many uploads into a shared command buffer and submits them as a single batch on a transfer queue.
+
+		@details
+		Intended to replace CommandPool::BeginSingleTimeCommands / EndSingleTimeCommands for bulk uploads: 
+		nothing is allocated, freed, or waited on per copy, and submissions never idle the queue.
+
+		Each submitted batch signals its own fence and is identified by a ticket. Tickets are handed out in submission order,
+		so a batch (and every batch before it) has completed once its ticket is less than or equal to the completed ticket.
+		The tickets can be used directly as the frame values of an UploadRing used as the copy source.
+
+		Command buffers and fences of completed batches are recycled, so steady state use does not create any device objects.
+
+		Ideally the queue provided is from a family matching QueueMask::TransferOnly. If the resources are used by queues of another family,
+		they must either be created with concurrent sharing or have ownership transfer barriers recorded (See GetCommandBuffer).
+
+		Like the command pool it owns, the batcher is externally synchronized.
+		*/
+		class TransferBatcher
+		{
+		public:
+
+			/**
+			@brief Identifies a submitted batch.
+			*/
+			using Ticket = u64;
+
+			/**
+			@brief Ticket that does not refer to any batch. (Is always complete)
+			*/
+			static constexpr Ticket InvalidTicket = 0;
+
+			/**
+			@brief Default constructor.
+			*/
+			TransferBatcher() : recording(false), nextTicket(1), completedTicket(InvalidTicket), queue(nullptr), device(nullptr)
+			{}
+
+			/**
+			@brief Logical device specified.
+			*/
+			TransferBatcher(const LogicalDevice& _device) : pool(_device), recording(false), nextTicket(1), completedTicket(InvalidTicket), queue(nullptr), device(&_device)
+			{}
+
+			/**
+			@brief Performs a move operation to transfer ownership of the pool and batches to this host object.
+			*/
+			TransferBatcher(TransferBatcher&& _other) noexcept :
+				pool           (std::move(_other.pool           )),
+				current        (std::move(_other.current        )),
+				inFlight       (std::move(_other.inFlight       )),
+				freeBatches    (std::move(_other.freeBatches    )),
+				recording      (std::move(_other.recording      )),
+				nextTicket     (std::move(_other.nextTicket     )),
+				completedTicket(std::move(_other.completedTicket)),
+				queue          (std::move(_other.queue          )),
+				device         (std::move(_other.device         ))
+			{
+				_other.recording = false  ;
+				_other.queue     = nullptr;
+				_other.device    = nullptr;
+			}
+
+			/**
+			@brief Waits on and releases the batches if the batcher was created.
+			*/
+			~TransferBatcher()
+			{
+				if (queue != nullptr) Destroy();
+			}
+
+			/**
+			@brief Record a buffer to buffer copy into the current batch.
+			*/
+			EResult CopyBuffer(const Buffer& _sourceBuffer, const Buffer& _destinationBuffer, ui32 _regionCount, const Buffer::CopyInfo* _regions)
+			{
+				EResult returnCode = Open();
+
+				if (returnCode != EResult::Success) return returnCode;
+
+				CommandBuffer::Parent::Parent::CopyBuffer(current.commandBuffer, _sourceBuffer, _destinationBuffer, _regionCount, _regions);
+
+				return EResult::Success;
+			}
+
+			/**
+			@brief Record a buffer to image copy into the current batch.
+			*/
+			EResult CopyBufferToImage
+			(
+				const Buffer&                           _sourceBuffer  ,
+				const Image&                            _dstImage      ,
+				      EImageLayout                      _dstImageLayout,
+				      ui32                              _regionCount   ,
+				const CommandBuffer::BufferImageRegion* _regions
+			)
+			{
+				EResult returnCode = Open();
+
+				if (returnCode != EResult::Success) return returnCode;
+
+				CommandBuffer::Parent::Parent::CopyBufferToImage(current.commandBuffer, _sourceBuffer, _dstImage, _dstImageLayout, _regionCount, _regions);
+
+				return EResult::Success;
+			}
+
+			/**
+			@brief Create the command pool for the queue's family. Batches are submitted to the queue provided.
+			*/
+			EResult Create(const LogicalDevice::Queue& _queue)
+			{
+				if (device == nullptr) return EResult::Not_Ready;
+
+				CommandPool::CreateInfo info;
+
+				info.Flags.Set(ECommandPoolCreateFlag::Transient, ECommandPoolCreateFlag::ResetCommandBuffer);
+
+				info.QueueFamilyIndex = _queue.GetFamilyIndex();
+
+				EResult returnCode = pool.Create(*device, info);
+
+				if (returnCode != EResult::Success) return returnCode;
+
+				queue = &_queue;
+
+				return EResult::Success;
+			}
+
+			/**
+			@brief Create the command pool for the queue's family (logical device specified).
+			*/
+			EResult Create(const LogicalDevice& _device, const LogicalDevice::Queue& _queue)
+			{
+				device = &_device;
+
+				return Create(_queue);
+			}
+
+			/**
+			@brief Waits for the submitted batches to complete and destroys the fences and command pool. (A batch still being recorded is discarded)
+			*/
+			void Destroy()
+			{
+				if (recording)
+				{
+					freeBatches.push_back(std::move(current));
+
+					recording = false;
+				}
+
+				WaitIdle(UINT64_MAX);
+
+				inFlight   .clear();
+				freeBatches.clear();
+
+				pool.Destroy();
+
+				queue = nullptr;
+			}
+
+			/**
+			@brief Provides the command buffer of the current batch (beginning one if none is being recorded). 
+			
+			@details Used to record commands the batcher does not wrap, such as layout transitions or queue family ownership transfers.
+			The command buffer is only valid until the next Submit call.
+			*/
+			const CommandBuffer& GetCommandBuffer(EResult& _result)
+			{
+				_result = Open();
+
+				return current.commandBuffer;
+			}
+
+			/**
+			@brief The ticket of the last batch known to have completed. (Updated by Poll)
+			*/
+			Ticket GetCompletedTicket() const
+			{
+				return completedTicket;
+			}
+
+			/**
+			@brief The ticket the next submitted batch will receive.
+			*/
+			Ticket GetPendingTicket() const
+			{
+				return nextTicket;
+			}
+
+			/**
+			@brief The ticket of the last submitted batch.
+			*/
+			Ticket GetSubmittedTicket() const
+			{
+				return nextTicket - 1;
+			}
+
+			/**
+			@brief Checks if the batch of the ticket has completed, polling the in-flight batches if it is not yet known.
+			*/
+			bool IsComplete(Ticket _ticket)
+			{
+				if (_ticket <= completedTicket) return true;
+
+				Poll();
+
+				return _ticket <= completedTicket;
+			}
+
+			/**
+			@brief Recycles every batch that has completed without blocking.
+
+			@return An error code only if a fence status query failed.
+			*/
+			EResult Poll()
+			{
+				while (!inFlight.empty())
+				{
+					EResult status = inFlight.front().fence.GetStatus();
+
+					if (status == EResult::Not_Ready) break;
+
+					if (status != EResult::Success) return status;
+
+					Retire();
+				}
+
+				return EResult::Success;
+			}
+
+			/**
+			@brief Ends the current batch and submits it to the queue. 
+			
+			@details If nothing has been recorded since the last submit, no submission is made and the last submitted ticket is provided.
+			*/
+			EResult Submit(Ticket& _ticket)
+			{
+				if (!recording) 
+				{
+					_ticket = GetSubmittedTicket();
+
+					return EResult::Success;
+				}
+
+				recording = false;
+
+				EResult returnCode = current.commandBuffer.EndRecord();
+
+				if (returnCode != EResult::Success) 
+				{
+					freeBatches.push_back(std::move(current));
+
+					return returnCode;
+				}
+
+				CommandBuffer::SubmitInfo submitInfo;
+
+				submitInfo.CommandBufferCount = 1                    ;
+				submitInfo.CommandBuffers     = current.commandBuffer;
+
+				returnCode = queue->SubmitToQueue(1, submitInfo, current.fence);
+
+				if (returnCode != EResult::Success)
+				{
+					freeBatches.push_back(std::move(current));
+
+					return returnCode;
+				}
+
+				current.ticket = nextTicket++;
+
+				_ticket = current.ticket;
+
+				inFlight.push_back(std::move(current));
+
+				return EResult::Success;
+			}
+
+			/**
+			@brief Wait on the host for the batch of the ticket (and every batch before it) to complete.
+
+			@details If the ticket belongs to the batch being recorded, the batch is submitted first.
+			*/
+			EResult Wait(Ticket _ticket, u64 _timeout)
+			{
+				if (_ticket <= completedTicket) return EResult::Success;
+
+				if (_ticket >= nextTicket)
+				{
+					if (!recording) return EResult::Success;
+
+					EResult returnCode = Submit(_ticket);
+
+					if (returnCode != EResult::Success) return returnCode;
+				}
+
+				// A fence signal covers all work previously submitted to the queue, so only the ticket's fence needs to be waited on.
+				Batch& batch = inFlight[DeviceSize(_ticket - inFlight.front().ticket)];
+
+				EResult returnCode = batch.fence.WaitFor(_timeout);
+
+				if (returnCode != EResult::Success) return returnCode;
+
+				while (!inFlight.empty() && inFlight.front().ticket <= _ticket) Retire();
+
+				return Poll();
+			}
+
+			/**
+			@brief Wait on the host for all submitted batches to complete.
+			*/
+			EResult WaitIdle(u64 _timeout)
+			{
+				if (inFlight.empty()) return EResult::Success;
+
+				return Wait(inFlight.back().ticket, _timeout);
+			}
+
+			/**
+			@brief Performs a move assignment operation to transfer ownership of the pool and batches to this host object.
+			*/
+			TransferBatcher& operator= (TransferBatcher&& _other) noexcept
+			{
+				if (this == &_other)
+					return *this;
+
+				pool            = std::move(_other.pool           );
+				current         = std::move(_other.current        );
+				inFlight        = std::move(_other.inFlight       );
+				freeBatches     = std::move(_other.freeBatches    );
+				recording       = std::move(_other.recording      );
+				nextTicket      = std::move(_other.nextTicket     );
+				completedTicket = std::move(_other.completedTicket);
+				queue           = std::move(_other.queue          );
+				device          = std::move(_other.device         );
+
+				_other.recording = false  ;
+				_other.queue     = nullptr;
+				_other.device    = nullptr;
+
+				return *this;
+			}
+
+		protected:
+
+			struct Batch
+			{
+				CommandBuffer commandBuffer;
+
+				Fence fence;
+
+				Ticket ticket = InvalidTicket;
+			};
+
+			/**
+			@brief Begins recording a batch if one is not already being recorded, reusing a completed batch when available.
+			*/
+			EResult Open()
+			{
+				if (recording) return EResult::Success;
+
+				if (queue == nullptr) return EResult::Not_Ready;
+
+				EResult returnCode;
+
+				if (freeBatches.empty())
+				{
+					current = Batch();
+
+					returnCode = pool.Allocate(current.commandBuffer);
+
+					if (returnCode != EResult::Success) return returnCode;
+
+					returnCode = current.fence.Create(*device, Fence::CreateInfo());
+
+					if (returnCode != EResult::Success) 
+					{
+						pool.Free(current.commandBuffer);
+
+						return returnCode;
+					}
+				}
+				else
+				{
+					current = std::move(freeBatches.back());
+
+					freeBatches.pop_back();
+
+					returnCode = current.fence.Reset();
+
+					if (returnCode != EResult::Success)
+					{
+						freeBatches.push_back(std::move(current));
+
+						return returnCode;
+					}
+				}
+
+				CommandBuffer::BeginInfo beginInfo;
+
+				beginInfo.Flags = ECommandBufferUsageFlag::OneTimeSubmit;
+
+				// The pool resets command buffers implicitly on begin.
+				returnCode = current.commandBuffer.BeginRecord(beginInfo);
+
+				if (returnCode != EResult::Success)
+				{
+					freeBatches.push_back(std::move(current));
+
+					return returnCode;
+				}
+
+				recording = true;
+
+				return EResult::Success;
 			}
 
 			/**
-			@brief Destroy a command pool.
+			@brief Marks the oldest in-flight batch as completed and moves it to the free list.
 			*/
-			void Destroy()
+			void Retire()
 			{
-				Parent::Destroy(*device, handle, allocator);
+				completedTicket = inFlight.front().ticket;
 
-				handle    = Null<Handle>;
-				allocator = nullptr     ;
-				device    = nullptr     ;
+				freeBatches.push_back(std::move(inFlight.front()));
+
+				inFlight.pop_front();
 			}
 
+			CommandPool pool;
+
+			Batch current;
+
+			Deque<Batch> inFlight;
+
+			DynamicArray<Batch> freeBatches;
+
+			bool recording;
+
+			Ticket nextTicket;
+
+			Ticket completedTicket;
+
+			const LogicalDevice::Queue* queue;
+
+			const LogicalDevice* device;
+		};
+
+		/**
+		@brief A monotonically increasing counter of the work submitted to a queue, backed by a timeline semaphore.
+
+		@details
+		Every submission made through the timeline signals the next value of the counter once its work completes.
+		Completed work is tracked by querying the semaphore's counter instead of keeping a fence per frame or submission,
+		and values can be waited on by the host or by submissions to other queues (See AddWait).
+
+		Resources that must outlive the work using them can be handed to a DeferredRelease keyed on the value returned by Submit.
+
+		Requires the timelineSemaphore feature (Core in Vulkan 1.2).
+		*/
+		class GPU_Timeline
+		{
+		public:
+
 			/**
-			@brief Free the command buffers based on the count and handle container provided.
+			@brief Default constructor.
 			*/
-			void Free(ui32 _bufferCount, const CommandBuffer::Handle* _commandBuffers)
+			GPU_Timeline() : submittedValue(0), completedValue(0), queue(nullptr), device(nullptr)
+			{}
+
+			/**
+			@brief Logical device specified.
+			*/
+			GPU_Timeline(const LogicalDevice& _device) : semaphore(_device), submittedValue(0), completedValue(0), queue(nullptr), device(&_device)
+			{}
+
+			/**
+			@brief Performs a move operation to transfer ownership of the semaphore to this host object.
+			*/
+			GPU_Timeline(GPU_Timeline&& _other) noexcept :
+				semaphore            (std::move(_other.semaphore            )),
+				submittedValue       (std::move(_other.submittedValue       )),
+				completedValue       (std::move(_other.completedValue       )),
+				pendingWaitSemaphores(std::move(_other.pendingWaitSemaphores)),
+				pendingWaitValues    (std::move(_other.pendingWaitValues    )),
+				pendingWaitStages    (std::move(_other.pendingWaitStages    )),
+				queue                (std::move(_other.queue                )),
+				device               (std::move(_other.device               ))
 			{
-				Parent::Free(*device, handle, _bufferCount, _commandBuffers);
+				_other.queue  = nullptr;
+				_other.device = nullptr;
 			}
 
 			/**
-			@brief Free the command buffers based on the allocate info and handle container provided.
+			@brief Add a wait on a value of another timeline to the next submission. (Used to order work across queues)
 			*/
-			void Free(const AllocateInfo& _info, const CommandBuffer::Handle* _commandBuffers)
+			void AddWait(const GPU_Timeline& _timeline, u64 _value, Pipeline::StageFlags _stages)
 			{
-				Parent::Free(*device, handle, _info.BufferCount, _commandBuffers);	
+				pendingWaitSemaphores.push_back(_timeline.GetSemaphore());
+				pendingWaitValues    .push_back(_value                  );
+				pendingWaitStages    .push_back(_stages                 );
 			}
 
 			/**
-			@brief Free a command buffer.
+			@brief Create the timeline semaphore, the queue provided is the one submissions are made to.
 			*/
-			void Free(CommandBuffer& _commandBuffer)
+			EResult Create(const LogicalDevice::Queue& _queue, u64 _initialValue = 0)
 			{
-				Parent::Free(*device, handle, 1, _commandBuffer);
+				if (device == nullptr) return EResult::Not_Ready;
+
+				Semaphore::TypeSpecifiedCreateInfo typeInfo;
+
+				typeInfo.SemaphoreType = ESemaphoreType::Timeline;
+				typeInfo.InitialValue  = _initialValue           ;
+
+				Semaphore::CreateInfo info;
+
+				info.Next = &typeInfo;
+
+				EResult returnCode = semaphore.Create(*device, info);
+
+				if (returnCode != EResult::Success) return returnCode;
+
+				submittedValue = _initialValue;
+				completedValue = _initialValue;
+
+				queue = &_queue;
+
+				return EResult::Success;
 			}
 
 			/**
-			@brief Resetting a command pool recycles all of the resources from all of the command buffers allocated from the command pool back to the command pool. 
-			All command buffers that have been allocated from the command pool are put in the initial state.
+			@brief Create the timeline semaphore (logical device specified).
 			*/
-			EResult Reset(ResetFlags _flags)
+			EResult Create(const LogicalDevice& _device, const LogicalDevice::Queue& _queue, u64 _initialValue = 0)
 			{
-				return Parent::Reset(*device, handle, _flags);
+				device = &_device;
+
+				return Create(_queue, _initialValue);
 			}
 
 			/**
-			@brief Trimming a command pool recycles unused memory from the command pool back to the system. 
-			Command buffers allocated from the pool are not affected by the command.
+			@brief Destroy the timeline semaphore. (Does not wait for the submitted work)
 			*/
-			void Trim(TrimFlags _flags)
+			void Destroy()
 			{
-				Parent::Trim(*device, handle, _flags);
+				semaphore.Destroy();
+
+				pendingWaitSemaphores.clear();
+				pendingWaitValues    .clear();
+				pendingWaitStages    .clear();
+
+				queue = nullptr;
 			}
 
-		#pragma region SingleTimeCommands
+			/**
+			@brief Query the value of the counter, updating the last known completed value.
+			*/
+			EResult GetCompletedValue(u64& _value)
+			{
+				EResult returnCode = semaphore.GetCounterValue(_value);
+
+				if (returnCode != EResult::Success) return returnCode;
+
+				completedValue = _value;
+
+				return EResult::Success;
+			}
 
 			/**
-			* @brief Will auto-allocate a command buffer on the specified pool and begin recording commands on the buffer. 
-			* 
-			* @details
-			* The handle to the command buffer will be returned.
-			* 
-			* Expected to be used with the EndSingleTimeCommands function (defined below it).
+			@brief The completed value from the last query. (Does not query the device)
 			*/
-			CommandBuffer BeginSingleTimeCommands(EResult& _result)
+			u64 GetLastCompletedValue() const
 			{
-				AllocateInfo allocationInfo;
+				return completedValue;
+			}
 
-				allocationInfo.Pool = handle;
+			/**
+			@brief The value the next submission will signal.
+			*/
+			u64 GetNextValue() const
+			{
+				return submittedValue + 1;
+			}
 
-				CommandBuffer::Handle bufferHandle;
+			const Semaphore& GetSemaphore() const
+			{
+				return semaphore;
+			}
 
-				_result = Allocate(allocationInfo, &bufferHandle);
+			/**
+			@brief The value signaled by the last submission. (Once completed, all work submitted through the timeline has completed)
+			*/
+			u64 GetSubmittedValue() const
+			{
+				return submittedValue;
+			}
 
-				if (_result != EResult::Success) return CommandBuffer();
+			/**
+			@brief Checks if the value has been reached, querying the counter only if the last known completed value is behind it.
+			*/
+			bool IsComplete(u64 _value)
+			{
+				if (_value <= completedValue) return true;
 
-				CommandBuffer::BeginInfo beginInfo;
+				u64 value;
 
-				beginInfo.Flags = ECommandBufferUsageFlag::OneTimeSubmit;
+				if (GetCompletedValue(value) != EResult::Success) return false;
 
-				_result = CommandBuffer::Parent::BeginRecord(bufferHandle, beginInfo);
+				return _value <= value;
+			}
 
-				return CommandBuffer(*device, bufferHandle);
+			/**
+			@brief Submit a batch to the queue that signals the next value of the timeline.
+
+			@details
+			The timeline semaphore and any waits added with AddWait are appended to the semaphores of the submit info provided,
+			its own semaphores are expected to be binary.
+			*/
+			EResult Submit(const CommandBuffer::SubmitInfo& _submitInfo, u64& _signaledValue)
+			{
+				return Submit(_submitInfo, Null<Fence::Handle>, _signaledValue);
 			}
 
 			/**
-			* @brief Will end the recording and submit the command buffer created with the BeginSingleTimeCommands function.
-			* 
-			* @details
-			* Will wait until the queue is idle that the commands were submitted to. Will also free the command buffer after completion.
-			* 
-			* Expected to be used with the BeginSingleTimeCommands function (defined above it).
+			@brief Submit a batch to the queue that signals the next value of the timeline and a fence. (Fence is only needed for apis that require one)
 			*/
-			EResult EndSingleTimeCommands
-			(
-				      CommandBuffer&        _commandBuffer, 
-				const LogicalDevice::Queue& _queue
-			) 
+			EResult Submit(const CommandBuffer::SubmitInfo& _submitInfo, Fence::Handle _fence, u64& _signaledValue)
 			{
-				EResult result = EResult::Incomplete;
+				if (queue == nullptr) return EResult::Not_Ready;
 
-				result = _commandBuffer.EndRecord();
+				const u64 value = submittedValue + 1;
 
-				if (result != EResult::Success) return result;
+				waitSemaphores  .assign(_submitInfo.WaitSemaphores  , _submitInfo.WaitSemaphores   + _submitInfo.WaitSemaphoreCount  );
+				waitStages      .assign(_submitInfo.WaitDstStageMask, _submitInfo.WaitDstStageMask + _submitInfo.WaitSemaphoreCount  );
+				signalSemaphores.assign(_submitInfo.SignalSemaphores, _submitInfo.SignalSemaphores + _submitInfo.SignalSemaphoreCount);
 
-				CommandBuffer::SubmitInfo submitInfo;
+				// Binary semaphore values are ignored.
+				waitValues  .assign(_submitInfo.WaitSemaphoreCount  , 0);
+				signalValues.assign(_submitInfo.SignalSemaphoreCount, 0);
 
-				submitInfo.CommandBufferCount = 1             ;
-				submitInfo.CommandBuffers     = _commandBuffer;
+				waitSemaphores.insert(waitSemaphores.end(), pendingWaitSemaphores.begin(), pendingWaitSemaphores.end());
+				waitValues    .insert(waitValues    .end(), pendingWaitValues    .begin(), pendingWaitValues    .end());
+				waitStages    .insert(waitStages    .end(), pendingWaitStages    .begin(), pendingWaitStages    .end());
 
-				result = _queue.SubmitToQueue(1, submitInfo, Null<Fence::Handle>);
+				signalSemaphores.push_back(semaphore);
+				signalValues    .push_back(value    );
 
-				if (result != EResult::Success) return result;
+				CommandBuffer::SubmitInfo::TimelineSemaphore timelineInfo;
 
-				result = _queue.WaitUntilIdle();
+				timelineInfo.Next                      = _submitInfo.Next          ;
+				timelineInfo.WaitSemaphoreValueCount   = ui32(waitValues.size())   ;
+				timelineInfo.WaitSemaphoreValues       = waitValues.data()         ;
+				timelineInfo.SignalSemaphoreValueCount = ui32(signalValues.size());
+				timelineInfo.SignalSemaphoreValues     = signalValues.data()       ;
 
-				if (result != EResult::Success) return result;
+				CommandBuffer::SubmitInfo submitInfo = _submitInfo;
 
-				Free(_commandBuffer);
+				submitInfo.Next                 = &timelineInfo                ;
+				submitInfo.WaitSemaphoreCount   = ui32(waitSemaphores.size())  ;
+				submitInfo.WaitSemaphores       = waitSemaphores.data()        ;
+				submitInfo.WaitDstStageMask     = waitStages.data()            ;
+				submitInfo.SignalSemaphoreCount = ui32(signalSemaphores.size());
+				submitInfo.SignalSemaphores     = signalSemaphores.data()      ;
 
-				return result;
+				EResult returnCode = queue->SubmitToQueue(1, submitInfo, _fence);
+
+				if (returnCode != EResult::Success) return returnCode;
+
+				pendingWaitSemaphores.clear();
+				pendingWaitValues    .clear();
+				pendingWaitStages    .clear();
+
+				submittedValue = value;
+				_signaledValue = value;
+
+				return EResult::Success;
 			}
 
 			/**
-			@brief Uses a single time command buffer to copy a buffer with the provided queue and copy info.
+			@brief Wait on the host for the timeline to reach the value.
 			*/
-			EResult CopyBuffer
-			(
-				      Buffer&               _sourceBuffer     , 
-				      Buffer&               _destinationBuffer, 
-				      Buffer::CopyInfo&     _regionInfo       ,
-				const LogicalDevice::Queue& _queue
-			) 
+			EResult Wait(u64 _value, u64 _timeout)
 			{
-				EResult result;
+				if (_value <= completedValue) return EResult::Success;
 
-				CommandBuffer commandBuffer = BeginSingleTimeCommands(result);
+				Semaphore::WaitInfo info;
 
-				if (result != EResult::Success) return result;
+				info.SemaphoreCount = 1        ;
+				info.Semaphores     = semaphore;
+				info.Values         = &_value  ;
 
-				commandBuffer.CopyBuffer(_sourceBuffer, _destinationBuffer, 1, &_regionInfo);
+				EResult returnCode = semaphore.WaitFor(info, _timeout);
 
-				result = EndSingleTimeCommands(commandBuffer, _queue);
+				if (returnCode != EResult::Success) return returnCode;
 
-				return result;
+				if (_value > completedValue) completedValue = _value;
+
+				return EResult::Success;
 			}
 
-		#pragma endregion SingleTimeCommands
+			/**
+			@brief Wait on the host for all work submitted through the timeline to complete.
+			*/
+			EResult WaitIdle(u64 _timeout)
+			{
+				return Wait(submittedValue, _timeout);
+			}
 
 			/**
-			@brief Implicit conversion to give a reference to its handle.
+			@brief Performs a move assignment operation to transfer ownership of the semaphore to this host object.
 			*/
-			operator Handle&()
+			GPU_Timeline& operator= (GPU_Timeline&& _other) noexcept
 			{
-				return handle;
+				if (this == &_other)
+					return *this;
+
+				semaphore             = std::move(_other.semaphore            );
+				submittedValue        = std::move(_other.submittedValue       );
+				completedValue        = std::move(_other.completedValue       );
+				pendingWaitSemaphores = std::move(_other.pendingWaitSemaphores);
+				pendingWaitValues     = std::move(_other.pendingWaitValues    );
+				pendingWaitStages     = std::move(_other.pendingWaitStages    );
+				queue                 = std::move(_other.queue                );
+				device                = std::move(_other.device               );
+
+				_other.queue  = nullptr;
+				_other.device = nullptr;
+
+				return *this;
 			}
 
+		protected:
+
+			Semaphore semaphore;
+
+			u64 submittedValue;
+
+			u64 completedValue;
+
+			// Waits added for the next submission.
+
+			DynamicArray<Semaphore::Handle   > pendingWaitSemaphores;
+			DynamicArray<u64                 > pendingWaitValues    ;
+			DynamicArray<Pipeline::StageFlags> pendingWaitStages    ;
+
+			// Scratch used to build submissions (Kept to avoid allocating per submit).
+
+			DynamicArray<Semaphore::Handle   > waitSemaphores  ;
+			DynamicArray<u64                 > waitValues      ;
+			DynamicArray<Pipeline::StageFlags> waitStages      ;
+			DynamicArray<Semaphore::Handle   > signalSemaphores;
+			DynamicArray<u64                 > signalValues    ;
+
+			const LogicalDevice::Queue* queue;
+
+			const LogicalDevice* device;
+		};
+
+		template<typename ObjectType>
+		/**
+		@brief Holds on to host objects until the timeline value of the last work using them has completed.
+
+		@details
+		Objects are expected to be deferred in increasing timeline value order (from the same timeline).
+		The objects can either be released (the host object's destructor destroying the device object) or reclaimed for reuse.
+		*/
+		class DeferredRelease
+		{
+		public:
+
 			/**
-			@brief Implicit conversion to give a readonly reference to its handle.
+			@brief Releases every object whose value is less than or equal to the completed value.
+			
+			@return The number of objects released.
 			*/
-			operator const Handle&() const
+			ui32 Collect(u64 _completedValue)
 			{
-				return handle;
+				ui32 count = 0;
+
+				while (!entries.empty() && entries.front().Value <= _completedValue)
+				{
+					entries.pop_front();
+
+					count++;
+				}
+
+				return count;
 			}
 
 			/**
-			@brief Implicit conversion to give a pointer to its handle.
+			@brief Release all objects regardless of their value. (Only valid once the device is idle)
 			*/
-			operator const Handle*() const
+			void Clear()
 			{
-				return &handle;
+				entries.clear();
 			}
 
 			/**
-			@brief Checks to see if its the same object by checking to see if its the same handle.
+			@brief Keep the object until the timeline reaches the value.
 			*/
-			bool operator== (const CommandPool& _other) const
+			void Defer(u64 _value, ObjectType&& _object)
 			{
-				return handle == _other.handle;
+				entries.push_back(Entry{ _value, std::move(_object) });
+			}
+
+			DeviceSize GetCount() const
+			{
+				return entries.size();
+			}
+
+			bool IsEmpty() const
+			{
+				return entries.empty();
 			}
 
 			/**
-			@brief Performs a move assignment operation to transfer ownership of the device object to this host object.
+			@brief Move out the oldest object if its value has completed, instead of releasing it.
 			*/
-			CommandPool& operator= (CommandPool&& _other) noexcept
+			bool Reclaim(u64 _completedValue, ObjectType& _object)
 			{
-				if (this == &_other)
-					return *this;
+				if (entries.empty() || entries.front().Value > _completedValue) return false;
 
-				handle    = std::move(_other.handle   );
-				allocator = std::move(_other.allocator);
-				device    = std::move(_other.device   );
+				_object = std::move(entries.front().Object);
 
-				_other.handle    = Null<Handle>            ;
-				_other.allocator = Memory::DefaultAllocator;
-				_other.device    = nullptr                 ;
+				entries.pop_front();
 
-				return *this;
+				return true;
 			}
 
 		protected:
 
-			Handle handle;
-
-			const Memory::AllocationCallbacks* allocator;
+			struct Entry
+			{
+				u64        Value ;
+				ObjectType Object;
+			};
 
-			const LogicalDevice* device;
+			Deque<Entry> entries;
 		};
 
 		/** @} */	// Vault_3
@@ -0,0 +1,1010 @@
+/*!
+@file VV_CommandStream.hpp
+
+@brief Vaulted Vulkan: Command Streams
+
+@details Contains a deferred recording of commands that is later replayed into a command buffer.
+
+Command buffer recording is immediate: every command recorded calls into the driver and requires a command buffer (and its pool) owned by the recording thread.
+A command stream instead writes the commands as a compact linear representation into host memory, without requiring a device.
+Streams can be built on any thread (one stream per thread) and replayed into a command buffer in a single loop when recording is done.
+
+<a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#commandbuffers">Specification</a>
+*/
+
+
+
+#pragma once
+
+
+
+// VV
+#include "VV_Vaults.hpp"
+#include "VV_APISpecGroups.hpp"
+#include "VV_Platform.hpp"
+#include "VV_CPP_STL.hpp"
+#include "VV_Enums.hpp"
+#include "VV_Backend.hpp"
+#include "VV_Types.hpp"
+#include "VV_Constants.hpp"
+#include "VV_Memory_Backend.hpp"
+#include "VV_PhysicalDevice.hpp"
+#include "VV_Initialization.hpp"
+#include "VV_LogicalDevice.hpp"
+#include "VV_Memory.hpp"
+#include "VV_Sampler.hpp"
+#include "VV_Resource.hpp"
+#include "VV_SyncAndCacheControl.hpp"
+#include "VV_Shaders.hpp"
+#include "VV_Pipelines.hpp"
+#include "VV_RenderPass.hpp"
+#include "VV_Command.hpp"
+
+
+
+#ifndef VV_Option__Use_Long_Namespace
+namespace VV
+#else
+namespace VaultedVulkan
+#endif
+{
+	namespace V3
+	{
+		/**
+		@addtogroup Vault_3
+		@{
+		*/
+
+		/**
+		@brief A deferred recording of commands, stored as a linear stream of records in arena allocated pages.
+
+		@details
+		Each record is a header (operation and size) followed by the command's parameters, with any arrays the command references copied inline after them.
+		Records are 8 byte aligned and never span pages, so replay is a linear walk over the pages.
+
+		Clearing the stream keeps its pages, so a stream rebuilt every frame stops allocating once it has grown to its working size.
+
+		Only handles and parameters are recorded: the objects referenced must be alive when the stream is replayed,
+		and the Next chains of recorded structures are not captured (They are replayed as nullptr).
+
+		A stream is not internally synchronized, use one stream per recording thread.
+		*/
+		class CommandStream
+		{
+		public:
+
+			/**
+			@brief Operations a record can contain.
+			*/
+			enum class EOp : ui32
+			{
+				BeginRenderPass      ,
+				BindDescriptorSets   ,
+				BindIndexBuffer      ,
+				BindPipeline         ,
+				BindVertexBuffers    ,
+				CopyBuffer           ,
+				CopyBufferToImage    ,
+				Draw                 ,
+				DrawIndexed          ,
+				EndRenderPass        ,
+				Execute              ,
+				SetScissor           ,
+				SetViewport          ,
+				SubmitPipelineBarrier
+			};
+
+			/**
+			@brief Default size of a page of records.
+			*/
+			static constexpr DeviceSize DefaultPageSize = 64 * 1024;
+
+			/**
+			@brief Default constructor.
+			*/
+			CommandStream() : pageSize(DefaultPageSize), pageIndex(0), commandCount(0)
+			{}
+
+			/**
+			@brief Page size specified.
+			*/
+			CommandStream(DeviceSize _pageSize) : pageSize(_pageSize), pageIndex(0), commandCount(0)
+			{}
+
+			/**
+			@brief Record the beginning of a render pass instance. (The clear values are copied)
+			*/
+			void BeginRenderPass(const RenderPass::BeginInfo& _info, ESubpassContents _contents)
+			{
+				Writer record = Write(EOp::BeginRenderPass, Span<Cmd_BeginRenderPass>() + Span<ClearValue>(_info.ClearValueCount));
+
+				Cmd_BeginRenderPass& command = record.Next<Cmd_BeginRenderPass>();
+
+				command.Pass            = _info.RenderPass     ;
+				command.Target          = _info.Framebuffer    ;
+				command.RenderArea      = _info.RenderArea     ;
+				command.ClearValueCount = _info.ClearValueCount;
+				command.Contents        = _contents            ;
+
+				record.Copy(_info.ClearValues, _info.ClearValueCount);
+			}
+
+			/**
+			@brief Record a bind of descriptor sets.
+			*/
+			void BindDescriptorSets
+			(
+				      EPipelineBindPoint       _bindPoint         ,
+				      Pipeline::Layout::Handle _layout            ,
+				      ui32                     _firstSet          ,
+				      ui32                     _descriptorSetCount,
+				const DescriptorSet::Handle*   _descriptorSets    ,
+				      ui32                     _dynamicOffsetCount = 0,
+				const ui32*                    _dynamicOffsets     = nullptr
+			)
+			{
+				Writer record = Write
+				(
+					EOp::BindDescriptorSets,
+					Span<Cmd_BindDescriptorSets>() + Span<DescriptorSet::Handle>(_descriptorSetCount) + Span<ui32>(_dynamicOffsetCount)
+				);
+
+				Cmd_BindDescriptorSets& command = record.Next<Cmd_BindDescriptorSets>();
+
+				command.BindPoint          = _bindPoint         ;
+				command.Layout             = _layout            ;
+				command.FirstSet           = _firstSet          ;
+				command.DescriptorSetCount = _descriptorSetCount;
+				command.DynamicOffsetCount = _dynamicOffsetCount;
+
+				record.Copy(_descriptorSets, _descriptorSetCount);
+				record.Copy(_dynamicOffsets, _dynamicOffsetCount);
+			}
+
+			/**
+			@brief Record a bind of an index buffer.
+			*/
+			void BindIndexBuffer(Buffer::Handle _buffer, DeviceSize _offset, EIndexType _indexType)
+			{
+				Writer record = Write(EOp::BindIndexBuffer, Span<Cmd_BindIndexBuffer>());
+
+				Cmd_BindIndexBuffer& command = record.Next<Cmd_BindIndexBuffer>();
+
+				command.Object    = _buffer   ;
+				command.Offset    = _offset   ;
+				command.IndexType = _indexType;
+			}
+
+			/**
+			@brief Record a bind of a pipeline.
+			*/
+			void BindPipeline(EPipelineBindPoint _bindPoint, Pipeline::Handle _pipeline)
+			{
+				Writer record = Write(EOp::BindPipeline, Span<Cmd_BindPipeline>());
+
+				Cmd_BindPipeline& command = record.Next<Cmd_BindPipeline>();
+
+				command.BindPoint = _bindPoint;
+				command.Object    = _pipeline ;
+			}
+
+			/**
+			@brief Record a bind of vertex buffers.
+			*/
+			void BindVertexBuffers(ui32 _firstBinding, ui32 _bindingCount, const Buffer::Handle* _buffers, const DeviceSize* _offsets)
+			{
+				Writer record = Write
+				(
+					EOp::BindVertexBuffers,
+					Span<Cmd_BindVertexBuffers>() + Span<Buffer::Handle>(_bindingCount) + Span<DeviceSize>(_bindingCount)
+				);
+
+				Cmd_BindVertexBuffers& command = record.Next<Cmd_BindVertexBuffers>();
+
+				command.FirstBinding = _firstBinding;
+				command.BindingCount = _bindingCount;
+
+				record.Copy(_buffers, _bindingCount);
+				record.Copy(_offsets, _bindingCount);
+			}
+
+			/**
+			@brief Record a copy between buffers.
+			*/
+			void CopyBuffer(Buffer::Handle _sourceBuffer, Buffer::Handle _destinationBuffer, ui32 _regionCount, const Buffer::CopyInfo* _regions)
+			{
+				Writer record = Write(EOp::CopyBuffer, Span<Cmd_CopyBuffer>() + Span<Buffer::CopyInfo>(_regionCount));
+
+				Cmd_CopyBuffer& command = record.Next<Cmd_CopyBuffer>();
+
+				command.Source      = _sourceBuffer     ;
+				command.Destination = _destinationBuffer;
+				command.RegionCount = _regionCount      ;
+
+				record.Copy(_regions, _regionCount);
+			}
+
+			/**
+			@brief Record a copy from a buffer to an image.
+			*/
+			void CopyBufferToImage
+			(
+				      Buffer::Handle                    _sourceBuffer  ,
+				      Image::Handle                     _dstImage      ,
+				      EImageLayout                      _dstImageLayout,
+				      ui32                              _regionCount   ,
+				const CommandBuffer::BufferImageRegion* _regions
+			)
+			{
+				Writer record = Write(EOp::CopyBufferToImage, Span<Cmd_CopyBufferToImage>() + Span<CommandBuffer::BufferImageRegion>(_regionCount));
+
+				Cmd_CopyBufferToImage& command = record.Next<Cmd_CopyBufferToImage>();
+
+				command.Source      = _sourceBuffer  ;
+				command.Destination = _dstImage      ;
+				command.Layout      = _dstImageLayout;
+				command.RegionCount = _regionCount   ;
+
+				record.Copy(_regions, _regionCount);
+			}
+
+			/**
+			@brief Record a non-indexed draw. (Same parameter order as CommandBuffer::Draw)
+			*/
+			void Draw(ui32 _firstVertex, ui32 _vertexCount, ui32 _firstInstance, ui32 _instanceCount)
+			{
+				Writer record = Write(EOp::Draw, Span<Cmd_Draw>());
+
+				Cmd_Draw& command = record.Next<Cmd_Draw>();
+
+				command.FirstVertex   = _firstVertex  ;
+				command.VertexCount   = _vertexCount  ;
+				command.FirstInstance = _firstInstance;
+				command.InstanceCount = _instanceCount;
+			}
+
+			/**
+			@brief Record an indexed draw.
+			*/
+			void DrawIndexed(ui32 _indexCount, ui32 _instanceCount, ui32 _firstIndex, si32 _vertexOffset, ui32 _firstInstance)
+			{
+				Writer record = Write(EOp::DrawIndexed, Span<Cmd_DrawIndexed>());
+
+				Cmd_DrawIndexed& command = record.Next<Cmd_DrawIndexed>();
+
+				command.IndexCount    = _indexCount   ;
+				command.InstanceCount = _instanceCount;
+				command.FirstIndex    = _firstIndex   ;
+				command.VertexOffset  = _vertexOffset ;
+				command.FirstInstance = _firstInstance;
+			}
+
+			/**
+			@brief Record the end of a render pass instance.
+			*/
+			void EndRenderPass()
+			{
+				Write(EOp::EndRenderPass, 0);
+			}
+
+			/**
+			@brief Record an execution of secondary command buffers.
+			*/
+			void Execute(ui32 _secondaryBufferCount, const CommandBuffer::Handle* _secondaryBuffers)
+			{
+				Writer record = Write(EOp::Execute, Span<Cmd_Execute>() + Span<CommandBuffer::Handle>(_secondaryBufferCount));
+
+				record.Next<Cmd_Execute>().BufferCount = _secondaryBufferCount;
+
+				record.Copy(_secondaryBuffers, _secondaryBufferCount);
+			}
+
+			/**
+			@brief Record the scissors to set.
+			*/
+			void SetScissor(ui32 _firstScissor, ui32 _scissorCount, const Rect2D* _scissors)
+			{
+				Writer record = Write(EOp::SetScissor, Span<Cmd_SetRange>() + Span<Rect2D>(_scissorCount));
+
+				Cmd_SetRange& command = record.Next<Cmd_SetRange>();
+
+				command.First = _firstScissor;
+				command.Count = _scissorCount;
+
+				record.Copy(_scissors, _scissorCount);
+			}
+
+			/**
+			@brief Record the viewports to set.
+			*/
+			void SetViewport(ui32 _firstViewport, ui32 _viewportCount, const Viewport* _viewports)
+			{
+				Writer record = Write(EOp::SetViewport, Span<Cmd_SetRange>() + Span<Viewport>(_viewportCount));
+
+				Cmd_SetRange& command = record.Next<Cmd_SetRange>();
+
+				command.First = _firstViewport;
+				command.Count = _viewportCount;
+
+				record.Copy(_viewports, _viewportCount);
+			}
+
+			/**
+			@brief Record a pipeline barrier.
+			*/
+			void SubmitPipelineBarrier
+			(
+				      Pipeline::StageFlags    _sourceStageMask         ,
+				      Pipeline::StageFlags    _destinationStageMask    ,
+				      DependencyFlags         _dependencyFlags         ,
+				      ui32                    _memoryBarrierCount      ,
+				const Memory::Barrier*        _memoryBarriers          ,
+				      ui32                    _bufferMemoryBarrierCount,
+				const Buffer::Memory_Barrier* _bufferMemoryBarriers    ,
+				      ui32                    _imageMemoryBarrierCount ,
+				const Image::Memory_Barrier*  _imageMemoryBarriers
+			)
+			{
+				Writer record = Write
+				(
+					EOp::SubmitPipelineBarrier,
+					Span<Cmd_PipelineBarrier  >()                          +
+					Span<Memory::Barrier       >(_memoryBarrierCount      ) +
+					Span<Buffer::Memory_Barrier>(_bufferMemoryBarrierCount) +
+					Span<Image::Memory_Barrier >(_imageMemoryBarrierCount )
+				);
+
+				Cmd_PipelineBarrier& command = record.Next<Cmd_PipelineBarrier>();
+
+				command.SourceStageMask          = _sourceStageMask         ;
+				command.DestinationStageMask     = _destinationStageMask    ;
+				command.Dependencies             = _dependencyFlags         ;
+				command.MemoryBarrierCount       = _memoryBarrierCount      ;
+				command.BufferMemoryBarrierCount = _bufferMemoryBarrierCount;
+				command.ImageMemoryBarrierCount  = _imageMemoryBarrierCount ;
+
+				for (Memory::Barrier&        barrier : record.Copy(_memoryBarriers      , _memoryBarrierCount      )) barrier.Next = nullptr;
+				for (Buffer::Memory_Barrier& barrier : record.Copy(_bufferMemoryBarriers, _bufferMemoryBarrierCount)) barrier.Next = nullptr;
+				for (Image::Memory_Barrier&  barrier : record.Copy(_imageMemoryBarriers , _imageMemoryBarrierCount )) barrier.Next = nullptr;
+			}
+
+			/**
+			@brief Remove all records. (The pages are kept for reuse)
+			*/
+			void Clear()
+			{
+				for (Page& page : pages) page.Used = 0;
+
+				pageIndex    = 0;
+				commandCount = 0;
+			}
+
+			/**
+			@brief Amount of commands recorded.
+			*/
+			ui32 GetCommandCount() const
+			{
+				return commandCount;
+			}
+
+			/**
+			@brief Amount of bytes used by the records.
+			*/
+			DeviceSize GetSize() const
+			{
+				DeviceSize size = 0;
+
+				for (const Page& page : pages) size += page.Used;
+
+				return size;
+			}
+
+			bool IsEmpty() const
+			{
+				return commandCount == 0;
+			}
+
+			/**
+			@brief Append the records of a serialized stream. (Only valid for data serialized by this process, handles are recorded as is)
+
+			@details The records are validated before anything is appended: their sizes must fit the data, their operations must be known,
+			and their parameters (with the arrays their counts specify) must fit the record. The handles and values of the parameters are not validated.
+
+			@return false if the data is not a sequence of whole records. (Nothing is appended)
+			*/
+			bool Load(const u8* _data, DeviceSize _size)
+			{
+				DeviceSize offset = 0;
+
+				ui32 recordCount = 0;
+
+				while (offset < _size)
+				{
+					Header header;
+
+					if (_size - offset < sizeof(Header)) return false;
+
+					memcpy(&header, _data + offset, sizeof(Header));
+
+					if (header.Size < Span<Header>() || header.Size > _size - offset || header.Size % RecordAlignment != 0) return false;
+
+					if (!FitsRecord(header.Op, _data + offset + Span<Header>(), header.Size - Span<Header>())) return false;
+
+					offset += header.Size;
+
+					recordCount++;
+				}
+
+				for (offset = 0; offset < _size; )
+				{
+					Header header;
+
+					memcpy(&header, _data + offset, sizeof(Header));
+
+					u8* destination = Reserve(header.Size);
+
+					memcpy(destination, _data + offset, header.Size);
+
+					offset += header.Size;
+				}
+
+				commandCount += recordCount;
+
+				return true;
+			}
+
+			/**
+			@brief Record the stream's commands into the command buffer.
+			*/
+			void Replay(const CommandBuffer& _commandBuffer) const
+			{
+				const CommandBuffer::Handle handle = _commandBuffer;
+
+				for (const Page& page : pages)
+				{
+					DeviceSize offset = 0;
+
+					while (offset < page.Used)
+					{
+						const Header& header = *reinterpret_cast<const Header*>(page.Data.data() + offset);
+
+						Reader record(&header + 1);
+
+						Dispatch(handle, header.Op, record);
+
+						offset += header.Size;
+					}
+				}
+			}
+
+			/**
+			@brief Write the records as one contiguous block of bytes (appended to the array provided).
+			*/
+			void Serialize(DynamicArray<u8>& _bytes) const
+			{
+				_bytes.reserve(_bytes.size() + GetSize());
+
+				for (const Page& page : pages)
+				{
+					_bytes.insert(_bytes.end(), page.Data.begin(), page.Data.begin() + page.Used);
+				}
+			}
+
+		protected:
+
+			using Commands = V1::CommandBuffer;
+
+			static constexpr DeviceSize RecordAlignment = 8;
+
+			struct Header
+			{
+				EOp  Op  ;
+				ui32 Size;   ///< Size of the record including the header.
+			};
+
+			struct Page
+			{
+				DynamicArray<u8> Data;
+
+				DeviceSize Used;
+			};
+
+			struct Cmd_BeginRenderPass
+			{
+				RenderPass ::Handle Pass           ;
+				Framebuffer::Handle Target         ;
+				Rect2D              RenderArea     ;
+				ui32                ClearValueCount;
+				ESubpassContents    Contents       ;
+			};
+
+			struct Cmd_BindDescriptorSets
+			{
+				Pipeline::Layout::Handle Layout            ;
+				EPipelineBindPoint       BindPoint         ;
+				ui32                     FirstSet          ;
+				ui32                     DescriptorSetCount;
+				ui32                     DynamicOffsetCount;
+			};
+
+			struct Cmd_BindIndexBuffer
+			{
+				Buffer::Handle Object   ;
+				DeviceSize     Offset   ;
+				EIndexType     IndexType;
+			};
+
+			struct Cmd_BindPipeline
+			{
+				Pipeline::Handle   Object   ;
+				EPipelineBindPoint BindPoint;
+			};
+
+			struct Cmd_BindVertexBuffers
+			{
+				ui32 FirstBinding;
+				ui32 BindingCount;
+			};
+
+			struct Cmd_CopyBuffer
+			{
+				Buffer::Handle Source     ;
+				Buffer::Handle Destination;
+				ui32           RegionCount;
+			};
+
+			struct Cmd_CopyBufferToImage
+			{
+				Buffer::Handle Source     ;
+				Image ::Handle Destination;
+				EImageLayout   Layout     ;
+				ui32           RegionCount;
+			};
+
+			struct Cmd_Draw
+			{
+				ui32 FirstVertex  ;
+				ui32 VertexCount  ;
+				ui32 FirstInstance;
+				ui32 InstanceCount;
+			};
+
+			struct Cmd_DrawIndexed
+			{
+				ui32 IndexCount   ;
+				ui32 InstanceCount;
+				ui32 FirstIndex   ;
+				si32 VertexOffset ;
+				ui32 FirstInstance;
+			};
+
+			struct Cmd_Execute
+			{
+				ui32 BufferCount;
+			};
+
+			struct Cmd_PipelineBarrier
+			{
+				Pipeline::StageFlags SourceStageMask         ;
+				Pipeline::StageFlags DestinationStageMask    ;
+				DependencyFlags      Dependencies            ;
+				ui32                 MemoryBarrierCount      ;
+				ui32                 BufferMemoryBarrierCount;
+				ui32                 ImageMemoryBarrierCount ;
+			};
+
+			struct Cmd_SetRange
+			{
+				ui32 First;
+				ui32 Count;
+			};
+
+			/**
+			@brief A contiguous range of the record's elements.
+			*/
+			template<typename Type>
+			struct Range
+			{
+				Type* First;
+				Type* Last ;
+
+				Type* begin() const { return First; }
+				Type* end  () const { return Last ; }
+			};
+
+			/**
+			@brief Writes the parameters and arrays of a record in order.
+			*/
+			struct Writer
+			{
+				u8* Cursor;
+
+				template<typename Type>
+				Type& Next()
+				{
+					Type* value = new (Cursor) Type();
+
+					Cursor += Span<Type>();
+
+					return *value;
+				}
+
+				template<typename Type>
+				Range<Type> Copy(const Type* _elements, ui32 _count)
+				{
+					Type* first = reinterpret_cast<Type*>(Cursor);
+
+					if (_count != 0) memcpy(first, _elements, sizeof(Type) * _count);
+
+					Cursor += Span<Type>(_count);
+
+					return Range<Type>{ first, first + _count };
+				}
+			};
+
+			/**
+			@brief Reads the parameters and arrays of a record in the order they were written.
+			*/
+			struct Reader
+			{
+				const u8* Cursor;
+
+				Reader(const void* _start) : Cursor(static_cast<const u8*>(_start))
+				{}
+
+				template<typename Type>
+				const Type& Next()
+				{
+					const Type* value = reinterpret_cast<const Type*>(Cursor);
+
+					Cursor += Span<Type>();
+
+					return *value;
+				}
+
+				template<typename Type>
+				const Type* Array(ui32 _count)
+				{
+					const Type* first = reinterpret_cast<const Type*>(Cursor);
+
+					Cursor += Span<Type>(_count);
+
+					return _count != 0 ? first : nullptr;
+				}
+			};
+
+			template<typename Type>
+			static constexpr DeviceSize Span(ui32 _count = 1)
+			{
+				return (sizeof(Type) * _count + RecordAlignment - 1) & ~(RecordAlignment - 1);
+			}
+
+			/**
+			@brief Read the fixed parameters of a record, if the record is large enough to hold them.
+			*/
+			template<typename Command>
+			static bool ReadCommand(const u8* _parameters, DeviceSize _size, Command& _command)
+			{
+				if (_size < Span<Command>()) return false;
+
+				memcpy(&_command, _parameters, sizeof(Command));
+
+				return true;
+			}
+
+			/**
+			@brief Checks that the parameters of an operation, and the arrays their counts specify, fit in the parameter size of a record.
+			(false for an unknown operation)
+			*/
+			static bool FitsRecord(EOp _op, const u8* _parameters, DeviceSize _size)
+			{
+				switch (_op)
+				{
+					case EOp::BeginRenderPass:
+					{
+						Cmd_BeginRenderPass command;
+
+						return ReadCommand(_parameters, _size, command) &&
+							Span<Cmd_BeginRenderPass>() + Span<ClearValue>(command.ClearValueCount) <= _size;
+					}
+					case EOp::BindDescriptorSets:
+					{
+						Cmd_BindDescriptorSets command;
+
+						return ReadCommand(_parameters, _size, command) &&
+							Span<Cmd_BindDescriptorSets>() + Span<DescriptorSet::Handle>(command.DescriptorSetCount) + Span<ui32>(command.DynamicOffsetCount) <= _size;
+					}
+					case EOp::BindIndexBuffer:
+					{
+						return _size >= Span<Cmd_BindIndexBuffer>();
+					}
+					case EOp::BindPipeline:
+					{
+						return _size >= Span<Cmd_BindPipeline>();
+					}
+					case EOp::BindVertexBuffers:
+					{
+						Cmd_BindVertexBuffers command;
+
+						return ReadCommand(_parameters, _size, command) &&
+							Span<Cmd_BindVertexBuffers>() + Span<Buffer::Handle>(command.BindingCount) + Span<DeviceSize>(command.BindingCount) <= _size;
+					}
+					case EOp::CopyBuffer:
+					{
+						Cmd_CopyBuffer command;
+
+						return ReadCommand(_parameters, _size, command) &&
+							Span<Cmd_CopyBuffer>() + Span<Buffer::CopyInfo>(command.RegionCount) <= _size;
+					}
+					case EOp::CopyBufferToImage:
+					{
+						Cmd_CopyBufferToImage command;
+
+						return ReadCommand(_parameters, _size, command) &&
+							Span<Cmd_CopyBufferToImage>() + Span<CommandBuffer::BufferImageRegion>(command.RegionCount) <= _size;
+					}
+					case EOp::Draw:
+					{
+						return _size >= Span<Cmd_Draw>();
+					}
+					case EOp::DrawIndexed:
+					{
+						return _size >= Span<Cmd_DrawIndexed>();
+					}
+					case EOp::EndRenderPass:
+					{
+						return true;
+					}
+					case EOp::Execute:
+					{
+						Cmd_Execute command;
+
+						return ReadCommand(_parameters, _size, command) &&
+							Span<Cmd_Execute>() + Span<CommandBuffer::Handle>(command.BufferCount) <= _size;
+					}
+					case EOp::SetScissor:
+					{
+						Cmd_SetRange command;
+
+						return ReadCommand(_parameters, _size, command) && Span<Cmd_SetRange>() + Span<Rect2D>(command.Count) <= _size;
+					}
+					case EOp::SetViewport:
+					{
+						Cmd_SetRange command;
+
+						return ReadCommand(_parameters, _size, command) && Span<Cmd_SetRange>() + Span<Viewport>(command.Count) <= _size;
+					}
+					case EOp::SubmitPipelineBarrier:
+					{
+						Cmd_PipelineBarrier command;
+
+						return ReadCommand(_parameters, _size, command) &&
+							Span<Cmd_PipelineBarrier   >()                                 +
+							Span<Memory::Barrier       >(command.MemoryBarrierCount      ) +
+							Span<Buffer::Memory_Barrier>(command.BufferMemoryBarrierCount) +
+							Span<Image::Memory_Barrier >(command.ImageMemoryBarrierCount ) <= _size;
+					}
+				}
+
+				return false;
+			}
+
+			static void Dispatch(CommandBuffer::Handle _handle, EOp _op, Reader& _record)
+			{
+				switch (_op)
+				{
+					case EOp::BeginRenderPass:
+					{
+						const Cmd_BeginRenderPass& command = _record.Next<Cmd_BeginRenderPass>();
+
+						RenderPass::BeginInfo info;
+
+						info.RenderPass      = command.Pass                                      ;
+						info.Framebuffer     = command.Target                                    ;
+						info.RenderArea      = command.RenderArea                                ;
+						info.ClearValueCount = command.ClearValueCount                           ;
+						info.ClearValues     = _record.Array<ClearValue>(command.ClearValueCount);
+
+						Commands::BeginRenderPass(_handle, info, command.Contents);
+
+						break;
+					}
+					case EOp::BindDescriptorSets:
+					{
+						const Cmd_BindDescriptorSets& command = _record.Next<Cmd_BindDescriptorSets>();
+
+						const DescriptorSet::Handle* sets    = _record.Array<DescriptorSet::Handle>(command.DescriptorSetCount);
+						const ui32*                  offsets = _record.Array<ui32                 >(command.DynamicOffsetCount);
+
+						Commands::BindDescriptorSets(_handle, command.BindPoint, command.Layout, command.FirstSet, command.DescriptorSetCount, sets, command.DynamicOffsetCount, offsets);
+
+						break;
+					}
+					case EOp::BindIndexBuffer:
+					{
+						const Cmd_BindIndexBuffer& command = _record.Next<Cmd_BindIndexBuffer>();
+
+						Commands::BindIndexBuffer(_handle, command.Object, command.Offset, command.IndexType);
+
+						break;
+					}
+					case EOp::BindPipeline:
+					{
+						const Cmd_BindPipeline& command = _record.Next<Cmd_BindPipeline>();
+
+						Commands::BindPipeline(_handle, command.BindPoint, command.Object);
+
+						break;
+					}
+					case EOp::BindVertexBuffers:
+					{
+						const Cmd_BindVertexBuffers& command = _record.Next<Cmd_BindVertexBuffers>();
+
+						const Buffer::Handle* buffers = _record.Array<Buffer::Handle>(command.BindingCount);
+						const DeviceSize*     offsets = _record.Array<DeviceSize    >(command.BindingCount);
+
+						Commands::BindVertexBuffers(_handle, command.FirstBinding, command.BindingCount, buffers, offsets);
+
+						break;
+					}
+					case EOp::CopyBuffer:
+					{
+						const Cmd_CopyBuffer& command = _record.Next<Cmd_CopyBuffer>();
+
+						Commands::CopyBuffer(_handle, command.Source, command.Destination, command.RegionCount, _record.Array<Buffer::CopyInfo>(command.RegionCount));
+
+						break;
+					}
+					case EOp::CopyBufferToImage:
+					{
+						const Cmd_CopyBufferToImage& command = _record.Next<Cmd_CopyBufferToImage>();
+
+						const CommandBuffer::BufferImageRegion* regions = _record.Array<CommandBuffer::BufferImageRegion>(command.RegionCount);
+
+						Commands::CopyBufferToImage(_handle, command.Source, command.Destination, command.Layout, command.RegionCount, regions);
+
+						break;
+					}
+					case EOp::Draw:
+					{
+						const Cmd_Draw& command = _record.Next<Cmd_Draw>();
+
+						Commands::Draw(_handle, command.FirstVertex, command.VertexCount, command.FirstInstance, command.InstanceCount);
+
+						break;
+					}
+					case EOp::DrawIndexed:
+					{
+						const Cmd_DrawIndexed& command = _record.Next<Cmd_DrawIndexed>();
+
+						Commands::DrawIndexed(_handle, command.IndexCount, command.InstanceCount, command.FirstIndex, command.VertexOffset, command.FirstInstance);
+
+						break;
+					}
+					case EOp::EndRenderPass:
+					{
+						Commands::EndRenderPass(_handle);
+
+						break;
+					}
+					case EOp::Execute:
+					{
+						const Cmd_Execute& command = _record.Next<Cmd_Execute>();
+
+						Commands::Execute(_handle, command.BufferCount, _record.Array<CommandBuffer::Handle>(command.BufferCount));
+
+						break;
+					}
+					case EOp::SetScissor:
+					{
+						const Cmd_SetRange& command = _record.Next<Cmd_SetRange>();
+
+						Commands::SetScissor(_handle, command.First, command.Count, _record.Array<Rect2D>(command.Count));
+
+						break;
+					}
+					case EOp::SetViewport:
+					{
+						const Cmd_SetRange& command = _record.Next<Cmd_SetRange>();
+
+						Commands::SetViewport(_handle, command.First, command.Count, _record.Array<Viewport>(command.Count));
+
+						break;
+					}
+					case EOp::SubmitPipelineBarrier:
+					{
+						const Cmd_PipelineBarrier& command = _record.Next<Cmd_PipelineBarrier>();
+
+						const Memory::Barrier*        memoryBarriers = _record.Array<Memory::Barrier       >(command.MemoryBarrierCount      );
+						const Buffer::Memory_Barrier* bufferBarriers = _record.Array<Buffer::Memory_Barrier>(command.BufferMemoryBarrierCount);
+						const Image::Memory_Barrier*  imageBarriers  = _record.Array<Image::Memory_Barrier >(command.ImageMemoryBarrierCount );
+
+						Commands::SubmitPipelineBarrier
+						(
+							_handle                         ,
+							command.SourceStageMask         ,
+							command.DestinationStageMask    ,
+							command.Dependencies            ,
+							command.MemoryBarrierCount      ,
+							memoryBarriers                  ,
+							command.BufferMemoryBarrierCount,
+							bufferBarriers                  ,
+							command.ImageMemoryBarrierCount ,
+							imageBarriers
+						);
+
+						break;
+					}
+				}
+			}
+
+			/**
+			@brief Reserve space for a record of the specified size (including its header) in the current page, moving to the next page if it does not fit.
+			*/
+			u8* Reserve(DeviceSize _size)
+			{
+				while (pageIndex < pages.size())
+				{
+					Page& page = pages[pageIndex];
+
+					if (page.Used + _size <= page.Data.size())
+					{
+						u8* record = page.Data.data() + page.Used;
+
+						page.Used += _size;
+
+						return record;
+					}
+
+					// Only move past pages that have records, an empty page that is too small is replaced.
+					if (page.Used == 0)
+					{
+						page.Data.resize(_size > pageSize ? _size : pageSize);
+
+						continue;
+					}
+
+					pageIndex++;
+				}
+
+				Page page;
+
+				page.Data.resize(_size > pageSize ? _size : pageSize);
+				page.Used = 0;
+
+				pages.push_back(std::move(page));
+
+				return Reserve(_size);
+			}
+
+			/**
+			@brief Reserve a record and write its header, providing a writer positioned at its parameters.
+			*/
+			Writer Write(EOp _op, DeviceSize _parameterSize)
+			{
+				const DeviceSize size = Span<Header>() + _parameterSize;
+
+				u8* record = Reserve(size);
+
+				Header& header = *reinterpret_cast<Header*>(record);
+
+				header.Op   = _op       ;
+				header.Size = ui32(size);
+
+				commandCount++;
+
+				return Writer{ record + Span<Header>() };
+			}
+
+			DeviceSize pageSize;
+
+			DynamicArray<Page> pages;
+
+			ui32 pageIndex;
+
+			ui32 commandCount;
+		};
+
+		/** @} */	// Vault_3
+	}
+}
@@ -69,6 +69,13 @@ namespace VaultedVulkan
 		*/
 		constexpr ui32 Subpass_External = VK_SUBPASS_EXTERNAL;
 
+		/**
+		@brief Used to specify the remaining range of a memory object or buffer from an offset.
+
+		@details <a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#VK_WHOLE_SIZE">Specification</a>
+		*/
+		constexpr DeviceSize WholeSize = VK_WHOLE_SIZE;
+
 		
 
 		struct InstanceExt
@@ -117,6 +124,15 @@ namespace VaultedVulkan
 			@ingroup  APISpec__Appendix-E__Layers_and_Extensions_Informative
 			*/
 			static constexpr RoCStr Swapchain = VK_KHR_SWAPCHAIN_EXTENSION_NAME;	
+
+			/**
+			@brief Provides the ability to query the device's timestamps along with host timestamps, to correlate the two time domains.
+
+			@details <a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#VK_EXT_calibrated_timestamps">Specification</a> 
+
+			@ingroup  APISpec__Appendix-E__Layers_and_Extensions_Informative
+			*/
+			static constexpr RoCStr CalibratedTimestamps = VK_EXT_CALIBRATED_TIMESTAMPS_EXTENSION_NAME;
 		};
 
 		struct Layer
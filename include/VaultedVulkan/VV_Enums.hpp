@@ -471,6 +471,14 @@ namespace VaultedVulkan
 			AccelerationStructure_NV     = VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_NV 
 		};
 
+		/** @brief <a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#VkDescriptorUpdateTemplateType">Specification</a> @ingroup APISpec_Resource_Descriptors */
+		enum class EDescriptorUpdateTemplateType : ui32
+		{
+			DescriptorSet       = VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET          ,
+			PushDescriptors_KHR = VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_PUSH_DESCRIPTORS_KHR    ,
+			DescriptorSet_KHR   = VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET_KHR
+		};
+
 		/** @brief <a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#VkDeviceDiagnosticsConfigFlagBitsNV">Specification</a> @ingroup APISpec_Devices_and_Queues */
 		enum class EDeviceDiagnosticConfigFlag : ui32
 		{
@@ -1462,6 +1470,37 @@ namespace VaultedVulkan
 			VV_SpecifyBitmaskable = VK_QUERY_PIPELINE_STATISTIC_FLAG_BITS_MAX_ENUM
 		};
 
+		/** @brief <a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#VkQueryResultFlagBits">Specification</a> @ingroup APISpec_Queries */
+		enum class EQueryResultFlag : ui32
+		{
+			_64Bit           = VK_QUERY_RESULT_64_BIT               ,
+			Wait             = VK_QUERY_RESULT_WAIT_BIT             ,
+			WithAvailability = VK_QUERY_RESULT_WITH_AVAILABILITY_BIT,
+			Partial          = VK_QUERY_RESULT_PARTIAL_BIT          ,
+
+			VV_SpecifyBitmaskable = VK_QUERY_RESULT_FLAG_BITS_MAX_ENUM
+		};
+
+		/** @brief <a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#VkQueryType">Specification</a> @ingroup APISpec_Queries */
+		enum class EQueryType : ui32
+		{
+			Occlusion          = VK_QUERY_TYPE_OCCLUSION          ,
+			PipelineStatistics = VK_QUERY_TYPE_PIPELINE_STATISTICS,
+			Timestamp          = VK_QUERY_TYPE_TIMESTAMP          ,
+
+			// Provided by VK_KHR_performance_query
+			Performance_KHR = VK_QUERY_TYPE_PERFORMANCE_QUERY_KHR
+		};
+
+		/** @brief <a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#VkTimeDomainEXT">Specification</a> @ingroup APISpec_Queries */
+		enum class ETimeDomain : ui32
+		{
+			Device                  = VK_TIME_DOMAIN_DEVICE_EXT                   ,
+			ClockMonotonic          = VK_TIME_DOMAIN_CLOCK_MONOTONIC_EXT          ,
+			ClockMonotonicRaw       = VK_TIME_DOMAIN_CLOCK_MONOTONIC_RAW_EXT      ,
+			QueryPerformanceCounter = VK_TIME_DOMAIN_QUERY_PERFORMANCE_COUNTER_EXT
+		};
+
 		/** @brief <a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#VkResolveModeFlagBits">Specification</a> @ingroup APISpec_Render_Pass */
 		enum class EResolveModeFlags : ui32
 		{
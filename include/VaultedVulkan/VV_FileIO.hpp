@@ -0,0 +1,331 @@
+/*!
+@file VV_FileIO.hpp
+
+@brief Vaulted Vulkan: File IO
+
+@details Contains the platform file operations used by the library to persist data across runs (pipeline caches, shader binaries).
+
+Files are read through a read-only memory mapping so that large blobs can be handed to the API without being copied into an intermediate buffer,
+and are written to a temporary file that then replaces the destination, so that a reader never observes a partially written file.
+*/
+
+
+
+#pragma once
+
+
+
+// VV
+#include "VV_Vaults.hpp"
+#include "VV_APISpecGroups.hpp"
+#include "VV_Platform.hpp"
+#include "VV_CPP_STL.hpp"
+
+
+
+#ifdef _WIN32
+
+	#ifndef NOMINMAX
+	#define NOMINMAX
+	#endif
+
+	#include <windows.h>
+
+#else
+
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+
+#endif
+
+#include <cstdio>
+#include <string>
+
+
+
+#ifndef VV_Option__Use_Long_Namespace
+namespace VV
+#else
+namespace VaultedVulkan
+#endif
+{
+	namespace V0
+	{
+		/**
+		@addtogroup Vault_0
+		@{
+		*/
+
+		/**
+		@brief A read-only memory mapping of an entire file.
+
+		@details The mapping is released when the object is destroyed, any pointer to its data must not outlive it.
+		An empty file maps successfully with no data.
+		*/
+		class MappedFile
+		{
+		public:
+
+			/**
+			@brief Default constructor.
+			*/
+			MappedFile() : data(nullptr), size(0)
+			{}
+
+			/**
+			@brief Performs a move operation to transfer ownership of the mapping to this object.
+			*/
+			MappedFile(MappedFile&& _other) noexcept : data(_other.data), size(_other.size)
+			{
+				_other.data = nullptr;
+				_other.size = 0      ;
+			}
+
+			MappedFile(const MappedFile&) = delete;
+
+			MappedFile& operator= (const MappedFile&) = delete;
+
+			/**
+			@brief Unmaps the file if mapped.
+			*/
+			~MappedFile()
+			{
+				Close();
+			}
+
+			/**
+			@brief Unmaps the file.
+			*/
+			void Close()
+			{
+				if (data != nullptr)
+				{
+				#ifdef _WIN32
+
+					UnmapViewOfFile(data);
+
+				#else
+
+					munmap(const_cast<u8*>(data), size);
+
+				#endif
+				}
+
+				data = nullptr;
+				size = 0      ;
+			}
+
+			/**
+			@brief Provides the contents of the file. (nullptr if not open or empty)
+			*/
+			const u8* GetData() const
+			{
+				return data;
+			}
+
+			/**
+			@brief Provides the size of the file in bytes.
+			*/
+			std::size_t GetSize() const
+			{
+				return size;
+			}
+
+			/**
+			@brief Maps the file at the path specified. Returns false if the file could not be opened or mapped.
+			*/
+			bool Open(RoCStr _path)
+			{
+				Close();
+
+			#ifdef _WIN32
+
+				HANDLE file = CreateFileA(_path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+				if (file == INVALID_HANDLE_VALUE) return false;
+
+				LARGE_INTEGER fileSize;
+
+				if (!GetFileSizeEx(file, &fileSize))
+				{
+					CloseHandle(file);
+
+					return false;
+				}
+
+				if (fileSize.QuadPart == 0)
+				{
+					CloseHandle(file);
+
+					return true;
+				}
+
+				HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+				CloseHandle(file);
+
+				if (mapping == nullptr) return false;
+
+				void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+
+				// The view keeps the mapping alive.
+				CloseHandle(mapping);
+
+				if (view == nullptr) return false;
+
+				data = static_cast<const u8*>(view);
+				size = std::size_t(fileSize.QuadPart);
+
+			#else
+
+				int file = open(_path, O_RDONLY);
+
+				if (file < 0) return false;
+
+				struct stat status;
+
+				if (fstat(file, &status) != 0)
+				{
+					close(file);
+
+					return false;
+				}
+
+				if (status.st_size == 0)
+				{
+					close(file);
+
+					return true;
+				}
+
+				void* view = mmap(nullptr, std::size_t(status.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+
+				// The mapping keeps the file referenced.
+				close(file);
+
+				if (view == MAP_FAILED) return false;
+
+				data = static_cast<const u8*>(view);
+				size = std::size_t(status.st_size);
+
+			#endif
+
+				return true;
+			}
+
+			/**
+			@brief Performs a move assignment operation to transfer ownership of the mapping to this object.
+			*/
+			MappedFile& operator= (MappedFile&& _other) noexcept
+			{
+				if (this == &_other)
+					return *this;
+
+				Close();
+
+				data = _other.data;
+				size = _other.size;
+
+				_other.data = nullptr;
+				_other.size = 0      ;
+
+				return *this;
+			}
+
+		protected:
+
+			const u8* data;
+
+			std::size_t size;
+		};
+
+		/**
+		@brief Provides a path next to the one specified that no other writer (in this process or another) is using.
+
+		@details The name is made unique by the process id and a per process counter, so concurrent writes to the same destination never share a temporary file.
+		*/
+		inline std::string MakeTemporaryPath(RoCStr _path)
+		{
+			static std::atomic<u64> counter { 0 };
+
+		#ifdef _WIN32
+
+			const u64 processID = GetCurrentProcessId();
+
+		#else
+
+			const u64 processID = u64(getpid());
+
+		#endif
+
+			return std::string(_path) + "." + std::to_string(processID) + "." + std::to_string(counter.fetch_add(1)) + ".tmp";
+		}
+
+		/**
+		@brief Writes the blocks to a temporary file next to the path specified, then replaces the file at the path with it.
+
+		@details
+		The replacement is atomic on both platforms: readers either see the previous file or the complete new one.
+		Concurrent writers each use their own temporary file, the last replacement wins.
+		Returns false if any step failed (The destination is left untouched in that case).
+		*/
+		inline bool WriteFileAtomic(RoCStr _path, ui32 _blockCount, const void* const* _blocks, const std::size_t* _blockSizes)
+		{
+			const std::string temporaryPath = MakeTemporaryPath(_path);
+
+			FILE* file = std::fopen(temporaryPath.c_str(), "wb");
+
+			if (file == nullptr) return false;
+
+			bool written = true;
+
+			for (ui32 index = 0; index < _blockCount && written; index++)
+			{
+				written = std::fwrite(_blocks[index], 1, _blockSizes[index], file) == _blockSizes[index];
+			}
+
+			written = std::fflush(file) == 0 && written;
+
+		#ifndef _WIN32
+
+			// Make sure the contents reach the disk before the rename does.
+			written = written && fsync(fileno(file)) == 0;
+
+		#endif
+
+			written = std::fclose(file) == 0 && written;
+
+			if (!written)
+			{
+				std::remove(temporaryPath.c_str());
+
+				return false;
+			}
+
+		#ifdef _WIN32
+
+			const bool replaced = MoveFileExA(temporaryPath.c_str(), _path, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+
+		#else
+
+			const bool replaced = std::rename(temporaryPath.c_str(), _path) == 0;
+
+		#endif
+
+			if (!replaced) std::remove(temporaryPath.c_str());
+
+			return replaced;
+		}
+
+		/** @} */
+	}
+
+	namespace Corridors
+	{
+		using V0::MakeTemporaryPath;
+		using V0::MappedFile       ;
+		using V0::WriteFileAtomic  ;
+	}
+}
@@ -0,0 +1,871 @@
+/*!
+@file VV_Instrumentation.hpp
+
+@brief Vaulted Vulkan: Instrumentation
+
+@details Host side call instrumentation of the Vulkan API procedures called by the vaults.
+
+Only active when VV_Option__Instrument_Calls is defined, otherwise this file defines nothing and the vaults call the API directly.
+
+When it is, every API procedure the vaults call resolves (by unqualified lookup) to a wrapper defined here.
+The wrapper times the call and records it into the calling thread's counters: a call count, the total time spent,
+and a histogram of the call latencies (power of two buckets in nanoseconds).
+
+Each thread only writes to its own counters (no locks or read-modify-write operations on the call path).
+The registry lock is only taken when a thread makes its first call and when the counters are collected or reset.
+An observer may also be set to receive each call as it completes. (ex: the trace sink, see VV_Trace.hpp)
+When VV_Option__Capture_Calls is defined, the wrappers of the procedures captured call them through the capture. (See VV_Capture.hpp)
+
+Since every V1 function is a direct call of its API procedure, the statistics are reported per API procedure.
+Calls made through V2/V3 are counted against the procedures their V1 functions call.
+*/
+
+
+
+#pragma once
+
+
+
+// VV
+#include "VV_Vaults.hpp"
+#include "VV_APISpecGroups.hpp"
+#include "VV_Platform.hpp"
+#include "VV_CPP_STL.hpp"
+#include "VV_Capture.hpp"
+
+
+
+#ifdef VV_Option__Instrument_Calls
+
+#ifndef VV_Option__Use_Long_Namespace
+namespace VV
+#else
+namespace VaultedVulkan
+#endif
+{
+	namespace Instrumentation
+	{
+		/**
+		@addtogroup Instrumentation
+		@{
+		*/
+
+		/**
+		@brief The instrumented API procedures.
+		*/
+		enum class ECall : ui32
+		{
+			vkAcquireNextImageKHR,
+			vkAllocateCommandBuffers,
+			vkAllocateDescriptorSets,
+			vkAllocateMemory,
+			vkBeginCommandBuffer,
+			vkBindBufferMemory,
+			vkBindImageMemory,
+			vkCmdBeginQuery,
+			vkCmdBeginRenderPass,
+			vkCmdBindDescriptorSets,
+			vkCmdBindIndexBuffer,
+			vkCmdBindPipeline,
+			vkCmdBindVertexBuffers,
+			vkCmdBlitImage,
+			vkCmdCopyBuffer,
+			vkCmdCopyBufferToImage,
+			vkCmdCopyQueryPoolResults,
+			vkCmdDraw,
+			vkCmdDrawIndexed,
+			vkCmdEndQuery,
+			vkCmdEndRenderPass,
+			vkCmdExecuteCommands,
+			vkCmdPipelineBarrier,
+			vkCmdPushConstants,
+			vkCmdResetEvent,
+			vkCmdResetQueryPool,
+			vkCmdSetDeviceMask,
+			vkCmdSetEvent,
+			vkCmdSetScissor,
+			vkCmdSetViewport,
+			vkCmdWaitEvents,
+			vkCmdWriteTimestamp,
+			vkCreateBuffer,
+			vkCreateBufferView,
+			vkCreateCommandPool,
+			vkCreateComputePipelines,
+			vkCreateDescriptorPool,
+			vkCreateDescriptorSetLayout,
+			vkCreateDescriptorUpdateTemplate,
+			vkCreateDevice,
+			vkCreateEvent,
+			vkCreateFence,
+			vkCreateFramebuffer,
+			vkCreateGraphicsPipelines,
+			vkCreateImage,
+			vkCreateImageView,
+			vkCreateInstance,
+			vkCreatePipelineCache,
+			vkCreatePipelineLayout,
+			vkCreateQueryPool,
+			vkCreateRenderPass,
+			vkCreateSampler,
+			vkCreateSemaphore,
+			vkCreateShaderModule,
+			vkCreateSwapchainKHR,
+			vkCreateWin32SurfaceKHR,
+			vkDestroyBuffer,
+			vkDestroyBufferView,
+			vkDestroyCommandPool,
+			vkDestroyDescriptorPool,
+			vkDestroyDescriptorSetLayout,
+			vkDestroyDescriptorUpdateTemplate,
+			vkDestroyDevice,
+			vkDestroyEvent,
+			vkDestroyFence,
+			vkDestroyFramebuffer,
+			vkDestroyImage,
+			vkDestroyImageView,
+			vkDestroyInstance,
+			vkDestroyPipeline,
+			vkDestroyPipelineCache,
+			vkDestroyPipelineLayout,
+			vkDestroyQueryPool,
+			vkDestroyRenderPass,
+			vkDestroySampler,
+			vkDestroySemaphore,
+			vkDestroyShaderModule,
+			vkDestroySurfaceKHR,
+			vkDestroySwapchainKHR,
+			vkDeviceWaitIdle,
+			vkEndCommandBuffer,
+			vkEnumerateDeviceExtensionProperties,
+			vkEnumerateInstanceExtensionProperties,
+			vkEnumerateInstanceLayerProperties,
+			vkEnumerateInstanceVersion,
+			vkEnumeratePhysicalDeviceGroups,
+			vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR,
+			vkEnumeratePhysicalDevices,
+			vkFlushMappedMemoryRanges,
+			vkFreeCommandBuffers,
+			vkFreeDescriptorSets,
+			vkFreeMemory,
+			vkGetBufferMemoryRequirements,
+			vkGetDescriptorSetLayoutSupport,
+			vkGetDeviceProcAddr,
+			vkGetDeviceQueue,
+			vkGetDeviceQueue2,
+			vkGetEventStatus,
+			vkGetFenceFdKHR,
+			vkGetFenceStatus,
+			vkGetFenceWin32HandleKHR,
+			vkGetImageMemoryRequirements,
+			vkGetImageSubresourceLayout,
+			vkGetInstanceProcAddr,
+			vkGetPhysicalDeviceFeatures,
+			vkGetPhysicalDeviceFormatProperties,
+			vkGetPhysicalDeviceMemoryProperties,
+			vkGetPhysicalDeviceProperties,
+			vkGetPhysicalDeviceProperties2,
+			vkGetPhysicalDeviceQueueFamilyProperties,
+			vkGetPhysicalDeviceQueueFamilyProperties2,
+			vkGetPhysicalDeviceSurfaceCapabilitiesKHR,
+			vkGetPhysicalDeviceSurfaceFormatsKHR,
+			vkGetPhysicalDeviceSurfacePresentModesKHR,
+			vkGetPhysicalDeviceSurfaceSupportKHR,
+			vkGetPipelineCacheData,
+			vkGetQueryPoolResults,
+			vkGetSemaphoreCounterValue,
+			vkGetSemaphoreFdKHR,
+			vkGetSemaphoreWin32HandleKHR,
+			vkGetSwapchainImagesKHR,
+			vkGetSwapchainStatusKHR,
+			vkImportFenceFdKHR,
+			vkImportFenceWin32HandleKHR,
+			vkImportSemaphoreFdKHR,
+			vkImportSemaphoreWin32HandleKHR,
+			vkInvalidateMappedMemoryRanges,
+			vkMapMemory,
+			vkMergePipelineCaches,
+			vkQueuePresentKHR,
+			vkQueueSubmit,
+			vkQueueWaitIdle,
+			vkRegisterDeviceEventEXT,
+			vkRegisterDisplayEventEXT,
+			vkResetCommandBuffer,
+			vkResetCommandPool,
+			vkResetDescriptorPool,
+			vkResetEvent,
+			vkResetFences,
+			vkResetQueryPool,
+			vkSetEvent,
+			vkSignalSemaphore,
+			vkTrimCommandPool,
+			vkUnmapMemory,
+			vkUpdateDescriptorSetWithTemplate,
+			vkUpdateDescriptorSets,
+			vkWaitForFences,
+			vkWaitSemaphores,
+
+			Count
+		};
+
+		constexpr ui32 CallCount        = ui32(ECall::Count);
+		constexpr ui32 HistogramBuckets = 32;   ///< Bucket N holds the calls that took [2^N, 2^(N+1)) nanoseconds. (The last bucket holds everything above)
+
+		/**
+		@brief Provides the name of the API procedure.
+		*/
+		inline RoCStr GetCallName(ECall _call)
+		{
+			static constexpr RoCStr Names[CallCount] =
+			{
+				"vkAcquireNextImageKHR",
+				"vkAllocateCommandBuffers",
+				"vkAllocateDescriptorSets",
+				"vkAllocateMemory",
+				"vkBeginCommandBuffer",
+				"vkBindBufferMemory",
+				"vkBindImageMemory",
+				"vkCmdBeginQuery",
+				"vkCmdBeginRenderPass",
+				"vkCmdBindDescriptorSets",
+				"vkCmdBindIndexBuffer",
+				"vkCmdBindPipeline",
+				"vkCmdBindVertexBuffers",
+				"vkCmdBlitImage",
+				"vkCmdCopyBuffer",
+				"vkCmdCopyBufferToImage",
+				"vkCmdCopyQueryPoolResults",
+				"vkCmdDraw",
+				"vkCmdDrawIndexed",
+				"vkCmdEndQuery",
+				"vkCmdEndRenderPass",
+				"vkCmdExecuteCommands",
+				"vkCmdPipelineBarrier",
+				"vkCmdPushConstants",
+				"vkCmdResetEvent",
+				"vkCmdResetQueryPool",
+				"vkCmdSetDeviceMask",
+				"vkCmdSetEvent",
+				"vkCmdSetScissor",
+				"vkCmdSetViewport",
+				"vkCmdWaitEvents",
+				"vkCmdWriteTimestamp",
+				"vkCreateBuffer",
+				"vkCreateBufferView",
+				"vkCreateCommandPool",
+				"vkCreateComputePipelines",
+				"vkCreateDescriptorPool",
+				"vkCreateDescriptorSetLayout",
+				"vkCreateDescriptorUpdateTemplate",
+				"vkCreateDevice",
+				"vkCreateEvent",
+				"vkCreateFence",
+				"vkCreateFramebuffer",
+				"vkCreateGraphicsPipelines",
+				"vkCreateImage",
+				"vkCreateImageView",
+				"vkCreateInstance",
+				"vkCreatePipelineCache",
+				"vkCreatePipelineLayout",
+				"vkCreateQueryPool",
+				"vkCreateRenderPass",
+				"vkCreateSampler",
+				"vkCreateSemaphore",
+				"vkCreateShaderModule",
+				"vkCreateSwapchainKHR",
+				"vkCreateWin32SurfaceKHR",
+				"vkDestroyBuffer",
+				"vkDestroyBufferView",
+				"vkDestroyCommandPool",
+				"vkDestroyDescriptorPool",
+				"vkDestroyDescriptorSetLayout",
+				"vkDestroyDescriptorUpdateTemplate",
+				"vkDestroyDevice",
+				"vkDestroyEvent",
+				"vkDestroyFence",
+				"vkDestroyFramebuffer",
+				"vkDestroyImage",
+				"vkDestroyImageView",
+				"vkDestroyInstance",
+				"vkDestroyPipeline",
+				"vkDestroyPipelineCache",
+				"vkDestroyPipelineLayout",
+				"vkDestroyQueryPool",
+				"vkDestroyRenderPass",
+				"vkDestroySampler",
+				"vkDestroySemaphore",
+				"vkDestroyShaderModule",
+				"vkDestroySurfaceKHR",
+				"vkDestroySwapchainKHR",
+				"vkDeviceWaitIdle",
+				"vkEndCommandBuffer",
+				"vkEnumerateDeviceExtensionProperties",
+				"vkEnumerateInstanceExtensionProperties",
+				"vkEnumerateInstanceLayerProperties",
+				"vkEnumerateInstanceVersion",
+				"vkEnumeratePhysicalDeviceGroups",
+				"vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR",
+				"vkEnumeratePhysicalDevices",
+				"vkFlushMappedMemoryRanges",
+				"vkFreeCommandBuffers",
+				"vkFreeDescriptorSets",
+				"vkFreeMemory",
+				"vkGetBufferMemoryRequirements",
+				"vkGetDescriptorSetLayoutSupport",
+				"vkGetDeviceProcAddr",
+				"vkGetDeviceQueue",
+				"vkGetDeviceQueue2",
+				"vkGetEventStatus",
+				"vkGetFenceFdKHR",
+				"vkGetFenceStatus",
+				"vkGetFenceWin32HandleKHR",
+				"vkGetImageMemoryRequirements",
+				"vkGetImageSubresourceLayout",
+				"vkGetInstanceProcAddr",
+				"vkGetPhysicalDeviceFeatures",
+				"vkGetPhysicalDeviceFormatProperties",
+				"vkGetPhysicalDeviceMemoryProperties",
+				"vkGetPhysicalDeviceProperties",
+				"vkGetPhysicalDeviceProperties2",
+				"vkGetPhysicalDeviceQueueFamilyProperties",
+				"vkGetPhysicalDeviceQueueFamilyProperties2",
+				"vkGetPhysicalDeviceSurfaceCapabilitiesKHR",
+				"vkGetPhysicalDeviceSurfaceFormatsKHR",
+				"vkGetPhysicalDeviceSurfacePresentModesKHR",
+				"vkGetPhysicalDeviceSurfaceSupportKHR",
+				"vkGetPipelineCacheData",
+				"vkGetQueryPoolResults",
+				"vkGetSemaphoreCounterValue",
+				"vkGetSemaphoreFdKHR",
+				"vkGetSemaphoreWin32HandleKHR",
+				"vkGetSwapchainImagesKHR",
+				"vkGetSwapchainStatusKHR",
+				"vkImportFenceFdKHR",
+				"vkImportFenceWin32HandleKHR",
+				"vkImportSemaphoreFdKHR",
+				"vkImportSemaphoreWin32HandleKHR",
+				"vkInvalidateMappedMemoryRanges",
+				"vkMapMemory",
+				"vkMergePipelineCaches",
+				"vkQueuePresentKHR",
+				"vkQueueSubmit",
+				"vkQueueWaitIdle",
+				"vkRegisterDeviceEventEXT",
+				"vkRegisterDisplayEventEXT",
+				"vkResetCommandBuffer",
+				"vkResetCommandPool",
+				"vkResetDescriptorPool",
+				"vkResetEvent",
+				"vkResetFences",
+				"vkResetQueryPool",
+				"vkSetEvent",
+				"vkSignalSemaphore",
+				"vkTrimCommandPool",
+				"vkUnmapMemory",
+				"vkUpdateDescriptorSetWithTemplate",
+				"vkUpdateDescriptorSets",
+				"vkWaitForFences",
+				"vkWaitSemaphores",
+			};
+
+			return _call < ECall::Count ? Names[ui32(_call)] : "Unknown";
+		}
+
+		/**
+		@brief The statistics collected for an API procedure.
+		*/
+		struct CallStatistics
+		{
+			u64 Count                        = 0;
+			u64 TotalNanoseconds             = 0;
+			u64 Histogram[HistogramBuckets] {};
+
+			/**
+			@brief Provides the average latency of a call in nanoseconds.
+			*/
+			f64 GetAverageNanoseconds() const
+			{
+				return Count != 0 ? f64(TotalNanoseconds) / f64(Count) : 0.0;
+			}
+
+			/**
+			@brief Provides an upper bound of the latency at the percentile given. (0.0 - 1.0, bounded to the histogram's bucket)
+			*/
+			u64 GetPercentileNanoseconds(f64 _percentile) const
+			{
+				if (Count == 0) return 0;
+
+				u64 target = u64(f64(Count) * _percentile), accumulated = 0;
+
+				for (ui32 bucket = 0; bucket < HistogramBuckets; bucket++)
+				{
+					accumulated += Histogram[bucket];
+
+					if (accumulated > target || accumulated == Count)
+						return (u64(2) << bucket) - 1;
+				}
+
+				return (u64(2) << (HistogramBuckets - 1)) - 1;
+			}
+		};
+
+		/**
+		@brief The counters of an API procedure, written only by the thread that owns them.
+		*/
+		struct CallCounters
+		{
+			std::atomic<u64> Count                        { 0 };
+			std::atomic<u64> TotalNanoseconds             { 0 };
+			std::atomic<u64> Histogram[HistogramBuckets] {};
+		};
+
+		/**
+		@brief The counters of a thread.
+		*/
+		struct ThreadCounters
+		{
+			CallCounters Calls[CallCount];
+			bool         InUse = false;
+		};
+
+		/**
+		@brief Keeps the counters of every thread that has made a call.
+
+		@details Counters of threads that have exited are kept (and given to the next new thread) so that their calls stay in the totals.
+		*/
+		class Registry
+		{
+		public:
+
+			/**
+			@brief Provides the counters for a thread to write to.
+			*/
+			ThreadCounters* Acquire()
+			{
+				std::lock_guard<std::mutex> guard(lock);
+
+				for (ThreadCounters& counters : threads)
+				{
+					if (! counters.InUse)
+					{
+						counters.InUse = true;
+
+						return &counters;
+					}
+				}
+
+				ThreadCounters& counters = threads.emplace_back();
+
+				counters.InUse = true;
+
+				return &counters;
+			}
+
+			/**
+			@brief Sums the counters of every thread. (Since the last reset)
+			*/
+			DynamicArray<CallStatistics> Collect()
+			{
+				std::lock_guard<std::mutex> guard(lock);
+
+				DynamicArray<CallStatistics> statistics(CallCount);
+
+				Sum(statistics);
+
+				if (baseline.empty()) return statistics;
+
+				for (ui32 call = 0; call < CallCount; call++)
+				{
+					statistics[call].Count            -= baseline[call].Count;
+					statistics[call].TotalNanoseconds -= baseline[call].TotalNanoseconds;
+
+					for (ui32 bucket = 0; bucket < HistogramBuckets; bucket++)
+						statistics[call].Histogram[bucket] -= baseline[call].Histogram[bucket];
+				}
+
+				return statistics;
+			}
+
+			/**
+			@brief Returns a thread's counters to the registry.
+			*/
+			void Release(ThreadCounters* _counters)
+			{
+				std::lock_guard<std::mutex> guard(lock);
+
+				_counters->InUse = false;
+			}
+
+			/**
+			@brief Starts the statistics over.
+
+			@details The counters are only written by their threads, so they are not cleared:
+			their current values become the baseline subtracted by collection.
+			*/
+			void Reset()
+			{
+				std::lock_guard<std::mutex> guard(lock);
+
+				baseline.assign(CallCount, CallStatistics());
+
+				Sum(baseline);
+			}
+
+		protected:
+
+			void Sum(DynamicArray<CallStatistics>& _statistics) const
+			{
+				for (const ThreadCounters& counters : threads)
+				{
+					for (ui32 call = 0; call < CallCount; call++)
+					{
+						const CallCounters& source = counters.Calls[call];
+
+						_statistics[call].Count            += source.Count           .load(std::memory_order_relaxed);
+						_statistics[call].TotalNanoseconds += source.TotalNanoseconds.load(std::memory_order_relaxed);
+
+						for (ui32 bucket = 0; bucket < HistogramBuckets; bucket++)
+							_statistics[call].Histogram[bucket] += source.Histogram[bucket].load(std::memory_order_relaxed);
+					}
+				}
+			}
+
+			std::mutex                   lock    ;
+			Deque<ThreadCounters>        threads ;
+			DynamicArray<CallStatistics> baseline;
+		};
+
+		inline Registry& GetRegistry()
+		{
+			static Registry registry;
+
+			return registry;
+		}
+
+		/**
+		@brief Provides the calling thread's counters.
+		*/
+		inline ThreadCounters& GetThreadCounters()
+		{
+			struct ThreadSlot
+			{
+				ThreadCounters* Counters = GetRegistry().Acquire();
+
+				~ThreadSlot() { GetRegistry().Release(Counters); }
+			};
+
+			thread_local ThreadSlot slot;
+
+			return *slot.Counters;
+		}
+
+		/**
+		@brief Sums the statistics of every thread, indexed by ECall.
+		*/
+		inline DynamicArray<CallStatistics> Collect()
+		{
+			return GetRegistry().Collect();
+		}
+
+		/**
+		@brief Starts the statistics over.
+		*/
+		inline void Reset()
+		{
+			GetRegistry().Reset();
+		}
+
+		/**
+		@brief Records a call into the calling thread's counters.
+		*/
+		inline void Record(ECall _call, u64 _nanoseconds)
+		{
+			CallCounters& counters = GetThreadCounters().Calls[ui32(_call)];
+
+			ui32 bucket = 0;
+
+			for (u64 remaining = _nanoseconds >> 1; remaining != 0 && bucket < HistogramBuckets - 1; remaining >>= 1)
+				bucket++;
+
+			// Only this thread writes to its counters.
+			counters.Count           .store(counters.Count           .load(std::memory_order_relaxed) + 1           , std::memory_order_relaxed);
+			counters.TotalNanoseconds.store(counters.TotalNanoseconds.load(std::memory_order_relaxed) + _nanoseconds, std::memory_order_relaxed);
+
+			counters.Histogram[bucket].store(counters.Histogram[bucket].load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+		}
+
+		/**
+		@brief Receives every instrumented call as it completes. (Start and end in nanoseconds since the steady clock's epoch)
+
+		@details Called on the thread that made the call, so it must be thread safe.
+		*/
+		using CallObserver = void(*)(ECall _call, u64 _start, u64 _end);
+
+		inline std::atomic<CallObserver> Observer { nullptr };
+
+		/**
+		@brief Set the observer of the calls. (nullptr to remove it)
+
+		@details Calls in progress may still reach the previous observer shortly after it is removed.
+		*/
+		inline void SetCallObserver(CallObserver _observer)
+		{
+			Observer.store(_observer, std::memory_order_release);
+		}
+
+		/**
+		@brief Times a call for the duration of its scope.
+		*/
+		class CallTimer
+		{
+		public:
+
+			using Clock = std::chrono::steady_clock;
+
+			explicit CallTimer(ECall _call) : call(_call), start(Clock::now())
+			{}
+
+			~CallTimer()
+			{
+				Clock::time_point end = Clock::now();
+
+				Record(call, u64(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()));
+
+				CallObserver observer = Observer.load(std::memory_order_acquire);
+
+				if (observer != nullptr)
+				{
+					observer
+					(
+						call,
+						u64(std::chrono::duration_cast<std::chrono::nanoseconds>(start.time_since_epoch()).count()),
+						u64(std::chrono::duration_cast<std::chrono::nanoseconds>(end  .time_since_epoch()).count())
+					);
+				}
+			}
+
+			CallTimer(const CallTimer&) = delete;
+			CallTimer& operator= (const CallTimer&) = delete;
+
+		protected:
+
+			ECall             call ;
+			Clock::time_point start;
+		};
+
+		/**
+		@brief Defines the wrapper of an API procedure: times the call of the target given.
+
+		@details
+		The wrapper is an object rather than a function template: unqualified calls in the vaults would otherwise also find the
+		API prototype by argument dependent lookup, and prefer it over the template whenever the arguments match it exactly.
+		*/
+		#define VV_Instrument_Call(_PROCEDURE, _TARGET)                                              \
+		struct _PROCEDURE##_Wrapper                                                                  \
+		{                                                                                            \
+			template<typename... ArgumentTypes>                                                      \
+			auto operator() (ArgumentTypes&&... _arguments) const                                    \
+				-> decltype(_TARGET(std::forward<ArgumentTypes>(_arguments)...))                     \
+			{                                                                                        \
+				CallTimer timer(ECall::_PROCEDURE);                                                  \
+				                                                                                     \
+				return _TARGET(std::forward<ArgumentTypes>(_arguments)...);                          \
+			}                                                                                        \
+		};                                                                                           \
+		                                                                                             \
+		inline constexpr _PROCEDURE##_Wrapper _PROCEDURE {};
+
+		/**
+		@brief Device level procedures go through the MagmaChamber's entry points when it is open.
+		*/
+		#ifdef VT_Vault_MagmaChamber_Open
+			#define VV_Instrument_DeviceCall(_PROCEDURE) VV_Instrument_Call(_PROCEDURE, Vault_MagmaChamber::Entries::_PROCEDURE)
+		#else
+			#define VV_Instrument_DeviceCall(_PROCEDURE) VV_Instrument_Call(_PROCEDURE, ::_PROCEDURE)
+		#endif
+
+		#define VV_Instrument_LoaderCall(_PROCEDURE) VV_Instrument_Call(_PROCEDURE, ::_PROCEDURE)
+
+		/**
+		@brief Procedures the capture records or tracks handles of go through its procedures when capturing is enabled.
+		*/
+		#ifdef VV_Option__Capture_Calls
+			#define VV_Instrument_CapturedDeviceCall(_PROCEDURE) VV_Instrument_Call(_PROCEDURE, Capture::Calls::_PROCEDURE)
+			#define VV_Instrument_CapturedLoaderCall(_PROCEDURE) VV_Instrument_Call(_PROCEDURE, Capture::Calls::_PROCEDURE)
+		#else
+			#define VV_Instrument_CapturedDeviceCall(_PROCEDURE) VV_Instrument_DeviceCall(_PROCEDURE)
+			#define VV_Instrument_CapturedLoaderCall(_PROCEDURE) VV_Instrument_LoaderCall(_PROCEDURE)
+		#endif
+
+		/**
+		@brief The wrappers the vaults call instead of the API procedures.
+		*/
+		namespace Calls
+		{
+			VV_Instrument_CapturedDeviceCall(vkAcquireNextImageKHR)
+			VV_Instrument_CapturedDeviceCall(vkAllocateCommandBuffers)
+			VV_Instrument_CapturedDeviceCall(vkAllocateDescriptorSets)
+			VV_Instrument_CapturedDeviceCall(vkAllocateMemory)
+			VV_Instrument_CapturedDeviceCall(vkBeginCommandBuffer)
+			VV_Instrument_DeviceCall(vkBindBufferMemory)
+			VV_Instrument_DeviceCall(vkBindImageMemory)
+			VV_Instrument_CapturedDeviceCall(vkCmdBeginQuery)
+			VV_Instrument_CapturedDeviceCall(vkCmdBeginRenderPass)
+			VV_Instrument_CapturedDeviceCall(vkCmdBindDescriptorSets)
+			VV_Instrument_CapturedDeviceCall(vkCmdBindIndexBuffer)
+			VV_Instrument_CapturedDeviceCall(vkCmdBindPipeline)
+			VV_Instrument_CapturedDeviceCall(vkCmdBindVertexBuffers)
+			VV_Instrument_CapturedDeviceCall(vkCmdBlitImage)
+			VV_Instrument_CapturedDeviceCall(vkCmdCopyBuffer)
+			VV_Instrument_CapturedDeviceCall(vkCmdCopyBufferToImage)
+			VV_Instrument_CapturedDeviceCall(vkCmdCopyQueryPoolResults)
+			VV_Instrument_CapturedDeviceCall(vkCmdDraw)
+			VV_Instrument_CapturedDeviceCall(vkCmdDrawIndexed)
+			VV_Instrument_CapturedDeviceCall(vkCmdEndQuery)
+			VV_Instrument_CapturedDeviceCall(vkCmdEndRenderPass)
+			VV_Instrument_CapturedDeviceCall(vkCmdExecuteCommands)
+			VV_Instrument_CapturedDeviceCall(vkCmdPipelineBarrier)
+			VV_Instrument_CapturedDeviceCall(vkCmdPushConstants)
+			VV_Instrument_CapturedDeviceCall(vkCmdResetEvent)
+			VV_Instrument_CapturedDeviceCall(vkCmdResetQueryPool)
+			VV_Instrument_CapturedDeviceCall(vkCmdSetDeviceMask)
+			VV_Instrument_CapturedDeviceCall(vkCmdSetEvent)
+			VV_Instrument_CapturedDeviceCall(vkCmdSetScissor)
+			VV_Instrument_CapturedDeviceCall(vkCmdSetViewport)
+			VV_Instrument_CapturedDeviceCall(vkCmdWaitEvents)
+			VV_Instrument_CapturedDeviceCall(vkCmdWriteTimestamp)
+			VV_Instrument_CapturedDeviceCall(vkCreateBuffer)
+			VV_Instrument_CapturedDeviceCall(vkCreateBufferView)
+			VV_Instrument_CapturedDeviceCall(vkCreateCommandPool)
+			VV_Instrument_CapturedDeviceCall(vkCreateComputePipelines)
+			VV_Instrument_CapturedDeviceCall(vkCreateDescriptorPool)
+			VV_Instrument_CapturedDeviceCall(vkCreateDescriptorSetLayout)
+			VV_Instrument_CapturedDeviceCall(vkCreateDescriptorUpdateTemplate)
+			VV_Instrument_CapturedLoaderCall(vkCreateDevice)
+			VV_Instrument_CapturedDeviceCall(vkCreateEvent)
+			VV_Instrument_CapturedDeviceCall(vkCreateFence)
+			VV_Instrument_CapturedDeviceCall(vkCreateFramebuffer)
+			VV_Instrument_CapturedDeviceCall(vkCreateGraphicsPipelines)
+			VV_Instrument_CapturedDeviceCall(vkCreateImage)
+			VV_Instrument_CapturedDeviceCall(vkCreateImageView)
+			VV_Instrument_LoaderCall(vkCreateInstance)
+			VV_Instrument_CapturedDeviceCall(vkCreatePipelineCache)
+			VV_Instrument_CapturedDeviceCall(vkCreatePipelineLayout)
+			VV_Instrument_CapturedDeviceCall(vkCreateQueryPool)
+			VV_Instrument_CapturedDeviceCall(vkCreateRenderPass)
+			VV_Instrument_CapturedDeviceCall(vkCreateSampler)
+			VV_Instrument_CapturedDeviceCall(vkCreateSemaphore)
+			VV_Instrument_CapturedDeviceCall(vkCreateShaderModule)
+			VV_Instrument_CapturedDeviceCall(vkCreateSwapchainKHR)
+			VV_Instrument_DeviceCall(vkDestroyBuffer)
+			VV_Instrument_DeviceCall(vkDestroyBufferView)
+			VV_Instrument_DeviceCall(vkDestroyCommandPool)
+			VV_Instrument_DeviceCall(vkDestroyDescriptorPool)
+			VV_Instrument_DeviceCall(vkDestroyDescriptorSetLayout)
+			VV_Instrument_DeviceCall(vkDestroyDescriptorUpdateTemplate)
+			VV_Instrument_DeviceCall(vkDestroyDevice)
+			VV_Instrument_DeviceCall(vkDestroyEvent)
+			VV_Instrument_DeviceCall(vkDestroyFence)
+			VV_Instrument_DeviceCall(vkDestroyFramebuffer)
+			VV_Instrument_DeviceCall(vkDestroyImage)
+			VV_Instrument_DeviceCall(vkDestroyImageView)
+			VV_Instrument_LoaderCall(vkDestroyInstance)
+			VV_Instrument_DeviceCall(vkDestroyPipeline)
+			VV_Instrument_DeviceCall(vkDestroyPipelineCache)
+			VV_Instrument_DeviceCall(vkDestroyPipelineLayout)
+			VV_Instrument_DeviceCall(vkDestroyQueryPool)
+			VV_Instrument_DeviceCall(vkDestroyRenderPass)
+			VV_Instrument_DeviceCall(vkDestroySampler)
+			VV_Instrument_DeviceCall(vkDestroySemaphore)
+			VV_Instrument_DeviceCall(vkDestroyShaderModule)
+			VV_Instrument_LoaderCall(vkDestroySurfaceKHR)
+			VV_Instrument_DeviceCall(vkDestroySwapchainKHR)
+			VV_Instrument_CapturedDeviceCall(vkDeviceWaitIdle)
+			VV_Instrument_CapturedDeviceCall(vkEndCommandBuffer)
+			VV_Instrument_LoaderCall(vkEnumerateDeviceExtensionProperties)
+			VV_Instrument_LoaderCall(vkEnumerateInstanceExtensionProperties)
+			VV_Instrument_LoaderCall(vkEnumerateInstanceLayerProperties)
+			VV_Instrument_LoaderCall(vkEnumerateInstanceVersion)
+			VV_Instrument_LoaderCall(vkEnumeratePhysicalDeviceGroups)
+			VV_Instrument_LoaderCall(vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR)
+			VV_Instrument_LoaderCall(vkEnumeratePhysicalDevices)
+			VV_Instrument_DeviceCall(vkFlushMappedMemoryRanges)
+			VV_Instrument_DeviceCall(vkFreeCommandBuffers)
+			VV_Instrument_DeviceCall(vkFreeDescriptorSets)
+			VV_Instrument_DeviceCall(vkFreeMemory)
+			VV_Instrument_DeviceCall(vkGetBufferMemoryRequirements)
+			VV_Instrument_DeviceCall(vkGetDescriptorSetLayoutSupport)
+			VV_Instrument_LoaderCall(vkGetDeviceProcAddr)
+			VV_Instrument_CapturedDeviceCall(vkGetDeviceQueue)
+			VV_Instrument_CapturedDeviceCall(vkGetDeviceQueue2)
+			VV_Instrument_DeviceCall(vkGetEventStatus)
+			VV_Instrument_LoaderCall(vkGetFenceFdKHR)
+			VV_Instrument_DeviceCall(vkGetFenceStatus)
+			VV_Instrument_DeviceCall(vkGetImageMemoryRequirements)
+			VV_Instrument_DeviceCall(vkGetImageSubresourceLayout)
+			VV_Instrument_LoaderCall(vkGetInstanceProcAddr)
+			VV_Instrument_LoaderCall(vkGetPhysicalDeviceFeatures)
+			VV_Instrument_LoaderCall(vkGetPhysicalDeviceFormatProperties)
+			VV_Instrument_LoaderCall(vkGetPhysicalDeviceMemoryProperties)
+			VV_Instrument_LoaderCall(vkGetPhysicalDeviceProperties)
+			VV_Instrument_LoaderCall(vkGetPhysicalDeviceProperties2)
+			VV_Instrument_LoaderCall(vkGetPhysicalDeviceQueueFamilyProperties)
+			VV_Instrument_LoaderCall(vkGetPhysicalDeviceQueueFamilyProperties2)
+			VV_Instrument_LoaderCall(vkGetPhysicalDeviceSurfaceCapabilitiesKHR)
+			VV_Instrument_LoaderCall(vkGetPhysicalDeviceSurfaceFormatsKHR)
+			VV_Instrument_LoaderCall(vkGetPhysicalDeviceSurfacePresentModesKHR)
+			VV_Instrument_LoaderCall(vkGetPhysicalDeviceSurfaceSupportKHR)
+			VV_Instrument_DeviceCall(vkGetPipelineCacheData)
+			VV_Instrument_DeviceCall(vkGetQueryPoolResults)
+			VV_Instrument_DeviceCall(vkGetSemaphoreCounterValue)
+			VV_Instrument_LoaderCall(vkGetSemaphoreFdKHR)
+			VV_Instrument_CapturedDeviceCall(vkGetSwapchainImagesKHR)
+			VV_Instrument_DeviceCall(vkGetSwapchainStatusKHR)
+			VV_Instrument_LoaderCall(vkImportFenceFdKHR)
+			VV_Instrument_LoaderCall(vkImportSemaphoreFdKHR)
+			VV_Instrument_DeviceCall(vkInvalidateMappedMemoryRanges)
+			VV_Instrument_DeviceCall(vkMapMemory)
+			VV_Instrument_DeviceCall(vkMergePipelineCaches)
+			VV_Instrument_CapturedDeviceCall(vkQueuePresentKHR)
+			VV_Instrument_CapturedDeviceCall(vkQueueSubmit)
+			VV_Instrument_CapturedDeviceCall(vkQueueWaitIdle)
+			VV_Instrument_LoaderCall(vkRegisterDeviceEventEXT)
+			VV_Instrument_LoaderCall(vkRegisterDisplayEventEXT)
+			VV_Instrument_CapturedDeviceCall(vkResetCommandBuffer)
+			VV_Instrument_CapturedDeviceCall(vkResetCommandPool)
+			VV_Instrument_DeviceCall(vkResetDescriptorPool)
+			VV_Instrument_DeviceCall(vkResetEvent)
+			VV_Instrument_CapturedDeviceCall(vkResetFences)
+			VV_Instrument_DeviceCall(vkResetQueryPool)
+			VV_Instrument_DeviceCall(vkSetEvent)
+			VV_Instrument_DeviceCall(vkSignalSemaphore)
+			VV_Instrument_DeviceCall(vkTrimCommandPool)
+			VV_Instrument_DeviceCall(vkUnmapMemory)
+			VV_Instrument_DeviceCall(vkUpdateDescriptorSetWithTemplate)
+			VV_Instrument_CapturedDeviceCall(vkUpdateDescriptorSets)
+			VV_Instrument_CapturedDeviceCall(vkWaitForFences)
+			VV_Instrument_DeviceCall(vkWaitSemaphores)
+
+		#ifdef VK_USE_PLATFORM_WIN32_KHR
+
+			VV_Instrument_LoaderCall(vkCreateWin32SurfaceKHR)
+			VV_Instrument_LoaderCall(vkGetFenceWin32HandleKHR)
+			VV_Instrument_LoaderCall(vkGetSemaphoreWin32HandleKHR)
+			VV_Instrument_LoaderCall(vkImportFenceWin32HandleKHR)
+			VV_Instrument_LoaderCall(vkImportSemaphoreWin32HandleKHR)
+
+		#endif
+		}
+
+		#undef VV_Instrument_CapturedLoaderCall
+		#undef VV_Instrument_CapturedDeviceCall
+		#undef VV_Instrument_LoaderCall
+		#undef VV_Instrument_DeviceCall
+		#undef VV_Instrument_Call
+
+		/** @} */	// Instrumentation
+	}
+
+	using namespace Instrumentation::Calls;
+}
+
+#endif
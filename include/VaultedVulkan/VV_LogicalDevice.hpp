@@ -636,6 +636,10 @@ namespace VaultedVulkan
 			LogicalDevice(LogicalDevice&& _other) noexcept :
 				handle(std::move(_other.handle)), physicalDevice(std::move(_other.physicalDevice)), allocator(std::move(_other.allocator))
 			{
+			#ifdef VT_Vault_MagmaChamber_Open
+				dispatch = _other.dispatch;
+			#endif
+
 				_other.handle         = Null<Handle>;
 				_other.physicalDevice = nullptr     ;
 				_other.allocator      = nullptr     ;
@@ -664,7 +668,7 @@ namespace VaultedVulkan
 			{
 				if (physicalDevice == nullptr) return EResult::Not_Ready;
 
-				return Parent::Create(*physicalDevice, _createInfo, handle);
+				return LoadDispatchTable(Parent::Create(*physicalDevice, _createInfo, handle));
 			}
 
 			/**
@@ -676,7 +680,7 @@ namespace VaultedVulkan
 
 				allocator = &_allocator;
 
-				return Parent::Create(*physicalDevice, _createInfo, allocator, handle);
+				return LoadDispatchTable(Parent::Create(*physicalDevice, _createInfo, allocator, handle));
 			}
 
 			/**
@@ -687,7 +691,7 @@ namespace VaultedVulkan
 				physicalDevice = &_physicalDevice        ;
 				allocator      = Memory::DefaultAllocator;
 
-				return Parent::Create(*physicalDevice, _createInfo, handle);
+				return LoadDispatchTable(Parent::Create(*physicalDevice, _createInfo, handle));
 			}
 
 			/**
@@ -698,7 +702,7 @@ namespace VaultedVulkan
 				physicalDevice = &_physicalDevice;
 				allocator      = &_allocator     ;
 
-				return Parent::Create(*physicalDevice, _createInfo, allocator, handle);
+				return LoadDispatchTable(Parent::Create(*physicalDevice, _createInfo, allocator, handle));
 			}
 
 			/**
@@ -706,12 +710,26 @@ namespace VaultedVulkan
 			*/
 			void Destroy()
 			{
+			#ifdef VT_Vault_MagmaChamber_Open
+				if (handle != Null<Handle>) Vault_MagmaChamber::UnregisterDevice(handle);
+			#endif
+
 				Parent::Destroy(handle, allocator);
 
 				handle    = Null<Handle>;
 				allocator = nullptr     ;
 			}
 
+		#ifdef VT_Vault_MagmaChamber_Open
+			/**
+			@brief Provides the device level procedures loaded for the device.
+			*/
+			const Vault_MagmaChamber::DeviceTable& GetDispatchTable() const
+			{
+				return dispatch;
+			}
+		#endif
+
 			/**
 			@brief provides a readonly reference to a physical device host object.
 			*/
@@ -791,6 +809,10 @@ namespace VaultedVulkan
 				physicalDevice = std::move(_other.physicalDevice);
 				allocator      = std::move(_other.allocator     );
 
+			#ifdef VT_Vault_MagmaChamber_Open
+				dispatch = _other.dispatch;
+			#endif
+
 				_other.handle         = Null<Handle>;
 				_other.physicalDevice = nullptr     ;
 				_other.allocator      = nullptr     ;
@@ -800,11 +822,33 @@ namespace VaultedVulkan
 
 		protected:
 
+			/**
+			@brief Loads the device's dispatch table once it was created, and registers it so calls on the device's objects use it. (MagmaChamber only)
+
+			@details When MaxDevices tables are already registered, the device's calls go through the loader exports instead.
+			*/
+			EResult LoadDispatchTable(EResult _createResult)
+			{
+			#ifdef VT_Vault_MagmaChamber_Open
+				if (_createResult != EResult::Success) return _createResult;
+
+				dispatch.Load(handle);
+
+				Vault_MagmaChamber::RegisterDevice(dispatch, handle);
+			#endif
+
+				return _createResult;
+			}
+
 			Handle handle;
 
 			const PhysicalDevice* physicalDevice;
 
 			const Memory::AllocationCallbacks* allocator;
+
+		#ifdef VT_Vault_MagmaChamber_Open
+			Vault_MagmaChamber::DeviceTable dispatch {};
+		#endif
 		};
 
 		/**
@@ -0,0 +1,687 @@
+/*!
+@file VV_MagmaChamber.hpp
+
+@brief Vaulted Vulkan: Magma Chamber
+
+@details Device level dispatch tables, loaded with vkGetDeviceProcAddr so that calls on a device skip the loader's trampolines.
+
+Only active when VT_Vault_MagmaChamber_Open is defined. When it is, the other vaults call the device level procedures
+through the entry points defined here instead of the loader exports (they resolve to them by unqualified lookup).
+
+Every logical device registers its own table when created. An entry point finds the table of the device its dispatchable
+object (device, queue or command buffer) belongs to by the object's dispatch key, so any amount of devices may be used at once.
+Objects of devices that are not registered (more than MaxDevices, or created outside of the library) go through the loader exports.
+
+<a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#initialization-functionpointers">Specification</a>
+*/
+
+
+
+#pragma once
+
+
+
+// VV
+#include "VV_Vaults.hpp"
+#include "VV_Platform.hpp"
+#include "VV_CPP_STL.hpp"
+
+
+
+#ifdef VT_Vault_MagmaChamber_Open
+
+#ifndef VV_Option__Use_Long_Namespace
+namespace VV
+#else
+namespace VaultedVulkan
+#endif
+{
+	namespace Vault_MagmaChamber
+	{
+		/**
+		@addtogroup Vault_MagmaChamber
+		@{
+		*/
+
+		/**
+		@brief Device level procedures used by the library, obtained for a specific device.
+		*/
+		struct DeviceTable
+		{
+			PFN_vkAcquireNextImageKHR             vkAcquireNextImageKHR;
+			PFN_vkAllocateCommandBuffers          vkAllocateCommandBuffers;
+			PFN_vkAllocateDescriptorSets          vkAllocateDescriptorSets;
+			PFN_vkAllocateMemory                  vkAllocateMemory;
+			PFN_vkBeginCommandBuffer              vkBeginCommandBuffer;
+			PFN_vkBindBufferMemory                vkBindBufferMemory;
+			PFN_vkBindImageMemory                 vkBindImageMemory;
+			PFN_vkCmdBeginQuery                   vkCmdBeginQuery;
+			PFN_vkCmdBeginRenderPass              vkCmdBeginRenderPass;
+			PFN_vkCmdBindDescriptorSets           vkCmdBindDescriptorSets;
+			PFN_vkCmdBindIndexBuffer              vkCmdBindIndexBuffer;
+			PFN_vkCmdBindPipeline                 vkCmdBindPipeline;
+			PFN_vkCmdBindVertexBuffers            vkCmdBindVertexBuffers;
+			PFN_vkCmdBlitImage                    vkCmdBlitImage;
+			PFN_vkCmdCopyBuffer                   vkCmdCopyBuffer;
+			PFN_vkCmdCopyBufferToImage            vkCmdCopyBufferToImage;
+			PFN_vkCmdCopyQueryPoolResults         vkCmdCopyQueryPoolResults;
+			PFN_vkCmdDraw                         vkCmdDraw;
+			PFN_vkCmdDrawIndexed                  vkCmdDrawIndexed;
+			PFN_vkCmdEndQuery                     vkCmdEndQuery;
+			PFN_vkCmdEndRenderPass                vkCmdEndRenderPass;
+			PFN_vkCmdExecuteCommands              vkCmdExecuteCommands;
+			PFN_vkCmdPipelineBarrier              vkCmdPipelineBarrier;
+			PFN_vkCmdPushConstants                vkCmdPushConstants;
+			PFN_vkCmdResetEvent                   vkCmdResetEvent;
+			PFN_vkCmdResetQueryPool               vkCmdResetQueryPool;
+			PFN_vkCmdSetDeviceMask                vkCmdSetDeviceMask;
+			PFN_vkCmdSetEvent                     vkCmdSetEvent;
+			PFN_vkCmdSetScissor                   vkCmdSetScissor;
+			PFN_vkCmdSetViewport                  vkCmdSetViewport;
+			PFN_vkCmdWaitEvents                   vkCmdWaitEvents;
+			PFN_vkCmdWriteTimestamp               vkCmdWriteTimestamp;
+			PFN_vkCreateBuffer                    vkCreateBuffer;
+			PFN_vkCreateBufferView                vkCreateBufferView;
+			PFN_vkCreateCommandPool               vkCreateCommandPool;
+			PFN_vkCreateComputePipelines          vkCreateComputePipelines;
+			PFN_vkCreateDescriptorPool            vkCreateDescriptorPool;
+			PFN_vkCreateDescriptorSetLayout       vkCreateDescriptorSetLayout;
+			PFN_vkCreateDescriptorUpdateTemplate  vkCreateDescriptorUpdateTemplate;
+			PFN_vkCreateEvent                     vkCreateEvent;
+			PFN_vkCreateFence                     vkCreateFence;
+			PFN_vkCreateFramebuffer               vkCreateFramebuffer;
+			PFN_vkCreateGraphicsPipelines         vkCreateGraphicsPipelines;
+			PFN_vkCreateImage                     vkCreateImage;
+			PFN_vkCreateImageView                 vkCreateImageView;
+			PFN_vkCreatePipelineCache             vkCreatePipelineCache;
+			PFN_vkCreatePipelineLayout            vkCreatePipelineLayout;
+			PFN_vkCreateQueryPool                 vkCreateQueryPool;
+			PFN_vkCreateRenderPass                vkCreateRenderPass;
+			PFN_vkCreateSampler                   vkCreateSampler;
+			PFN_vkCreateSemaphore                 vkCreateSemaphore;
+			PFN_vkCreateShaderModule              vkCreateShaderModule;
+			PFN_vkCreateSwapchainKHR              vkCreateSwapchainKHR;
+			PFN_vkDestroyBuffer                   vkDestroyBuffer;
+			PFN_vkDestroyBufferView               vkDestroyBufferView;
+			PFN_vkDestroyCommandPool              vkDestroyCommandPool;
+			PFN_vkDestroyDescriptorPool           vkDestroyDescriptorPool;
+			PFN_vkDestroyDescriptorSetLayout      vkDestroyDescriptorSetLayout;
+			PFN_vkDestroyDescriptorUpdateTemplate vkDestroyDescriptorUpdateTemplate;
+			PFN_vkDestroyDevice                   vkDestroyDevice;
+			PFN_vkDestroyEvent                    vkDestroyEvent;
+			PFN_vkDestroyFence                    vkDestroyFence;
+			PFN_vkDestroyFramebuffer              vkDestroyFramebuffer;
+			PFN_vkDestroyImage                    vkDestroyImage;
+			PFN_vkDestroyImageView                vkDestroyImageView;
+			PFN_vkDestroyPipeline                 vkDestroyPipeline;
+			PFN_vkDestroyPipelineCache            vkDestroyPipelineCache;
+			PFN_vkDestroyPipelineLayout           vkDestroyPipelineLayout;
+			PFN_vkDestroyQueryPool                vkDestroyQueryPool;
+			PFN_vkDestroyRenderPass               vkDestroyRenderPass;
+			PFN_vkDestroySampler                  vkDestroySampler;
+			PFN_vkDestroySemaphore                vkDestroySemaphore;
+			PFN_vkDestroyShaderModule             vkDestroyShaderModule;
+			PFN_vkDestroySwapchainKHR             vkDestroySwapchainKHR;
+			PFN_vkDeviceWaitIdle                  vkDeviceWaitIdle;
+			PFN_vkEndCommandBuffer                vkEndCommandBuffer;
+			PFN_vkFlushMappedMemoryRanges         vkFlushMappedMemoryRanges;
+			PFN_vkFreeCommandBuffers              vkFreeCommandBuffers;
+			PFN_vkFreeDescriptorSets              vkFreeDescriptorSets;
+			PFN_vkFreeMemory                      vkFreeMemory;
+			PFN_vkGetBufferMemoryRequirements     vkGetBufferMemoryRequirements;
+			PFN_vkGetDescriptorSetLayoutSupport   vkGetDescriptorSetLayoutSupport;
+			PFN_vkGetDeviceQueue                  vkGetDeviceQueue;
+			PFN_vkGetDeviceQueue2                 vkGetDeviceQueue2;
+			PFN_vkGetEventStatus                  vkGetEventStatus;
+			PFN_vkGetFenceStatus                  vkGetFenceStatus;
+			PFN_vkGetImageMemoryRequirements      vkGetImageMemoryRequirements;
+			PFN_vkGetImageSubresourceLayout       vkGetImageSubresourceLayout;
+			PFN_vkGetPipelineCacheData            vkGetPipelineCacheData;
+			PFN_vkGetQueryPoolResults             vkGetQueryPoolResults;
+			PFN_vkGetSemaphoreCounterValue        vkGetSemaphoreCounterValue;
+			PFN_vkGetSwapchainImagesKHR           vkGetSwapchainImagesKHR;
+			PFN_vkGetSwapchainStatusKHR           vkGetSwapchainStatusKHR;
+			PFN_vkInvalidateMappedMemoryRanges    vkInvalidateMappedMemoryRanges;
+			PFN_vkMapMemory                       vkMapMemory;
+			PFN_vkMergePipelineCaches             vkMergePipelineCaches;
+			PFN_vkQueuePresentKHR                 vkQueuePresentKHR;
+			PFN_vkQueueSubmit                     vkQueueSubmit;
+			PFN_vkQueueWaitIdle                   vkQueueWaitIdle;
+			PFN_vkResetCommandBuffer              vkResetCommandBuffer;
+			PFN_vkResetCommandPool                vkResetCommandPool;
+			PFN_vkResetDescriptorPool             vkResetDescriptorPool;
+			PFN_vkResetEvent                      vkResetEvent;
+			PFN_vkResetFences                     vkResetFences;
+			PFN_vkResetQueryPool                  vkResetQueryPool;
+			PFN_vkSetEvent                        vkSetEvent;
+			PFN_vkSignalSemaphore                 vkSignalSemaphore;
+			PFN_vkTrimCommandPool                 vkTrimCommandPool;
+			PFN_vkUnmapMemory                     vkUnmapMemory;
+			PFN_vkUpdateDescriptorSetWithTemplate vkUpdateDescriptorSetWithTemplate;
+			PFN_vkUpdateDescriptorSets            vkUpdateDescriptorSets;
+			PFN_vkWaitForFences                   vkWaitForFences;
+			PFN_vkWaitSemaphores                  vkWaitSemaphores;
+
+			/**
+			@brief Obtains the device's procedures. (Procedures not supported by the device are null)
+			*/
+			void Load(VkDevice _device)
+			{
+				vkAcquireNextImageKHR             = Get<PFN_vkAcquireNextImageKHR>(_device, "vkAcquireNextImageKHR");
+				vkAllocateCommandBuffers          = Get<PFN_vkAllocateCommandBuffers>(_device, "vkAllocateCommandBuffers");
+				vkAllocateDescriptorSets          = Get<PFN_vkAllocateDescriptorSets>(_device, "vkAllocateDescriptorSets");
+				vkAllocateMemory                  = Get<PFN_vkAllocateMemory>(_device, "vkAllocateMemory");
+				vkBeginCommandBuffer              = Get<PFN_vkBeginCommandBuffer>(_device, "vkBeginCommandBuffer");
+				vkBindBufferMemory                = Get<PFN_vkBindBufferMemory>(_device, "vkBindBufferMemory");
+				vkBindImageMemory                 = Get<PFN_vkBindImageMemory>(_device, "vkBindImageMemory");
+				vkCmdBeginQuery                   = Get<PFN_vkCmdBeginQuery>(_device, "vkCmdBeginQuery");
+				vkCmdBeginRenderPass              = Get<PFN_vkCmdBeginRenderPass>(_device, "vkCmdBeginRenderPass");
+				vkCmdBindDescriptorSets           = Get<PFN_vkCmdBindDescriptorSets>(_device, "vkCmdBindDescriptorSets");
+				vkCmdBindIndexBuffer              = Get<PFN_vkCmdBindIndexBuffer>(_device, "vkCmdBindIndexBuffer");
+				vkCmdBindPipeline                 = Get<PFN_vkCmdBindPipeline>(_device, "vkCmdBindPipeline");
+				vkCmdBindVertexBuffers            = Get<PFN_vkCmdBindVertexBuffers>(_device, "vkCmdBindVertexBuffers");
+				vkCmdBlitImage                    = Get<PFN_vkCmdBlitImage>(_device, "vkCmdBlitImage");
+				vkCmdCopyBuffer                   = Get<PFN_vkCmdCopyBuffer>(_device, "vkCmdCopyBuffer");
+				vkCmdCopyBufferToImage            = Get<PFN_vkCmdCopyBufferToImage>(_device, "vkCmdCopyBufferToImage");
+				vkCmdCopyQueryPoolResults         = Get<PFN_vkCmdCopyQueryPoolResults>(_device, "vkCmdCopyQueryPoolResults");
+				vkCmdDraw                         = Get<PFN_vkCmdDraw>(_device, "vkCmdDraw");
+				vkCmdDrawIndexed                  = Get<PFN_vkCmdDrawIndexed>(_device, "vkCmdDrawIndexed");
+				vkCmdEndQuery                     = Get<PFN_vkCmdEndQuery>(_device, "vkCmdEndQuery");
+				vkCmdEndRenderPass                = Get<PFN_vkCmdEndRenderPass>(_device, "vkCmdEndRenderPass");
+				vkCmdExecuteCommands              = Get<PFN_vkCmdExecuteCommands>(_device, "vkCmdExecuteCommands");
+				vkCmdPipelineBarrier              = Get<PFN_vkCmdPipelineBarrier>(_device, "vkCmdPipelineBarrier");
+				vkCmdPushConstants                = Get<PFN_vkCmdPushConstants>(_device, "vkCmdPushConstants");
+				vkCmdResetEvent                   = Get<PFN_vkCmdResetEvent>(_device, "vkCmdResetEvent");
+				vkCmdResetQueryPool               = Get<PFN_vkCmdResetQueryPool>(_device, "vkCmdResetQueryPool");
+				vkCmdSetDeviceMask                = Get<PFN_vkCmdSetDeviceMask>(_device, "vkCmdSetDeviceMask");
+				vkCmdSetEvent                     = Get<PFN_vkCmdSetEvent>(_device, "vkCmdSetEvent");
+				vkCmdSetScissor                   = Get<PFN_vkCmdSetScissor>(_device, "vkCmdSetScissor");
+				vkCmdSetViewport                  = Get<PFN_vkCmdSetViewport>(_device, "vkCmdSetViewport");
+				vkCmdWaitEvents                   = Get<PFN_vkCmdWaitEvents>(_device, "vkCmdWaitEvents");
+				vkCmdWriteTimestamp               = Get<PFN_vkCmdWriteTimestamp>(_device, "vkCmdWriteTimestamp");
+				vkCreateBuffer                    = Get<PFN_vkCreateBuffer>(_device, "vkCreateBuffer");
+				vkCreateBufferView                = Get<PFN_vkCreateBufferView>(_device, "vkCreateBufferView");
+				vkCreateCommandPool               = Get<PFN_vkCreateCommandPool>(_device, "vkCreateCommandPool");
+				vkCreateComputePipelines          = Get<PFN_vkCreateComputePipelines>(_device, "vkCreateComputePipelines");
+				vkCreateDescriptorPool            = Get<PFN_vkCreateDescriptorPool>(_device, "vkCreateDescriptorPool");
+				vkCreateDescriptorSetLayout       = Get<PFN_vkCreateDescriptorSetLayout>(_device, "vkCreateDescriptorSetLayout");
+				vkCreateDescriptorUpdateTemplate  = Get<PFN_vkCreateDescriptorUpdateTemplate>(_device, "vkCreateDescriptorUpdateTemplate");
+				vkCreateEvent                     = Get<PFN_vkCreateEvent>(_device, "vkCreateEvent");
+				vkCreateFence                     = Get<PFN_vkCreateFence>(_device, "vkCreateFence");
+				vkCreateFramebuffer               = Get<PFN_vkCreateFramebuffer>(_device, "vkCreateFramebuffer");
+				vkCreateGraphicsPipelines         = Get<PFN_vkCreateGraphicsPipelines>(_device, "vkCreateGraphicsPipelines");
+				vkCreateImage                     = Get<PFN_vkCreateImage>(_device, "vkCreateImage");
+				vkCreateImageView                 = Get<PFN_vkCreateImageView>(_device, "vkCreateImageView");
+				vkCreatePipelineCache             = Get<PFN_vkCreatePipelineCache>(_device, "vkCreatePipelineCache");
+				vkCreatePipelineLayout            = Get<PFN_vkCreatePipelineLayout>(_device, "vkCreatePipelineLayout");
+				vkCreateQueryPool                 = Get<PFN_vkCreateQueryPool>(_device, "vkCreateQueryPool");
+				vkCreateRenderPass                = Get<PFN_vkCreateRenderPass>(_device, "vkCreateRenderPass");
+				vkCreateSampler                   = Get<PFN_vkCreateSampler>(_device, "vkCreateSampler");
+				vkCreateSemaphore                 = Get<PFN_vkCreateSemaphore>(_device, "vkCreateSemaphore");
+				vkCreateShaderModule              = Get<PFN_vkCreateShaderModule>(_device, "vkCreateShaderModule");
+				vkCreateSwapchainKHR              = Get<PFN_vkCreateSwapchainKHR>(_device, "vkCreateSwapchainKHR");
+				vkDestroyBuffer                   = Get<PFN_vkDestroyBuffer>(_device, "vkDestroyBuffer");
+				vkDestroyBufferView               = Get<PFN_vkDestroyBufferView>(_device, "vkDestroyBufferView");
+				vkDestroyCommandPool              = Get<PFN_vkDestroyCommandPool>(_device, "vkDestroyCommandPool");
+				vkDestroyDescriptorPool           = Get<PFN_vkDestroyDescriptorPool>(_device, "vkDestroyDescriptorPool");
+				vkDestroyDescriptorSetLayout      = Get<PFN_vkDestroyDescriptorSetLayout>(_device, "vkDestroyDescriptorSetLayout");
+				vkDestroyDescriptorUpdateTemplate = Get<PFN_vkDestroyDescriptorUpdateTemplate>(_device, "vkDestroyDescriptorUpdateTemplate");
+				vkDestroyDevice                   = Get<PFN_vkDestroyDevice>(_device, "vkDestroyDevice");
+				vkDestroyEvent                    = Get<PFN_vkDestroyEvent>(_device, "vkDestroyEvent");
+				vkDestroyFence                    = Get<PFN_vkDestroyFence>(_device, "vkDestroyFence");
+				vkDestroyFramebuffer              = Get<PFN_vkDestroyFramebuffer>(_device, "vkDestroyFramebuffer");
+				vkDestroyImage                    = Get<PFN_vkDestroyImage>(_device, "vkDestroyImage");
+				vkDestroyImageView                = Get<PFN_vkDestroyImageView>(_device, "vkDestroyImageView");
+				vkDestroyPipeline                 = Get<PFN_vkDestroyPipeline>(_device, "vkDestroyPipeline");
+				vkDestroyPipelineCache            = Get<PFN_vkDestroyPipelineCache>(_device, "vkDestroyPipelineCache");
+				vkDestroyPipelineLayout           = Get<PFN_vkDestroyPipelineLayout>(_device, "vkDestroyPipelineLayout");
+				vkDestroyQueryPool                = Get<PFN_vkDestroyQueryPool>(_device, "vkDestroyQueryPool");
+				vkDestroyRenderPass               = Get<PFN_vkDestroyRenderPass>(_device, "vkDestroyRenderPass");
+				vkDestroySampler                  = Get<PFN_vkDestroySampler>(_device, "vkDestroySampler");
+				vkDestroySemaphore                = Get<PFN_vkDestroySemaphore>(_device, "vkDestroySemaphore");
+				vkDestroyShaderModule             = Get<PFN_vkDestroyShaderModule>(_device, "vkDestroyShaderModule");
+				vkDestroySwapchainKHR             = Get<PFN_vkDestroySwapchainKHR>(_device, "vkDestroySwapchainKHR");
+				vkDeviceWaitIdle                  = Get<PFN_vkDeviceWaitIdle>(_device, "vkDeviceWaitIdle");
+				vkEndCommandBuffer                = Get<PFN_vkEndCommandBuffer>(_device, "vkEndCommandBuffer");
+				vkFlushMappedMemoryRanges         = Get<PFN_vkFlushMappedMemoryRanges>(_device, "vkFlushMappedMemoryRanges");
+				vkFreeCommandBuffers              = Get<PFN_vkFreeCommandBuffers>(_device, "vkFreeCommandBuffers");
+				vkFreeDescriptorSets              = Get<PFN_vkFreeDescriptorSets>(_device, "vkFreeDescriptorSets");
+				vkFreeMemory                      = Get<PFN_vkFreeMemory>(_device, "vkFreeMemory");
+				vkGetBufferMemoryRequirements     = Get<PFN_vkGetBufferMemoryRequirements>(_device, "vkGetBufferMemoryRequirements");
+				vkGetDescriptorSetLayoutSupport   = Get<PFN_vkGetDescriptorSetLayoutSupport>(_device, "vkGetDescriptorSetLayoutSupport");
+				vkGetDeviceQueue                  = Get<PFN_vkGetDeviceQueue>(_device, "vkGetDeviceQueue");
+				vkGetDeviceQueue2                 = Get<PFN_vkGetDeviceQueue2>(_device, "vkGetDeviceQueue2");
+				vkGetEventStatus                  = Get<PFN_vkGetEventStatus>(_device, "vkGetEventStatus");
+				vkGetFenceStatus                  = Get<PFN_vkGetFenceStatus>(_device, "vkGetFenceStatus");
+				vkGetImageMemoryRequirements      = Get<PFN_vkGetImageMemoryRequirements>(_device, "vkGetImageMemoryRequirements");
+				vkGetImageSubresourceLayout       = Get<PFN_vkGetImageSubresourceLayout>(_device, "vkGetImageSubresourceLayout");
+				vkGetPipelineCacheData            = Get<PFN_vkGetPipelineCacheData>(_device, "vkGetPipelineCacheData");
+				vkGetQueryPoolResults             = Get<PFN_vkGetQueryPoolResults>(_device, "vkGetQueryPoolResults");
+				vkGetSemaphoreCounterValue        = Get<PFN_vkGetSemaphoreCounterValue>(_device, "vkGetSemaphoreCounterValue");
+				vkGetSwapchainImagesKHR           = Get<PFN_vkGetSwapchainImagesKHR>(_device, "vkGetSwapchainImagesKHR");
+				vkGetSwapchainStatusKHR           = Get<PFN_vkGetSwapchainStatusKHR>(_device, "vkGetSwapchainStatusKHR");
+				vkInvalidateMappedMemoryRanges    = Get<PFN_vkInvalidateMappedMemoryRanges>(_device, "vkInvalidateMappedMemoryRanges");
+				vkMapMemory                       = Get<PFN_vkMapMemory>(_device, "vkMapMemory");
+				vkMergePipelineCaches             = Get<PFN_vkMergePipelineCaches>(_device, "vkMergePipelineCaches");
+				vkQueuePresentKHR                 = Get<PFN_vkQueuePresentKHR>(_device, "vkQueuePresentKHR");
+				vkQueueSubmit                     = Get<PFN_vkQueueSubmit>(_device, "vkQueueSubmit");
+				vkQueueWaitIdle                   = Get<PFN_vkQueueWaitIdle>(_device, "vkQueueWaitIdle");
+				vkResetCommandBuffer              = Get<PFN_vkResetCommandBuffer>(_device, "vkResetCommandBuffer");
+				vkResetCommandPool                = Get<PFN_vkResetCommandPool>(_device, "vkResetCommandPool");
+				vkResetDescriptorPool             = Get<PFN_vkResetDescriptorPool>(_device, "vkResetDescriptorPool");
+				vkResetEvent                      = Get<PFN_vkResetEvent>(_device, "vkResetEvent");
+				vkResetFences                     = Get<PFN_vkResetFences>(_device, "vkResetFences");
+				vkResetQueryPool                  = Get<PFN_vkResetQueryPool>(_device, "vkResetQueryPool");
+				vkSetEvent                        = Get<PFN_vkSetEvent>(_device, "vkSetEvent");
+				vkSignalSemaphore                 = Get<PFN_vkSignalSemaphore>(_device, "vkSignalSemaphore");
+				vkTrimCommandPool                 = Get<PFN_vkTrimCommandPool>(_device, "vkTrimCommandPool");
+				vkUnmapMemory                     = Get<PFN_vkUnmapMemory>(_device, "vkUnmapMemory");
+				vkUpdateDescriptorSetWithTemplate = Get<PFN_vkUpdateDescriptorSetWithTemplate>(_device, "vkUpdateDescriptorSetWithTemplate");
+				vkUpdateDescriptorSets            = Get<PFN_vkUpdateDescriptorSets>(_device, "vkUpdateDescriptorSets");
+				vkWaitForFences                   = Get<PFN_vkWaitForFences>(_device, "vkWaitForFences");
+				vkWaitSemaphores                  = Get<PFN_vkWaitSemaphores>(_device, "vkWaitSemaphores");
+			}
+
+			/**
+			@brief Uses the loader exports. (Extension procedures the loader does not export are null)
+			*/
+			void LoadExports()
+			{
+				vkAcquireNextImageKHR             = ::vkAcquireNextImageKHR;
+				vkAllocateCommandBuffers          = ::vkAllocateCommandBuffers;
+				vkAllocateDescriptorSets          = ::vkAllocateDescriptorSets;
+				vkAllocateMemory                  = ::vkAllocateMemory;
+				vkBeginCommandBuffer              = ::vkBeginCommandBuffer;
+				vkBindBufferMemory                = ::vkBindBufferMemory;
+				vkBindImageMemory                 = ::vkBindImageMemory;
+				vkCmdBeginQuery                   = ::vkCmdBeginQuery;
+				vkCmdBeginRenderPass              = ::vkCmdBeginRenderPass;
+				vkCmdBindDescriptorSets           = ::vkCmdBindDescriptorSets;
+				vkCmdBindIndexBuffer              = ::vkCmdBindIndexBuffer;
+				vkCmdBindPipeline                 = ::vkCmdBindPipeline;
+				vkCmdBindVertexBuffers            = ::vkCmdBindVertexBuffers;
+				vkCmdBlitImage                    = ::vkCmdBlitImage;
+				vkCmdCopyBuffer                   = ::vkCmdCopyBuffer;
+				vkCmdCopyBufferToImage            = ::vkCmdCopyBufferToImage;
+				vkCmdCopyQueryPoolResults         = ::vkCmdCopyQueryPoolResults;
+				vkCmdDraw                         = ::vkCmdDraw;
+				vkCmdDrawIndexed                  = ::vkCmdDrawIndexed;
+				vkCmdEndQuery                     = ::vkCmdEndQuery;
+				vkCmdEndRenderPass                = ::vkCmdEndRenderPass;
+				vkCmdExecuteCommands              = ::vkCmdExecuteCommands;
+				vkCmdPipelineBarrier              = ::vkCmdPipelineBarrier;
+				vkCmdPushConstants                = ::vkCmdPushConstants;
+				vkCmdResetEvent                   = ::vkCmdResetEvent;
+				vkCmdResetQueryPool               = ::vkCmdResetQueryPool;
+				vkCmdSetDeviceMask                = ::vkCmdSetDeviceMask;
+				vkCmdSetEvent                     = ::vkCmdSetEvent;
+				vkCmdSetScissor                   = ::vkCmdSetScissor;
+				vkCmdSetViewport                  = ::vkCmdSetViewport;
+				vkCmdWaitEvents                   = ::vkCmdWaitEvents;
+				vkCmdWriteTimestamp               = ::vkCmdWriteTimestamp;
+				vkCreateBuffer                    = ::vkCreateBuffer;
+				vkCreateBufferView                = ::vkCreateBufferView;
+				vkCreateCommandPool               = ::vkCreateCommandPool;
+				vkCreateComputePipelines          = ::vkCreateComputePipelines;
+				vkCreateDescriptorPool            = ::vkCreateDescriptorPool;
+				vkCreateDescriptorSetLayout       = ::vkCreateDescriptorSetLayout;
+				vkCreateDescriptorUpdateTemplate  = ::vkCreateDescriptorUpdateTemplate;
+				vkCreateEvent                     = ::vkCreateEvent;
+				vkCreateFence                     = ::vkCreateFence;
+				vkCreateFramebuffer               = ::vkCreateFramebuffer;
+				vkCreateGraphicsPipelines         = ::vkCreateGraphicsPipelines;
+				vkCreateImage                     = ::vkCreateImage;
+				vkCreateImageView                 = ::vkCreateImageView;
+				vkCreatePipelineCache             = ::vkCreatePipelineCache;
+				vkCreatePipelineLayout            = ::vkCreatePipelineLayout;
+				vkCreateQueryPool                 = ::vkCreateQueryPool;
+				vkCreateRenderPass                = ::vkCreateRenderPass;
+				vkCreateSampler                   = ::vkCreateSampler;
+				vkCreateSemaphore                 = ::vkCreateSemaphore;
+				vkCreateShaderModule              = ::vkCreateShaderModule;
+				vkCreateSwapchainKHR              = ::vkCreateSwapchainKHR;
+				vkDestroyBuffer                   = ::vkDestroyBuffer;
+				vkDestroyBufferView               = ::vkDestroyBufferView;
+				vkDestroyCommandPool              = ::vkDestroyCommandPool;
+				vkDestroyDescriptorPool           = ::vkDestroyDescriptorPool;
+				vkDestroyDescriptorSetLayout      = ::vkDestroyDescriptorSetLayout;
+				vkDestroyDescriptorUpdateTemplate = ::vkDestroyDescriptorUpdateTemplate;
+				vkDestroyDevice                   = ::vkDestroyDevice;
+				vkDestroyEvent                    = ::vkDestroyEvent;
+				vkDestroyFence                    = ::vkDestroyFence;
+				vkDestroyFramebuffer              = ::vkDestroyFramebuffer;
+				vkDestroyImage                    = ::vkDestroyImage;
+				vkDestroyImageView                = ::vkDestroyImageView;
+				vkDestroyPipeline                 = ::vkDestroyPipeline;
+				vkDestroyPipelineCache            = ::vkDestroyPipelineCache;
+				vkDestroyPipelineLayout           = ::vkDestroyPipelineLayout;
+				vkDestroyQueryPool                = ::vkDestroyQueryPool;
+				vkDestroyRenderPass               = ::vkDestroyRenderPass;
+				vkDestroySampler                  = ::vkDestroySampler;
+				vkDestroySemaphore                = ::vkDestroySemaphore;
+				vkDestroyShaderModule             = ::vkDestroyShaderModule;
+				vkDestroySwapchainKHR             = ::vkDestroySwapchainKHR;
+				vkDeviceWaitIdle                  = ::vkDeviceWaitIdle;
+				vkEndCommandBuffer                = ::vkEndCommandBuffer;
+				vkFlushMappedMemoryRanges         = ::vkFlushMappedMemoryRanges;
+				vkFreeCommandBuffers              = ::vkFreeCommandBuffers;
+				vkFreeDescriptorSets              = ::vkFreeDescriptorSets;
+				vkFreeMemory                      = ::vkFreeMemory;
+				vkGetBufferMemoryRequirements     = ::vkGetBufferMemoryRequirements;
+				vkGetDescriptorSetLayoutSupport   = ::vkGetDescriptorSetLayoutSupport;
+				vkGetDeviceQueue                  = ::vkGetDeviceQueue;
+				vkGetDeviceQueue2                 = ::vkGetDeviceQueue2;
+				vkGetEventStatus                  = ::vkGetEventStatus;
+				vkGetFenceStatus                  = ::vkGetFenceStatus;
+				vkGetImageMemoryRequirements      = ::vkGetImageMemoryRequirements;
+				vkGetImageSubresourceLayout       = ::vkGetImageSubresourceLayout;
+				vkGetPipelineCacheData            = ::vkGetPipelineCacheData;
+				vkGetQueryPoolResults             = ::vkGetQueryPoolResults;
+				vkGetSemaphoreCounterValue        = ::vkGetSemaphoreCounterValue;
+				vkGetSwapchainImagesKHR           = ::vkGetSwapchainImagesKHR;
+				vkGetSwapchainStatusKHR           = nullptr;
+				vkInvalidateMappedMemoryRanges    = ::vkInvalidateMappedMemoryRanges;
+				vkMapMemory                       = ::vkMapMemory;
+				vkMergePipelineCaches             = ::vkMergePipelineCaches;
+				vkQueuePresentKHR                 = ::vkQueuePresentKHR;
+				vkQueueSubmit                     = ::vkQueueSubmit;
+				vkQueueWaitIdle                   = ::vkQueueWaitIdle;
+				vkResetCommandBuffer              = ::vkResetCommandBuffer;
+				vkResetCommandPool                = ::vkResetCommandPool;
+				vkResetDescriptorPool             = ::vkResetDescriptorPool;
+				vkResetEvent                      = ::vkResetEvent;
+				vkResetFences                     = ::vkResetFences;
+				vkResetQueryPool                  = ::vkResetQueryPool;
+				vkSetEvent                        = ::vkSetEvent;
+				vkSignalSemaphore                 = ::vkSignalSemaphore;
+				vkTrimCommandPool                 = ::vkTrimCommandPool;
+				vkUnmapMemory                     = ::vkUnmapMemory;
+				vkUpdateDescriptorSetWithTemplate = ::vkUpdateDescriptorSetWithTemplate;
+				vkUpdateDescriptorSets            = ::vkUpdateDescriptorSets;
+				vkWaitForFences                   = ::vkWaitForFences;
+				vkWaitSemaphores                  = ::vkWaitSemaphores;
+			}
+
+		protected:
+
+			template<typename Procedure>
+			static Procedure Get(VkDevice _device, const char* _procedureName)
+			{
+				return reinterpret_cast<Procedure>(::vkGetDeviceProcAddr(_device, _procedureName));
+			}
+		};
+
+		/**
+		@brief Maximum amount of devices with a registered table at a time.
+		*/
+		static constexpr ui32 MaxDevices = 8;
+
+		/**
+		@brief Provides the dispatch key of a dispatchable object.
+
+		@details
+		The loader starts every dispatchable object with a pointer to its dispatch table, and gives a device's queues and
+		command buffers the device's. The pointer identifies the device any of them belong to.
+		*/
+		template<typename DispatchableHandle>
+		inline const void* GetDispatchKey(DispatchableHandle _object)
+		{
+			return *reinterpret_cast<const void* const*>(_object);
+		}
+
+		/**
+		@brief The tables of the devices registered, found by dispatch key.
+
+		@details
+		Slots are only written while holding the lock. A slot's table is written before its key is published,
+		so a call finds either nothing or the complete table of its device.
+		*/
+		namespace Registry
+		{
+			struct Slot
+			{
+				std::atomic<const void*> Key   ;
+				VkDevice                 Device;
+				DeviceTable              Table ;
+			};
+
+			inline Slot Slots[MaxDevices] {};
+
+			inline std::atomic<ui32> SlotCount { 0 };   ///< Slots that were ever used, so lookups scan no further.
+
+			inline std::mutex Lock;
+
+			inline const DeviceTable Exports = []()
+			{
+				DeviceTable exports {};
+
+				exports.LoadExports();
+
+				return exports;
+			}();
+		}
+
+		/**
+		@brief Provides the table of the device with the dispatch key specified. (The loader exports if it is not registered)
+
+		@details Slots are scanned in the order devices were registered, a device registered first is found on the first compare.
+		*/
+		inline const DeviceTable& FindDeviceTable(const void* _dispatchKey)
+		{
+			const ui32 slotCount = Registry::SlotCount.load(std::memory_order_acquire);
+
+			for (ui32 index = 0; index < slotCount; index++)
+			{
+				if (Registry::Slots[index].Key.load(std::memory_order_acquire) == _dispatchKey) return Registry::Slots[index].Table;
+			}
+
+			return Registry::Exports;
+		}
+
+		/**
+		@brief Registers a device's table, so calls on its objects go through it.
+
+		@details
+		Must be done before the device's objects are used through the entry points.
+		Returns false when MaxDevices are already registered, the device's calls then go through the loader exports.
+		*/
+		inline bool RegisterDevice(const DeviceTable& _table, VkDevice _device)
+		{
+			std::lock_guard<std::mutex> guard(Registry::Lock);
+
+			const ui32 slotCount = Registry::SlotCount.load(std::memory_order_relaxed);
+
+			ui32 index = 0;
+
+			while (index < slotCount && Registry::Slots[index].Device != VK_NULL_HANDLE) index++;
+
+			if (index == MaxDevices) return false;
+
+			Registry::Slot& slot = Registry::Slots[index];
+
+			slot.Device = _device;
+			slot.Table  = _table ;
+
+			slot.Key.store(GetDispatchKey(_device), std::memory_order_release);
+
+			if (index == slotCount) Registry::SlotCount.store(slotCount + 1, std::memory_order_release);
+
+			return true;
+		}
+
+		/**
+		@brief Removes a device's table. (Before the device is destroyed, once nothing calls on its objects)
+		*/
+		inline void UnregisterDevice(VkDevice _device)
+		{
+			std::lock_guard<std::mutex> guard(Registry::Lock);
+
+			const ui32 slotCount = Registry::SlotCount.load(std::memory_order_relaxed);
+
+			for (ui32 index = 0; index < slotCount; index++)
+			{
+				Registry::Slot& slot = Registry::Slots[index];
+
+				if (slot.Device != _device) continue;
+
+				slot.Key.store(nullptr, std::memory_order_release);
+
+				slot.Device = VK_NULL_HANDLE;
+			}
+		}
+
+		/**
+		@brief Checks if the device's table is registered.
+		*/
+		inline bool IsRegistered(VkDevice _device)
+		{
+			return &FindDeviceTable(GetDispatchKey(_device)) != &Registry::Exports;
+		}
+
+		/**
+		@brief Calls a device level procedure through the table of the device the dispatchable object (first parameter) belongs to.
+
+		@details Entry points are objects rather than functions, so that unqualified calls in the vaults cannot be taken by argument dependent lookup.
+		*/
+		template<auto Procedure>
+		struct Entry;
+
+		template<typename ReturnType, typename DispatchableHandle, typename... ParameterTypes, ReturnType (VKAPI_PTR* DeviceTable::* Procedure)(DispatchableHandle, ParameterTypes...)>
+		struct Entry<Procedure>
+		{
+			ReturnType operator() (DispatchableHandle _object, ParameterTypes... _parameters) const
+			{
+				return (FindDeviceTable(GetDispatchKey(_object)).*Procedure)(_object, _parameters...);
+			}
+		};
+
+		/**
+		@brief Entry points called by the vaults for the device level procedures.
+		*/
+		namespace Entries
+		{
+			inline constexpr Entry<&DeviceTable::vkAcquireNextImageKHR>             vkAcquireNextImageKHR             {};
+			inline constexpr Entry<&DeviceTable::vkAllocateCommandBuffers>          vkAllocateCommandBuffers          {};
+			inline constexpr Entry<&DeviceTable::vkAllocateDescriptorSets>          vkAllocateDescriptorSets          {};
+			inline constexpr Entry<&DeviceTable::vkAllocateMemory>                  vkAllocateMemory                  {};
+			inline constexpr Entry<&DeviceTable::vkBeginCommandBuffer>              vkBeginCommandBuffer              {};
+			inline constexpr Entry<&DeviceTable::vkBindBufferMemory>                vkBindBufferMemory                {};
+			inline constexpr Entry<&DeviceTable::vkBindImageMemory>                 vkBindImageMemory                 {};
+			inline constexpr Entry<&DeviceTable::vkCmdBeginQuery>                   vkCmdBeginQuery                   {};
+			inline constexpr Entry<&DeviceTable::vkCmdBeginRenderPass>              vkCmdBeginRenderPass              {};
+			inline constexpr Entry<&DeviceTable::vkCmdBindDescriptorSets>           vkCmdBindDescriptorSets           {};
+			inline constexpr Entry<&DeviceTable::vkCmdBindIndexBuffer>              vkCmdBindIndexBuffer              {};
+			inline constexpr Entry<&DeviceTable::vkCmdBindPipeline>                 vkCmdBindPipeline                 {};
+			inline constexpr Entry<&DeviceTable::vkCmdBindVertexBuffers>            vkCmdBindVertexBuffers            {};
+			inline constexpr Entry<&DeviceTable::vkCmdBlitImage>                    vkCmdBlitImage                    {};
+			inline constexpr Entry<&DeviceTable::vkCmdCopyBuffer>                   vkCmdCopyBuffer                   {};
+			inline constexpr Entry<&DeviceTable::vkCmdCopyBufferToImage>            vkCmdCopyBufferToImage            {};
+			inline constexpr Entry<&DeviceTable::vkCmdCopyQueryPoolResults>         vkCmdCopyQueryPoolResults         {};
+			inline constexpr Entry<&DeviceTable::vkCmdDraw>                         vkCmdDraw                         {};
+			inline constexpr Entry<&DeviceTable::vkCmdDrawIndexed>                  vkCmdDrawIndexed                  {};
+			inline constexpr Entry<&DeviceTable::vkCmdEndQuery>                     vkCmdEndQuery                     {};
+			inline constexpr Entry<&DeviceTable::vkCmdEndRenderPass>                vkCmdEndRenderPass                {};
+			inline constexpr Entry<&DeviceTable::vkCmdExecuteCommands>              vkCmdExecuteCommands              {};
+			inline constexpr Entry<&DeviceTable::vkCmdPipelineBarrier>              vkCmdPipelineBarrier              {};
+			inline constexpr Entry<&DeviceTable::vkCmdPushConstants>                vkCmdPushConstants                {};
+			inline constexpr Entry<&DeviceTable::vkCmdResetEvent>                   vkCmdResetEvent                   {};
+			inline constexpr Entry<&DeviceTable::vkCmdResetQueryPool>               vkCmdResetQueryPool               {};
+			inline constexpr Entry<&DeviceTable::vkCmdSetDeviceMask>                vkCmdSetDeviceMask                {};
+			inline constexpr Entry<&DeviceTable::vkCmdSetEvent>                     vkCmdSetEvent                     {};
+			inline constexpr Entry<&DeviceTable::vkCmdSetScissor>                   vkCmdSetScissor                   {};
+			inline constexpr Entry<&DeviceTable::vkCmdSetViewport>                  vkCmdSetViewport                  {};
+			inline constexpr Entry<&DeviceTable::vkCmdWaitEvents>                   vkCmdWaitEvents                   {};
+			inline constexpr Entry<&DeviceTable::vkCmdWriteTimestamp>               vkCmdWriteTimestamp               {};
+			inline constexpr Entry<&DeviceTable::vkCreateBuffer>                    vkCreateBuffer                    {};
+			inline constexpr Entry<&DeviceTable::vkCreateBufferView>                vkCreateBufferView                {};
+			inline constexpr Entry<&DeviceTable::vkCreateCommandPool>               vkCreateCommandPool               {};
+			inline constexpr Entry<&DeviceTable::vkCreateComputePipelines>          vkCreateComputePipelines          {};
+			inline constexpr Entry<&DeviceTable::vkCreateDescriptorPool>            vkCreateDescriptorPool            {};
+			inline constexpr Entry<&DeviceTable::vkCreateDescriptorSetLayout>       vkCreateDescriptorSetLayout       {};
+			inline constexpr Entry<&DeviceTable::vkCreateDescriptorUpdateTemplate>  vkCreateDescriptorUpdateTemplate  {};
+			inline constexpr Entry<&DeviceTable::vkCreateEvent>                     vkCreateEvent                     {};
+			inline constexpr Entry<&DeviceTable::vkCreateFence>                     vkCreateFence                     {};
+			inline constexpr Entry<&DeviceTable::vkCreateFramebuffer>               vkCreateFramebuffer               {};
+			inline constexpr Entry<&DeviceTable::vkCreateGraphicsPipelines>         vkCreateGraphicsPipelines         {};
+			inline constexpr Entry<&DeviceTable::vkCreateImage>                     vkCreateImage                     {};
+			inline constexpr Entry<&DeviceTable::vkCreateImageView>                 vkCreateImageView                 {};
+			inline constexpr Entry<&DeviceTable::vkCreatePipelineCache>             vkCreatePipelineCache             {};
+			inline constexpr Entry<&DeviceTable::vkCreatePipelineLayout>            vkCreatePipelineLayout            {};
+			inline constexpr Entry<&DeviceTable::vkCreateQueryPool>                 vkCreateQueryPool                 {};
+			inline constexpr Entry<&DeviceTable::vkCreateRenderPass>                vkCreateRenderPass                {};
+			inline constexpr Entry<&DeviceTable::vkCreateSampler>                   vkCreateSampler                   {};
+			inline constexpr Entry<&DeviceTable::vkCreateSemaphore>                 vkCreateSemaphore                 {};
+			inline constexpr Entry<&DeviceTable::vkCreateShaderModule>              vkCreateShaderModule              {};
+			inline constexpr Entry<&DeviceTable::vkCreateSwapchainKHR>              vkCreateSwapchainKHR              {};
+			inline constexpr Entry<&DeviceTable::vkDestroyBuffer>                   vkDestroyBuffer                   {};
+			inline constexpr Entry<&DeviceTable::vkDestroyBufferView>               vkDestroyBufferView               {};
+			inline constexpr Entry<&DeviceTable::vkDestroyCommandPool>              vkDestroyCommandPool              {};
+			inline constexpr Entry<&DeviceTable::vkDestroyDescriptorPool>           vkDestroyDescriptorPool           {};
+			inline constexpr Entry<&DeviceTable::vkDestroyDescriptorSetLayout>      vkDestroyDescriptorSetLayout      {};
+			inline constexpr Entry<&DeviceTable::vkDestroyDescriptorUpdateTemplate> vkDestroyDescriptorUpdateTemplate {};
+			inline constexpr Entry<&DeviceTable::vkDestroyDevice>                   vkDestroyDevice                   {};
+			inline constexpr Entry<&DeviceTable::vkDestroyEvent>                    vkDestroyEvent                    {};
+			inline constexpr Entry<&DeviceTable::vkDestroyFence>                    vkDestroyFence                    {};
+			inline constexpr Entry<&DeviceTable::vkDestroyFramebuffer>              vkDestroyFramebuffer              {};
+			inline constexpr Entry<&DeviceTable::vkDestroyImage>                    vkDestroyImage                    {};
+			inline constexpr Entry<&DeviceTable::vkDestroyImageView>                vkDestroyImageView                {};
+			inline constexpr Entry<&DeviceTable::vkDestroyPipeline>                 vkDestroyPipeline                 {};
+			inline constexpr Entry<&DeviceTable::vkDestroyPipelineCache>            vkDestroyPipelineCache            {};
+			inline constexpr Entry<&DeviceTable::vkDestroyPipelineLayout>           vkDestroyPipelineLayout           {};
+			inline constexpr Entry<&DeviceTable::vkDestroyQueryPool>                vkDestroyQueryPool                {};
+			inline constexpr Entry<&DeviceTable::vkDestroyRenderPass>               vkDestroyRenderPass               {};
+			inline constexpr Entry<&DeviceTable::vkDestroySampler>                  vkDestroySampler                  {};
+			inline constexpr Entry<&DeviceTable::vkDestroySemaphore>                vkDestroySemaphore                {};
+			inline constexpr Entry<&DeviceTable::vkDestroyShaderModule>             vkDestroyShaderModule             {};
+			inline constexpr Entry<&DeviceTable::vkDestroySwapchainKHR>             vkDestroySwapchainKHR             {};
+			inline constexpr Entry<&DeviceTable::vkDeviceWaitIdle>                  vkDeviceWaitIdle                  {};
+			inline constexpr Entry<&DeviceTable::vkEndCommandBuffer>                vkEndCommandBuffer                {};
+			inline constexpr Entry<&DeviceTable::vkFlushMappedMemoryRanges>         vkFlushMappedMemoryRanges         {};
+			inline constexpr Entry<&DeviceTable::vkFreeCommandBuffers>              vkFreeCommandBuffers              {};
+			inline constexpr Entry<&DeviceTable::vkFreeDescriptorSets>              vkFreeDescriptorSets              {};
+			inline constexpr Entry<&DeviceTable::vkFreeMemory>                      vkFreeMemory                      {};
+			inline constexpr Entry<&DeviceTable::vkGetBufferMemoryRequirements>     vkGetBufferMemoryRequirements     {};
+			inline constexpr Entry<&DeviceTable::vkGetDescriptorSetLayoutSupport>   vkGetDescriptorSetLayoutSupport   {};
+			inline constexpr Entry<&DeviceTable::vkGetDeviceQueue>                  vkGetDeviceQueue                  {};
+			inline constexpr Entry<&DeviceTable::vkGetDeviceQueue2>                 vkGetDeviceQueue2                 {};
+			inline constexpr Entry<&DeviceTable::vkGetEventStatus>                  vkGetEventStatus                  {};
+			inline constexpr Entry<&DeviceTable::vkGetFenceStatus>                  vkGetFenceStatus                  {};
+			inline constexpr Entry<&DeviceTable::vkGetImageMemoryRequirements>      vkGetImageMemoryRequirements      {};
+			inline constexpr Entry<&DeviceTable::vkGetImageSubresourceLayout>       vkGetImageSubresourceLayout       {};
+			inline constexpr Entry<&DeviceTable::vkGetPipelineCacheData>            vkGetPipelineCacheData            {};
+			inline constexpr Entry<&DeviceTable::vkGetQueryPoolResults>             vkGetQueryPoolResults             {};
+			inline constexpr Entry<&DeviceTable::vkGetSemaphoreCounterValue>        vkGetSemaphoreCounterValue        {};
+			inline constexpr Entry<&DeviceTable::vkGetSwapchainImagesKHR>           vkGetSwapchainImagesKHR           {};
+			inline constexpr Entry<&DeviceTable::vkGetSwapchainStatusKHR>           vkGetSwapchainStatusKHR           {};
+			inline constexpr Entry<&DeviceTable::vkInvalidateMappedMemoryRanges>    vkInvalidateMappedMemoryRanges    {};
+			inline constexpr Entry<&DeviceTable::vkMapMemory>                       vkMapMemory                       {};
+			inline constexpr Entry<&DeviceTable::vkMergePipelineCaches>             vkMergePipelineCaches             {};
+			inline constexpr Entry<&DeviceTable::vkQueuePresentKHR>                 vkQueuePresentKHR                 {};
+			inline constexpr Entry<&DeviceTable::vkQueueSubmit>                     vkQueueSubmit                     {};
+			inline constexpr Entry<&DeviceTable::vkQueueWaitIdle>                   vkQueueWaitIdle                   {};
+			inline constexpr Entry<&DeviceTable::vkResetCommandBuffer>              vkResetCommandBuffer              {};
+			inline constexpr Entry<&DeviceTable::vkResetCommandPool>                vkResetCommandPool                {};
+			inline constexpr Entry<&DeviceTable::vkResetDescriptorPool>             vkResetDescriptorPool             {};
+			inline constexpr Entry<&DeviceTable::vkResetEvent>                      vkResetEvent                      {};
+			inline constexpr Entry<&DeviceTable::vkResetFences>                     vkResetFences                     {};
+			inline constexpr Entry<&DeviceTable::vkResetQueryPool>                  vkResetQueryPool                  {};
+			inline constexpr Entry<&DeviceTable::vkSetEvent>                        vkSetEvent                        {};
+			inline constexpr Entry<&DeviceTable::vkSignalSemaphore>                 vkSignalSemaphore                 {};
+			inline constexpr Entry<&DeviceTable::vkTrimCommandPool>                 vkTrimCommandPool                 {};
+			inline constexpr Entry<&DeviceTable::vkUnmapMemory>                     vkUnmapMemory                     {};
+			inline constexpr Entry<&DeviceTable::vkUpdateDescriptorSetWithTemplate> vkUpdateDescriptorSetWithTemplate {};
+			inline constexpr Entry<&DeviceTable::vkUpdateDescriptorSets>            vkUpdateDescriptorSets            {};
+			inline constexpr Entry<&DeviceTable::vkWaitForFences>                   vkWaitForFences                   {};
+			inline constexpr Entry<&DeviceTable::vkWaitSemaphores>                  vkWaitSemaphores                  {};
+		}
+
+		/** @} */	// Vault_MagmaChamber
+	}
+
+	#ifndef VV_Option__Instrument_Calls
+	// (When instrumented, the instrumentation's wrappers call the entry points instead)
+	using namespace Vault_MagmaChamber::Entries;
+	#endif
+}
+
+#endif
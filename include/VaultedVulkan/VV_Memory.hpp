@@ -60,6 +60,22 @@ namespace VaultedVulkan
 			*/
 			static constexpr DeviceSize ZeroOffset = 0;
 
+			/**
+			@brief Structure specifying a mapped memory range.
+
+			@details <a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#VkMappedMemoryRange">Specification</a>
+
+			@ingroup APISpec_Memory_Allocation
+			*/
+			struct MappedRange : V0::VKStruct_Base<VkMappedMemoryRange, EStructureType::MappedMemoryRange>
+			{
+				      EType      SType  = STypeEnum;
+				const void*      Next   = nullptr  ;
+				      Handle     Memory;
+				      DeviceSize Offset;
+				      DeviceSize Size  ;
+			};
+
 			/**
 			* @brief Allocate memory objects.
 			* 
@@ -84,6 +100,23 @@ namespace VaultedVulkan
 				return EResult(vkAllocateMemory(_device, _allocateInfo, *_allocator, &_memory) );
 			}
 
+			/**
+			* @brief Flush host writes of mapped memory ranges so they are made available to the device. (Only needed for non-coherent memory)
+			* 
+			* @details <a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#vkFlushMappedMemoryRanges">Specification</a>
+			* 
+			* @ingroup APISpec_Memory_Allocation
+			* 
+			* \param _device
+			* \param _rangeCount
+			* \param _ranges
+			* \return 
+			*/
+			static EResult FlushMappedRanges(LogicalDevice::Handle _device, ui32 _rangeCount, const MappedRange* _ranges)
+			{
+				return EResult(vkFlushMappedMemoryRanges(_device, _rangeCount, *_ranges));
+			}
+
 			/**
 			* @brief Free a memory object.
 			*
@@ -101,6 +134,23 @@ namespace VaultedVulkan
 				vkFreeMemory(_device, _memory, *_allocator);
 			}
 
+			/**
+			* @brief Invalidate mapped memory ranges so device writes are made visible to the host. (Only needed for non-coherent memory)
+			* 
+			* @details <a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#vkInvalidateMappedMemoryRanges">Specification</a>
+			* 
+			* @ingroup APISpec_Memory_Allocation
+			* 
+			* \param _device
+			* \param _rangeCount
+			* \param _ranges
+			* \return 
+			*/
+			static EResult InvalidateMappedRanges(LogicalDevice::Handle _device, ui32 _rangeCount, const MappedRange* _ranges)
+			{
+				return EResult(vkInvalidateMappedMemoryRanges(_device, _rangeCount, *_ranges));
+			}
+
 			/** 
 			* @brief Retrieve a host virtual address pointer to a region of a mappable memory object.
 			* 
@@ -331,6 +381,34 @@ namespace VaultedVulkan
 				device = nullptr     ;
 			}
 
+			/**
+			@brief Flush a range of the mapped memory object so host writes are made available to the device.
+			*/
+			EResult FlushMappedRange(DeviceSize _offset, DeviceSize _size) const
+			{
+				MappedRange range;
+
+				range.Memory = handle ;
+				range.Offset = _offset;
+				range.Size   = _size  ;
+
+				return Parent::FlushMappedRanges(*device, 1, &range);
+			}
+
+			/**
+			@brief Invalidate a range of the mapped memory object so device writes are made visible to the host.
+			*/
+			EResult InvalidateMappedRange(DeviceSize _offset, DeviceSize _size) const
+			{
+				MappedRange range;
+
+				range.Memory = handle ;
+				range.Offset = _offset;
+				range.Size   = _size  ;
+
+				return Parent::InvalidateMappedRanges(*device, 1, &range);
+			}
+
 			/**
 			@brief Retrieve a host virtual address pointer to a region of a mappable memory object.
 			*/
@@ -350,6 +428,8 @@ namespace VaultedVulkan
 			/**
 			@brief Writes to GPU memory by mapping to device memory specified by a
 			handle and then using memcpy to copy data specified in _data.
+
+			@details For frequent uploads use an UploadRing instead, which keeps its memory mapped.
 			*/
 			void WriteToGPU(DeviceSize _offset, DeviceSize _size, MapFlags _flags, RoVoidPtr& _data) const
 			{
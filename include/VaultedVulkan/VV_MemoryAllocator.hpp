@@ -0,0 +1,1323 @@
+/*!
+@file VV_MemoryAllocator.hpp
+
+@brief Vaulted Vulkan: Memory Allocator
+
+@details Contains pooled sub-allocation of device memory.
+
+Device memory allocations are expensive and limited in count (see Limits::MaxMemoryAllocationCount).
+Instead of a memory object per resource, large blocks are allocated per memory type and resources are bound at offsets within them.
+
+<a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#memory-device">Specification</a>
+*/
+
+
+
+#pragma once
+
+
+
+// VV
+#include "VV_Vaults.hpp"
+#include "VV_APISpecGroups.hpp"
+#include "VV_Platform.hpp"
+#include "VV_CPP_STL.hpp"
+#include "VV_Enums.hpp"
+#include "VV_Backend.hpp"
+#include "VV_Types.hpp"
+#include "VV_Constants.hpp"
+#include "VV_Memory_Backend.hpp"
+#include "VV_PhysicalDevice.hpp"
+#include "VV_Initialization.hpp"
+#include "VV_LogicalDevice.hpp"
+#include "VV_Memory.hpp"
+#include "VV_Sampler.hpp"
+#include "VV_Resource.hpp"
+
+
+
+#ifdef _MSC_VER
+	#include <intrin.h>
+#endif
+
+
+
+#ifndef VV_Option__Use_Long_Namespace
+namespace VV
+#else
+namespace VaultedVulkan
+#endif
+{
+	namespace V3
+	{
+		/**
+		@addtogroup Vault_3
+		@{
+		*/
+
+		/**
+		@brief Two-level segregated fit (TLSF) bookkeeping of a single block of device memory.
+
+		@details
+		This is a pure host structure: it only tracks offsets and never touches the device.
+		Allocation and free are constant time in the common case.
+
+		Alignment and the buffer-image granularity are respected: linear and non-linear resources
+		placed next to each other will never share a page of the granularity size.
+
+		<a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#resources-bufferimagegranularity">Specification</a>
+		*/
+		class MemoryBlockAllocator
+		{
+		public:
+
+			using NodeID = ui32;
+
+			/**
+			@brief Used to specify an invalid node.
+			*/
+			static constexpr NodeID InvalidNode = 4294967295;
+
+			/**
+			@brief A region of the block handed out by the allocator.
+			*/
+			struct Allocation
+			{
+				DeviceSize Offset = 0          ;
+				DeviceSize Size   = 0          ;
+				NodeID     Node   = InvalidNode;
+			};
+
+			/**
+			@brief Default constructor.
+			*/
+			MemoryBlockAllocator() : capacity(0), granularity(1), usedSize(0), allocationCount(0), firstLevelBitmap(0)
+			{
+				secondLevelBitmaps.fill(0);
+
+				for (auto& heads : freeHeads) heads.fill(InvalidNode);
+			}
+
+			/**
+			@brief Capacity and buffer-image granularity specified.
+			*/
+			MemoryBlockAllocator(DeviceSize _capacity, DeviceSize _granularity) : MemoryBlockAllocator()
+			{
+				Reset(_capacity, _granularity);
+			}
+
+			/**
+			@brief Allocate a region of the block.
+
+			@details The tiling specifies if the resource is linear (buffers, linear images) or not; this is used to respect the buffer-image granularity.
+
+			@return false if there is no free region that can fit the request.
+			*/
+			bool Allocate(DeviceSize _size, DeviceSize _alignment, EImageTiling _tiling, Allocation& _allocation)
+			{
+				if (_size == 0 || _size > capacity - usedSize) return false;
+
+				if (_alignment == 0) _alignment = 1;
+
+				ui32 firstLevel, secondLevel;
+
+				Mapping(_size, firstLevel, secondLevel);
+
+				while (FindFreeBin(firstLevel, secondLevel))
+				{
+					for (NodeID node = freeHeads[firstLevel][secondLevel]; node != InvalidNode; node = nodes[node].NextFree)
+					{
+						DeviceSize offset;
+
+						if (CheckFit(node, _size, _alignment, _tiling, offset))
+						{
+							Split(node, offset, _size, _tiling);
+
+							_allocation.Offset = offset;
+							_allocation.Size   = _size ;
+							_allocation.Node   = node  ;
+
+							return true;
+						}
+					}
+
+					if (++secondLevel == SecondLevel_Count)
+					{
+						secondLevel = 0;
+
+						if (++firstLevel == FirstLevel_Count) return false;
+					}
+				}
+
+				return false;
+			}
+
+			/**
+			@brief Return a region to the block, merging it with its free neighbors.
+			*/
+			void Free(const Allocation& _allocation)
+			{
+				NodeID node = _allocation.Node;
+
+				if (node == InvalidNode || nodes[node].Free) return;
+
+				usedSize -= nodes[node].Size;
+
+				allocationCount--;
+
+				nodes[node].Free = true;
+
+				NodeID previous = nodes[node].PrevPhysical;
+
+				if (previous != InvalidNode && nodes[previous].Free)
+				{
+					RemoveFree(previous);
+
+					nodes[previous].Size += nodes[node].Size;
+
+					Unlink(node);
+
+					node = previous;
+				}
+
+				NodeID next = nodes[node].NextPhysical;
+
+				if (next != InvalidNode && nodes[next].Free)
+				{
+					RemoveFree(next);
+
+					nodes[node].Size += nodes[next].Size;
+
+					Unlink(next);
+				}
+
+				InsertFree(node);
+			}
+
+			/**
+			@brief Drops all allocations and starts over with a single free region of the given capacity.
+			*/
+			void Reset(DeviceSize _capacity, DeviceSize _granularity)
+			{
+				capacity        = _capacity                         ;
+				granularity     = _granularity > 0 ? _granularity : 1;
+				usedSize        = 0                                 ;
+				allocationCount = 0                                 ;
+
+				nodes      .clear();
+				unusedNodes.clear();
+
+				firstLevelBitmap = 0;
+
+				secondLevelBitmaps.fill(0);
+
+				for (auto& heads : freeHeads) heads.fill(InvalidNode);
+
+				if (capacity == 0) return;
+
+				NodeID node = AcquireNode();
+
+				nodes[node].Offset = 0       ;
+				nodes[node].Size   = capacity;
+
+				InsertFree(node);
+			}
+
+			ui32 GetAllocationCount() const
+			{
+				return allocationCount;
+			}
+
+			DeviceSize GetCapacity() const
+			{
+				return capacity;
+			}
+
+			DeviceSize GetUsedSize() const
+			{
+				return usedSize;
+			}
+
+			bool IsEmpty() const
+			{
+				return allocationCount == 0;
+			}
+
+		protected:
+
+			static constexpr ui32 SecondLevel_Log2  = 5                           ;
+			static constexpr ui32 SecondLevel_Count = 1 << SecondLevel_Log2       ;
+			static constexpr ui32 FirstLevel_Count  = 64 - SecondLevel_Log2 + 1   ;
+
+			struct Node
+			{
+				DeviceSize   Offset       = 0                    ;
+				DeviceSize   Size         = 0                    ;
+				NodeID       PrevPhysical = InvalidNode          ;
+				NodeID       NextPhysical = InvalidNode          ;
+				NodeID       PrevFree     = InvalidNode          ;
+				NodeID       NextFree     = InvalidNode          ;
+				EImageTiling Tiling       = EImageTiling::Linear ;
+				bool         Free         = true                 ;
+			};
+
+			static DeviceSize AlignUp(DeviceSize _value, DeviceSize _alignment)
+			{
+				return (_value + _alignment - 1) & ~(_alignment - 1);
+			}
+
+			static ui32 FindHighestBit(u64 _mask)
+			{
+			#ifdef _MSC_VER
+				unsigned long index; _BitScanReverse64(&index, _mask); return ui32(index);
+			#else
+				return ui32(63 - __builtin_clzll(_mask));
+			#endif
+			}
+
+			static ui32 FindLowestBit(u64 _mask)
+			{
+			#ifdef _MSC_VER
+				unsigned long index; _BitScanForward64(&index, _mask); return ui32(index);
+			#else
+				return ui32(__builtin_ctzll(_mask));
+			#endif
+			}
+
+			/**
+			@brief Linear (buffer) and non-linear (optimal image) resources must not share a granularity page.
+			*/
+			static bool IsTilingConflict(EImageTiling _first, EImageTiling _second)
+			{
+				return (_first == EImageTiling::Linear) != (_second == EImageTiling::Linear);
+			}
+
+			/**
+			@brief Finds the first and second level bin for the size.
+			*/
+			static void Mapping(DeviceSize _size, ui32& _firstLevel, ui32& _secondLevel)
+			{
+				if (_size < SecondLevel_Count)
+				{
+					_firstLevel  = 0         ;
+					_secondLevel = ui32(_size);
+
+					return;
+				}
+
+				ui32 highestBit = FindHighestBit(_size);
+
+				_firstLevel  = highestBit - SecondLevel_Log2 + 1;
+				_secondLevel = ui32(_size >> (highestBit - SecondLevel_Log2)) ^ SecondLevel_Count;
+			}
+
+			bool OnSamePage(DeviceSize _lastByteOfFirst, DeviceSize _firstByteOfSecond) const
+			{
+				return (_lastByteOfFirst & ~(granularity - 1)) == (_firstByteOfSecond & ~(granularity - 1));
+			}
+
+			NodeID AcquireNode()
+			{
+				NodeID node;
+
+				if (unusedNodes.empty())
+				{
+					node = NodeID(nodes.size());
+
+					nodes.push_back(Node());
+				}
+				else
+				{
+					node = unusedNodes.back();
+
+					unusedNodes.pop_back();
+
+					nodes[node] = Node();
+				}
+
+				return node;
+			}
+
+			/**
+			@brief Checks if the free node can hold the request, providing the offset the allocation would start at.
+			*/
+			bool CheckFit(NodeID _node, DeviceSize _size, DeviceSize _alignment, EImageTiling _tiling, DeviceSize& _offset) const
+			{
+				const Node& block = nodes[_node];
+
+				_offset = AlignUp(block.Offset, _alignment);
+
+				if (granularity > 1 && block.PrevPhysical != InvalidNode)
+				{
+					const Node& previous = nodes[block.PrevPhysical];
+
+					if (IsTilingConflict(previous.Tiling, _tiling) && OnSamePage(previous.Offset + previous.Size - 1, _offset))
+					{
+						_offset = AlignUp(_offset, granularity);
+					}
+				}
+
+				if (_offset + _size > block.Offset + block.Size) return false;
+
+				if (granularity > 1 && block.NextPhysical != InvalidNode)
+				{
+					const Node& next = nodes[block.NextPhysical];
+
+					if (!next.Free && IsTilingConflict(next.Tiling, _tiling) && OnSamePage(_offset + _size - 1, next.Offset))
+					{
+						return false;
+					}
+				}
+
+				return true;
+			}
+
+			/**
+			@brief Finds the first non-empty bin at or above the one specified.
+			*/
+			bool FindFreeBin(ui32& _firstLevel, ui32& _secondLevel) const
+			{
+				u64 secondLevelMap = secondLevelBitmaps[_firstLevel] & (~u64(0) << _secondLevel);
+
+				if (secondLevelMap == 0)
+				{
+					if (_firstLevel + 1 >= FirstLevel_Count) return false;
+
+					u64 firstLevelMap = firstLevelBitmap & (~u64(0) << (_firstLevel + 1));
+
+					if (firstLevelMap == 0) return false;
+
+					_firstLevel    = FindLowestBit(firstLevelMap);
+					secondLevelMap = secondLevelBitmaps[_firstLevel];
+				}
+
+				_secondLevel = FindLowestBit(secondLevelMap);
+
+				return true;
+			}
+
+			void InsertFree(NodeID _node)
+			{
+				ui32 firstLevel, secondLevel;
+
+				Mapping(nodes[_node].Size, firstLevel, secondLevel);
+
+				NodeID& head = freeHeads[firstLevel][secondLevel];
+
+				nodes[_node].Free     = true       ;
+				nodes[_node].PrevFree = InvalidNode;
+				nodes[_node].NextFree = head       ;
+
+				if (head != InvalidNode) nodes[head].PrevFree = _node;
+
+				head = _node;
+
+				firstLevelBitmap                |= u64 (1) << firstLevel ;
+				secondLevelBitmaps[firstLevel]  |= ui32(1) << secondLevel;
+			}
+
+			void RemoveFree(NodeID _node)
+			{
+				ui32 firstLevel, secondLevel;
+
+				Mapping(nodes[_node].Size, firstLevel, secondLevel);
+
+				Node& node = nodes[_node];
+
+				if (node.PrevFree != InvalidNode) nodes[node.PrevFree].NextFree = node.NextFree;
+				if (node.NextFree != InvalidNode) nodes[node.NextFree].PrevFree = node.PrevFree;
+
+				NodeID& head = freeHeads[firstLevel][secondLevel];
+
+				if (head == _node) head = node.NextFree;
+
+				if (head == InvalidNode)
+				{
+					secondLevelBitmaps[firstLevel] &= ~(ui32(1) << secondLevel);
+
+					if (secondLevelBitmaps[firstLevel] == 0) firstLevelBitmap &= ~(u64(1) << firstLevel);
+				}
+
+				node.PrevFree = InvalidNode;
+				node.NextFree = InvalidNode;
+			}
+
+			/**
+			@brief Carves the allocation out of a free node, returning the leftover front and back regions to the free lists.
+			*/
+			void Split(NodeID _node, DeviceSize _offset, DeviceSize _size, EImageTiling _tiling)
+			{
+				RemoveFree(_node);
+
+				DeviceSize blockOffset = nodes[_node].Offset                      ;
+				DeviceSize blockEnd    = nodes[_node].Offset + nodes[_node].Size  ;
+
+				if (_offset > blockOffset)
+				{
+					NodeID front = AcquireNode();
+
+					nodes[front].Offset       = blockOffset                ;
+					nodes[front].Size         = _offset - blockOffset      ;
+					nodes[front].PrevPhysical = nodes[_node].PrevPhysical  ;
+					nodes[front].NextPhysical = _node                      ;
+
+					if (nodes[front].PrevPhysical != InvalidNode) nodes[nodes[front].PrevPhysical].NextPhysical = front;
+
+					nodes[_node].PrevPhysical = front;
+
+					InsertFree(front);
+				}
+
+				if (_offset + _size < blockEnd)
+				{
+					NodeID back = AcquireNode();
+
+					nodes[back].Offset       = _offset + _size            ;
+					nodes[back].Size         = blockEnd - (_offset + _size);
+					nodes[back].PrevPhysical = _node                      ;
+					nodes[back].NextPhysical = nodes[_node].NextPhysical  ;
+
+					if (nodes[back].NextPhysical != InvalidNode) nodes[nodes[back].NextPhysical].PrevPhysical = back;
+
+					nodes[_node].NextPhysical = back;
+
+					InsertFree(back);
+				}
+
+				nodes[_node].Offset = _offset;
+				nodes[_node].Size   = _size  ;
+				nodes[_node].Tiling = _tiling;
+				nodes[_node].Free   = false  ;
+
+				usedSize += _size;
+
+				allocationCount++;
+			}
+
+			/**
+			@brief Removes a node from the physical chain and recycles it.
+			*/
+			void Unlink(NodeID _node)
+			{
+				NodeID previous = nodes[_node].PrevPhysical;
+				NodeID next     = nodes[_node].NextPhysical;
+
+				if (previous != InvalidNode) nodes[previous].NextPhysical = next    ;
+				if (next     != InvalidNode) nodes[next    ].PrevPhysical = previous;
+
+				unusedNodes.push_back(_node);
+			}
+
+			DeviceSize capacity;
+
+			DeviceSize granularity;
+
+			DeviceSize usedSize;
+
+			ui32 allocationCount;
+
+			DynamicArray<Node> nodes;
+
+			DynamicArray<NodeID> unusedNodes;
+
+			u64 firstLevelBitmap;
+
+			std::array<ui32, FirstLevel_Count> secondLevelBitmaps;
+
+			std::array<std::array<NodeID, SecondLevel_Count>, FirstLevel_Count> freeHeads;
+		};
+
+		/**
+		@brief Pools device memory into large blocks per memory type and sub-allocates resources from them.
+
+		@details
+		Blocks that are host visible are persistently mapped for their lifetime.
+		Requests larger than the block size get a dedicated block of their own.
+
+		Not thread safe: externally synchronize access to a pool.
+		*/
+		class MemoryPool
+		{
+		public:
+
+			/**
+			@brief Default size of a block of device memory. (64 MiB)
+			*/
+			static constexpr DeviceSize DefaultBlockSize = 64ull * 1024ull * 1024ull;
+
+			/**
+			@brief A region of a pooled memory block bound to a resource.
+			*/
+			class SubAllocation
+			{
+			public:
+
+				SubAllocation() : memory(nullptr), offset(0), size(0), mappedData(nullptr), blockIndex(0), node(MemoryBlockAllocator::InvalidNode)
+				{}
+
+				/**
+				@brief The device memory object this region belongs to.
+				*/
+				const Memory& GetMemory() const
+				{
+					return *memory;
+				}
+
+				DeviceSize GetOffset() const
+				{
+					return offset;
+				}
+
+				DeviceSize GetSize() const
+				{
+					return size;
+				}
+
+				/**
+				@brief Host address of the region if the memory is host visible, otherwise nullptr.
+				*/
+				VoidPtr GetMappedData() const
+				{
+					return mappedData;
+				}
+
+				bool IsValid() const
+				{
+					return memory != nullptr;
+				}
+
+			protected:
+
+				friend class MemoryPool;
+
+				const Memory* memory;
+
+				DeviceSize offset;
+				DeviceSize size  ;
+
+				VoidPtr mappedData;
+
+				ui32                         blockIndex;
+				MemoryBlockAllocator::NodeID node      ;
+			};
+
+			/**
+			@brief Default constructor.
+			*/
+			MemoryPool() : blockSize(DefaultBlockSize), allocator(Memory::DefaultAllocator), device(nullptr)
+			{}
+
+			/**
+			@brief Logical device specified.
+			*/
+			MemoryPool(const LogicalDevice& _device) : blockSize(DefaultBlockSize), allocator(Memory::DefaultAllocator), device(&_device)
+			{}
+
+			/**
+			@brief Logical device and block size specified.
+			*/
+			MemoryPool(const LogicalDevice& _device, DeviceSize _blockSize) : blockSize(_blockSize), allocator(Memory::DefaultAllocator), device(&_device)
+			{}
+
+			/**
+			@brief Logical device, block size, and allocator specified.
+			*/
+			MemoryPool(const LogicalDevice& _device, DeviceSize _blockSize, const Memory::AllocationCallbacks& _allocator) :
+				blockSize(_blockSize), allocator(&_allocator), device(&_device)
+			{}
+
+			/**
+			@brief Performs a move operation to transfer ownership of the device memory to this host object.
+			*/
+			MemoryPool(MemoryPool&& _other) noexcept :
+				blocks(std::move(_other.blocks)), blockSize(_other.blockSize), allocator(std::move(_other.allocator)), device(std::move(_other.device))
+			{
+				_other.blocks.clear();
+
+				_other.allocator = Memory::DefaultAllocator;
+				_other.device    = nullptr                 ;
+			}
+
+			/**
+			@brief Frees all blocks of device memory.
+			*/
+			~MemoryPool()
+			{
+				if (!blocks.empty()) Destroy();
+			}
+
+			/**
+			@brief Sub-allocate a region that satisfies the memory requirements with a memory type that has the properties specified.
+			*/
+			EResult Allocate
+			(
+				const Memory::Requirements&  _requirements,
+				      Memory::PropertyFlags  _properties  ,
+				      EImageTiling           _tiling      ,
+				      SubAllocation&         _allocation
+			)
+			{
+				if (device == nullptr) return EResult::Not_Ready;
+
+				ui32 memoryTypeIndex = device->GetPhysicalDevice().FindMemoryType(_requirements.MemoryTypeBits, _properties);
+
+				if (memoryTypeIndex == InvalidMemoryType) return EResult::Error_FeatureNotPresent;
+
+				bool dedicated = _requirements.Size > blockSize;
+
+				if (!dedicated)
+				{
+					for (ui32 index = 0; index < blocks.size(); index++)
+					{
+						Block& block = blocks[index];
+
+						if (block.memoryTypeIndex != memoryTypeIndex || block.dedicated) continue;
+
+						if (Suballocate(index, _requirements, _tiling, _allocation)) return EResult::Success;
+					}
+				}
+
+				ui32 blockIndex;
+
+				EResult returnCode = CreateBlock(memoryTypeIndex, dedicated ? _requirements.Size : blockSize, dedicated, blockIndex);
+
+				if (returnCode != EResult::Success) return returnCode;
+
+				if (!Suballocate(blockIndex, _requirements, _tiling, _allocation)) return EResult::Error_OutOfDeviceMemory;
+
+				return EResult::Success;
+			}
+
+			/**
+			@brief Sub-allocate memory for the buffer and bind it.
+			*/
+			EResult Allocate(Buffer& _buffer, Memory::PropertyFlags _properties, SubAllocation& _allocation)
+			{
+				EResult returnCode = Allocate(_buffer.GetMemoryRequirements(), _properties, EImageTiling::Linear, _allocation);
+
+				if (returnCode != EResult::Success) return returnCode;
+
+				return _buffer.BindMemory(_allocation.GetMemory(), _allocation.GetOffset());
+			}
+
+			/**
+			@brief Sub-allocate memory for the image and bind it.
+			*/
+			EResult Allocate(Image& _image, EImageTiling _tiling, Memory::PropertyFlags _properties, SubAllocation& _allocation)
+			{
+				EResult returnCode = Allocate(_image.GetMemoryRequirements(), _properties, _tiling, _allocation);
+
+				if (returnCode != EResult::Success) return returnCode;
+
+				return _image.BindMemory(_allocation.GetMemory(), _allocation.GetOffset());
+			}
+
+			/**
+			@brief Frees every block of device memory. Outstanding sub-allocations become invalid.
+			*/
+			void Destroy()
+			{
+				for (auto& block : blocks)
+				{
+					if (block.memoryTypeIndex != InvalidMemoryType) ReleaseBlock(block);
+				}
+
+				blocks.clear();
+			}
+
+			/**
+			@brief Return a region to its block. Dedicated blocks are released immediately.
+			*/
+			void Free(SubAllocation& _allocation)
+			{
+				if (!_allocation.IsValid()) return;
+
+				Block& block = blocks[_allocation.blockIndex];
+
+				MemoryBlockAllocator::Allocation region;
+
+				region.Offset = _allocation.offset;
+				region.Size   = _allocation.size  ;
+				region.Node   = _allocation.node  ;
+
+				block.allocator.Free(region);
+
+				if (block.dedicated && block.allocator.IsEmpty()) ReleaseBlock(block);
+
+				_allocation = SubAllocation();
+			}
+
+			/**
+			@brief Releases all blocks of device memory that no longer have any sub-allocations.
+			*/
+			void Trim()
+			{
+				for (auto& block : blocks)
+				{
+					if (block.memoryTypeIndex != InvalidMemoryType && block.allocator.IsEmpty()) ReleaseBlock(block);
+				}
+			}
+
+			/**
+			@brief Number of device memory objects currently allocated by the pool.
+			*/
+			ui32 GetBlockCount() const
+			{
+				ui32 count = 0;
+
+				for (const auto& block : blocks)
+				{
+					if (block.memoryTypeIndex != InvalidMemoryType) count++;
+				}
+
+				return count;
+			}
+
+			/**
+			@brief Total amount of device memory sub-allocated to resources.
+			*/
+			DeviceSize GetUsedSize() const
+			{
+				DeviceSize size = 0;
+
+				for (const auto& block : blocks) size += block.allocator.GetUsedSize();
+
+				return size;
+			}
+
+			/**
+			@brief Performs a move assignment operation to transfer ownership of the device memory to this host object.
+			*/
+			MemoryPool& operator= (MemoryPool&& _other) noexcept
+			{
+				if (this == &_other)
+					return *this;
+
+				if (!blocks.empty()) Destroy();
+
+				blocks    = std::move(_other.blocks   );
+				blockSize = _other.blockSize           ;
+				allocator = std::move(_other.allocator);
+				device    = std::move(_other.device   );
+
+				_other.blocks.clear();
+
+				_other.allocator = Memory::DefaultAllocator;
+				_other.device    = nullptr                 ;
+
+				return *this;
+			}
+
+		protected:
+
+			static constexpr ui32 InvalidMemoryType = PhysicalDevice::MemoryTypeTable::NotFound;
+
+			struct Block
+			{
+				Memory               memory                               ;
+				MemoryBlockAllocator allocator                            ;
+				ui32                 memoryTypeIndex = InvalidMemoryType  ;
+				VoidPtr              mappedData      = nullptr            ;
+				bool                 dedicated       = false              ;
+			};
+
+			EResult CreateBlock(ui32 _memoryTypeIndex, DeviceSize _size, bool _dedicated, ui32& _blockIndex)
+			{
+				_blockIndex = ui32(blocks.size());
+
+				// Reuse the slot of a released block (blocks are kept in a deque so sub-allocations can point at their memory).
+				for (ui32 index = 0; index < blocks.size(); index++)
+				{
+					if (blocks[index].memoryTypeIndex == InvalidMemoryType) { _blockIndex = index; break; }
+				}
+
+				if (_blockIndex == blocks.size()) blocks.emplace_back();
+
+				Block& block = blocks[_blockIndex];
+
+				Memory::AllocateInfo info;
+
+				info.AllocationSize  = _size           ;
+				info.MemoryTypeIndex = _memoryTypeIndex;
+
+				EResult returnCode = allocator == Memory::DefaultAllocator
+					? block.memory.Allocate(*device, info)
+					: block.memory.Allocate(*device, info, *allocator);
+
+				if (returnCode != EResult::Success) return returnCode;
+
+				const auto& memoryType = device->GetPhysicalDevice().GetMemoryProperties().Types[_memoryTypeIndex];
+
+				if (memoryType.PropertyFlags.HasFlag(EMemoryPropertyFlag::HostVisible))
+				{
+					returnCode = block.memory.Map(Memory::ZeroOffset, WholeSize, Memory::MapFlags(), block.mappedData);
+
+					if (returnCode != EResult::Success)
+					{
+						block.memory.Free();
+
+						return returnCode;
+					}
+				}
+
+				block.allocator.Reset(_size, device->GetPhysicalDevice().GetProperties().LimitsSpec.BufferImageGranularity);
+
+				block.memoryTypeIndex = _memoryTypeIndex;
+				block.dedicated       = _dedicated      ;
+
+				return EResult::Success;
+			}
+
+			void ReleaseBlock(Block& _block)
+			{
+				if (_block.mappedData != nullptr) _block.memory.Unmap();
+
+				_block.memory.Free();
+
+				_block.allocator.Reset(0, 1);
+
+				_block.memoryTypeIndex = InvalidMemoryType;
+				_block.mappedData      = nullptr          ;
+				_block.dedicated       = false            ;
+			}
+
+			bool Suballocate(ui32 _blockIndex, const Memory::Requirements& _requirements, EImageTiling _tiling, SubAllocation& _allocation)
+			{
+				Block& block = blocks[_blockIndex];
+
+				MemoryBlockAllocator::Allocation region;
+
+				if (!block.allocator.Allocate(_requirements.Size, _requirements.Alignment, _tiling, region)) return false;
+
+				_allocation.memory     = &block.memory ;
+				_allocation.offset     = region.Offset ;
+				_allocation.size       = region.Size   ;
+				_allocation.blockIndex = _blockIndex   ;
+				_allocation.node       = region.Node   ;
+
+				_allocation.mappedData = block.mappedData != nullptr
+					? static_cast<VoidPtr>(static_cast<u8*>(block.mappedData) + region.Offset)
+					: nullptr;
+
+				return true;
+			}
+
+			Deque<Block> blocks;
+
+			DeviceSize blockSize;
+
+			const Memory::AllocationCallbacks* allocator;
+
+			const LogicalDevice* device;
+		};
+
+		/**
+		@brief Host bookkeeping of a frame fenced ring of memory.
+
+		@details
+		Allocations are made linearly from the head and wrap around to the start when the end is reached.
+		The tail only advances when a frame is retired: EndFrame marks the head with a monotonic frame value
+		(frame number, timeline semaphore value, etc) and Retire releases every frame up to the completed value.
+
+		This is a pure host structure: it only tracks offsets and never touches the device.
+		*/
+		class RingAllocator
+		{
+		public:
+
+			/**
+			@brief Default constructor.
+			*/
+			RingAllocator() : capacity(0), head(0), tail(0), consumed(0), retired(0)
+			{}
+
+			/**
+			@brief Capacity specified.
+			*/
+			RingAllocator(DeviceSize _capacity) : capacity(_capacity), head(0), tail(0), consumed(0), retired(0)
+			{}
+
+			/**
+			@brief Allocate a region from the head of the ring.
+
+			@return false if the ring does not have enough space until frames are retired.
+			*/
+			bool Allocate(DeviceSize _size, DeviceSize _alignment, DeviceSize& _offset)
+			{
+				if (_size == 0 || _size > capacity) return false;
+
+				if (_alignment == 0) _alignment = 1;
+
+				if (GetUsedSize() == 0) Rewind();
+
+				DeviceSize offset = (head + _alignment - 1) & ~(_alignment - 1);
+
+				if (head > tail || GetUsedSize() == 0)
+				{
+					// Free space is from the head to the end of the ring, then from the start to the tail.
+
+					if (offset + _size <= capacity)
+					{
+						consumed += offset + _size - head;
+						head      = offset + _size       ;
+						_offset   = offset               ;
+
+						return true;
+					}
+
+					if (_size > tail) return false;
+
+					consumed += (capacity - head) + _size;
+					head      = _size                    ;
+					_offset   = 0                        ;
+
+					return true;
+				}
+
+				if (head < tail && offset + _size <= tail)
+				{
+					consumed += offset + _size - head;
+					head      = offset + _size       ;
+					_offset   = offset               ;
+
+					return true;
+				}
+
+				return false;
+			}
+
+			/**
+			@brief Marks the end of the allocations made for a frame with its frame value.
+			*/
+			void EndFrame(u64 _frameValue)
+			{
+				Frame frame;
+
+				frame.Value    = _frameValue;
+				frame.Head     = head       ;
+				frame.Consumed = consumed   ;
+
+				frames.push_back(frame);
+			}
+
+			/**
+			@brief Releases the allocations of every frame with a value less than or equal to the completed value.
+			*/
+			void Retire(u64 _completedValue)
+			{
+				while (!frames.empty() && frames.front().Value <= _completedValue)
+				{
+					tail    = frames.front().Head    ;
+					retired = frames.front().Consumed;
+
+					frames.pop_front();
+				}
+
+				if (GetUsedSize() == 0) Rewind();
+			}
+
+			/**
+			@brief Drops all allocations and frames.
+			*/
+			void Reset(DeviceSize _capacity)
+			{
+				capacity = _capacity;
+				head     = 0        ;
+				tail     = 0        ;
+				consumed = 0        ;
+				retired  = 0        ;
+
+				frames.clear();
+			}
+
+			DeviceSize GetCapacity() const
+			{
+				return capacity;
+			}
+
+			DeviceSize GetHead() const
+			{
+				return head;
+			}
+
+			DeviceSize GetTail() const
+			{
+				return tail;
+			}
+
+			/**
+			@brief Amount of the ring in use by frames that have not been retired (includes padding lost to alignment and wrapping).
+			*/
+			DeviceSize GetUsedSize() const
+			{
+				return DeviceSize(consumed - retired);
+			}
+
+		protected:
+
+			struct Frame
+			{
+				u64        Value   ;
+				DeviceSize Head    ;
+				u64        Consumed;
+			};
+
+			/**
+			@brief Moves the head and tail of an empty ring back to the start, so that a request the size of the ring can fit.
+
+			@details Frames still pending are empty (nothing was allocated since), so their heads are moved along.
+			*/
+			void Rewind()
+			{
+				head = 0;
+				tail = 0;
+
+				for (Frame& frame : frames) frame.Head = 0;
+			}
+
+			DeviceSize capacity;
+
+			DeviceSize head;
+			DeviceSize tail;
+
+			u64 consumed;
+			u64 retired ;
+
+			Deque<Frame> frames;
+		};
+
+		/**
+		@brief A persistently mapped ring buffer used to stage uploads to the device.
+
+		@details
+		The memory is mapped once on creation instead of a map, memcpy, unmap for every write (See Memory::WriteToGPU).
+		Writes are valid until the frame they were made in is retired, which must only happen once the device is done reading them
+		(ex: the frame's fence was waited on, or a timeline semaphore reached the value).
+
+		If the memory is not host coherent, the written ranges are flushed (aligned to the non-coherent atom size) by Flush or EndFrame.
+		*/
+		class UploadRing
+		{
+		public:
+
+			/**
+			@brief Default constructor.
+			*/
+			UploadRing() : mappedData(nullptr), coherent(false), nonCoherentAtomSize(1), device(nullptr)
+			{}
+
+			/**
+			@brief Logical device specified.
+			*/
+			UploadRing(const LogicalDevice& _device) : buffer(_device), memory(_device), mappedData(nullptr), coherent(false), nonCoherentAtomSize(1), device(&_device)
+			{}
+
+			/**
+			@brief Destroys the ring if its memory is still mapped.
+			*/
+			~UploadRing()
+			{
+				if (mappedData != nullptr) Destroy();
+			}
+
+			/**
+			@brief Allocate a region of the ring, providing its offset in the buffer and its host address to write to.
+
+			@return EResult::Not_Ready if the ring is full until frames are retired.
+			*/
+			EResult Allocate(DeviceSize _size, DeviceSize _alignment, DeviceSize& _offset, VoidPtr& _data)
+			{
+				if (mappedData == nullptr) return EResult::Not_Ready;
+
+				if (!ring.Allocate(_size, _alignment, _offset)) return EResult::Not_Ready;
+
+				_data = static_cast<u8*>(mappedData) + _offset;
+
+				if (!coherent)
+				{
+					Memory::MappedRange range;
+
+					range.Memory = memory;
+					range.Offset = _offset & ~(nonCoherentAtomSize - 1);
+					range.Size   = ((_offset + _size + nonCoherentAtomSize - 1) & ~(nonCoherentAtomSize - 1)) - range.Offset;
+
+					if (range.Offset + range.Size > ring.GetCapacity()) range.Size = WholeSize;
+
+					pendingRanges.push_back(range);
+				}
+
+				return EResult::Success;
+			}
+
+			/**
+			@brief Create the ring buffer with a persistently mapped host visible memory.
+			*/
+			EResult Create(DeviceSize _capacity, Buffer::UsageFlags _usage = EBufferUsage::TransferSource)
+			{
+				if (device == nullptr) return EResult::Not_Ready;
+
+				Buffer::CreateInfo info(_usage, ESharingMode::Exclusive);
+
+				info.Size = _capacity;
+
+				EResult returnCode = buffer.Create(*device, info);
+
+				if (returnCode != EResult::Success) return returnCode;
+
+				const PhysicalDevice&        physicalDevice = device->GetPhysicalDevice()  ;
+				const Memory::Requirements&  requirements   = buffer.GetMemoryRequirements();
+
+				// Prefer coherent memory so no flushes are needed.
+				ui32 memoryTypeIndex = physicalDevice.FindMemoryType
+				(
+					requirements.MemoryTypeBits,
+					Memory::PropertyFlags(EMemoryPropertyFlag::HostVisible ),
+					Memory::PropertyFlags(EMemoryPropertyFlag::HostCoherent)
+				);
+
+				if (memoryTypeIndex == PhysicalDevice::MemoryTypeTable::NotFound) return EResult::Error_FeatureNotPresent;
+
+				Memory::AllocateInfo allocateInfo;
+
+				allocateInfo.AllocationSize  = requirements.Size;
+				allocateInfo.MemoryTypeIndex = memoryTypeIndex  ;
+
+				returnCode = memory.Allocate(*device, allocateInfo);
+
+				if (returnCode != EResult::Success) return returnCode;
+
+				returnCode = buffer.BindMemory(memory, Memory::ZeroOffset);
+
+				if (returnCode != EResult::Success) return returnCode;
+
+				returnCode = memory.Map(Memory::ZeroOffset, WholeSize, Memory::MapFlags(), mappedData);
+
+				if (returnCode != EResult::Success) return returnCode;
+
+				coherent            = physicalDevice.GetMemoryProperties().Types[memoryTypeIndex].PropertyFlags.HasFlag(EMemoryPropertyFlag::HostCoherent);
+				nonCoherentAtomSize = physicalDevice.GetProperties().LimitsSpec.NonCoherentAtomSize;
+
+				if (nonCoherentAtomSize == 0) nonCoherentAtomSize = 1;
+
+				ring.Reset(_capacity);
+
+				return EResult::Success;
+			}
+
+			/**
+			@brief Create the ring buffer (logical device specified).
+			*/
+			EResult Create(const LogicalDevice& _device, DeviceSize _capacity, Buffer::UsageFlags _usage = EBufferUsage::TransferSource)
+			{
+				device = &_device;
+
+				return Create(_capacity, _usage);
+			}
+
+			/**
+			@brief Unmaps and frees the ring.
+			*/
+			void Destroy()
+			{
+				if (mappedData != nullptr) memory.Unmap();
+
+				buffer.Destroy();
+				memory.Free   ();
+
+				ring.Reset(0);
+
+				pendingRanges.clear();
+
+				mappedData = nullptr;
+			}
+
+			/**
+			@brief Flushes the writes of the frame and marks its end with the frame value.
+			*/
+			EResult EndFrame(u64 _frameValue)
+			{
+				EResult returnCode = Flush();
+
+				ring.EndFrame(_frameValue);
+
+				return returnCode;
+			}
+
+			/**
+			@brief Flush the ranges written since the last flush. (Does nothing for coherent memory)
+			*/
+			EResult Flush()
+			{
+				if (pendingRanges.empty()) return EResult::Success;
+
+				EResult returnCode = Memory::FlushMappedRanges(*device, ui32(pendingRanges.size()), pendingRanges.data());
+
+				pendingRanges.clear();
+
+				return returnCode;
+			}
+
+			/**
+			@brief Releases the regions of every frame with a value less than or equal to the completed value.
+			*/
+			void Retire(u64 _completedValue)
+			{
+				ring.Retire(_completedValue);
+			}
+
+			/**
+			@brief Copy the data into the ring, providing the offset in the buffer it was written to.
+			*/
+			EResult Write(RoVoidPtr _data, DeviceSize _size, DeviceSize _alignment, DeviceSize& _offset)
+			{
+				VoidPtr destination;
+
+				EResult returnCode = Allocate(_size, _alignment, _offset, destination);
+
+				if (returnCode != EResult::Success) return returnCode;
+
+				memcpy(destination, _data, _size);
+
+				return EResult::Success;
+			}
+
+			/**
+			@brief The buffer to use as the source of transfer commands.
+			*/
+			const Buffer& GetBuffer() const
+			{
+				return buffer;
+			}
+
+			const RingAllocator& GetRing() const
+			{
+				return ring;
+			}
+
+			bool IsCoherent() const
+			{
+				return coherent;
+			}
+
+		protected:
+
+			Buffer buffer;
+
+			Memory memory;
+
+			RingAllocator ring;
+
+			VoidPtr mappedData;
+
+			bool coherent;
+
+			DeviceSize nonCoherentAtomSize;
+
+			DynamicArray<Memory::MappedRange> pendingRanges;
+
+			const LogicalDevice* device;
+		};
+
+		/** @} */
+	}
+}
@@ -0,0 +1,654 @@
+/*!
+@file VV_ObjectCache.hpp
+
+@brief Vaulted Vulkan: Object Caches
+
+@details Contains caches that intern device objects by the content of their create info,
+so that identical descriptions (samplers, descriptor set layouts, pipeline layouts, render passes) share a single device object.
+
+Sharing also keeps the amount of live samplers down, which are limited by the device. (maxSamplerAllocationCount)
+
+<a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#limits-maxSamplerAllocationCount">Specification</a>
+*/
+
+
+
+#pragma once
+
+
+
+// VV
+#include "VV_Vaults.hpp"
+#include "VV_APISpecGroups.hpp"
+#include "VV_Platform.hpp"
+#include "VV_CPP_STL.hpp"
+#include "VV_Enums.hpp"
+#include "VV_Backend.hpp"
+#include "VV_Types.hpp"
+#include "VV_Constants.hpp"
+#include "VV_Memory_Backend.hpp"
+#include "VV_PhysicalDevice.hpp"
+#include "VV_Initialization.hpp"
+#include "VV_LogicalDevice.hpp"
+#include "VV_Memory.hpp"
+#include "VV_Sampler.hpp"
+#include "VV_Resource.hpp"
+#include "VV_SyncAndCacheControl.hpp"
+#include "VV_Shaders.hpp"
+#include "VV_Pipelines.hpp"
+#include "VV_RenderPass.hpp"
+#include "VV_StructHash.hpp"
+
+
+
+#ifndef VV_Option__Use_Long_Namespace
+namespace VV
+#else
+namespace VaultedVulkan
+#endif
+{
+	namespace V3
+	{
+		/**
+		@addtogroup Vault_3
+		@{
+		*/
+
+		/**
+		@brief Owns copies of the arrays referenced by a cached create info, so that the cached info outlives the one it was copied from.
+		*/
+		class ObjectCacheStorage
+		{
+		public:
+
+			/**
+			@brief Copies the entries, and provides the copy. (nullptr if there are no entries)
+			*/
+			template<typename Type>
+			const Type* Copy(ui32 _count, const Type* _entries)
+			{
+				static_assert(std::is_trivially_copyable<Type>::value, "Cached entries must be trivially copyable.");
+
+				if (_count == 0 || _entries == nullptr) return nullptr;
+
+				blocks.emplace_back(sizeof(Type) * _count);
+
+				std::memcpy(blocks.back().data(), _entries, sizeof(Type) * _count);
+
+				return reinterpret_cast<const Type*>(blocks.back().data());
+			}
+
+		protected:
+
+			// The blocks never move once allocated, as the deque does not relocate its elements.
+			Deque<DynamicArray<u8>> blocks;
+		};
+
+		/**
+		@brief Interns device objects by the content of their create info, handing out counted references to a single object per unique description.
+
+		@details
+		The traits define the object cached:
+
+		- CreateInfo and Handle types.
+		- Create and Destroy functions of the device object.
+		- A Copy function that deep copies a create info into storage owned by the cache.
+		  It returns false for infos that cannot be copied (a Next chain with structures unknown to the library),
+		  those are still created, but are not shared.
+
+		Lookups compute the hash outside of any lock, and then only lock one of the cache's shards, so that threads looking up different objects rarely contend.
+		Releasing a reference never locks.
+
+		Objects are not destroyed when their last reference is released (The description is likely to be requested again):
+		Trim destroys the unreferenced objects, Destroy destroys all of them.
+
+		The cache cannot be moved or copied, as its references point into it.
+		*/
+		template<typename Traits>
+		class ObjectCache
+		{
+		public:
+
+			using CreateInfo = typename Traits::CreateInfo;
+			using Handle     = typename Traits::Handle    ;
+
+			/**
+			@brief Lookup and object counts.
+			*/
+			struct Statistics
+			{
+				u64  Hits                = 0;
+				u64  Misses              = 0;
+				ui32 LiveObjects         = 0;
+				ui32 UnreferencedObjects = 0;
+
+				/**
+				@brief Provides the ratio of lookups that found an existing object. (0 if there were no lookups)
+				*/
+				f64 GetHitRate() const
+				{
+					return Hits + Misses != 0 ? f64(Hits) / f64(Hits + Misses) : 0.0;
+				}
+			};
+
+		protected:
+
+			struct Entry;
+
+		public:
+
+			/**
+			@brief A counted reference to a cached object. The object stays alive while referenced.
+			*/
+			class Reference
+			{
+			public:
+
+				/**
+				@brief Default constructor. (References nothing)
+				*/
+				Reference() : entry(nullptr)
+				{}
+
+				/**
+				@brief Adds a reference to the object of the other reference.
+				*/
+				Reference(const Reference& _other) : entry(_other.entry)
+				{
+					if (entry != nullptr) entry->References.fetch_add(1, std::memory_order_relaxed);
+				}
+
+				/**
+				@brief Performs a move operation to transfer the reference to this object.
+				*/
+				Reference(Reference&& _other) noexcept : entry(_other.entry)
+				{
+					_other.entry = nullptr;
+				}
+
+				/**
+				@brief Releases the reference if valid.
+				*/
+				~Reference()
+				{
+					Release();
+				}
+
+				/**
+				@brief Provides the handle of the object referenced. (Null if invalid)
+				*/
+				Handle GetHandle() const
+				{
+					return entry != nullptr ? entry->Object : Null<Handle>;
+				}
+
+				/**
+				@brief Whether the reference references an object.
+				*/
+				bool IsValid() const
+				{
+					return entry != nullptr;
+				}
+
+				/**
+				@brief Releases the reference. (The object is destroyed by the cache's Trim once unreferenced)
+				*/
+				void Release()
+				{
+					if (entry != nullptr) entry->References.fetch_sub(1, std::memory_order_acq_rel);
+
+					entry = nullptr;
+				}
+
+				operator Handle() const
+				{
+					return GetHandle();
+				}
+
+				Reference& operator= (const Reference& _other)
+				{
+					if (this == &_other)
+						return *this;
+
+					if (_other.entry != nullptr) _other.entry->References.fetch_add(1, std::memory_order_relaxed);
+
+					Release();
+
+					entry = _other.entry;
+
+					return *this;
+				}
+
+				Reference& operator= (Reference&& _other) noexcept
+				{
+					if (this == &_other)
+						return *this;
+
+					Release();
+
+					entry = _other.entry;
+
+					_other.entry = nullptr;
+
+					return *this;
+				}
+
+				bool operator== (const Reference& _other) const
+				{
+					return entry == _other.entry;
+				}
+
+			protected:
+
+				friend class ObjectCache;
+
+				Reference(Entry* _entry) : entry(_entry)
+				{}
+
+				Entry* entry;
+			};
+
+			/**
+			@brief Default constructor.
+			*/
+			ObjectCache() : allocator(Memory::DefaultAllocator), device(nullptr)
+			{}
+
+			/**
+			@brief Logical device specified.
+			*/
+			ObjectCache(const LogicalDevice& _device) : allocator(Memory::DefaultAllocator), device(&_device)
+			{}
+
+			/**
+			@brief Logical device and allocator specified.
+			*/
+			ObjectCache(const LogicalDevice& _device, const Memory::AllocationCallbacks* _allocator) : allocator(_allocator), device(&_device)
+			{}
+
+			ObjectCache(const ObjectCache&) = delete;
+
+			ObjectCache& operator= (const ObjectCache&) = delete;
+
+			/**
+			@brief Destroys the cached objects.
+			*/
+			~ObjectCache()
+			{
+				Destroy();
+			}
+
+			/**
+			@brief Provides a reference to the object described by the create info, creating it if no identical description was cached.
+			*/
+			EResult Acquire(const CreateInfo& _info, Reference& _reference)
+			{
+				if (device == nullptr) return EResult::Not_Ready;
+
+				V1::StructHasher hasher;
+
+				hasher.Add(_info);
+
+				const Key key { hasher.GetHash(), &_info };
+
+				Shard& shard = shards[key.Hash % ShardCount];
+
+				std::lock_guard<std::mutex> guard(shard.Lock);
+
+				auto found = shard.Interned.find(key);
+
+				if (found != shard.Interned.end())
+				{
+					found->second->References.fetch_add(1, std::memory_order_relaxed);
+
+					hits.fetch_add(1, std::memory_order_relaxed);
+
+					_reference = Reference(found->second);
+
+					return EResult::Success;
+				}
+
+				misses.fetch_add(1, std::memory_order_relaxed);
+
+				std::unique_ptr<Entry> entry(new Entry);
+
+				const bool copied = Traits::Copy(_info, entry->Storage, entry->Info);
+
+				EResult returnCode = Traits::Create(*device, _info, allocator, entry->Object);
+
+				if (returnCode != EResult::Success) return returnCode;
+
+				entry->References.store(1, std::memory_order_relaxed);
+
+				if (copied) shard.Interned.emplace(Key { key.Hash, &entry->Info }, entry.get());
+
+				entry->Hash     = key.Hash;
+				entry->Interned = copied  ;
+
+				_reference = Reference(entry.get());
+
+				shard.Entries.push_back(std::move(entry));
+
+				return EResult::Success;
+			}
+
+			/**
+			@brief Destroys all the cached objects. (They must no longer be referenced or in use by the device)
+			*/
+			void Destroy()
+			{
+				for (Shard& shard : shards)
+				{
+					std::lock_guard<std::mutex> guard(shard.Lock);
+
+					for (std::unique_ptr<Entry>& entry : shard.Entries)
+					{
+						Traits::Destroy(*device, entry->Object, allocator);
+					}
+
+					shard.Interned.clear();
+					shard.Entries .clear();
+				}
+			}
+
+			Statistics GetStatistics() const
+			{
+				Statistics statistics;
+
+				statistics.Hits   = hits  .load(std::memory_order_relaxed);
+				statistics.Misses = misses.load(std::memory_order_relaxed);
+
+				for (const Shard& shard : shards)
+				{
+					std::lock_guard<std::mutex> guard(shard.Lock);
+
+					statistics.LiveObjects += ui32(shard.Entries.size());
+
+					for (const std::unique_ptr<Entry>& entry : shard.Entries)
+					{
+						if (entry->References.load(std::memory_order_acquire) == 0) statistics.UnreferencedObjects++;
+					}
+				}
+
+				return statistics;
+			}
+
+			/**
+			@brief Resets the hit and miss counts.
+			*/
+			void ResetStatistics()
+			{
+				hits  .store(0, std::memory_order_relaxed);
+				misses.store(0, std::memory_order_relaxed);
+			}
+
+			/**
+			@brief Destroys the objects that are no longer referenced, and provides the amount destroyed.
+			(The objects must no longer be in use by the device)
+			*/
+			ui32 Trim()
+			{
+				ui32 destroyed = 0;
+
+				for (Shard& shard : shards)
+				{
+					std::lock_guard<std::mutex> guard(shard.Lock);
+
+					auto unreferenced = std::stable_partition
+					(
+						shard.Entries.begin(), shard.Entries.end(),
+						[](const std::unique_ptr<Entry>& _entry) { return _entry->References.load(std::memory_order_acquire) != 0; }
+					);
+
+					for (auto entry = unreferenced; entry != shard.Entries.end(); entry++)
+					{
+						if ((*entry)->Interned) shard.Interned.erase(Key { (*entry)->Hash, &(*entry)->Info });
+
+						Traits::Destroy(*device, (*entry)->Object, allocator);
+
+						destroyed++;
+					}
+
+					shard.Entries.erase(unreferenced, shard.Entries.end());
+				}
+
+				return destroyed;
+			}
+
+		protected:
+
+			static constexpr ui32 ShardCount = 16;
+
+			/**
+			@brief A cached object with the copy of the create info that describes it.
+			*/
+			struct Entry
+			{
+				Handle             Object     = Null<Handle>;
+				CreateInfo         Info      ;
+				ObjectCacheStorage Storage   ;
+				std::atomic<ui32>  References { 0 };
+				u64                Hash       = 0    ;
+				bool               Interned   = false;
+			};
+
+			/**
+			@brief The lookup key: the hash is computed once per lookup, the info is only compared on a hash match.
+			*/
+			struct Key
+			{
+				      u64         Hash;
+				const CreateInfo* Info;
+			};
+
+			struct KeyHash
+			{
+				std::size_t operator() (const Key& _key) const
+				{
+					return std::size_t(_key.Hash);
+				}
+			};
+
+			struct KeyEqual
+			{
+				bool operator() (const Key& _left, const Key& _right) const
+				{
+					return _left.Hash == _right.Hash && V1::StructComparer::Equal(*_left.Info, *_right.Info);
+				}
+			};
+
+			struct Shard
+			{
+				mutable std::mutex Lock;
+
+				std::unordered_map<Key, Entry*, KeyHash, KeyEqual> Interned;
+
+				DynamicArray<std::unique_ptr<Entry>> Entries;
+			};
+
+			std::array<Shard, ShardCount> shards;
+
+			std::atomic<u64> hits { 0 };
+
+			std::atomic<u64> misses { 0 };
+
+			const Memory::AllocationCallbacks* allocator;
+
+			const LogicalDevice* device;
+		};
+
+		/**
+		@brief Object cache traits of samplers.
+		*/
+		struct SamplerCacheTraits
+		{
+			using CreateInfo = V1::Sampler::CreateInfo;
+			using Handle     = V1::Sampler::Handle    ;
+
+			static bool Copy(const CreateInfo& _info, ObjectCacheStorage& /*_storage*/, CreateInfo& _copy)
+			{
+				_copy = _info;
+
+				return _info.Next == nullptr;
+			}
+
+			static EResult Create(const LogicalDevice& _device, const CreateInfo& _info, const Memory::AllocationCallbacks* _allocator, Handle& _handle)
+			{
+				return V1::Sampler::Create(_device, _info, _allocator, _handle);
+			}
+
+			static void Destroy(const LogicalDevice& _device, Handle _handle, const Memory::AllocationCallbacks* _allocator)
+			{
+				V1::Sampler::Destroy(_device, _handle, _allocator);
+			}
+		};
+
+		/**
+		@brief Object cache traits of descriptor set layouts.
+		*/
+		struct DescriptorSetLayoutCacheTraits
+		{
+			using CreateInfo = V1::Pipeline::Layout::DescriptorSet::CreateInfo;
+			using Handle     = V1::Pipeline::Layout::DescriptorSet::Handle    ;
+
+			using Binding         = V1::Pipeline::Layout::DescriptorSet::Binding;
+			using FlagsCreateInfo = Binding::FlagsCreateInfo                    ;
+
+			static bool Copy(const CreateInfo& _info, ObjectCacheStorage& _storage, CreateInfo& _copy)
+			{
+				_copy = _info;
+
+				Binding* bindings = const_cast<Binding*>(_storage.Copy(_info.BindingCount, _info.Bindings));
+
+				// Only sampler bindings read their immutable samplers, the pointer of any other binding may be garbage.
+				for (ui32 index = 0; bindings != nullptr && index < _info.BindingCount; index++)
+				{
+					bindings[index].ImmutableSamplers = V1::StructHasher::TakesImmutableSamplers(bindings[index].Type)
+						? _storage.Copy(bindings[index].Count, bindings[index].ImmutableSamplers)
+						: nullptr;
+				}
+
+				_copy.Bindings = bindings;
+				_copy.Next     = nullptr ;
+
+				// Only the binding flags can be chained to a cached layout.
+				const void** link = &_copy.Next;
+
+				for (const VkBaseInStructure* next = static_cast<const VkBaseInStructure*>(_info.Next); next != nullptr; next = next->pNext)
+				{
+					if (EStructureType(next->sType) != EStructureType::Descriptor_SetLayoutBindingFlags_CreateInfo) return false;
+
+					FlagsCreateInfo* flagsInfo = const_cast<FlagsCreateInfo*>(_storage.Copy(1, reinterpret_cast<const FlagsCreateInfo*>(next)));
+
+					flagsInfo->BindingFlags = _storage.Copy(flagsInfo->BindingCount, flagsInfo->BindingFlags);
+					flagsInfo->Next         = nullptr;
+
+					*link = flagsInfo;
+
+					link = &flagsInfo->Next;
+				}
+
+				return true;
+			}
+
+			static EResult Create(const LogicalDevice& _device, const CreateInfo& _info, const Memory::AllocationCallbacks* _allocator, Handle& _handle)
+			{
+				return V1::Pipeline::Layout::DescriptorSet::Create(_device, _info, _allocator, _handle);
+			}
+
+			static void Destroy(const LogicalDevice& _device, Handle _handle, const Memory::AllocationCallbacks* _allocator)
+			{
+				V1::Pipeline::Layout::DescriptorSet::Destroy(_device, _handle, _allocator);
+			}
+		};
+
+		/**
+		@brief Object cache traits of pipeline layouts.
+		*/
+		struct PipelineLayoutCacheTraits
+		{
+			using CreateInfo = V1::Pipeline::Layout::CreateInfo;
+			using Handle     = V1::Pipeline::Layout::Handle    ;
+
+			static bool Copy(const CreateInfo& _info, ObjectCacheStorage& _storage, CreateInfo& _copy)
+			{
+				_copy = _info;
+
+				_copy.SetLayouts         = _storage.Copy(_info.SetLayoutCount        , _info.SetLayouts        );
+				_copy.PushConstantRanges = _storage.Copy(_info.PushConstantRangeCount, _info.PushConstantRanges);
+
+				return _info.Next == nullptr;
+			}
+
+			static EResult Create(const LogicalDevice& _device, const CreateInfo& _info, const Memory::AllocationCallbacks* _allocator, Handle& _handle)
+			{
+				return V1::Pipeline::Layout::Create(_device, _info, _allocator, _handle);
+			}
+
+			static void Destroy(const LogicalDevice& _device, Handle _handle, const Memory::AllocationCallbacks* _allocator)
+			{
+				V1::Pipeline::Layout::Destroy(_device, _handle, _allocator);
+			}
+		};
+
+		/**
+		@brief Object cache traits of render passes.
+		*/
+		struct RenderPassCacheTraits
+		{
+			using CreateInfo = V1::RenderPass::CreateInfo;
+			using Handle     = V1::RenderPass::Handle    ;
+
+			using SubpassDescription = V1::RenderPass::SubpassDescription;
+
+			static bool Copy(const CreateInfo& _info, ObjectCacheStorage& _storage, CreateInfo& _copy)
+			{
+				_copy = _info;
+
+				_copy.Attachments  = _storage.Copy(_info.AttachmentCount, _info.Attachments );
+				_copy.Dependencies = _storage.Copy(_info.DependencyCount, _info.Dependencies);
+
+				SubpassDescription* subpasses = const_cast<SubpassDescription*>(_storage.Copy(_info.SubpassCount, _info.Subpasses));
+
+				for (ui32 index = 0; subpasses != nullptr && index < _info.SubpassCount; index++)
+				{
+					SubpassDescription& subpass = subpasses[index];
+
+					subpass.InputAttachments       = _storage.Copy(subpass.InputAttachmentCount   , subpass.InputAttachments      );
+					subpass.ColorAttachments       = _storage.Copy(subpass.ColorAttachmentCount   , subpass.ColorAttachments      );
+					subpass.ResolveAttachments     = _storage.Copy(subpass.ColorAttachmentCount   , subpass.ResolveAttachments    );
+					subpass.DepthStencilAttachment = _storage.Copy(1                              , subpass.DepthStencilAttachment);
+					subpass.PreserveAttachments    = _storage.Copy(subpass.PreserveAttachmentCount, subpass.PreserveAttachments   );
+				}
+
+				_copy.Subpasses = subpasses;
+
+				return _info.Next == nullptr;
+			}
+
+			static EResult Create(const LogicalDevice& _device, const CreateInfo& _info, const Memory::AllocationCallbacks* _allocator, Handle& _handle)
+			{
+				return V1::RenderPass::Create(_device, _info, _allocator, _handle);
+			}
+
+			static void Destroy(const LogicalDevice& _device, Handle _handle, const Memory::AllocationCallbacks* _allocator)
+			{
+				V1::RenderPass::Destroy(_device, _handle, _allocator);
+			}
+		};
+
+		/** @brief Interns samplers by their create info. */
+		using SamplerCache = ObjectCache<SamplerCacheTraits>;
+
+		/** @brief Interns descriptor set layouts by their create info. */
+		using DescriptorSetLayoutCache = ObjectCache<DescriptorSetLayoutCacheTraits>;
+
+		/** @brief Interns pipeline layouts by their create info. */
+		using PipelineLayoutCache = ObjectCache<PipelineLayoutCacheTraits>;
+
+		/** @brief Interns render passes by their create info. */
+		using RenderPassCache = ObjectCache<RenderPassCacheTraits>;
+
+		/** @} */	// Vault_3
+	}
+}
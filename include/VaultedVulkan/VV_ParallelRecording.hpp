@@ -0,0 +1,420 @@
+/*!
+@file VV_ParallelRecording.hpp
+
+@brief Vaulted Vulkan: Parallel Recording
+
+@details Contains a facility to record the commands of a render pass (or any secondary work) across several threads.
+
+Command pools are externally synchronized: a pool (and the buffers allocated from it) may only be used by one thread at a time.
+Parallel recording therefore requires a pool per thread, and per frame in flight so that a frame's pools can be reset while the others are still executing.
+Each thread records into secondary command buffers which the primary buffer then executes in order.
+
+<a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#fundamentals-threadingbehavior">Specification</a>
+*/
+
+
+
+#pragma once
+
+
+
+
+// VV
+#include "VV_Vaults.hpp"
+#include "VV_APISpecGroups.hpp"
+#include "VV_Platform.hpp"
+#include "VV_CPP_STL.hpp"
+#include "VV_Enums.hpp"
+#include "VV_Backend.hpp"
+#include "VV_Types.hpp"
+#include "VV_Constants.hpp"
+#include "VV_Memory_Backend.hpp"
+#include "VV_PhysicalDevice.hpp"
+#include "VV_Initialization.hpp"
+#include "VV_LogicalDevice.hpp"
+#include "VV_Memory.hpp"
+#include "VV_Sampler.hpp"
+#include "VV_Resource.hpp"
+#include "VV_SyncAndCacheControl.hpp"
+#include "VV_Shaders.hpp"
+#include "VV_Pipelines.hpp"
+#include "VV_RenderPass.hpp"
+#include "VV_Command.hpp"
+
+
+
+#ifndef VV_Option__Use_Long_Namespace
+namespace VV
+#else
+namespace VaultedVulkan
+#endif
+{
+	namespace V3
+	{
+		/**
+		@addtogroup Vault_3
+		@{
+		*/
+
+		/**
+		@brief Records a list of items (draws, dispatches, etc) into secondary command buffers across a group of threads, then executes them from a primary buffer.
+
+		@details
+		The items are split into tasks of a fixed amount of items. Each task is recorded into its own secondary buffer,
+		and threads pick up the next task available as they finish their previous one, so that uneven tasks balance across threads.
+		The secondary buffers are executed in task order, so the order of the items is preserved regardless of which thread recorded them.
+
+		The calling thread records alongside the worker threads: a recorder created with a thread count of 1 records everything on the calling thread.
+
+		Every thread has a frame command pool per frame in flight. Secondary buffers are allocated from the pool the first time they are needed,
+		and are reused after BeginFrame resets the frame's pools (No allocations are done once a frame has reached its working size).
+
+		The recorder cannot be moved or copied, as its worker threads reference it.
+		*/
+		class ParallelRecorder
+		{
+		public:
+
+			/**
+			@brief Records the items in the range [_firstItem, _firstItem + _itemCount) into the secondary buffer provided.
+
+			@details Called concurrently from several threads (_thread identifies the calling thread: 0 is the thread that called Record).
+			The secondary buffer has begun recording and will be ended after the function returns.
+			*/
+			using RecordFunction = std::function<void(const CommandBuffer& _secondary, ui32 _firstItem, ui32 _itemCount, ui32 _thread)>;
+
+			/**
+			@brief Default constructor.
+			*/
+			ParallelRecorder() : 
+				threadCount(0), frameCount(0), frameIndex(0), device(nullptr)
+			{}
+
+			/**
+			@brief Constructor with logical device specified.
+			*/
+			ParallelRecorder(const LogicalDevice& _device) : 
+				threadCount(0), frameCount(0), frameIndex(0), device(&_device)
+			{}
+
+			ParallelRecorder(const ParallelRecorder&) = delete;
+
+			ParallelRecorder& operator= (const ParallelRecorder&) = delete;
+
+			/**
+			@brief Stops the worker threads and destroys the command pools if the recorder was created.
+			*/
+			~ParallelRecorder()
+			{
+				if (threadCount != 0) Destroy();
+			}
+
+			/**
+			@brief Resets the command pools of the frame for every thread, making its secondary buffers available for recording again.
+
+			@details The previous submission that used the frame's buffers must have completed. 
+			Fails with EResult::Error_InitalizationFailed if the recorder has not been created.
+			*/
+			EResult BeginFrame(ui32 _frameIndex)
+			{
+				if (frameCount == 0) return EResult::Error_InitalizationFailed;
+
+				frameIndex = _frameIndex % frameCount;
+
+				for (ui32 thread = 0; thread < threadCount; thread++)
+				{
+					EResult returnCode = GetThreadPool(thread).Reset();
+
+					if (returnCode != EResult::Success) return returnCode;
+				}
+
+				return EResult::Success;
+			}
+
+			/**
+			@brief Create the command pools for the queue's family and start the worker threads.
+
+			@param _threadCount    Amount of threads that record, including the calling thread. (0 uses the hardware concurrency)
+			@param _framesInFlight Amount of frames that may be executing while another one is recorded.
+			*/
+			EResult Create(const LogicalDevice::Queue& _queue, ui32 _threadCount, ui32 _framesInFlight)
+			{
+				if (device == nullptr) return EResult::Not_Ready;
+
+				if (_threadCount == 0) _threadCount = (std::max)(std::thread::hardware_concurrency(), 1u);
+
+				if (_framesInFlight == 0) _framesInFlight = 1;
+
+				pools.resize(_threadCount * _framesInFlight);
+
+				for (FrameCommandPool& threadPool : pools)
+				{
+					EResult returnCode = threadPool.Create(*device, _queue);
+
+					if (returnCode != EResult::Success)
+					{
+						pools.clear();
+
+						return returnCode;
+					}
+				}
+
+				threadCount = _threadCount   ;
+				frameCount  = _framesInFlight;
+				frameIndex  = 0              ;
+
+				stopping    = false;
+				generation  = 0    ;
+				workersBusy = 0    ;
+
+				for (ui32 thread = 1; thread < threadCount; thread++)
+				{
+					workers.emplace_back(&ParallelRecorder::WorkerLoop, this, thread);
+				}
+
+				return EResult::Success;
+			}
+
+			/**
+			@brief Create the command pools for the queue's family and start the worker threads (logical device specified).
+			*/
+			EResult Create(const LogicalDevice& _device, const LogicalDevice::Queue& _queue, ui32 _threadCount, ui32 _framesInFlight)
+			{
+				device = &_device;
+
+				return Create(_queue, _threadCount, _framesInFlight);
+			}
+
+			/**
+			@brief Stops the worker threads and destroys the command pools. (The buffers recorded must no longer be in use by the device)
+			*/
+			void Destroy()
+			{
+				{
+					std::lock_guard<std::mutex> guard(lock);
+
+					stopping = true;
+				}
+
+				wake.notify_all();
+
+				for (std::thread& worker : workers) worker.join();
+
+				workers.clear();
+
+				for (FrameCommandPool& threadPool : pools) threadPool.Destroy();
+
+				pools.clear();
+
+				threadCount = 0;
+				frameCount  = 0;
+			}
+
+			ui32 GetFrameCount() const
+			{
+				return frameCount;
+			}
+
+			ui32 GetThreadCount() const
+			{
+				return threadCount;
+			}
+
+			/**
+			@brief Record the items across the threads, and execute the recorded secondary buffers from the primary buffer.
+
+			@details
+			The primary buffer must be recording, and if the inheritance window specifies a render pass the primary must be within
+			that render pass's subpass begun with ESubpassContents::SecondaryCommandBuffers.
+
+			@param _itemsPerTask Amount of items recorded into a single secondary buffer. (Smaller tasks balance better, larger tasks have less overhead)
+			*/
+			EResult Record
+			(
+				const CommandBuffer&                    _primary     ,
+				const CommandBuffer::InheritanceWindow& _inheritance ,
+				      ui32                              _itemCount   ,
+				      ui32                              _itemsPerTask,
+				const RecordFunction&                   _function
+			)
+			{
+				if (threadCount == 0) return EResult::Not_Ready;
+
+				if (_itemCount == 0) return EResult::Success;
+
+				if (_itemsPerTask == 0) _itemsPerTask = 1;
+
+				job.Inheritance  = &_inheritance;
+				job.Function     = &_function   ;
+				job.ItemCount    = _itemCount   ;
+				job.ItemsPerTask = _itemsPerTask;
+				job.TaskCount    = (_itemCount + _itemsPerTask - 1) / _itemsPerTask;
+				job.Result       = EResult::Success;
+
+				job.NextTask.store(0, std::memory_order_relaxed);
+
+				secondaries.resize(job.TaskCount);
+
+				{
+					std::lock_guard<std::mutex> guard(lock);
+
+					workersBusy = ui32(workers.size());
+
+					generation++;
+				}
+
+				wake.notify_all();
+
+				Work(0);
+
+				{
+					std::unique_lock<std::mutex> guard(lock);
+
+					done.wait(guard, [this]() { return workersBusy == 0; });
+				}
+
+				if (job.Result != EResult::Success) return job.Result;
+
+				_primary.Execute(job.TaskCount, secondaries.data());
+
+				return EResult::Success;
+			}
+
+		protected:
+
+			/**
+			@brief The record currently distributed across the threads.
+			*/
+			struct Job
+			{
+				const CommandBuffer::InheritanceWindow* Inheritance  = nullptr;
+				const RecordFunction*                   Function     = nullptr;
+				      ui32                              ItemCount    = 0      ;
+				      ui32                              ItemsPerTask = 0      ;
+				      ui32                              TaskCount    = 0      ;
+				      EResult                           Result       = EResult::Success;
+
+				std::atomic<ui32> NextTask { 0 };
+			};
+
+			/**
+			@brief Provides the command pool of the thread for the current frame.
+			*/
+			FrameCommandPool& GetThreadPool(ui32 _thread)
+			{
+				return pools[frameIndex * threadCount + _thread];
+			}
+
+			/**
+			@brief Records tasks until there are none left.
+			*/
+			void Work(ui32 _thread)
+			{
+				FrameCommandPool& threadPool = GetThreadPool(_thread);
+
+				CommandBuffer::BeginInfo beginInfo;
+
+				if (job.Inheritance->RenderPass != Null<RenderPass::Handle>)
+				{
+					beginInfo.Flags.Set(ECommandBufferUsageFlag::OneTimeSubmit, ECommandBufferUsageFlag::RenderPassContinue);
+				}
+				else
+				{
+					beginInfo.Flags.Set(ECommandBufferUsageFlag::OneTimeSubmit);
+				}
+
+				beginInfo.InheritanceInfo = job.Inheritance;
+
+				for (ui32 task = job.NextTask.fetch_add(1); task < job.TaskCount; task = job.NextTask.fetch_add(1))
+				{
+					CommandBuffer::Handle bufferHandle = Null<CommandBuffer::Handle>;
+
+					EResult returnCode = threadPool.Acquire(ECommandBufferLevel::Secondary, bufferHandle);
+
+					CommandBuffer secondary(*device, bufferHandle);
+
+					if (returnCode == EResult::Success) returnCode = secondary.BeginRecord(beginInfo);
+
+					if (returnCode == EResult::Success)
+					{
+						const ui32 firstItem = task * job.ItemsPerTask;
+
+						(*job.Function)(secondary, firstItem, (std::min)(job.ItemsPerTask, job.ItemCount - firstItem), _thread);
+
+						returnCode = secondary.EndRecord();
+					}
+
+					if (returnCode != EResult::Success)
+					{
+						std::lock_guard<std::mutex> guard(lock);
+
+						if (job.Result == EResult::Success) job.Result = returnCode;
+					}
+
+					secondaries[task] = bufferHandle;
+				}
+			}
+
+			/**
+			@brief Worker threads wait for a record to be issued, and take part in it until it has no tasks left.
+			*/
+			void WorkerLoop(ui32 _thread)
+			{
+				u64 lastGeneration = 0;
+
+				while (true)
+				{
+					{
+						std::unique_lock<std::mutex> guard(lock);
+
+						wake.wait(guard, [&]() { return stopping || generation != lastGeneration; });
+
+						if (stopping) return;
+
+						lastGeneration = generation;
+					}
+
+					Work(_thread);
+
+					{
+						std::lock_guard<std::mutex> guard(lock);
+
+						workersBusy--;
+					}
+
+					done.notify_one();
+				}
+			}
+
+			ui32 threadCount;
+
+			ui32 frameCount;
+
+			ui32 frameIndex;
+
+			DynamicArray<FrameCommandPool> pools;
+
+			DynamicArray<CommandBuffer::Handle> secondaries;
+
+			DynamicArray<std::thread> workers;
+
+			Job job;
+
+			std::mutex lock;
+
+			std::condition_variable wake;
+
+			std::condition_variable done;
+
+			u64 generation = 0;
+
+			ui32 workersBusy = 0;
+
+			bool stopping = false;
+
+			const LogicalDevice* device;
+		};
+
+		/** @} */	// Vault_3
+	}
+}
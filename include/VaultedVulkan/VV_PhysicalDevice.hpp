@@ -30,6 +30,12 @@ A physical device usually represents a single complete implementation of Vulkan
 
 
 
+#ifdef _MSC_VER
+	#include <intrin.h>
+#endif
+
+
+
 #ifndef VT_Option__Use_Long_Namespace
 namespace VV
 #else
@@ -157,6 +163,21 @@ namespace VaultedVulkan
 				Bool SparseResidencyAliased                 ;
 				Bool VariableMultisampleRate                ;
 				Bool InheritedQueries                       ;
+
+				/**
+				* @brief To enable resetting queries from the host, add HostQuery to the Next chain of the logical device create info.
+				* 
+				* @details
+				* <a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#VkPhysicalDeviceHostQueryResetFeatures">Specification</a> 
+				* 
+				* @ingroup APISpec_Features
+				*/
+				struct HostQuery : V0::VKStruct_Base<VkPhysicalDeviceHostQueryResetFeatures, EStructureType::PhysicalDevice_HostQueryReset_Features>
+				{
+					EType SType          = STypeEnum;
+					void* Next           = nullptr  ;
+					Bool  HostQueryReset;
+				};
 			};
 
 			/**
@@ -309,6 +330,178 @@ namespace VaultedVulkan
 				Memory::Heap Heaps[MaxMemoryHeaps];
 			};
 
+			/**
+			@brief A lookup table from memory property flags to the best memory type, built once from the memory properties.
+
+			@details
+			For every combination of required flags (the type must have all of them) the table keeps the types that qualify,
+			and for every combination of preferred flags it keeps the types grouped by how many of the flags they have.
+			A lookup is then a few mask intersections against the requirements' memory type bits, without querying the device or scanning the types.
+
+			Types with as many preferred flags are chosen by index, as the implementation orders types of the same flags by performance.
+			For example: requiring DeviceLocal and preferring HostVisible picks a device local type visible to the host when there is one
+			(resizable BAR), and a plain device local type otherwise.
+
+			Only the core flags (device local through protected) are tabled, queries with other flags scan the types instead.
+
+			<a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#memory-device">Specification</a>
+			*/
+			class MemoryTypeTable
+			{
+			public:
+
+				static constexpr ui32 NotFound = 4294967295;
+
+				static constexpr ui32 FlagCount        = 6              ;   ///< DeviceLocal, HostVisible, HostCoherent, HostCached, LazilyAllocated, Protected
+				static constexpr ui32 FlagCombinations = 1 << FlagCount;
+
+				/**
+				@brief Default constructor. (No memory types)
+				*/
+				MemoryTypeTable() : typeCount(0), typeFlags{}, requiredTypes{}, preferredTypes{}
+				{}
+
+				/**
+				@brief Builds the table from the memory properties specified.
+				*/
+				MemoryTypeTable(const MemoryProperties& _properties) : MemoryTypeTable()
+				{
+					Build(_properties);
+				}
+
+				/**
+				@brief Builds the table from the memory properties of the physical device. (Queries them once)
+				*/
+				MemoryTypeTable(Handle _physicalDevice) : MemoryTypeTable()
+				{
+					MemoryProperties properties;
+
+					GetMemoryProperties(_physicalDevice, properties);
+
+					Build(properties);
+				}
+
+				/**
+				@brief Builds the table from the memory properties specified.
+				*/
+				void Build(const MemoryProperties& _properties)
+				{
+					typeCount = (std::min)(_properties.TypeCount, ui32(MaxMemoryTypes));
+
+					for (ui32 type = 0; type < typeCount; type++)
+					{
+						typeFlags[type] = _properties.Types[type].PropertyFlags;
+					}
+
+					for (ui32 combination = 0; combination < FlagCombinations; combination++)
+					{
+						requiredTypes [combination] = 0;
+						preferredTypes[combination].fill(0);
+
+						const ui32 preferredCount = GetFlagCount(combination);
+
+						for (ui32 type = 0; type < typeCount; type++)
+						{
+							const ui32 typeBit = 1u << type;
+
+							if ((typeFlags[type] & combination) == combination) requiredTypes[combination] |= typeBit;
+
+							// Tier 0 has all the flags of the combination, the last tier has none of them.
+							preferredTypes[combination][preferredCount - GetFlagCount(typeFlags[type] & combination)] |= typeBit;
+						}
+					}
+				}
+
+				/**
+				@brief Finds the first memory type allowed by the type filter that has the properties required. (NotFound otherwise)
+				*/
+				ui32 Find(ui32 _typeFilter, Memory::PropertyFlags _required) const
+				{
+					return Find(_typeFilter, _required, Memory::PropertyFlags());
+				}
+
+				/**
+				@brief Finds the memory type allowed by the type filter that has the properties required, and the most of the properties preferred. (NotFound otherwise)
+				*/
+				ui32 Find(ui32 _typeFilter, Memory::PropertyFlags _required, Memory::PropertyFlags _preferred) const
+				{
+					const VkMemoryPropertyFlags required  = _required ;
+					const VkMemoryPropertyFlags preferred = _preferred;
+
+					if (required >= FlagCombinations || preferred >= FlagCombinations) return Scan(_typeFilter, required, preferred);
+
+					const ui32 candidates = _typeFilter & requiredTypes[required];
+
+					if (candidates == 0) return NotFound;
+
+					for (ui32 tier = 0; tier <= FlagCount; tier++)
+					{
+						const ui32 matches = candidates & preferredTypes[preferred][tier];
+
+						if (matches != 0) return GetLowestType(matches);
+					}
+
+					return NotFound;
+				}
+
+				ui32 GetTypeCount() const
+				{
+					return typeCount;
+				}
+
+			protected:
+
+				static ui32 GetFlagCount(ui32 _flags)
+				{
+					ui32 count = 0;
+
+					for (; _flags != 0; _flags &= _flags - 1) count++;
+
+					return count;
+				}
+
+				static ui32 GetLowestType(ui32 _types)
+				{
+				#ifdef _MSC_VER
+					unsigned long index; _BitScanForward(&index, _types); return ui32(index);
+				#else
+					return ui32(__builtin_ctz(_types));
+				#endif
+				}
+
+				/**
+				@brief Fallback for flags outside of the table.
+				*/
+				ui32 Scan(ui32 _typeFilter, VkMemoryPropertyFlags _required, VkMemoryPropertyFlags _preferred) const
+				{
+					ui32 bestType    = NotFound;
+					ui32 bestMatches = 0       ;
+
+					for (ui32 type = 0; type < typeCount; type++)
+					{
+						if (!(_typeFilter & (1u << type)) || (typeFlags[type] & _required) != _required) continue;
+
+						const ui32 matches = GetFlagCount(typeFlags[type] & _preferred);
+
+						if (bestType == NotFound || matches > bestMatches)
+						{
+							bestType    = type   ;
+							bestMatches = matches;
+						}
+					}
+
+					return bestType;
+				}
+
+				ui32 typeCount;
+
+				std::array<VkMemoryPropertyFlags, MaxMemoryTypes> typeFlags;
+
+				std::array<ui32, FlagCombinations> requiredTypes;
+
+				std::array<std::array<ui32, FlagCount + 1>, FlagCombinations> preferredTypes;
+			};
+
 			/**
 			* @brief
 			* <a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#VkPerformanceCounterKHR">Specification</a> 
@@ -1018,6 +1211,8 @@ namespace VaultedVulkan
 				Parent::GetProperties      (handle, properties      );
 				Parent::GetProperties      (handle, properties      );
 				Parent::GetProperties2     (handle, properties2     );
+
+				memoryTypes.Build(memoryProperties);
 			}
 
 			/**
@@ -1032,6 +1227,8 @@ namespace VaultedVulkan
 				Parent::GetProperties      (handle, properties      );
 				Parent::GetProperties      (handle, properties      );
 				Parent::GetProperties2     (handle, properties2     );
+
+				memoryTypes.Build(memoryProperties);
 			}
 
 			/**
@@ -1086,25 +1283,22 @@ namespace VaultedVulkan
 			*/
 			ui32 FindMemoryType(ui32 _typeFilter, Memory::PropertyFlags _properties) const
 			{
-				for (ui32 index = 0; index < memoryProperties.TypeCount; index++)
-				{
-					auto flags = memoryProperties.Types[index].PropertyFlags;
-
-					if
-					(
-						_typeFilter & (1 << index) &&
-						(flags & _properties) == _properties
-					)
-					{
-						return index;
-					}
-				}
+				ui32 memoryType = memoryTypes.Find(_typeFilter, _properties);
 
 			#ifdef VT_Option__Use_STL_Exceptions
-				throw std::runtime_error("Failed to find suitable memory type!");
+				if (memoryType == MemoryTypeTable::NotFound) throw std::runtime_error("Failed to find suitable memory type!");
 			#endif
 
-				return 4294967295;
+				return memoryType;
+			}
+
+			/**
+			@brief Find the memory type for the type filter and properties required, that has the most of the properties preferred.
+			(MemoryTypeTable::NotFound if none have the properties required)
+			*/
+			ui32 FindMemoryType(ui32 _typeFilter, Memory::PropertyFlags _required, Memory::PropertyFlags _preferred) const
+			{
+				return memoryTypes.Find(_typeFilter, _required, _preferred);
 			}
 
 			/**
@@ -1188,6 +1382,14 @@ namespace VaultedVulkan
 				return memoryProperties;
 			}
 
+			/**
+			@brief Provides the memory type lookup table built from the memory properties.
+			*/
+			const MemoryTypeTable& GetMemoryTypeTable() const
+			{
+				return memoryTypes;
+			}
+
 			/**
 			@brief Provides the properties.
 			*/
@@ -1286,6 +1488,8 @@ namespace VaultedVulkan
 
 			MemoryProperties memoryProperties; 
 
+			MemoryTypeTable memoryTypes;
+
 			Properties  properties ;
 			Properties2 properties2;
 		};
@@ -0,0 +1,549 @@
+/*!
+@file VV_PipelineCompiler.hpp
+
+@brief Vaulted Vulkan: Pipeline Compiler
+
+@details Contains a service that creates pipelines on a group of worker threads, so that the thread issuing them does not stall on shader compilation.
+
+Pipeline creation is not externally synchronized on the device, and a pipeline cache may be used by several creations at once
+(unless it was created with the externally synchronized flag), so the workers share a single cache.
+
+<a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#pipelines-cache">Specification</a>
+*/
+
+
+
+#pragma once
+
+
+
+// VV
+#include "VV_Vaults.hpp"
+#include "VV_APISpecGroups.hpp"
+#include "VV_Platform.hpp"
+#include "VV_CPP_STL.hpp"
+#include "VV_Enums.hpp"
+#include "VV_Backend.hpp"
+#include "VV_Types.hpp"
+#include "VV_Constants.hpp"
+#include "VV_Memory_Backend.hpp"
+#include "VV_PhysicalDevice.hpp"
+#include "VV_Initialization.hpp"
+#include "VV_LogicalDevice.hpp"
+#include "VV_Memory.hpp"
+#include "VV_Sampler.hpp"
+#include "VV_Resource.hpp"
+#include "VV_SyncAndCacheControl.hpp"
+#include "VV_Shaders.hpp"
+#include "VV_Pipelines.hpp"
+#include "VV_ObjectCache.hpp"
+
+
+
+#ifndef VV_Option__Use_Long_Namespace
+namespace VV
+#else
+namespace VaultedVulkan
+#endif
+{
+	namespace V3
+	{
+		/**
+		@addtogroup Vault_3
+		@{
+		*/
+
+		/**
+		@brief Creates pipelines asynchronously on a group of worker threads, against a shared pipeline cache.
+
+		@details
+		Each compile request is a batch of create infos of the same kind, created with a single call to the API's multi-create entry point.
+		Requests are picked up by the workers in the order they were issued.
+
+		The batch overloads read the create infos (and all the state they point to: shader stages, specialization info, fixed function state, etc)
+		from a worker thread, they must remain alive and unmodified until the request's result is ready.
+		The single pipeline overloads deep copy the create info instead, so it may be a temporary.
+		(Next chains are not copied: the structures chained to the info or its states must still remain alive until the pipeline is ready)
+
+		The compiler does not own the pipelines it creates: they are destroyed by the application (or assigned to a V3 pipeline object).
+
+		The compiler cannot be moved or copied, as its worker threads reference it.
+		*/
+		class PipelineCompiler
+		{
+		public:
+
+			/**
+			@brief A single pipeline being compiled, that can be polled without blocking.
+
+			@details While the pipeline is not ready, GetHandle provides the fallback given to it,
+			so that rendering can keep using a simpler pipeline until the compiled one is available.
+			*/
+			class PendingPipeline
+			{
+			public:
+
+				/**
+				@brief Default constructor. (No pipeline pending)
+				*/
+				PendingPipeline()
+				{}
+
+				/**
+				@brief Provides the compiled pipeline if it is ready and was created successfully, otherwise the fallback specified.
+				*/
+				Pipeline::Handle GetHandle(Pipeline::Handle _fallback) const
+				{
+					if (!IsReady() || result.get() != EResult::Success) return _fallback;
+
+					return *handle;
+				}
+
+				/**
+				@brief Waits for the compile to finish and provides its result.
+				*/
+				EResult GetResult() const
+				{
+					if (!IsValid()) return EResult::Not_Ready;
+
+					return result.get();
+				}
+
+				/**
+				@brief Whether the compile has finished. (Does not block)
+				*/
+				bool IsReady() const
+				{
+					return IsValid() && result.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+				}
+
+				/**
+				@brief Whether a pipeline was issued to be compiled.
+				*/
+				bool IsValid() const
+				{
+					return result.valid();
+				}
+
+				/**
+				@brief Waits for the compile to finish, and provides the pipeline. (Null if it failed)
+				*/
+				Pipeline::Handle Wait() const
+				{
+					return GetResult() == EResult::Success ? *handle : Null<Pipeline::Handle>;
+				}
+
+			protected:
+
+				friend class PipelineCompiler;
+
+				std::shared_future<EResult> result;
+
+				std::shared_ptr<Pipeline::Handle> handle;
+			};
+
+			/**
+			@brief Default constructor.
+			*/
+			PipelineCompiler() :
+				threadCount(0), allocator(Memory::DefaultAllocator), cache(nullptr), device(nullptr)
+			{}
+
+			PipelineCompiler(const PipelineCompiler&) = delete;
+
+			PipelineCompiler& operator= (const PipelineCompiler&) = delete;
+
+			/**
+			@brief Finishes the requests issued and stops the worker threads if the compiler was created.
+			*/
+			~PipelineCompiler()
+			{
+				if (threadCount != 0) Destroy();
+			}
+
+			/**
+			@brief Issue a batch of graphics pipelines to be created.
+
+			@details The handles are written to _pipelines once the future is ready, the array must remain alive until then.
+			*/
+			std::future<EResult> Compile(ui32 _createInfoCount, const Pipeline::Graphics::CreateInfo* _createInfos, Pipeline::Handle* _pipelines)
+			{
+				return Issue
+				(
+					[this, _createInfoCount, _createInfos, _pipelines]()
+					{
+						return V2::Pipeline::Graphics::Create(*device, GetCacheHandle(), _createInfoCount, _createInfos, allocator, _pipelines);
+					}
+				);
+			}
+
+			/**
+			@brief Issue a batch of compute pipelines to be created.
+
+			@details The handles are written to _pipelines once the future is ready, the array must remain alive until then.
+			*/
+			std::future<EResult> Compile(ui32 _createInfoCount, const Pipeline::Compute::CreateInfo* _createInfos, Pipeline::Handle* _pipelines)
+			{
+				return Issue
+				(
+					[this, _createInfoCount, _createInfos, _pipelines]()
+					{
+						return V2::Pipeline::Compute::Create(*device, GetCacheHandle(), _createInfoCount, _createInfos, allocator, _pipelines);
+					}
+				);
+			}
+
+			/**
+			@brief Issue a single graphics pipeline to be created. (The info is copied, it does not need to outlive the call)
+			*/
+			PendingPipeline Compile(const Pipeline::Graphics::CreateInfo& _info)
+			{
+				return CompileCopy(_info);
+			}
+
+			/**
+			@brief Issue a single compute pipeline to be created. (The info is copied, it does not need to outlive the call)
+			*/
+			PendingPipeline Compile(const Pipeline::Compute::CreateInfo& _info)
+			{
+				return CompileCopy(_info);
+			}
+
+			/**
+			@brief Start the worker threads.
+
+			@param _cache       Cache shared by all the compiles. (Must remain alive until the compiler is destroyed)
+			@param _threadCount Amount of worker threads. (0 uses the hardware concurrency minus the calling thread)
+			*/
+			EResult Create(const LogicalDevice& _device, const Pipeline::Cache& _cache, ui32 _threadCount)
+			{
+				return Create(_device, _cache, Memory::DefaultAllocator, _threadCount);
+			}
+
+			/**
+			@brief Start the worker threads (allocator specified).
+			*/
+			EResult Create(const LogicalDevice& _device, const Pipeline::Cache& _cache, const Memory::AllocationCallbacks* _allocator, ui32 _threadCount)
+			{
+				if (threadCount != 0) return EResult::Not_Ready;
+
+				if (_threadCount == 0) _threadCount = (std::max)(std::thread::hardware_concurrency(), 2u) - 1;
+
+				device    = &_device  ;
+				cache     = &_cache   ;
+				allocator = _allocator;
+
+				stopping    = false;
+				threadCount = _threadCount;
+
+				for (ui32 thread = 0; thread < threadCount; thread++)
+				{
+					workers.emplace_back(&PipelineCompiler::WorkerLoop, this);
+				}
+
+				return EResult::Success;
+			}
+
+			/**
+			@brief Finishes the requests issued and stops the worker threads.
+			*/
+			void Destroy()
+			{
+				{
+					std::lock_guard<std::mutex> guard(lock);
+
+					stopping = true;
+				}
+
+				wake.notify_all();
+
+				for (std::thread& worker : workers) worker.join();
+
+				workers.clear();
+
+				threadCount = 0;
+			}
+
+			/**
+			@brief Provides the amount of requests that have not finished.
+			*/
+			ui32 GetPendingCount() const
+			{
+				std::lock_guard<std::mutex> guard(lock);
+
+				return ui32(requests.size()) + requestsBusy;
+			}
+
+			ui32 GetThreadCount() const
+			{
+				return threadCount;
+			}
+
+			/**
+			@brief Blocks until all the requests issued have finished.
+			*/
+			void WaitIdle()
+			{
+				std::unique_lock<std::mutex> guard(lock);
+
+				idle.wait(guard, [this]() { return requests.empty() && requestsBusy == 0; });
+			}
+
+		protected:
+
+			/**
+			@brief A batch of pipelines waiting to be created.
+			*/
+			struct Request
+			{
+				std::function<EResult()> Compile;
+				std::promise<EResult>    Result ;
+			};
+
+			/**
+			@brief A create info copied along with the state it points to, kept alive by the request compiling it.
+			*/
+			template<typename CreateInfo>
+			struct CopiedInfo
+			{
+				CreateInfo         Info   ;
+				ObjectCacheStorage Storage;
+			};
+
+			using ShaderStageInfo = V1::Pipeline::ShaderStage     ::CreateInfo;
+			using VertexInputInfo = V1::Pipeline::VertexInputState::CreateInfo;
+			using ViewportInfo    = V1::Pipeline::ViewportState   ::CreateInfo;
+			using MultisampleInfo = V1::Pipeline::MultiSampleState::CreateInfo;
+			using ColorBlendInfo  = V1::Pipeline::ColorBlendState ::CreateInfo;
+			using DynamicInfo     = V1::Pipeline::DynamicState    ::CreateInfo;
+
+			/**
+			@brief Copies the info and issues it as a batch of one, with the copy and the handle owned by the pending pipeline.
+			*/
+			template<typename CreateInfo>
+			PendingPipeline CompileCopy(const CreateInfo& _info)
+			{
+				std::shared_ptr<CopiedInfo<CreateInfo>> copy = std::make_shared<CopiedInfo<CreateInfo>>();
+
+				Copy(_info, copy->Storage, copy->Info);
+
+				PendingPipeline pending;
+
+				pending.handle = std::make_shared<Pipeline::Handle>(Null<Pipeline::Handle>);
+
+				Pipeline::Handle* handle = pending.handle.get();
+
+				pending.result = Issue
+				(
+					[this, copy, handle]()
+					{
+						return CreatePipeline(copy->Info, handle);
+					}
+				).share();
+
+				return pending;
+			}
+
+			EResult CreatePipeline(const Pipeline::Graphics::CreateInfo& _info, Pipeline::Handle* _pipeline) const
+			{
+				return V2::Pipeline::Graphics::Create(*device, GetCacheHandle(), 1, &_info, allocator, _pipeline);
+			}
+
+			EResult CreatePipeline(const Pipeline::Compute::CreateInfo& _info, Pipeline::Handle* _pipeline) const
+			{
+				return V2::Pipeline::Compute::Create(*device, GetCacheHandle(), 1, &_info, allocator, _pipeline);
+			}
+
+			/**
+			@brief Copies the entry point name and specialization of a shader stage.
+			*/
+			static void Copy(const ShaderStageInfo& _stage, ObjectCacheStorage& _storage, ShaderStageInfo& _copy)
+			{
+				using SpecializationInfo = V1::Pipeline::Specialization::Info;
+
+				_copy = _stage;
+
+				if (_stage.Name != nullptr) _copy.Name = _storage.Copy(ui32(std::strlen(_stage.Name) + 1), _stage.Name);
+
+				if (_stage.Specialization == nullptr) return;
+
+				SpecializationInfo* specialization = const_cast<SpecializationInfo*>(_storage.Copy(1, _stage.Specialization));
+
+				specialization->MapEntires = _storage.Copy(specialization->MapEntryCount, specialization->MapEntires);
+				specialization->Data       = _storage.Copy(ui32(specialization->SizeOfData), static_cast<const u8*>(specialization->Data));
+
+				_copy.Specialization = specialization;
+			}
+
+			static void Copy(const Pipeline::Compute::CreateInfo& _info, ObjectCacheStorage& _storage, Pipeline::Compute::CreateInfo& _copy)
+			{
+				_copy = _info;
+
+				Copy(_info.ShaderStage, _storage, _copy.ShaderStage);
+			}
+
+			/**
+			@brief Copies the stages and the fixed function states, along with the arrays they point to.
+			*/
+			static void Copy(const Pipeline::Graphics::CreateInfo& _info, ObjectCacheStorage& _storage, Pipeline::Graphics::CreateInfo& _copy)
+			{
+				_copy = _info;
+
+				if (_info.Stages != nullptr)
+				{
+					ShaderStageInfo* stages = const_cast<ShaderStageInfo*>(_storage.Copy(_info.StageCount, _info.Stages));
+
+					for (ui32 index = 0; index < _info.StageCount; index++) Copy(_info.Stages[index], _storage, stages[index]);
+
+					_copy.Stages = stages;
+				}
+
+				if (_info.VertexInputState != nullptr)
+				{
+					VertexInputInfo* state = const_cast<VertexInputInfo*>(_storage.Copy(1, _info.VertexInputState));
+
+					state->BindingDescriptions   = _storage.Copy(state->BindingDescriptionCount  , state->BindingDescriptions  );
+					state->AttributeDescriptions = _storage.Copy(state->AttributeDescriptionCount, state->AttributeDescriptions);
+
+					_copy.VertexInputState = state;
+				}
+
+				if (_info.ViewportState != nullptr)
+				{
+					ViewportInfo* state = const_cast<ViewportInfo*>(_storage.Copy(1, _info.ViewportState));
+
+					state->Viewports = _storage.Copy(state->ViewportCount, state->Viewports);
+					state->Scissors  = _storage.Copy(state->ScissorCount , state->Scissors );
+
+					_copy.ViewportState = state;
+				}
+
+				if (_info.MultisampleState != nullptr)
+				{
+					MultisampleInfo* state = const_cast<MultisampleInfo*>(_storage.Copy(1, _info.MultisampleState));
+
+					// The mask has a bit per sample, in words of 32 bits.
+					state->SampleMask = _storage.Copy((ui32(state->RasterizationSamples) + 31) / 32, state->SampleMask);
+
+					_copy.MultisampleState = state;
+				}
+
+				if (_info.ColorBlendState != nullptr)
+				{
+					ColorBlendInfo* state = const_cast<ColorBlendInfo*>(_storage.Copy(1, _info.ColorBlendState));
+
+					state->Attachments = _storage.Copy(state->AttachmentCount, state->Attachments);
+
+					_copy.ColorBlendState = state;
+				}
+
+				if (_info.DynamicState != nullptr)
+				{
+					DynamicInfo* state = const_cast<DynamicInfo*>(_storage.Copy(1, _info.DynamicState));
+
+					state->States = _storage.Copy(state->StateCount, state->States);
+
+					_copy.DynamicState = state;
+				}
+
+				_copy.InputAssemblyState = _storage.Copy(1, _info.InputAssemblyState);
+				_copy.TessellationState  = _storage.Copy(1, _info.TessellationState );
+				_copy.RasterizationState = _storage.Copy(1, _info.RasterizationState);
+				_copy.DepthStencilState  = _storage.Copy(1, _info.DepthStencilState );
+			}
+
+			Pipeline::Cache::Handle GetCacheHandle() const
+			{
+				return *cache;
+			}
+
+			/**
+			@brief Queue the compile function, and provide the future of its result. (Ready with Not_Ready if the compiler was not created)
+			*/
+			std::future<EResult> Issue(std::function<EResult()>&& _compile)
+			{
+				Request request;
+
+				request.Compile = std::move(_compile);
+
+				std::future<EResult> result = request.Result.get_future();
+
+				if (threadCount == 0)
+				{
+					request.Result.set_value(EResult::Not_Ready);
+
+					return result;
+				}
+
+				{
+					std::lock_guard<std::mutex> guard(lock);
+
+					requests.push_back(std::move(request));
+				}
+
+				wake.notify_one();
+
+				return result;
+			}
+
+			/**
+			@brief Worker threads compile requests until the compiler is stopping and no requests are left.
+			*/
+			void WorkerLoop()
+			{
+				while (true)
+				{
+					Request request;
+
+					{
+						std::unique_lock<std::mutex> guard(lock);
+
+						wake.wait(guard, [this]() { return stopping || !requests.empty(); });
+
+						if (requests.empty()) return;
+
+						request = std::move(requests.front());
+
+						requests.pop_front();
+
+						requestsBusy++;
+					}
+
+					request.Result.set_value(request.Compile());
+
+					{
+						std::lock_guard<std::mutex> guard(lock);
+
+						requestsBusy--;
+					}
+
+					idle.notify_all();
+				}
+			}
+
+			ui32 threadCount;
+
+			Deque<Request> requests;
+
+			DynamicArray<std::thread> workers;
+
+			mutable std::mutex lock;
+
+			std::condition_variable wake;
+
+			std::condition_variable idle;
+
+			ui32 requestsBusy = 0;
+
+			bool stopping = false;
+
+			const Memory::AllocationCallbacks* allocator;
+
+			const Pipeline::Cache* cache;
+
+			const LogicalDevice* device;
+		};
+
+		/** @} */	// Vault_3
+	}
+}
@@ -18,6 +18,7 @@
 #include "VV_APISpecGroups.hpp"
 #include "VV_Platform.hpp"
 #include "VV_CPP_STL.hpp"
+#include "VV_FileIO.hpp"
 #include "VV_Enums.hpp"
 #include "VV_Backend.hpp"
 #include "VV_Types.hpp"
@@ -115,7 +116,7 @@ namespace VaultedVulkan
 					      LogicalDevice::Handle        _deviceHandle ,
 					const CreateInfo&                  _createInfo   ,
 					const Memory::AllocationCallbacks* _allocator    ,
-					      Cache::Handle                _pipelineCache
+					      Cache::Handle&               _pipelineCache
 				)
 				{
 					return EResult(vkCreatePipelineCache(_deviceHandle, _createInfo, *_allocator, &_pipelineCache));
@@ -138,15 +139,52 @@ namespace VaultedVulkan
 					vkDestroyPipelineCache(_deviceHandle, _cache, *_allocator);
 				}
 
-				/** 
-				@todo 
-				#TODO: MakeMergCacheFunction vkMergePipelineCaches 
-				*/
+				/**
+				 * @brief Get the data store from a pipeline cache.
+				 * 
+				 * @details
+				 * <a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#vkGetPipelineCacheData">Specification</a> 
+				 * 
+				 * If _data is nullptr, the maximum size of the data is returned in _dataSize. 
+				 * Otherwise _dataSize must be the size of _data and is set to the amount of bytes written.
+				 * 
+				 * @ingroup APISpec_Pipelines
+				 * 
+				 * \param _deviceHandle
+				 * \param _cache
+				 * \param _dataSize
+				 * \param _data
+				 * \return 
+				 */
+				static EResult GetData(LogicalDevice::Handle _deviceHandle, Cache::Handle _cache, std::size_t& _dataSize, void* _data)
+				{
+					return EResult(vkGetPipelineCacheData(_deviceHandle, _cache, &_dataSize, _data));
+				}
 
-				/** 
-				@todo 
-				#TODO:  vkGetPipelineCacheData 
-				*/
+				/**
+				 * @brief Combine the data stores of pipeline caches.
+				 * 
+				 * @details
+				 * <a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#vkMergePipelineCaches">Specification</a> 
+				 * 
+				 * @ingroup APISpec_Pipelines
+				 * 
+				 * \param _deviceHandle
+				 * \param _destinationCache
+				 * \param _sourceCacheCount
+				 * \param _sourceCaches
+				 * \return 
+				 */
+				static EResult Merge
+				(
+					      LogicalDevice::Handle _deviceHandle    ,
+					      Cache::Handle         _destinationCache,
+					      ui32                  _sourceCacheCount,
+					const Cache::Handle*        _sourceCaches
+				)
+				{
+					return EResult(vkMergePipelineCaches(_deviceHandle, _destinationCache, _sourceCacheCount, _sourceCaches));
+				}
 			};
 
 			/**
@@ -968,6 +1006,108 @@ namespace VaultedVulkan
 			}
 		};
 
+		/**
+		@brief Describes how descriptors are read from a block of host memory, so that a descriptor set can be updated with a single call.
+
+		@details <a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#descriptorsets-updates-with-template">Specification</a> 
+
+		@ingroup APISpec_Resource_Descriptors
+		*/
+		struct DescriptorUpdateTemplate
+		{
+			/** @brief <a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#VkDescriptorUpdateTemplate">Specification</a> @ingroup APISpec_Resource_Descriptors */
+			using Handle = VkDescriptorUpdateTemplate;
+
+			/** @brief <a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#VkDescriptorUpdateTemplateCreateFlags">Specification</a> @ingroup APISpec_Resource_Descriptors */
+			using CreateFlags = Bitfield<EUndefined, VkDescriptorUpdateTemplateCreateFlags>;
+
+			/** @brief <a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#VkDescriptorUpdateTemplateEntry">Specification</a> @ingroup APISpec_Resource_Descriptors */
+			struct Entry : V0::VKStruct_Base<VkDescriptorUpdateTemplateEntry>
+			{
+				ui32            DstBinding     ;
+				ui32            DstArrayElement;
+				ui32            DescriptorCount;
+				EDescriptorType DescriptorType ;
+				std::size_t     Offset         ;
+				std::size_t     Stride         ;
+			};
+
+			/** @brief <a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#VkDescriptorUpdateTemplateCreateInfo">Specification</a> @ingroup APISpec_Resource_Descriptors */
+			struct CreateInfo : V0::VKStruct_Base<VkDescriptorUpdateTemplateCreateInfo, EStructureType::DescriptorUpdateTemplate_CreateInfo>
+			{
+				      EType                                   SType                      = STypeEnum                                    ;
+				const void*                                   Next                       = nullptr                                      ;
+				      CreateFlags                             Flags                     ;
+				      ui32                                    DescriptorUpdateEntryCount = 0                                            ;
+				const Entry*                                  DescriptorUpdateEntries    = nullptr                                      ;
+				      EDescriptorUpdateTemplateType           TemplateType               = EDescriptorUpdateTemplateType::DescriptorSet ;
+				      Pipeline::Layout::DescriptorSet::Handle DescriptorSetLayout        = Null<Pipeline::Layout::DescriptorSet::Handle>;
+				      EPipelineBindPoint                      BindPoint                  = EPipelineBindPoint::Graphics                 ;
+				      Pipeline::Layout::Handle                PipelineLayout             = Null<Pipeline::Layout::Handle>               ;
+				      ui32                                    Set                        = 0                                            ;
+			};
+
+			/**
+			 * @brief Create a descriptor update template.
+			 * 
+			 * @details
+			 * <a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#vkCreateDescriptorUpdateTemplate">Specification</a> 
+			 * 
+			 * @ingroup APISpec_Resource_Descriptors
+			 * 
+			 * \param _deviceHandle
+			 * \param _createInfo
+			 * \param _allocator
+			 * \param _template
+			 * \return 
+			 */
+			static EResult Create
+			(
+				      LogicalDevice::Handle        _deviceHandle,
+				const CreateInfo&                  _createInfo  ,
+				const Memory::AllocationCallbacks* _allocator   ,
+				      Handle&                      _template
+			)
+			{
+				return EResult(vkCreateDescriptorUpdateTemplate(_deviceHandle, _createInfo, *_allocator, &_template));
+			}
+
+			/**
+			 * @brief Destroy a descriptor update template.
+			 * 
+			 * @details
+			 * <a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#vkDestroyDescriptorUpdateTemplate">Specification</a> 
+			 * 
+			 * @ingroup APISpec_Resource_Descriptors
+			 * 
+			 * \param _deviceHandle
+			 * \param _template
+			 * \param _allocator
+			 */
+			static void Destroy(LogicalDevice::Handle _deviceHandle, Handle _template, const Memory::AllocationCallbacks* _allocator)
+			{
+				vkDestroyDescriptorUpdateTemplate(_deviceHandle, _template, *_allocator);
+			}
+
+			/**
+			 * @brief Update the contents of a descriptor set object using an update template.
+			 * 
+			 * @details
+			 * <a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#vkUpdateDescriptorSetWithTemplate">Specification</a> 
+			 * 
+			 * @ingroup APISpec_Resource_Descriptors
+			 * 
+			 * \param _deviceHandle
+			 * \param _descriptorSet
+			 * \param _template
+			 * \param _data
+			 */
+			static void UpdateSet(LogicalDevice::Handle _deviceHandle, DescriptorSet::Handle _descriptorSet, Handle _template, const void* _data)
+			{
+				vkUpdateDescriptorSetWithTemplate(_deviceHandle, _descriptorSet, _template, _data);
+			}
+		};
+
 		/**
 		using Typedef of descriptor set layout in more recognizable form.
 		*/
@@ -1025,7 +1165,7 @@ namespace VaultedVulkan
 				(
 					      LogicalDevice::Handle  _deviceHandle ,
 					const CreateInfo&            _createInfo   ,
-					      Cache::Handle          _pipelineCache
+					      Cache::Handle&         _pipelineCache
 				)
 				{
 					return Parent::Create(_deviceHandle, _createInfo, Memory::DefaultAllocator, _pipelineCache);
@@ -1141,6 +1281,182 @@ namespace VaultedVulkan
 				}
 
 				using Parent::Destroy;
+
+				/**
+				@brief Generates the push constant range of a push constant block type.
+
+				@details The type must be trivially copyable and a multiple of 4 bytes in size, as push constant ranges are.
+				*/
+				template<typename Type>
+				static PushConstantRange GetPushConstantRange(ShaderStageFlags _stageFlags, ui32 _offset)
+				{
+					static_assert(!std::is_pointer<Type>::value          , "Push constant blocks are described by their type, not a pointer to it.");
+					static_assert(std::is_trivially_copyable<Type>::value, "Push constants must be trivially copyable.");
+					static_assert(sizeof(Type) % 4 == 0                  , "Push constants must be a multiple of 4 bytes in size.");
+
+					PushConstantRange range {};
+
+					range.StageFlags = _stageFlags       ;
+					range.Offset     = _offset           ;
+					range.Size       = ui32(sizeof(Type));
+
+					return range;
+				}
+
+				/**
+				@brief Generates the push constant range of a push constant block type. (At the start of the push constants)
+				*/
+				template<typename Type>
+				static PushConstantRange GetPushConstantRange(ShaderStageFlags _stageFlags)
+				{
+					return GetPushConstantRange<Type>(_stageFlags, 0);
+				}
+			};
+
+			/**
+			@brief Specialization constants with their map entries derived at compile time.
+			*/
+			struct Specialization : public Parent::Specialization
+			{
+				using Parent = Parent::Specialization;
+
+				/**
+				@brief A set of specialization constants of the types specified, packed with their natural alignment.
+
+				@details
+				The offset of each constant is computed at compile time, and the map entries are built from them.
+				Constant IDs default to the index of the constant, and can be changed with SetConstantID.
+
+				@code
+				// layout(constant_id = 0) const uint  LightCount = 1;
+				// layout(constant_id = 1) const bool  UseShadows = false;
+				// layout(constant_id = 2) const float Exposure   = 1.0;
+				using Permutation = Pipeline::Specialization::Constants<ui32, Bool, f32>;
+
+				Permutation permutation(4, true, 1.5f);
+
+				Pipeline::Specialization::Info info = permutation.GetInfo();
+				@endcode
+
+				The info points to the constants object, which must outlive the pipelines created with it.
+				*/
+				template<typename... Types>
+				class Constants
+				{
+				public:
+
+					static constexpr ui32 Count = ui32(sizeof...(Types));
+
+					static_assert(Count > 0, "Specialization constants must have at least one constant.");
+					static_assert(std::conjunction<std::is_trivially_copyable<Types>...>::value, "Specialization constants must be trivially copyable.");
+					static_assert(std::conjunction<std::bool_constant<sizeof(Types) <= 8>...>::value, "Specialization constants must be scalars. (Up to 8 bytes)");
+					static_assert(!std::disjunction<std::is_same<Types, bool>...>::value, "Boolean specialization constants must be Bool (VkBool32), not bool.");
+
+					static constexpr std::array<ui32, Count> Sizes      = { ui32(sizeof (Types))... };
+					static constexpr std::array<ui32, Count> Alignments = { ui32(alignof(Types))... };
+
+					static constexpr std::array<ui32, Count> Offsets =
+						[]()
+						{
+							std::array<ui32, Count> offsets {};
+
+							ui32 offset = 0;
+
+							for (ui32 index = 0; index < Count; index++)
+							{
+								offset = (offset + Alignments[index] - 1) / Alignments[index] * Alignments[index];
+
+								offsets[index] = offset;
+
+								offset += Sizes[index];
+							}
+
+							return offsets;
+						}();
+
+					static constexpr ui32 Size = Count > 0 ? Offsets[Count - 1] + Sizes[Count - 1] : 0;
+
+					template<ui32 Index>
+					using Type = std::tuple_element_t<Index, std::tuple<Types...>>;
+
+					/**
+					@brief Default constructor. (All constants zeroed)
+					*/
+					Constants() : data{}, entries{}
+					{
+						for (ui32 index = 0; index < Count; index++)
+						{
+							entries[index].ConstantID = index         ;
+							entries[index].Offset     = Offsets[index];
+							entries[index].Size       = Sizes  [index];
+						}
+					}
+
+					/**
+					@brief Specifies the value of every constant.
+					*/
+					Constants(const Types&... _values) : Constants()
+					{
+						SetAll(std::make_integer_sequence<ui32, Count>(), _values...);
+					}
+
+					/**
+					@brief Provides the value of a constant.
+					*/
+					template<ui32 Index>
+					Type<Index> Get() const
+					{
+						Type<Index> value;
+
+						memcpy(&value, data.data() + Offsets[Index], sizeof(Type<Index>));
+
+						return value;
+					}
+
+					/**
+					@brief Generates the specialization info of the constants. (Points to this object)
+					*/
+					Info GetInfo() const
+					{
+						Info info {};
+
+						info.MapEntryCount = Count         ;
+						info.MapEntires    = entries.data();
+						info.SizeOfData    = Size          ;
+						info.Data          = data.data()   ;
+
+						return info;
+					}
+
+					/**
+					@brief Sets the value of a constant.
+					*/
+					template<ui32 Index>
+					void Set(const Type<Index>& _value)
+					{
+						memcpy(data.data() + Offsets[Index], &_value, sizeof(Type<Index>));
+					}
+
+					/**
+					@brief Sets the constant ID a constant specializes. (Its index by default)
+					*/
+					void SetConstantID(ui32 _index, ui32 _constantID)
+					{
+						entries[_index].ConstantID = _constantID;
+					}
+
+				protected:
+
+					template<ui32... Indices>
+					void SetAll(std::integer_sequence<ui32, Indices...>, const Types&... _values)
+					{
+						(Set<Indices>(_values), ...);
+					}
+
+					alignas(8) std::array<u8, Size> data;
+
+					std::array<MapEntry, Count> entries;
+				};
 			};
 
 			struct Compute : public Parent::Compute
@@ -1219,6 +1535,42 @@ namespace VaultedVulkan
 			}
 		};
 
+		/**
+		@brief Describes how descriptors are read from a block of host memory, so that a descriptor set can be updated with a single call.
+		*/
+		struct DescriptorUpdateTemplate : public V1::DescriptorUpdateTemplate
+		{
+			using Parent = V1::DescriptorUpdateTemplate;
+
+			/**
+			 * @brief Create a descriptor update template (Default allocator).
+			 * 
+			 * \param _deviceHandle
+			 * \param _createInfo
+			 * \param _template
+			 * \return 
+			 */
+			static EResult Create(LogicalDevice::Handle _deviceHandle, const CreateInfo& _createInfo, Handle& _template)
+			{
+				return Parent::Create(_deviceHandle, _createInfo, Memory::DefaultAllocator, _template);
+			}
+
+			using Parent::Create;
+
+			/**
+			 * @brief Destroy a descriptor update template (Default allocator).
+			 * 
+			 * \param _deviceHandle
+			 * \param _template
+			 */
+			static void Destroy(LogicalDevice::Handle _deviceHandle, Handle _template)
+			{
+				Parent::Destroy(_deviceHandle, _template, Memory::DefaultAllocator);
+			}
+
+			using Parent::Destroy;
+		};
+
 		/**
 		using Typedef of descriptor set layout in more recognizable form.
 		*/
@@ -1303,6 +1655,109 @@ namespace VaultedVulkan
 					if (handle != Null<Handle>) Destroy();
 				}
 
+				/**
+				@brief Header of a pipeline cache file, identifying the device the cache data was retrieved with.
+
+				@details
+				The data of a pipeline cache is only usable by the same device and driver that produced it. 
+				A file is only loaded if its header matches the properties of the physical device, and its data is intact (checksum).
+				*/
+				struct FileHeader
+				{
+					static constexpr ui32 Magic         = 0x43505656;   // "VVPC"
+					static constexpr ui32 FormatVersion = 1         ;
+
+					ui32 MagicID          ;
+					ui32 Version          ;
+					ui32 VendorID         ;
+					ui32 DeviceID         ;
+					ui32 DriverVersion    ;
+					UUID PipelineCacheUUID;
+					u64  DataSize         ;
+					u64  Checksum         ;
+
+					/**
+					@brief Generates the header for the cache data retrieved with the physical device specified.
+					*/
+					static FileHeader Make(const PhysicalDevice::Properties& _properties, const void* _data, std::size_t _dataSize)
+					{
+						FileHeader header {};
+
+						header.MagicID       = Magic                    ;
+						header.Version       = FormatVersion            ;
+						header.VendorID      = _properties.VenderID     ;
+						header.DeviceID      = _properties.ID           ;
+						header.DriverVersion = _properties.DriverVersion;
+						header.DataSize      = _dataSize                ;
+						header.Checksum      = GetChecksum(_data, _dataSize);
+
+						memcpy(header.PipelineCacheUUID, _properties.PipelineCacheUUID, UUID_Size);
+
+						return header;
+					}
+
+					/**
+					@brief Checks if the header and the cache data following it can be used with the physical device specified.
+
+					@details The header of the cache data itself (written by the driver) is checked against the device as well.
+					*/
+					bool IsCompatible(const PhysicalDevice::Properties& _properties, const void* _data, std::size_t _dataSize) const
+					{
+						if 
+						(
+							MagicID       != Magic                     || 
+							Version       != FormatVersion             ||
+							VendorID      != _properties.VenderID      || 
+							DeviceID      != _properties.ID            || 
+							DriverVersion != _properties.DriverVersion ||
+							DataSize      != _dataSize                 ||
+							memcmp(PipelineCacheUUID, _properties.PipelineCacheUUID, UUID_Size) != 0
+						)
+						{
+							return false;
+						}
+
+						// Header written by the implementation: size, version, vendor ID, device ID, pipeline cache UUID.
+						constexpr std::size_t DataHeaderSize = 4 * sizeof(ui32) + UUID_Size;
+
+						if (_dataSize < DataHeaderSize) return false;
+
+						ui32 dataHeader[4]; memcpy(dataHeader, _data, sizeof(dataHeader));
+
+						if 
+						(
+							dataHeader[0] <  DataHeaderSize                     || 
+							dataHeader[1] != VK_PIPELINE_CACHE_HEADER_VERSION_ONE ||
+							dataHeader[2] != _properties.VenderID               || 
+							dataHeader[3] != _properties.ID                     ||
+							memcmp(static_cast<const u8*>(_data) + sizeof(dataHeader), _properties.PipelineCacheUUID, UUID_Size) != 0
+						)
+						{
+							return false;
+						}
+
+						return Checksum == GetChecksum(_data, _dataSize);
+					}
+
+					/**
+					@brief 64-bit FNV-1a hash of the data.
+					*/
+					static u64 GetChecksum(const void* _data, std::size_t _dataSize)
+					{
+						const u8* bytes = static_cast<const u8*>(_data);
+
+						u64 hash = 0xCBF29CE484222325ull;
+
+						for (std::size_t index = 0; index < _dataSize; index++)
+						{
+							hash ^= bytes[index];
+							hash *= 0x100000001B3ull;
+						}
+
+						return hash;
+					}
+				};
+
 				/**
 				@brief Create a cache.
 				*/
@@ -1334,6 +1789,68 @@ namespace VaultedVulkan
 					return Parent::Create(*device, _info, allocator, handle);
 				}
 
+				/**
+				@brief Create the cache, initialized with the data of the cache file at the path if the file is compatible with the physical device.
+
+				@details
+				A missing, stale (other device or driver), or corrupt file is not an error: the cache is created empty and _loaded is false.
+				The file is memory mapped and handed to the implementation directly.
+				*/
+				EResult CreateFromFile(RoCStr _path, const PhysicalDevice::Properties& _properties, bool& _loaded)
+				{
+					if (device == nullptr) return EResult::Not_Ready;
+
+					CreateInfo info; 
+
+					info.InitialDataSize = 0      ;
+					info.InitialData     = nullptr;
+
+					_loaded = false;
+
+					MappedFile file;
+
+					if (file.Open(_path) && file.GetSize() >= sizeof(FileHeader))
+					{
+						FileHeader header; memcpy(&header, file.GetData(), sizeof(FileHeader));
+
+						const u8*         data     = file.GetData() + sizeof(FileHeader);
+						const std::size_t dataSize = file.GetSize() - sizeof(FileHeader);
+
+						if (header.IsCompatible(_properties, data, dataSize))
+						{
+							info.InitialDataSize = dataSize;
+							info.InitialData     = data    ;
+
+							_loaded = true;
+						}
+					}
+
+					EResult returnCode = Parent::Create(*device, info, allocator, handle);
+
+					// The implementation may still reject the data, fallback to an empty cache.
+					if (returnCode != EResult::Success && _loaded)
+					{
+						info.InitialDataSize = 0      ;
+						info.InitialData     = nullptr;
+
+						_loaded = false;
+
+						returnCode = Parent::Create(*device, info, allocator, handle);
+					}
+
+					return returnCode;
+				}
+
+				/**
+				@brief Create the cache, initialized with the data of the cache file at the path if the file is compatible with the physical device.
+				*/
+				EResult CreateFromFile(RoCStr _path, const PhysicalDevice::Properties& _properties)
+				{
+					bool loaded;
+
+					return CreateFromFile(_path, _properties, loaded);
+				}
+
 				/**
 				@brief Destroy a cache.
 				*/
@@ -1345,6 +1862,74 @@ namespace VaultedVulkan
 					device = nullptr     ;
 				}
 
+				/**
+				@brief Retrieve the data of the cache.
+				*/
+				EResult GetData(DynamicArray<u8>& _data) const
+				{
+					EResult returnCode;
+
+					do
+					{
+						std::size_t dataSize = 0;
+
+						returnCode = Parent::GetData(*device, handle, dataSize, nullptr);
+
+						if (returnCode != EResult::Success) return returnCode;
+
+						_data.resize(dataSize);
+
+						// Incomplete if pipelines were added to the cache between both calls.
+						returnCode = Parent::GetData(*device, handle, dataSize, _data.data());
+
+						_data.resize(dataSize);
+					} 
+					while (returnCode == EResult::Incomplete);
+
+					return returnCode;
+				}
+
+				/**
+				@brief Merge the data of the source caches into this cache. (Ex: combining caches used by separate threads)
+				*/
+				EResult Merge(ui32 _sourceCacheCount, const Handle* _sourceCaches)
+				{
+					return Parent::Merge(*device, handle, _sourceCacheCount, _sourceCaches);
+				}
+
+				/**
+				@brief Merge the data of the source cache into this cache.
+				*/
+				EResult Merge(const Cache& _sourceCache)
+				{
+					return Parent::Merge(*device, handle, 1, _sourceCache);
+				}
+
+				/**
+				@brief Write the data of the cache to a file at the path, with a header identifying the physical device. (See FileHeader)
+
+				@details
+				The file is written next to the path and then replaces it, a concurrent reader never observes a partial file.
+				Returns EResult::Error_Unknown if the file could not be written.
+				*/
+				EResult SaveToFile(RoCStr _path, const PhysicalDevice::Properties& _properties) const
+				{
+					DynamicArray<u8> data;
+
+					EResult returnCode = GetData(data);
+
+					if (returnCode != EResult::Success) return returnCode;
+
+					const FileHeader header = FileHeader::Make(_properties, data.data(), data.size());
+
+					const void*       blocks    [2] = { &header           , data.data() };
+					const std::size_t blockSizes[2] = { sizeof(FileHeader), data.size() };
+
+					if (!WriteFileAtomic(_path, 2, blocks, blockSizes)) return EResult::Error_Unknown;
+
+					return EResult::Success;
+				}
+
 				/**
 				@brief Implicit conversion to give a reference to its handle.
 				*/
@@ -2000,7 +2585,7 @@ namespace VaultedVulkan
 			{
 				_pipelines.resize(_createInfoCount);
 
-				Handle* handles = nullptr;
+				DynamicArray<Handle> handles(_createInfoCount);
 
 				EResult returnCode = 
 					Parent::Parent::Compute::Create
@@ -2010,16 +2595,18 @@ namespace VaultedVulkan
 						_createInfoCount,
 						_createInfos    ,
 						_allocator      ,
-						handles
+						handles.data()
 					);
 
 				if (returnCode != EResult::Success) return returnCode;
 
-				int index = 0;
+				ui32 index = 0;
 
 				for (auto& pipeline : _pipelines)
 				{
 					pipeline.Assign(_device, _cache, _allocator, handles[index]);
+
+					index++;
 				}
 
 				return returnCode;
@@ -2148,7 +2735,7 @@ namespace VaultedVulkan
 			{
 				_pipelines.resize(_createInfoCount);
 
-				Handle* handles = nullptr;
+				DynamicArray<Handle> handles(_createInfoCount);
 
 				EResult returnCode = 
 					Parent::Parent::Graphics::Create
@@ -2158,22 +2745,342 @@ namespace VaultedVulkan
 						_createInfoCount,
 						_createInfos    ,
 						_allocator      ,
-						handles
+						handles.data()
 					);
 
 				if (returnCode != EResult::Success) return returnCode;
 
-				int index = 0;
+				ui32 index = 0;
 
 				for (auto& pipeline : _pipelines)
 				{
 					pipeline.Assign(_device, _cache, _allocator, handles[index]);
+
+					index++;
 				}
 
 				return returnCode;
 			}
 		};
 
+		/**
+		@brief Describes how descriptors are read from a block of host memory, so that a descriptor set can be updated with a single call.
+
+		@details
+		Instead of an array of writes per update, the application keeps the descriptor infos of a set in a struct of its own,
+		and the template reads them directly from it.
+
+		A template can be derived from the bindings of a descriptor set layout (See CreateFromBindings). The infos are then expected to be packed
+		in the order of the bindings, each binding taking its count of the info type of its descriptor type:
+		DescriptorSet::ImageInfo for samplers and images, DescriptorSet::BufferInfo for buffers, and BufferView::Handle for texel buffers.
+		As every info type is 8 byte aligned, a plain struct declaring the infos in binding order matches:
+
+		@code
+		struct MaterialDescriptors
+		{
+			DescriptorSet::BufferInfo Uniforms    ;   // Binding 0: UniformBuffer       , Count 1
+			DescriptorSet::ImageInfo  Textures[2] ;   // Binding 1: CombinedImageSampler, Count 2
+		};
+		@endcode
+
+		This object represents a device created object on the host. As such ownership is tied to this host object.
+		Due to this design, the object has no copy-construction allowed. Instead, default move constructor and assignment has been defined.
+		*/
+		class DescriptorUpdateTemplate : public V2::DescriptorUpdateTemplate
+		{
+		public:
+			using Parent = V2::DescriptorUpdateTemplate;
+
+			/**
+			@brief Default constructor.
+			*/
+			DescriptorUpdateTemplate() : handle(Null<Handle>), allocator(Memory::DefaultAllocator), device(nullptr), dataSize(0)
+			{}
+
+			/**
+			@brief Specify the logical device.
+			*/
+			DescriptorUpdateTemplate(const LogicalDevice& _device) : handle(Null<Handle>), allocator(Memory::DefaultAllocator), device(&_device), dataSize(0)
+			{}
+
+			/**
+			@brief Specify the logical device and allocator.
+			*/
+			DescriptorUpdateTemplate(const LogicalDevice& _device, const Memory::AllocationCallbacks& _allocator) :
+				handle(Null<Handle>), allocator(&_allocator), device(&_device), dataSize(0)
+			{}
+
+			/**
+			@brief Performs a move operation to transfer ownership of the device object to this host object.
+			*/
+			DescriptorUpdateTemplate(DescriptorUpdateTemplate&& _other) noexcept :
+				handle(std::move(_other.handle)), allocator(std::move(_other.allocator)), device(std::move(_other.device)), dataSize(_other.dataSize)
+			{
+				_other.handle    = Null<Handle>            ;
+				_other.allocator = Memory::DefaultAllocator;
+				_other.device    = nullptr                 ;
+				_other.dataSize  = 0                       ;
+			}
+
+			/**
+			@brief Destroy the template if the handle is not null.
+			*/
+			~DescriptorUpdateTemplate()
+			{
+				if (handle != Null<Handle>) Destroy();
+			}
+
+			/**
+			@brief Create the descriptor update template.
+			*/
+			EResult Create(const CreateInfo& _info)
+			{
+				if (device == nullptr) return EResult::Not_Ready;
+
+				dataSize = GetDataSize(_info.DescriptorUpdateEntryCount, _info.DescriptorUpdateEntries);
+
+				return Parent::Create(*device, _info, allocator, handle);
+			}
+
+			/**
+			@brief Create the descriptor update template (logical device specified).
+			*/
+			EResult Create(const LogicalDevice& _device, const CreateInfo& _info)
+			{
+				device = &_device;
+
+				return Create(_info);
+			}
+
+			/**
+			@brief Create the descriptor update template (logical device and allocator specified).
+			*/
+			EResult Create(const LogicalDevice& _device, const CreateInfo& _info, const Memory::AllocationCallbacks& _allocator)
+			{
+				device    = &_device   ;
+				allocator = &_allocator;
+
+				return Create(_info);
+			}
+
+			/**
+			@brief Create a template that updates every binding of a descriptor set layout, reading the infos packed in binding order. (See class details)
+
+			@param _bindingCount The bindings the layout was created with.
+			*/
+			EResult CreateFromBindings
+			(
+				      Pipeline::Layout::DescriptorSet::Handle   _layout      ,
+				      ui32                                      _bindingCount,
+				const Pipeline::Layout::DescriptorSet::Binding* _bindings
+			)
+			{
+				DynamicArray<Entry> entries(_bindingCount);
+
+				std::size_t offset = 0;
+
+				for (ui32 index = 0; index < _bindingCount; index++)
+				{
+					const Pipeline::Layout::DescriptorSet::Binding& binding = _bindings[index];
+
+					Entry& entry = entries[index];
+
+					entry.DstBinding      = binding.BindingID        ;
+					entry.DstArrayElement = 0                        ;
+					entry.DescriptorCount = binding.Count            ;
+					entry.DescriptorType  = binding.Type             ;
+					entry.Stride          = GetInfoSize(binding.Type);
+					entry.Offset          = offset                   ;
+
+					offset += entry.Stride * entry.DescriptorCount;
+
+					// Keep the following binding's infos aligned. (Only inline uniform blocks are not a multiple of 8 bytes)
+					offset = (offset + alignof(DescriptorSet::BufferInfo) - 1) & ~(alignof(DescriptorSet::BufferInfo) - 1);
+				}
+
+				CreateInfo info;
+
+				info.DescriptorUpdateEntryCount = _bindingCount ;
+				info.DescriptorUpdateEntries    = entries.data();
+				info.TemplateType               = EDescriptorUpdateTemplateType::DescriptorSet;
+				info.DescriptorSetLayout        = _layout       ;
+
+				return Create(info);
+			}
+
+			/**
+			@brief Create a template that updates every binding of a descriptor set layout, reading the infos packed in binding order. (See class details)
+			*/
+			EResult CreateFromBindings(const Pipeline::Layout::DescriptorSet& _layout, const Pipeline::Layout::DescriptorSet::CreateInfo& _layoutInfo)
+			{
+				return CreateFromBindings(_layout, _layoutInfo.BindingCount, _layoutInfo.Bindings);
+			}
+
+			/**
+			@brief Destroy the descriptor update template.
+			*/
+			void Destroy()
+			{
+				Parent::Destroy(*device, handle, allocator);
+
+				handle    = Null<Handle>            ;
+				allocator = Memory::DefaultAllocator;
+				device    = nullptr                 ;
+				dataSize  = 0                       ;
+			}
+
+			/**
+			@brief Provides the amount of bytes read from the data of an update.
+			*/
+			std::size_t GetDataSize() const
+			{
+				return dataSize;
+			}
+
+			/**
+			@brief Update the descriptor set with the infos read from the data.
+			*/
+			void Update(DescriptorSet::Handle _descriptorSet, const void* _data) const
+			{
+				Parent::UpdateSet(*device, _descriptorSet, handle, _data);
+			}
+
+			/**
+			@brief Update the descriptor set with the infos read from the data struct.
+
+			@details Only takes a struct: pointers (and arrays) go to the const void* overload instead of having their own address read as the data.
+			*/
+			template<typename DataType>
+			typename std::enable_if<std::is_class<DataType>::value>::type Update(DescriptorSet::Handle _descriptorSet, const DataType& _data) const
+			{
+				static_assert(std::is_trivially_copyable<DataType>::value, "The data must be a plain struct of descriptor infos.");
+
+				Parent::UpdateSet(*device, _descriptorSet, handle, &_data);
+			}
+
+			/**
+			@brief Implicit conversion to give a reference to its handle.
+			*/
+			operator Handle&()
+			{
+				return handle;
+			}
+
+			/**
+			@brief Implicit conversion to give a readonly reference to its handle.
+			*/
+			operator const Handle&() const
+			{
+				return handle;
+			}
+
+			/**
+			@brief Implicit conversion to give a pointer to its handle.
+			*/
+			operator const Handle*() const
+			{
+				return &handle;
+			}
+
+			/**
+			@brief Checks to see if its the same object by checking to see if its the same handle.
+			*/
+			bool operator== (const DescriptorUpdateTemplate& _other) const
+			{
+				return handle == _other.handle;
+			}
+
+			/**
+			@brief Performs a move assignment operation to transfer ownership of the device object to this host object.
+			*/
+			DescriptorUpdateTemplate& operator= (DescriptorUpdateTemplate&& _other) noexcept
+			{
+				if (this == &_other)
+					return *this;
+
+				handle    = std::move(_other.handle   );
+				allocator = std::move(_other.allocator);
+				device    = std::move(_other.device   );
+				dataSize  = _other.dataSize            ;
+
+				_other.handle    = Null<Handle>            ;
+				_other.allocator = Memory::DefaultAllocator;
+				_other.device    = nullptr                 ;
+				_other.dataSize  = 0                       ;
+
+				return *this;
+			}
+
+			/**
+			@brief Provides the size of the info read for a single descriptor of the type specified.
+			*/
+			static std::size_t GetInfoSize(EDescriptorType _type)
+			{
+				switch (_type)
+				{
+					case EDescriptorType::Sampler             :
+					case EDescriptorType::CombinedImageSampler:
+					case EDescriptorType::SampledImage        :
+					case EDescriptorType::StorageImage        :
+					case EDescriptorType::InputAttachment     :
+					{
+						return sizeof(DescriptorSet::ImageInfo);
+					}
+					case EDescriptorType::UniformTexelBuffer:
+					case EDescriptorType::StorageTexelBuffer:
+					{
+						return sizeof(BufferView::Handle);
+					}
+					case EDescriptorType::UniformBuffer       :
+					case EDescriptorType::StorageBuffer       :
+					case EDescriptorType::UniformBufferDynamic:
+					case EDescriptorType::StorageBufferDynamic:
+					{
+						return sizeof(DescriptorSet::BufferInfo);
+					}
+					case EDescriptorType::InlineUniformBlock_Extension:
+					{
+						return 1;   // The descriptor count of an inline uniform block is its size in bytes.
+					}
+					default:
+					{
+						return sizeof(void*);   // Acceleration structures are referenced by handle.
+					}
+				}
+			}
+
+		protected:
+
+			/**
+			@brief The end of the furthest info read by the entries.
+			*/
+			static std::size_t GetDataSize(ui32 _entryCount, const Entry* _entries)
+			{
+				std::size_t size = 0;
+
+				for (ui32 index = 0; index < _entryCount; index++)
+				{
+					const Entry& entry = _entries[index];
+
+					if (entry.DescriptorCount == 0) continue;
+
+					const std::size_t stride = entry.Stride != 0 ? entry.Stride : GetInfoSize(entry.DescriptorType);
+
+					size = (std::max)(size, entry.Offset + entry.Stride * (entry.DescriptorCount - 1) + stride);
+				}
+
+				return size;
+			}
+
+			Handle handle;
+
+			const Memory::AllocationCallbacks* allocator;
+
+			const LogicalDevice* device;
+
+			std::size_t dataSize;
+		};
+
 		/**
 		using Typedef of descriptor set layout in more recognizable form.
 		*/
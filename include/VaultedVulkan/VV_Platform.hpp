@@ -56,6 +56,7 @@ specified, why this is required.
 // VT
 #include "VV_Vaults.hpp"
 #include "VV_APISpecGroups.hpp"
+#include "VV_MagmaChamber.hpp"
 
 
 #pragma endregion Includes
@@ -0,0 +1,1088 @@
+/*!
+@file VV_Profiler.hpp
+
+@brief Vaulted Vulkan: GPU Profiler
+
+@details Contains a hierarchical GPU scope profiler, measuring the device time spent between timestamps written around recorded commands,
+and batches of occlusion and pipeline statistics queries.
+
+Results of a frame are read back when they become available (without waiting on the device),
+so reading them does not stall the frame being recorded.
+
+<a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#queries-timestamps">Specification</a>
+*/
+
+
+
+#pragma once
+
+
+
+// VV
+#include "VV_Vaults.hpp"
+#include "VV_APISpecGroups.hpp"
+#include "VV_Platform.hpp"
+#include "VV_CPP_STL.hpp"
+#include "VV_Enums.hpp"
+#include "VV_Backend.hpp"
+#include "VV_Types.hpp"
+#include "VV_Constants.hpp"
+#include "VV_Memory_Backend.hpp"
+#include "VV_PhysicalDevice.hpp"
+#include "VV_Initialization.hpp"
+#include "VV_LogicalDevice.hpp"
+#include "VV_Memory.hpp"
+#include "VV_Sampler.hpp"
+#include "VV_Resource.hpp"
+#include "VV_SyncAndCacheControl.hpp"
+#include "VV_Query.hpp"
+#include "VV_Shaders.hpp"
+#include "VV_Pipelines.hpp"
+#include "VV_RenderPass.hpp"
+#include "VV_Command.hpp"
+
+
+
+#ifndef VV_Option__Use_Long_Namespace
+namespace VV
+#else
+namespace VaultedVulkan
+#endif
+{
+	namespace V3
+	{
+		/**
+		@addtogroup Vault_3
+		@{
+		*/
+
+		/**
+		@brief Measures the device time of nested scopes of recorded commands, keeping rolling statistics per scope.
+
+		@details
+		Scopes are identified by their name and their parent scope, so the same name nested under different scopes is a different scope.
+		A scope recorded several times in a frame accumulates its timings for that frame.
+
+		Usage per frame in flight:
+		BeginFrame (outside of a render pass, before any scope), scopes recorded with Scope objects or Begin/EndScope, then EndFrame.
+		The frame must then be submitted before the next BeginFrame.
+		A frame's results are collected once the device has finished it, at the latest when its query pool is reused.
+		If they are still not available at that point (more frames in flight than query pools), the frame's timings are dropped.
+
+		The profiler is not thread safe: scopes must be recorded from a single thread, in the order they execute on the queue.
+		*/
+		class GPU_Profiler
+		{
+		public:
+
+			using ScopeID = ui32;
+
+			static constexpr ScopeID InvalidScope = ScopeID(-1);
+
+			/**
+			@brief Rolling statistics of a scope over its history. (Milliseconds)
+			*/
+			struct Statistics
+			{
+				f64  Last       ;
+				f64  Average    ;
+				f64  Minimum    ;
+				f64  Maximum    ;
+				ui32 SampleCount;
+			};
+
+			/**
+			@brief A scope measured in a frame collected. (Device timestamps)
+			*/
+			struct Sample
+			{
+				ScopeID Scope;
+				u64     Begin;
+				u64     End  ;
+			};
+
+			/**
+			@brief Records a scope for the lifetime of the object.
+			*/
+			class Scope
+			{
+			public:
+
+				/**
+				@brief Begin a scope on the command buffer.
+				*/
+				Scope(GPU_Profiler& _profiler, const CommandBuffer& _commandBuffer, RoCStr _name) :
+					profiler(&_profiler), commandBuffer(&_commandBuffer)
+				{
+					profiler->BeginScope(_commandBuffer, _name);
+				}
+
+				Scope(const Scope&) = delete;
+
+				Scope& operator= (const Scope&) = delete;
+
+				/**
+				@brief End the scope on the command buffer it began on.
+				*/
+				~Scope()
+				{
+					profiler->EndScope(*commandBuffer);
+				}
+
+			protected:
+
+				GPU_Profiler* profiler;
+
+				const CommandBuffer* commandBuffer;
+			};
+
+			/**
+			@brief Default constructor.
+			*/
+			GPU_Profiler() :
+				device(nullptr), frameIndex(0), timestampMask(0), timestampPeriod(0), historyLength(0), droppedCount(0), overflowCount(0), keepSamples(false)
+			{}
+
+			GPU_Profiler(const GPU_Profiler&) = delete;
+
+			GPU_Profiler& operator= (const GPU_Profiler&) = delete;
+
+			/**
+			@brief Destroys the query pools if the profiler was created.
+			*/
+			~GPU_Profiler()
+			{
+				if (!frames.empty()) Destroy();
+			}
+
+			/**
+			@brief Begin a frame: collects the available results, and resets the frame's query pool.
+
+			@details Must be recorded outside of a render pass, before the scopes of the frame.
+			*/
+			void BeginFrame(const CommandBuffer& _commandBuffer)
+			{
+				if (frames.empty()) return;
+
+				Collect();
+
+				frameIndex = (frameIndex + 1) % ui32(frames.size());
+
+				Frame& frame = frames[frameIndex];
+
+				if (frame.State == EFrameState::Pending) droppedCount++;
+
+				frame.Records.clear();
+
+				frame.QueryCount = 0                    ;
+				frame.State      = EFrameState::Recording;
+
+				stack.clear();
+
+				_commandBuffer.ResetQueryPool(frame.Pool, 0, frame.Pool.GetQueryCount());
+			}
+
+			/**
+			@brief Begin a scope nested in the scope currently open.
+
+			@return The scope began, or InvalidScope if no frame is being recorded.
+			*/
+			ScopeID BeginScope(const CommandBuffer& _commandBuffer, RoCStr _name, EPipelineStageFlag _stage = EPipelineStageFlag::TopOfPipe)
+			{
+				if (frames.empty() || frames[frameIndex].State != EFrameState::Recording)
+				{
+					stack.push_back({ InvalidScope, NoRecord });
+
+					return InvalidScope;
+				}
+
+				Frame& frame = frames[frameIndex];
+
+				ScopeID scope = AcquireScope(stack.empty() ? InvalidScope : stack.back().Scope, _name);
+
+				ui32 recordIndex = NoRecord;
+
+				if (frame.QueryCount + 2 <= frame.Pool.GetQueryCount())
+				{
+					recordIndex = ui32(frame.Records.size());
+
+					frame.Records.push_back({ scope, frame.QueryCount, NoQuery });
+
+					_commandBuffer.WriteTimestamp(_stage, frame.Pool, frame.QueryCount);
+
+					frame.QueryCount += 2;
+				}
+				else
+				{
+					overflowCount++;
+				}
+
+				stack.push_back({ scope, recordIndex });
+
+				return scope;
+			}
+
+			/**
+			@brief Collect the results of the frames the device has finished. (Does not wait on the device)
+
+			@return The amount of frames collected.
+			*/
+			ui32 Collect()
+			{
+				ui32 collected = 0;
+
+				// Oldest frames first, so that the history remains in submission order.
+				for (ui32 offset = 1; offset <= ui32(frames.size()); offset++)
+				{
+					Frame& frame = frames[(frameIndex + offset) % ui32(frames.size())];
+
+					if (frame.State != EFrameState::Pending) continue;
+
+					EResult result = frame.Pool.GetResults(0, frame.QueryCount, frame.Results.data(), EQueryResultFlag::WithAvailability);
+
+					if (result == EResult::Not_Ready) continue;
+
+					if (result == EResult::Success)
+					{
+						Resolve(frame);
+
+						collected++;
+					}
+					else
+					{
+						droppedCount++;
+					}
+
+					frame.State = EFrameState::Idle;
+				}
+
+				return collected;
+			}
+
+			/**
+			@brief Create the query pools.
+
+			@param _queue             Queue the frames are submitted to. (Must support timestamps)
+			@param _frameCount        Amount of frames in flight.
+			@param _maxScopesPerFrame Amount of scopes measured per frame, further scopes are not measured.
+			@param _historyLength     Amount of frames kept for a scope's rolling statistics.
+			*/
+			EResult Create(const LogicalDevice& _device, const LogicalDevice::Queue& _queue, ui32 _frameCount, ui32 _maxScopesPerFrame, ui32 _historyLength)
+			{
+				if (!frames.empty() || _frameCount == 0 || _maxScopesPerFrame == 0 || _historyLength == 0) return EResult::Not_Ready;
+
+				const PhysicalDevice& physicalDevice = _device.GetPhysicalDevice();
+
+				ui32 validBits = physicalDevice.GetAvailableQueueFamilies()[_queue.GetFamilyIndex()].TimestampValidBits;
+
+				if (validBits == 0) return EResult::Error_FeatureNotPresent;
+
+				device          = &_device;
+				timestampMask   = validBits >= 64 ? ~u64(0) : (u64(1) << validBits) - 1;
+				timestampPeriod = f64(physicalDevice.GetProperties().LimitsSpec.TimestampPeriod);
+				historyLength   = _historyLength;
+
+				QueryPool::CreateInfo info {};
+
+				info.QueryType  = EQueryType::Timestamp ;
+				info.QueryCount = _maxScopesPerFrame * 2;
+
+				frames.resize(_frameCount);
+
+				for (Frame& frame : frames)
+				{
+					EResult result = frame.Pool.Create(_device, info);
+
+					if (result != EResult::Success)
+					{
+						Destroy();
+
+						return result;
+					}
+
+					frame.Records.reserve(_maxScopesPerFrame);
+
+					frame.Results.resize(std::size_t(info.QueryCount) * 2);
+				}
+
+				frameIndex = _frameCount - 1;
+
+				return EResult::Success;
+			}
+
+			/**
+			@brief Destroy the query pools, and clear the scopes measured.
+			*/
+			void Destroy()
+			{
+				frames .clear();
+				scopes .clear();
+				roots  .clear();
+				stack  .clear();
+				samples.clear();
+
+				device        = nullptr;
+				droppedCount  = 0      ;
+				overflowCount = 0      ;
+			}
+
+			/**
+			@brief End a frame, ending the scopes left open.
+			*/
+			void EndFrame(const CommandBuffer& _commandBuffer)
+			{
+				if (frames.empty() || frames[frameIndex].State != EFrameState::Recording) return;
+
+				while (!stack.empty()) EndScope(_commandBuffer);
+
+				Frame& frame = frames[frameIndex];
+
+				frame.State = frame.Records.empty() ? EFrameState::Idle : EFrameState::Pending;
+			}
+
+			/**
+			@brief End the scope currently open.
+			*/
+			void EndScope(const CommandBuffer& _commandBuffer, EPipelineStageFlag _stage = EPipelineStageFlag::BottomOfPipe)
+			{
+				if (stack.empty()) return;
+
+				OpenScope open = stack.back();
+
+				stack.pop_back();
+
+				if (open.Record == NoRecord) return;
+
+				Frame& frame = frames[frameIndex];
+
+				Record& record = frame.Records[open.Record];
+
+				record.EndQuery = record.BeginQuery + 1;
+
+				_commandBuffer.WriteTimestamp(_stage, frame.Pool, record.EndQuery);
+			}
+
+			/**
+			@brief Provides the amount of frames whose timings were dropped, because their results were not available when their query pool was reused.
+			*/
+			ui32 GetDroppedCount() const
+			{
+				return droppedCount;
+			}
+
+			/**
+			@brief Provides the amount of scopes that were not measured, because a frame exceeded the maximum amount of scopes.
+			*/
+			ui32 GetOverflowCount() const
+			{
+				return overflowCount;
+			}
+
+			/**
+			@brief Provides a scope by its parent and name. (InvalidScope if it was never recorded)
+
+			@param _parent Parent of the scope. (InvalidScope for a top level scope)
+			*/
+			ScopeID GetScope(ScopeID _parent, RoCStr _name) const
+			{
+				const DynamicArray<ScopeID>& children = _parent == InvalidScope ? roots : scopes[_parent].Children;
+
+				for (ScopeID child : children)
+				{
+					if (scopes[child].Name == _name) return child;
+				}
+
+				return InvalidScope;
+			}
+
+			/**
+			@brief Provides the amount of scopes recorded so far. (Scope ids are from 0 to the count)
+			*/
+			ui32 GetScopeCount() const
+			{
+				return ui32(scopes.size());
+			}
+
+			/**
+			@brief Provides the nesting depth of a scope. (0 for top level scopes)
+			*/
+			ui32 GetScopeDepth(ScopeID _scope) const
+			{
+				return scopes[_scope].Depth;
+			}
+
+			RoCStr GetScopeName(ScopeID _scope) const
+			{
+				return scopes[_scope].Name.c_str();
+			}
+
+			/**
+			@brief Provides the parent of a scope. (InvalidScope for top level scopes)
+			*/
+			ScopeID GetScopeParent(ScopeID _scope) const
+			{
+				return scopes[_scope].Parent;
+			}
+
+			/**
+			@brief Provides the rolling statistics of a scope over the frames in its history.
+			*/
+			Statistics GetStatistics(ScopeID _scope) const
+			{
+				const ScopeInfo& scope = scopes[_scope];
+
+				Statistics statistics {};
+
+				statistics.SampleCount = scope.SampleCount;
+
+				if (scope.SampleCount == 0) return statistics;
+
+				statistics.Last    = scope.History[(scope.HistoryNext + historyLength - 1) % historyLength];
+				statistics.Minimum = statistics.Last;
+				statistics.Maximum = statistics.Last;
+
+				f64 sum = 0;
+
+				for (ui32 sample = 0; sample < scope.SampleCount; sample++)
+				{
+					f64 time = scope.History[sample];
+
+					sum += time;
+
+					statistics.Minimum = (std::min)(statistics.Minimum, time);
+					statistics.Maximum = (std::max)(statistics.Maximum, time);
+				}
+
+				statistics.Average = sum / f64(scope.SampleCount);
+
+				return statistics;
+			}
+
+			/**
+			@brief Keep the samples of the frames collected until they are taken. (ex: to trace the device's timeline)
+
+			@details The samples accumulate until TakeSamples is called.
+			*/
+			void KeepSamples(bool _keep)
+			{
+				keepSamples = _keep;
+
+				if (!_keep) samples.clear();
+			}
+
+			/**
+			@brief Appends the samples kept since the last call to the container specified, in the order they were recorded.
+
+			@return The amount of samples appended.
+			*/
+			ui32 TakeSamples(DynamicArray<Sample>& _samples)
+			{
+				ui32 count = ui32(samples.size());
+
+				_samples.insert(_samples.end(), samples.begin(), samples.end());
+
+				samples.clear();
+
+				return count;
+			}
+
+			/**
+			@brief Provides the time in milliseconds of a duration in timestamp ticks.
+			*/
+			f64 ToMilliseconds(u64 _ticks) const
+			{
+				return f64(_ticks) * timestampPeriod / 1000000.0;
+			}
+
+		protected:
+
+			static constexpr ui32 NoQuery  = ui32(-1);
+			static constexpr ui32 NoRecord = ui32(-1);
+
+			enum class EFrameState
+			{
+				Idle     ,
+				Recording,
+				Pending
+			};
+
+			/**
+			@brief A scope measured in a frame, between its two timestamp queries.
+			*/
+			struct Record
+			{
+				ScopeID Scope     ;
+				ui32    BeginQuery;
+				ui32    EndQuery  ;
+			};
+
+			struct Frame
+			{
+				QueryPool            Pool      ;
+				DynamicArray<Record> Records   ;
+				DynamicArray<u64>    Results   ;   ///< Timestamp and availability per query.
+				ui32                 QueryCount = 0                ;
+				EFrameState          State      = EFrameState::Idle;
+			};
+
+			struct OpenScope
+			{
+				ScopeID Scope ;
+				ui32    Record;
+			};
+
+			struct ScopeInfo
+			{
+				std::string           Name       ;
+				ScopeID               Parent     ;
+				ui32                  Depth      ;
+				DynamicArray<ScopeID> Children   ;
+				DynamicArray<f64>     History    ;
+				ui32                  HistoryNext;
+				ui32                  SampleCount;
+				f64                   FrameTime  ;   ///< Accumulated time of the frame being resolved.
+				bool                  Touched    ;
+			};
+
+			/**
+			@brief Find the scope of the name under the parent, adding it if it was never recorded.
+			*/
+			ScopeID AcquireScope(ScopeID _parent, RoCStr _name)
+			{
+				ScopeID scope = GetScope(_parent, _name);
+
+				if (scope != InvalidScope) return scope;
+
+				scope = ScopeID(scopes.size());
+
+				ScopeInfo info {};
+
+				info.Name   = _name  ;
+				info.Parent = _parent;
+				info.Depth  = _parent == InvalidScope ? 0 : scopes[_parent].Depth + 1;
+
+				info.History.resize(historyLength);
+
+				scopes.push_back(std::move(info));
+
+				(_parent == InvalidScope ? roots : scopes[_parent].Children).push_back(scope);
+
+				return scope;
+			}
+
+			/**
+			@brief Accumulate the timings of a frame's records per scope, and add them to the scopes' history.
+			*/
+			void Resolve(const Frame& _frame)
+			{
+				touched.clear();
+
+				for (const Record& record : _frame.Records)
+				{
+					if (record.EndQuery == NoQuery) continue;
+
+					u64 begin = _frame.Results[std::size_t(record.BeginQuery) * 2];
+					u64 end   = _frame.Results[std::size_t(record.EndQuery  ) * 2];
+
+					if (keepSamples) samples.push_back({ record.Scope, begin & timestampMask, end & timestampMask });
+
+					ScopeInfo& scope = scopes[record.Scope];
+
+					if (!scope.Touched)
+					{
+						touched.push_back(record.Scope);
+
+						scope.FrameTime = 0   ;
+						scope.Touched   = true;
+					}
+
+					scope.FrameTime += ToMilliseconds((end - begin) & timestampMask);
+				}
+
+				for (ScopeID id : touched)
+				{
+					ScopeInfo& scope = scopes[id];
+
+					scope.History[scope.HistoryNext] = scope.FrameTime;
+
+					scope.HistoryNext = (scope.HistoryNext + 1) % historyLength;
+
+					if (scope.SampleCount < historyLength) scope.SampleCount++;
+
+					scope.Touched = false;
+				}
+			}
+
+			const LogicalDevice* device;
+
+			DynamicArray<Frame> frames;
+
+			ui32 frameIndex;
+
+			DynamicArray<ScopeInfo> scopes;
+
+			DynamicArray<ScopeID> roots;
+
+			DynamicArray<OpenScope> stack;
+
+			DynamicArray<ScopeID> touched;
+
+			u64 timestampMask;
+
+			f64 timestampPeriod;
+
+			ui32 historyLength;
+
+			ui32 droppedCount;
+
+			ui32 overflowCount;
+
+			bool keepSamples;
+
+			DynamicArray<Sample> samples;
+		};
+
+		/**
+		@brief Batches occlusion or pipeline statistics queries per frame, reading their results back without waiting on the device.
+
+		@details
+		Each frame in flight owns a range of a single query pool, reset from the host when the frame begins
+		(requires the host query reset feature: PhysicalDevice::Features::HostQuery).
+
+		At the end of the frame the results are copied by the device into a host visible readback buffer.
+		Collect checks the availability written along with each result, so it never waits on the device.
+		The results of the most recent frame collected are kept until a newer frame is collected,
+		(ex: to cull the objects that were occluded in that frame).
+
+		A frame's range is reused after the amount of frames in flight specified, its results are dropped if they were not collected by then.
+		The previous submission of the frame must have completed by then (ex: its fence was waited on before recording the frame again),
+		as its queries are reset and its results cleared from the host.
+
+		Each query has one value for occlusion queries (the amount of samples passed), or one value per statistic enabled for
+		pipeline statistics queries, in the order of the statistic flag bits (lowest bit first).
+
+		The batch is not thread safe: queries must be recorded from a single thread.
+		*/
+		class QueryBatch
+		{
+		public:
+
+			static constexpr ui32 NoQuery = ui32(-1);
+
+			/**
+			@brief Default constructor.
+			*/
+			QueryBatch() :
+				mappedData(nullptr), coherent(false), queriesPerFrame(0), valueCount(0), frameIndex(0), frameNumber(0),
+				latestFrame(0), latestQueryCount(0), droppedCount(0), device(nullptr)
+			{}
+
+			QueryBatch(const QueryBatch&) = delete;
+
+			QueryBatch& operator= (const QueryBatch&) = delete;
+
+			/**
+			@brief Destroys the batch if it was created.
+			*/
+			~QueryBatch()
+			{
+				if (!frames.empty()) Destroy();
+			}
+
+			/**
+			@brief Begin a frame, resetting its range of queries from the host.
+
+			@details The previous submission of the frame must have completed: the device may not be using its queries or copying its results.
+
+			@return The number of the frame (Starting at 1, used to identify the frame of the latest results).
+			*/
+			u64 BeginFrame()
+			{
+				if (frames.empty()) return 0;
+
+				Collect();
+
+				frameIndex = (frameIndex + 1) % ui32(frames.size());
+
+				Frame& frame = frames[frameIndex];
+
+				if (frame.State == EFrameState::Pending) droppedCount++;
+
+				pool.Reset(frameIndex * queriesPerFrame, queriesPerFrame);
+
+				// Clears the availability of the frame's previous results, so they are not taken for this frame's before its copy executes.
+				memset(GetFrameResults(frameIndex), 0, std::size_t(queriesPerFrame) * GetQueryStride());
+
+				if (!coherent) memory.FlushMappedRange(Memory::ZeroOffset, WholeSize);
+
+				frame.Number     = ++frameNumber          ;
+				frame.QueryCount = 0                      ;
+				frame.State      = EFrameState::Recording;
+
+				return frame.Number;
+			}
+
+			/**
+			@brief Begin a query of the frame.
+
+			@return The index of the query in the frame, or NoQuery if the frame's queries are exhausted (or no frame is being recorded).
+			*/
+			ui32 BeginQuery(const CommandBuffer& _commandBuffer, CommandBuffer::QueryControlFlags _flags = CommandBuffer::QueryControlFlags())
+			{
+				if (frames.empty()) return NoQuery;
+
+				Frame& frame = frames[frameIndex];
+
+				if (frame.State != EFrameState::Recording || frame.QueryCount == queriesPerFrame) return NoQuery;
+
+				ui32 query = frame.QueryCount++;
+
+				_commandBuffer.BeginQuery(pool, frameIndex * queriesPerFrame + query, _flags);
+
+				return query;
+			}
+
+			/**
+			@brief Collect the results of the frames the device has finished. (Does not wait on the device)
+
+			@return The amount of frames collected.
+			*/
+			ui32 Collect()
+			{
+				ui32 collected = 0;
+
+				if (!coherent && !frames.empty()) memory.InvalidateMappedRange(Memory::ZeroOffset, WholeSize);
+
+				// Oldest frames first, so that the latest results are from the most recent frame.
+				for (ui32 offset = 1; offset <= ui32(frames.size()); offset++)
+				{
+					ui32   index = (frameIndex + offset) % ui32(frames.size());
+					Frame& frame = frames[index];
+
+					if (frame.State != EFrameState::Pending || !IsAvailable(index)) continue;
+
+					const u64* results = GetFrameResults(index);
+
+					latest.resize(std::size_t(frame.QueryCount) * valueCount);
+
+					for (ui32 query = 0; query < frame.QueryCount; query++)
+					{
+						memcpy(&latest[std::size_t(query) * valueCount], results + std::size_t(query) * (valueCount + 1), valueCount * sizeof(u64));
+					}
+
+					latestFrame      = frame.Number    ;
+					latestQueryCount = frame.QueryCount;
+
+					frame.State = EFrameState::Idle;
+
+					collected++;
+				}
+
+				return collected;
+			}
+
+			/**
+			@brief Create the query pool and the readback buffer.
+
+			@param _type            Occlusion or PipelineStatistics.
+			@param _statistics      Statistics counted by pipeline statistics queries. (Ignored for occlusion queries)
+			@param _frameCount      Amount of frames in flight.
+			@param _queriesPerFrame Amount of queries that can be recorded in a frame.
+			*/
+			EResult Create
+			(
+				const LogicalDevice&                    _device         ,
+				      EQueryType                        _type           ,
+				      QueryPool::PipelineStatisticFlags _statistics     ,
+				      ui32                              _frameCount     ,
+				      ui32                              _queriesPerFrame
+			)
+			{
+				if (!frames.empty() || _frameCount == 0 || _queriesPerFrame == 0) return EResult::Not_Ready;
+
+				if (_type != EQueryType::Occlusion && _type != EQueryType::PipelineStatistics) return EResult::Not_Ready;
+
+				if (_type == EQueryType::PipelineStatistics && !_statistics.HasAnyFlag()) return EResult::Not_Ready;
+
+				device          = &_device         ;
+				queriesPerFrame = _queriesPerFrame;
+				valueCount      = 1               ;
+
+				pool   = QueryPool(_device);
+				buffer = Buffer   (_device);
+				memory = Memory   (_device);
+
+				if (_type == EQueryType::PipelineStatistics)
+				{
+					valueCount = 0;
+
+					for (VkQueryPipelineStatisticFlags bits = _statistics; bits != 0; bits &= bits - 1) valueCount++;
+				}
+
+				QueryPool::CreateInfo poolInfo {};
+
+				poolInfo.QueryType          = _type                          ;
+				poolInfo.QueryCount         = _frameCount * _queriesPerFrame;
+				poolInfo.PipelineStatistics = _type == EQueryType::PipelineStatistics ? _statistics : QueryPool::PipelineStatisticFlags();
+
+				EResult returnCode = pool.Create(poolInfo);
+
+				if (returnCode == EResult::Success) returnCode = CreateReadback(DeviceSize(poolInfo.QueryCount) * GetQueryStride());
+
+				if (returnCode != EResult::Success)
+				{
+					Destroy();
+
+					return returnCode;
+				}
+
+				frames.resize(_frameCount);
+
+				frameIndex = _frameCount - 1;
+
+				return EResult::Success;
+			}
+
+			/**
+			@brief Destroy the query pool and the readback buffer.
+			*/
+			void Destroy()
+			{
+				if (device == nullptr) return;
+
+				if (mappedData != nullptr) memory.Unmap();
+
+				pool  .Destroy();
+				buffer.Destroy();
+				memory.Free   ();
+
+				frames.clear();
+				latest.clear();
+
+				mappedData       = nullptr;
+				latestFrame      = 0      ;
+				latestQueryCount = 0      ;
+				droppedCount     = 0      ;
+				device           = nullptr;
+			}
+
+			/**
+			@brief End the frame, copying its results to the readback buffer.
+
+			@details Must be recorded outside of a render pass, after the frame's queries ended.
+			*/
+			void EndFrame(const CommandBuffer& _commandBuffer)
+			{
+				if (frames.empty() || frames[frameIndex].State != EFrameState::Recording) return;
+
+				Frame& frame = frames[frameIndex];
+
+				if (frame.QueryCount == 0)
+				{
+					frame.State = EFrameState::Idle;
+
+					return;
+				}
+
+				DeviceSize offset = DeviceSize(frameIndex) * queriesPerFrame * GetQueryStride();
+
+				// The device waits for the queries to complete before copying, the host never does.
+				QueryPool::ResultFlags flags(EQueryResultFlag::_64Bit, EQueryResultFlag::Wait, EQueryResultFlag::WithAvailability);
+
+				_commandBuffer.CopyQueryPoolResults(pool, frameIndex * queriesPerFrame, frame.QueryCount, buffer, offset, GetQueryStride(), flags);
+
+				Buffer::Memory_Barrier barrier {};
+
+				barrier.SrcAccessMask       = AccessFlags(EAccessFlag::TransferWrite);
+				barrier.DstAccessMask       = AccessFlags(EAccessFlag::HostRead     );
+				barrier.SrcQueueFamilyIndex = QueueFamily_Ignored                    ;
+				barrier.DstQueueFamilyIndex = QueueFamily_Ignored                    ;
+				barrier.Buffer              = buffer                                 ;
+				barrier.Offset              = offset                                 ;
+				barrier.Size                = DeviceSize(frame.QueryCount) * GetQueryStride();
+
+				_commandBuffer.SubmitPipelineBarrier
+				(
+					Pipeline::StageFlags(EPipelineStageFlag::Transfer),
+					Pipeline::StageFlags(EPipelineStageFlag::Host    ),
+					DependencyFlags(),
+					1, &barrier
+				);
+
+				frame.State = EFrameState::Pending;
+			}
+
+			/**
+			@brief End a query of the frame. (Does nothing for NoQuery)
+			*/
+			void EndQuery(const CommandBuffer& _commandBuffer, ui32 _query)
+			{
+				if (_query == NoQuery) return;
+
+				_commandBuffer.EndQuery(pool, frameIndex * queriesPerFrame + _query);
+			}
+
+			/**
+			@brief Provides the amount of frames whose results were dropped, because they were not collected before their queries were reused.
+			*/
+			ui32 GetDroppedCount() const
+			{
+				return droppedCount;
+			}
+
+			/**
+			@brief Provides the number of the frame the latest results are from. (0 if no frame was collected)
+			*/
+			u64 GetLatestFrame() const
+			{
+				return latestFrame;
+			}
+
+			/**
+			@brief Provides the amount of queries recorded in the frame of the latest results.
+			*/
+			ui32 GetLatestQueryCount() const
+			{
+				return latestQueryCount;
+			}
+
+			/**
+			@brief Provides the values of a query in the latest results. (Null if the query is not part of them)
+			*/
+			const u64* GetLatestValues(ui32 _query) const
+			{
+				if (_query >= latestQueryCount) return nullptr;
+
+				return &latest[std::size_t(_query) * valueCount];
+			}
+
+			/**
+			@brief Provides the amount of values per query.
+			*/
+			ui32 GetValueCount() const
+			{
+				return valueCount;
+			}
+
+		protected:
+
+			enum class EFrameState
+			{
+				Idle     ,
+				Recording,
+				Pending
+			};
+
+			struct Frame
+			{
+				u64         Number     = 0                ;
+				ui32        QueryCount = 0                ;
+				EFrameState State      = EFrameState::Idle;
+			};
+
+			/**
+			@brief Create the readback buffer with a persistently mapped host visible memory. (Cached memory preferred, as it is read by the host)
+			*/
+			EResult CreateReadback(DeviceSize _size)
+			{
+				Buffer::CreateInfo info(EBufferUsage::TransferDestination, ESharingMode::Exclusive);
+
+				info.Size = _size;
+
+				EResult returnCode = buffer.Create(info);
+
+				if (returnCode != EResult::Success) return returnCode;
+
+				const PhysicalDevice&       physicalDevice = device->GetPhysicalDevice()  ;
+				const Memory::Requirements& requirements   = buffer.GetMemoryRequirements();
+
+				ui32 memoryTypeIndex = physicalDevice.FindMemoryType
+				(
+					requirements.MemoryTypeBits,
+					Memory::PropertyFlags(EMemoryPropertyFlag::HostVisible),
+					Memory::PropertyFlags(EMemoryPropertyFlag::HostCached )
+				);
+
+				if (memoryTypeIndex == PhysicalDevice::MemoryTypeTable::NotFound) return EResult::Error_FeatureNotPresent;
+
+				Memory::AllocateInfo allocateInfo;
+
+				allocateInfo.AllocationSize  = requirements.Size;
+				allocateInfo.MemoryTypeIndex = memoryTypeIndex  ;
+
+				returnCode = memory.Allocate(allocateInfo);
+
+				if (returnCode != EResult::Success) return returnCode;
+
+				returnCode = buffer.BindMemory(memory, Memory::ZeroOffset);
+
+				if (returnCode != EResult::Success) return returnCode;
+
+				returnCode = memory.Map(Memory::ZeroOffset, WholeSize, Memory::MapFlags(), mappedData);
+
+				if (returnCode != EResult::Success) return returnCode;
+
+				coherent = physicalDevice.GetMemoryProperties().Types[memoryTypeIndex].PropertyFlags.HasFlag(EMemoryPropertyFlag::HostCoherent);
+
+				return EResult::Success;
+			}
+
+			u64* GetFrameResults(ui32 _frame) const
+			{
+				return static_cast<u64*>(mappedData) + std::size_t(_frame) * queriesPerFrame * (valueCount + 1);
+			}
+
+			/**
+			@brief Size of a query's results in the readback buffer: its values followed by its availability.
+			*/
+			DeviceSize GetQueryStride() const
+			{
+				return DeviceSize(valueCount + 1) * sizeof(u64);
+			}
+
+			bool IsAvailable(ui32 _frame) const
+			{
+				const u64* results = GetFrameResults(_frame);
+
+				for (ui32 query = 0; query < frames[_frame].QueryCount; query++)
+				{
+					if (results[std::size_t(query) * (valueCount + 1) + valueCount] == 0) return false;
+				}
+
+				return true;
+			}
+
+			QueryPool pool;
+
+			Buffer buffer;
+
+			Memory memory;
+
+			VoidPtr mappedData;
+
+			bool coherent;
+
+			ui32 queriesPerFrame;
+
+			ui32 valueCount;
+
+			DynamicArray<Frame> frames;
+
+			ui32 frameIndex;
+
+			u64 frameNumber;
+
+			DynamicArray<u64> latest;
+
+			u64 latestFrame;
+
+			ui32 latestQueryCount;
+
+			ui32 droppedCount;
+
+			const LogicalDevice* device;
+		};
+
+		/** @} */
+	}
+}
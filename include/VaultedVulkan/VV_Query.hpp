@@ -0,0 +1,726 @@
+/*!
+@file VV_Query.hpp
+
+@brief Vaulted Vulkan: Queries
+
+@details
+Queries provide a mechanism to return information about the processing of a sequence of Vulkan commands.
+Query operations are asynchronous, and as such, their results are not returned immediately.
+Instead, their results, and their availability status are stored in a query pool.
+
+Calibrated timestamps (VK_EXT_calibrated_timestamps) are defined here as well, to relate timestamp query results to host time.
+
+<a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#queries">Specification</a>
+*/
+
+
+
+#pragma once
+
+
+
+// VV
+#include "VV_Vaults.hpp"
+#include "VV_APISpecGroups.hpp"
+#include "VV_Platform.hpp"
+#include "VV_CPP_STL.hpp"
+#include "VV_Enums.hpp"
+#include "VV_Backend.hpp"
+#include "VV_Types.hpp"
+#include "VV_Constants.hpp"
+#include "VV_Memory_Backend.hpp"
+#include "VV_PhysicalDevice.hpp"
+#include "VV_Initialization.hpp"
+#include "VV_LogicalDevice.hpp"
+#include "VV_Memory.hpp"
+#include "VV_Sampler.hpp"
+#include "VV_Resource.hpp"
+
+
+
+#ifndef VV_Option__Use_Long_Namespace
+namespace VV
+#else
+namespace VaultedVulkan
+#endif
+{
+	namespace V1
+	{
+		/**
+		@addtogroup Vault_1
+		@{
+		*/
+
+		/**
+		@brief Queries are managed using query pool objects. Each query pool is a collection of a specific number of queries of a particular type.
+
+		@details <a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#queries-pools">Specification</a>
+
+		@ingroup APISpec_Queries
+		*/
+		struct QueryPool
+		{
+			/** @brief <a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#VkQueryPool">Specification</a> @ingroup APISpec_Queries */
+			using Handle = VkQueryPool;
+
+			using CreateFlags = Bitfield<EUndefined, VkQueryPoolCreateFlags>;   ///< @brief Reserved for future use.
+
+			/** @brief <a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#VkQueryPipelineStatisticFlags">Specification</a> @ingroup APISpec_Queries */
+			using PipelineStatisticFlags = Bitfield<EQueryPipelineStatisticFlag, VkQueryPipelineStatisticFlags>;
+
+			/** @brief <a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#VkQueryResultFlags">Specification</a> @ingroup APISpec_Queries */
+			using ResultFlags = Bitfield<EQueryResultFlag, VkQueryResultFlags>;
+
+			/** @brief <a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#VkQueryPoolCreateInfo">Specification</a> @ingroup APISpec_Queries */
+			struct CreateInfo : V0::VKStruct_Base<VkQueryPoolCreateInfo, EStructureType::QueryPool_CreateInfo>
+			{
+				      EType                  SType              = STypeEnum;
+				const void*                  Next               = nullptr  ;
+				      CreateFlags            Flags             ;
+				      EQueryType             QueryType         ;
+				      ui32                   QueryCount        ;
+				      PipelineStatisticFlags PipelineStatistics;
+			};
+
+			/**
+			@brief Create a query pool.
+
+			@details <a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#vkCreateQueryPool">Specification</a>
+
+			@ingroup APISpec_Queries
+			*/
+			static EResult Create
+			(
+				      LogicalDevice::Handle        _device    ,
+				const CreateInfo&                  _createInfo,
+				const Memory::AllocationCallbacks* _allocator ,
+				      Handle&                      _queryPool
+			)
+			{
+				return EResult(vkCreateQueryPool(_device, _createInfo, *_allocator, &_queryPool));
+			}
+
+			/**
+			@brief Destroy a query pool.
+
+			@details <a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#vkDestroyQueryPool">Specification</a>
+
+			@ingroup APISpec_Queries
+			*/
+			static void Destroy
+			(
+				      LogicalDevice::Handle        _device   ,
+				      Handle                       _queryPool,
+				const Memory::AllocationCallbacks* _allocator
+			)
+			{
+				vkDestroyQueryPool(_device, _queryPool, *_allocator);
+			}
+
+			/**
+			@brief Copy the status and results of a range of queries to host memory.
+
+			@details
+			Without ResultFlags Wait, results that are not available are not written and Not_Ready is returned.
+
+			<a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#vkGetQueryPoolResults">Specification</a>
+
+			@ingroup APISpec_Queries
+			*/
+			static EResult GetResults
+			(
+				LogicalDevice::Handle _device    ,
+				Handle                _queryPool ,
+				ui32                  _firstQuery,
+				ui32                  _queryCount,
+				std::size_t           _dataSize  ,
+				void*                 _data      ,
+				DeviceSize            _stride    ,
+				ResultFlags           _flags
+			)
+			{
+				return EResult(vkGetQueryPoolResults(_device, _queryPool, _firstQuery, _queryCount, _dataSize, _data, _stride, _flags));
+			}
+
+			/**
+			@brief Reset a range of queries from the host. (Requires the host query reset feature)
+
+			@details <a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#vkResetQueryPool">Specification</a>
+
+			@ingroup APISpec_Queries
+			*/
+			static void Reset(LogicalDevice::Handle _device, Handle _queryPool, ui32 _firstQuery, ui32 _queryCount)
+			{
+				vkResetQueryPool(_device, _queryPool, _firstQuery, _queryCount);
+			}
+		};
+
+		/**
+		@brief Calibrated timestamps sample the timestamps of several time domains at once, to correlate the device's timestamps with the host's.
+
+		@details
+		Provided by VK_EXT_calibrated_timestamps. (DeviceExt::CalibratedTimestamps)
+
+		<a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#VK_EXT_calibrated_timestamps">Specification</a>
+
+		@ingroup APISpec_Queries
+		*/
+		struct CalibratedTimestamps
+		{
+			/**
+			@brief Pointer to the get calibrateable time domains function.
+
+			@details
+			The function is not provided automatically from the Vulkan API and must be
+			retrieved with AppInstance's GetProcedureAddress function.
+			*/
+			using FPtr_GetTimeDomains = PFN_vkGetPhysicalDeviceCalibrateableTimeDomainsEXT;
+
+			/**
+			@brief Pointer to the get calibrated timestamps function.
+
+			@details
+			The function is not provided automatically from the Vulkan API and must be
+			retrieved with LogicalDevice's GetProcedureAddress function.
+			*/
+			using FPtr_Get = PFN_vkGetCalibratedTimestampsEXT;
+
+			/** @brief <a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#VkCalibratedTimestampInfoEXT">Specification</a> @ingroup APISpec_Queries */
+			struct Info : V0::VKStruct_Base<VkCalibratedTimestampInfoEXT, EStructureType::Calibrated_Timestamp_Info_EXT>
+			{
+				      EType       SType      = STypeEnum;
+				const void*       Next       = nullptr  ;
+				      ETimeDomain TimeDomain;
+			};
+
+			/**
+			@brief Query the time domains the physical device supports for calibrated timestamps.
+
+			@details <a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#vkGetPhysicalDeviceCalibrateableTimeDomainsEXT">Specification</a>
+
+			@ingroup APISpec_Queries
+			*/
+			static EResult GetTimeDomains
+			(
+				AppInstance::Handle    _appInstance   ,
+				PhysicalDevice::Handle _physicalDevice,
+				ui32&                  _count         ,
+				ETimeDomain*           _timeDomains
+			)
+			{
+				static FPtr_GetTimeDomains delegate = nullptr;
+
+				if (delegate == nullptr) delegate = AppInstance::GetProcedureAddress<FPtr_GetTimeDomains>(_appInstance, "vkGetPhysicalDeviceCalibrateableTimeDomainsEXT");
+
+				if (delegate == nullptr) return EResult::Error_ExtensionNotPresent;
+
+				return EResult(delegate(_physicalDevice, &_count, (VkTimeDomainEXT*)(_timeDomains)));
+			}
+
+			/**
+			@brief Query a set of timestamps, one per time domain specified, sampled as closely together as possible.
+
+			@details
+			The maximum deviation is the amount of nanoseconds the timestamps may be apart from each other.
+
+			<a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#vkGetCalibratedTimestampsEXT">Specification</a>
+
+			@ingroup APISpec_Queries
+			*/
+			static EResult Get
+			(
+				      LogicalDevice::Handle _device        ,
+				      ui32                  _timestampCount,
+				const Info*                 _infos         ,
+				      u64*                  _timestamps    ,
+				      u64&                  _maxDeviation
+			)
+			{
+				FPtr_Get delegate = LogicalDevice::GetProcedureAddress<FPtr_Get>(_device, "vkGetCalibratedTimestampsEXT");
+
+				if (delegate == nullptr) return EResult::Error_ExtensionNotPresent;
+
+				return EResult(delegate(_device, _timestampCount, (const VkCalibratedTimestampInfoEXT*)(_infos), _timestamps, &_maxDeviation));
+			}
+		};
+
+		/** @} */
+	}
+
+	namespace V2
+	{
+		/**
+		@addtogroup Vault_2
+		@{
+		*/
+
+		/**
+		@brief Queries are managed using query pool objects. Each query pool is a collection of a specific number of queries of a particular type.
+		*/
+		struct QueryPool : public V1::QueryPool
+		{
+			using Parent = V1::QueryPool;
+
+			/**
+			@brief Create a query pool (Default Allocator).
+			*/
+			static EResult Create(LogicalDevice::Handle _device, const CreateInfo& _createInfo, Handle& _queryPool)
+			{
+				return Parent::Create(_device, _createInfo, Memory::DefaultAllocator, _queryPool);
+			}
+
+			using Parent::Create;
+
+			/**
+			@brief Destroy a query pool (Default Allocator).
+			*/
+			static void Destroy(LogicalDevice::Handle _device, Handle _queryPool)
+			{
+				Parent::Destroy(_device, _queryPool, Memory::DefaultAllocator);
+			}
+
+			using Parent::Destroy;
+
+			/**
+			@brief Copy the results of a range of queries as tightly packed 64-bit values.
+
+			@details With availability requested, each query is followed by its availability value. (The array must fit two values per query)
+			*/
+			static EResult GetResults
+			(
+				LogicalDevice::Handle _device    ,
+				Handle                _queryPool ,
+				ui32                  _firstQuery,
+				ui32                  _queryCount,
+				u64*                  _results   ,
+				ResultFlags           _flags
+			)
+			{
+				_flags.Add(EQueryResultFlag::_64Bit);
+
+				DeviceSize stride = _flags.HasFlag(EQueryResultFlag::WithAvailability) ? 2 * sizeof(u64) : sizeof(u64);
+
+				return Parent::GetResults(_device, _queryPool, _firstQuery, _queryCount, std::size_t(stride * _queryCount), _results, stride, _flags);
+			}
+
+			using Parent::GetResults;
+		};
+
+		/**
+		@brief Calibrated timestamps sample the timestamps of several time domains at once, to correlate the device's timestamps with the host's.
+		*/
+		struct CalibratedTimestamps : public V1::CalibratedTimestamps
+		{
+			using Parent = V1::CalibratedTimestamps;
+
+			/**
+			@brief Provides the time domains the physical device supports for calibrated timestamps.
+			*/
+			static EResult GetTimeDomains(AppInstance::Handle _appInstance, PhysicalDevice::Handle _physicalDevice, DynamicArray<ETimeDomain>& _timeDomains)
+			{
+				ui32 count;
+
+				EResult returnCode = Parent::GetTimeDomains(_appInstance, _physicalDevice, count, nullptr);
+
+				if (returnCode != EResult::Success) return returnCode;
+
+				_timeDomains.resize(count);
+
+				return Parent::GetTimeDomains(_appInstance, _physicalDevice, count, _timeDomains.data());
+			}
+
+			using Parent::GetTimeDomains;
+		};
+
+		/** @} */
+	}
+
+	namespace V3
+	{
+		/**
+		@addtogroup Vault_3
+		@{
+		*/
+
+		/**
+		@brief Queries are managed using query pool objects. Each query pool is a collection of a specific number of queries of a particular type.
+
+		@details
+		This object represents a device created object on the host. As such ownership is tied to this host object.
+		Due to this design, the object has no copy-construction allowed. Instead, default move constructor and assignment has been defined.
+		*/
+		class QueryPool : public V2::QueryPool
+		{
+		public:
+
+			using Parent = V2::QueryPool;
+
+			/**
+			@brief Default constructor.
+			*/
+			QueryPool() : handle(Null<Handle>), allocator(Memory::DefaultAllocator), device(nullptr), type(EQueryType::Timestamp), count(0)
+			{}
+
+			/**
+			@brief Logical device specified.
+			*/
+			QueryPool(const LogicalDevice& _device) : handle(Null<Handle>), allocator(Memory::DefaultAllocator), device(&_device), type(EQueryType::Timestamp), count(0)
+			{}
+
+			/**
+			@brief Logical device and allocator specified.
+			*/
+			QueryPool(const LogicalDevice& _device, const Memory::AllocationCallbacks& _allocator) :
+				handle(Null<Handle>), allocator(&_allocator), device(&_device), type(EQueryType::Timestamp), count(0)
+			{}
+
+			/**
+			@brief Performs a move operation to transfer ownership of the device object to this host object.
+			*/
+			QueryPool(QueryPool&& _other) noexcept :
+				handle(std::move(_other.handle)), allocator(std::move(_other.allocator)), device(std::move(_other.device)), type(_other.type), count(_other.count)
+			{
+				_other.handle    = Null<Handle>            ;
+				_other.allocator = Memory::DefaultAllocator;
+				_other.device    = nullptr                 ;
+				_other.count     = 0                       ;
+			}
+
+			/**
+			@brief Destroy the query pool if the handle is not null.
+			*/
+			~QueryPool()
+			{
+				if (handle != Null<Handle>) Destroy();
+			}
+
+			/**
+			@brief Create a query pool.
+			*/
+			EResult Create(const CreateInfo& _info)
+			{
+				if (device == nullptr) return EResult::Not_Ready;
+
+				type  = _info.QueryType ;
+				count = _info.QueryCount;
+
+				return Parent::Create(*device, _info, allocator, handle);
+			}
+
+			/**
+			@brief Create a query pool (logical device specified).
+			*/
+			EResult Create(const LogicalDevice& _device, const CreateInfo& _info)
+			{
+				device = &_device;
+
+				return Create(_info);
+			}
+
+			/**
+			@brief Create a query pool (logical device and allocator specified).
+			*/
+			EResult Create(const LogicalDevice& _device, const CreateInfo& _info, const Memory::AllocationCallbacks& _allocator)
+			{
+				device    = &_device   ;
+				allocator = &_allocator;
+
+				return Create(_info);
+			}
+
+			/**
+			@brief Destroy the query pool.
+			*/
+			void Destroy()
+			{
+				Parent::Destroy(*device, handle, allocator);
+
+				handle = Null<Handle>;
+				device = nullptr     ;
+				count  = 0           ;
+			}
+
+			/**
+			@brief Provides the amount of queries in the pool.
+			*/
+			ui32 GetQueryCount() const
+			{
+				return count;
+			}
+
+			/**
+			@brief Provides the type of queries in the pool.
+			*/
+			EQueryType GetQueryType() const
+			{
+				return type;
+			}
+
+			/**
+			@brief Copy the status and results of a range of queries to host memory.
+			*/
+			EResult GetResults(ui32 _firstQuery, ui32 _queryCount, std::size_t _dataSize, void* _data, DeviceSize _stride, ResultFlags _flags) const
+			{
+				return Parent::GetResults(*device, handle, _firstQuery, _queryCount, _dataSize, _data, _stride, _flags);
+			}
+
+			/**
+			@brief Copy the results of a range of queries as tightly packed 64-bit values.
+			*/
+			EResult GetResults(ui32 _firstQuery, ui32 _queryCount, u64* _results, ResultFlags _flags) const
+			{
+				return Parent::GetResults(*device, handle, _firstQuery, _queryCount, _results, _flags);
+			}
+
+			/**
+			@brief Reset a range of queries from the host. (Requires the host query reset feature)
+			*/
+			void Reset(ui32 _firstQuery, ui32 _queryCount) const
+			{
+				Parent::Reset(*device, handle, _firstQuery, _queryCount);
+			}
+
+			/**
+			@brief Implicit conversion to give a reference to its handle.
+			*/
+			operator Handle&()
+			{
+				return handle;
+			}
+
+			/**
+			@brief Implicit conversion to give a readonly reference to its handle.
+			*/
+			operator const Handle&() const
+			{
+				return handle;
+			}
+
+			/**
+			@brief Implicit conversion to give a pointer to its handle.
+			*/
+			operator const Handle*() const
+			{
+				return &handle;
+			}
+
+			/**
+			@brief Checks to see if its the same object by checking to see if its the same handle.
+			*/
+			bool operator== (const QueryPool& _other) const
+			{
+				return handle == _other.handle;
+			}
+
+			/**
+			@brief Performs a move assignment operation to transfer ownership of the device object to this host object.
+			*/
+			QueryPool& operator= (QueryPool&& _other) noexcept
+			{
+				if (this == &_other)
+					return *this;
+
+				handle    = std::move(_other.handle   );
+				allocator = std::move(_other.allocator);
+				device    = std::move(_other.device   );
+				type      = _other.type                ;
+				count     = _other.count               ;
+
+				_other.handle    = Null<Handle>            ;
+				_other.allocator = Memory::DefaultAllocator;
+				_other.device    = nullptr                 ;
+				_other.count     = 0                       ;
+
+				return *this;
+			}
+
+		protected:
+
+			Handle handle;
+
+			const Memory::AllocationCallbacks* allocator;
+
+			const LogicalDevice* device;
+
+			EQueryType type;
+
+			ui32 count;
+		};
+
+		/**
+		@brief Correlates a device's timestamps with the host's steady clock (std::chrono::steady_clock) using calibrated timestamps.
+
+		@details
+		The host time domain sampled is the one the steady clock is based on: QueryPerformanceCounter on Windows, ClockMonotonic otherwise.
+		The device and host clocks drift apart, so the calibration should be redone periodically. (ex: once a second)
+
+		Requires the device to be created with DeviceExt::CalibratedTimestamps enabled.
+		*/
+		class TimestampCalibration : public V2::CalibratedTimestamps
+		{
+		public:
+
+			using Parent = V2::CalibratedTimestamps;
+
+			using Clock = std::chrono::steady_clock;
+
+		#ifdef _WIN32
+			static constexpr ETimeDomain HostDomain = ETimeDomain::QueryPerformanceCounter;
+		#else
+			static constexpr ETimeDomain HostDomain = ETimeDomain::ClockMonotonic;
+		#endif
+
+			/**
+			@brief Default constructor.
+			*/
+			TimestampCalibration() : 
+				device(nullptr), timestampMask(0), timestampPeriod(0.0), deviceTimestamp(0), hostTimestamp(0), maxDeviation(0), calibrated(false)
+			{}
+
+			/**
+			@brief Calibrate the timestamps of the queue's family on the device.
+
+			@return Error_FeatureNotPresent if the queue family has no timestamps, or the device or host time domain cannot be calibrated.
+			*/
+			EResult Create(const AppInstance& _appInstance, const LogicalDevice& _device, const LogicalDevice::Queue& _queue)
+			{
+				const PhysicalDevice& physicalDevice = _device.GetPhysicalDevice();
+
+				ui32 validBits = physicalDevice.GetAvailableQueueFamilies()[_queue.GetFamilyIndex()].TimestampValidBits;
+
+				if (validBits == 0) return EResult::Error_FeatureNotPresent;
+
+				DynamicArray<ETimeDomain> timeDomains;
+
+				EResult result = Parent::GetTimeDomains(_appInstance, physicalDevice, timeDomains);
+
+				if (result != EResult::Success) return result;
+
+				bool hasDevice = std::find(timeDomains.begin(), timeDomains.end(), ETimeDomain::Device) != timeDomains.end();
+				bool hasHost   = std::find(timeDomains.begin(), timeDomains.end(), HostDomain         ) != timeDomains.end();
+
+				if (!hasDevice || !hasHost) return EResult::Error_FeatureNotPresent;
+
+				device          = &_device;
+				timestampMask   = validBits >= 64 ? ~u64(0) : (u64(1) << validBits) - 1;
+				timestampPeriod = f64(physicalDevice.GetProperties().LimitsSpec.TimestampPeriod);
+
+				return Calibrate();
+			}
+
+			/**
+			@brief Sample the device and host timestamps again.
+			*/
+			EResult Calibrate()
+			{
+				if (device == nullptr) return EResult::Not_Ready;
+
+				Info infos[2];
+
+				infos[0].TimeDomain = ETimeDomain::Device;
+				infos[1].TimeDomain = HostDomain         ;
+
+				u64 timestamps[2], deviation;
+
+				EResult result = Parent::Get(*device, 2, infos, timestamps, deviation);
+
+				if (result != EResult::Success) return result;
+
+				deviceTimestamp = timestamps[0] & timestampMask;
+				hostTimestamp   = ToNanoseconds(timestamps[1]) ;
+				maxDeviation    = deviation                    ;
+				calibrated      = true                         ;
+
+				return EResult::Success;
+			}
+
+			/**
+			@brief Stop calibrating.
+			*/
+			void Destroy()
+			{
+				device     = nullptr;
+				calibrated = false  ;
+			}
+
+			/**
+			@brief Provides the maximum deviation of the last calibration in nanoseconds.
+			*/
+			u64 GetMaxDeviation() const
+			{
+				return maxDeviation;
+			}
+
+			/**
+			@brief Checks to see if a calibration has been made.
+			*/
+			bool IsCalibrated() const
+			{
+				return calibrated;
+			}
+
+			/**
+			@brief Converts a device timestamp to the steady clock's time. (Nanoseconds since its epoch)
+
+			@details The timestamp is expected to be within half of the timestamp's range of the last calibration.
+			*/
+			s64 ToHostNanoseconds(u64 _deviceTimestamp) const
+			{
+				u64 after  = (_deviceTimestamp - deviceTimestamp) & timestampMask;
+				u64 before = (deviceTimestamp - _deviceTimestamp) & timestampMask;
+
+				f64 ticks = after <= (timestampMask >> 1) ? f64(after) : -f64(before);
+
+				return s64(hostTimestamp) + s64(ticks * timestampPeriod);
+			}
+
+			/**
+			@brief Converts a device timestamp to the steady clock's time.
+			*/
+			Clock::time_point ToHostTime(u64 _deviceTimestamp) const
+			{
+				return Clock::time_point(std::chrono::duration_cast<Clock::duration>(std::chrono::nanoseconds(ToHostNanoseconds(_deviceTimestamp))));
+			}
+
+		protected:
+
+			/**
+			@brief Converts a timestamp of the host domain to nanoseconds.
+			*/
+			static u64 ToNanoseconds(u64 _hostTimestamp)
+			{
+			#ifdef _WIN32
+
+				LARGE_INTEGER frequency;
+
+				QueryPerformanceFrequency(&frequency);
+
+				u64 ticksPerSecond = u64(frequency.QuadPart);
+
+				return (_hostTimestamp / ticksPerSecond) * 1000000000 + (_hostTimestamp % ticksPerSecond) * 1000000000 / ticksPerSecond;
+
+			#else
+
+				return _hostTimestamp;
+
+			#endif
+			}
+
+			const LogicalDevice* device;
+
+			u64 timestampMask;
+
+			f64 timestampPeriod;
+
+			u64 deviceTimestamp;
+
+			u64 hostTimestamp;   ///< Nanoseconds.
+
+			u64 maxDeviation;
+
+			bool calibrated;
+		};
+
+		/** @} */
+	}
+}
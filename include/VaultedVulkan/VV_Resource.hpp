@@ -88,7 +88,8 @@ namespace VaultedVulkan
 				      DeviceSize   Size                 ;
 				      UsageFlags   Usage                ;
 				      ESharingMode SharingMode          ;
-				      ui32         QueueFamilyIndexCount;
+				      ui32         QueueFamilyIndexCount = 0      ;
+				const ui32*        QueueFamilyIndices    = nullptr;
 			};
 
 			/** @brief <a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#VkBufferCopy">Specification</a> @ingroup APISpec_Copy_Commands */
@@ -348,6 +349,30 @@ namespace VaultedVulkan
 				ui32        LayerCount    ;
 			};
 
+			/** 
+			@brief <a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#VkImageSubresource">Specification</a>  
+			@ingroup APISpec_Resource_Creation
+			*/
+			struct Subresource : V0::VKStruct_Base<VkImageSubresource>
+			{
+				AspectFlags AspectMask;
+				ui32        MipLevel  ;
+				ui32        ArrayLayer;
+			};
+
+			/** 
+			@brief <a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#VkSubresourceLayout">Specification</a>  
+			@ingroup APISpec_Resource_Creation
+			*/
+			struct SubresourceLayout : V0::VKStruct_Base<VkSubresourceLayout>
+			{
+				DeviceSize Offset    ;
+				DeviceSize Size      ;
+				DeviceSize RowPitch  ;
+				DeviceSize ArrayPitch;
+				DeviceSize DepthPitch;
+			};
+
 			/** 
 			@brief <a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#VkImageMemoryBarrier">Specification</a>  
 			@ingroup APISpec_Synchronization_and_Cache_Control
@@ -446,6 +471,22 @@ namespace VaultedVulkan
 			{
 				vkGetImageMemoryRequirements(_device, _image, _memoryRequirements);
 			}
+
+			/**
+			 * @brief Provides the layout of a subresource of an image with linear tiling.
+			 * 
+			 * @details <a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#vkGetImageSubresourceLayout">Specification</a> 
+			 * @ingroup APISpec_Resource_Creation
+			 * 
+			 * \param _device
+			 * \param _image
+			 * \param _subresource
+			 * \param _layout
+			 */
+			static void GetSubresourceLayout(LogicalDevice::Handle _device, Handle _image, const Subresource& _subresource, SubresourceLayout& _layout)
+			{
+				vkGetImageSubresourceLayout(_device, _image, _subresource, _layout);
+			}
 		};
 
 		/**
@@ -798,6 +839,7 @@ namespace VaultedVulkan
 					Usage                 = _usage      ;
 					SharingMode           = _sharingMode;
 					QueueFamilyIndexCount = 0           ;
+					QueueFamilyIndices    = nullptr     ;
 				}
 			};
 
@@ -835,6 +877,8 @@ namespace VaultedVulkan
 			/**
 			 * @brief Will create a buffer and immediately bind it to allocated memory made just for it.
 			 * 
+			 * @details Queries the memory properties on every call, the overload taking a table can reuse the one a V3 PhysicalDevice keeps. (GetMemoryTypeTable)
+			 * 
 			 * \param _bufferInfo
 			 * \param _propertyFlags
 			 * \param _buffer
@@ -854,6 +898,22 @@ namespace VaultedVulkan
 				Memory::PropertyFlags  _propertyFlags , 
 				Memory::Handle&        _bufferMemory      
 			)
+			{
+				return CreateAndBind(PhysicalDevice::MemoryTypeTable(_physicalDevice), _device, _bufferInfo, _buffer, _propertyFlags, _bufferMemory);
+			}
+
+			/**
+			@brief Will create a buffer and immediately bind it to memory made just for it, with the memory type looked up in the table specified.
+			*/
+			static EResult CreateAndBind
+			(
+				const PhysicalDevice::MemoryTypeTable& _memoryTypes  ,
+				LogicalDevice::Handle                  _device       ,
+				CreateInfo                             _bufferInfo   ,
+				Handle&                                _buffer       ,
+				Memory::PropertyFlags                  _propertyFlags,
+				Memory::Handle&                        _bufferMemory
+			)
 			{
 				EResult returnCode = Buffer::Create(_device, _bufferInfo, Memory::DefaultAllocator, _buffer);
 
@@ -867,7 +927,7 @@ namespace VaultedVulkan
 				Memory::AllocateInfo allocationInfo{};
 
 				allocationInfo.AllocationSize  = memReq.Size;
-				allocationInfo.MemoryTypeIndex = PhysicalDevice::FindMemoryType(_physicalDevice, memReq.MemoryTypeBits, _propertyFlags);
+				allocationInfo.MemoryTypeIndex = _memoryTypes.Find(memReq.MemoryTypeBits, _propertyFlags);
 
 				returnCode = Memory::Allocate(_device, allocationInfo, Memory::DefaultAllocator, _bufferMemory);
 
@@ -882,6 +942,8 @@ namespace VaultedVulkan
 			/**
 			 * @brief Will create a buffer and immediately bind it to allocated memory made just for it.
 			 * 
+			 * @details Queries the memory properties on every call, the overload taking a table can reuse the one a V3 PhysicalDevice keeps. (GetMemoryTypeTable)
+			 * 
 			 * \param _bufferInfo
 			 * \param _propertyFlags
 			 * \param _buffer
@@ -902,6 +964,23 @@ namespace VaultedVulkan
 				Memory::Handle&              _bufferMemory  ,
 				Memory::AllocationCallbacks* _allcator
 			)
+			{
+				return CreateAndBind(PhysicalDevice::MemoryTypeTable(_physicalDevice), _device, _bufferInfo, _buffer, _propertyFlags, _bufferMemory, _allcator);
+			}
+
+			/**
+			@brief Will create a buffer and immediately bind it to memory made just for it, with the memory type looked up in the table specified.
+			*/
+			static EResult CreateAndBind
+			(
+				const PhysicalDevice::MemoryTypeTable& _memoryTypes  ,
+				LogicalDevice::Handle                  _device       ,
+				CreateInfo                             _bufferInfo   ,
+				Handle&                                _buffer       ,
+				Memory::PropertyFlags                  _propertyFlags,
+				Memory::Handle&                        _bufferMemory ,
+				Memory::AllocationCallbacks*           _allcator
+			)
 			{
 				EResult returnCode = Buffer::Create(_device, _bufferInfo, _allcator, _buffer);
 
@@ -914,7 +993,7 @@ namespace VaultedVulkan
 				Memory::AllocateInfo allocationInfo{};
 
 				allocationInfo.AllocationSize  = memReq.Size;
-				allocationInfo.MemoryTypeIndex = PhysicalDevice::FindMemoryType(_physicalDevice, memReq.MemoryTypeBits, _propertyFlags);
+				allocationInfo.MemoryTypeIndex = _memoryTypes.Find(memReq.MemoryTypeBits, _propertyFlags);
 
 				returnCode = Memory::Allocate(_device, allocationInfo, _allcator, _bufferMemory);
 
@@ -1008,6 +1087,8 @@ namespace VaultedVulkan
 			/**
 			 * @brief Will create an image and immediately bind it to memory made just for it.
 			 * 
+			 * @details Queries the memory properties on every call, the overload taking a table can reuse the one a V3 PhysicalDevice keeps. (GetMemoryTypeTable)
+			 * 
 			 * \param _physicalDevice
 			 * \param _device
 			 * \param _info
@@ -1025,6 +1106,22 @@ namespace VaultedVulkan
 				Memory::PropertyFlags  _propertyFlags , 
 				Memory::Handle&        _imageMemory      
 			)
+			{
+				return CreateAndBind(PhysicalDevice::MemoryTypeTable(_physicalDevice), _device, _info, _image, _propertyFlags, _imageMemory);
+			}
+
+			/**
+			@brief Will create an image and immediately bind it to memory made just for it, with the memory type looked up in the table specified.
+			*/
+			static EResult CreateAndBind
+			(
+				const PhysicalDevice::MemoryTypeTable& _memoryTypes  ,
+				LogicalDevice::Handle                  _device       ,
+				CreateInfo                             _info         ,
+				Handle&                                _image        ,
+				Memory::PropertyFlags                  _propertyFlags,
+				Memory::Handle&                        _imageMemory
+			)
 			{
 				EResult returnCode = Image::Create(_device, _info, _image);
 
@@ -1038,7 +1135,7 @@ namespace VaultedVulkan
 				Memory::AllocateInfo allocationInfo{};
 
 				allocationInfo.AllocationSize  = memReq.Size;
-				allocationInfo.MemoryTypeIndex = PhysicalDevice::FindMemoryType(_physicalDevice, memReq.MemoryTypeBits, _propertyFlags);
+				allocationInfo.MemoryTypeIndex = _memoryTypes.Find(memReq.MemoryTypeBits, _propertyFlags);
 
 				returnCode = Memory::Allocate(_device, allocationInfo, _imageMemory);
 
@@ -1053,6 +1150,8 @@ namespace VaultedVulkan
 			/**
 			 * @brief Will create an image and immediately bind it to memory made just for it..
 			 * 
+			 * @details Queries the memory properties on every call, the overload taking a table can reuse the one a V3 PhysicalDevice keeps. (GetMemoryTypeTable)
+			 * 
 			 * \param _physicalDevice
 			 * \param _device
 			 * \param _info
@@ -1071,6 +1170,23 @@ namespace VaultedVulkan
 				Memory::Handle&              _imageMemory   ,
 				Memory::AllocationCallbacks* _allcator
 			)
+			{
+				return CreateAndBind(PhysicalDevice::MemoryTypeTable(_physicalDevice), _device, _info, _image, _propertyFlags, _imageMemory, _allcator);
+			}
+
+			/**
+			@brief Will create an image and immediately bind it to memory made just for it, with the memory type looked up in the table specified.
+			*/
+			static EResult CreateAndBind
+			(
+				const PhysicalDevice::MemoryTypeTable& _memoryTypes  ,
+				LogicalDevice::Handle                  _device       ,
+				CreateInfo                             _info         ,
+				Handle&                                _image        ,
+				Memory::PropertyFlags                  _propertyFlags,
+				Memory::Handle&                        _imageMemory  ,
+				Memory::AllocationCallbacks*           _allcator
+			)
 			{
 				EResult returnCode = Image::Create(_device, _info, _allcator, _image);
 
@@ -1084,7 +1200,7 @@ namespace VaultedVulkan
 				Memory::AllocateInfo allocationInfo{};
 
 				allocationInfo.AllocationSize  = memReq.Size;
-				allocationInfo.MemoryTypeIndex = PhysicalDevice::FindMemoryType(_physicalDevice, memReq.MemoryTypeBits, _propertyFlags);
+				allocationInfo.MemoryTypeIndex = _memoryTypes.Find(memReq.MemoryTypeBits, _propertyFlags);
 
 				returnCode = Memory::Allocate(_device, allocationInfo, _allcator, _imageMemory);
 
@@ -1728,6 +1844,18 @@ namespace VaultedVulkan
 				return memoryRequirements;
 			}
 
+			/**
+			@brief Provides the layout of a subresource. (Images with linear tiling)
+			*/
+			SubresourceLayout GetSubresourceLayout(const Subresource& _subresource) const
+			{
+				SubresourceLayout layout;
+
+				Parent::GetSubresourceLayout(*device, handle, _subresource, layout);
+
+				return layout;
+			}
+
 			/**
 			@brief Implicit conversion to give a reference to its handle.
 			*/
@@ -2271,6 +2399,332 @@ namespace VaultedVulkan
 			const LogicalDevice* device;
 		};
 
+		/**
+		@brief Allocates descriptor sets from a chain of descriptor pools, creating another pool whenever the current ones run out.
+
+		@details
+		Every pool of the chain is created from the same pool create info (See Create). When an allocation fails because the current pool
+		is out of memory or fragmented, the allocation is retried on the next pool of the chain, which is created if needed.
+		Pools are never sized for the worst case, the chain grows to the working size instead.
+
+		Transient sets: Reset returns every set of every pool in a single reset per pool. Use one allocator per frame in flight,
+		and reset it once the frame's previous submission has completed.
+
+		Persistent sets: Release puts a set back into a free list of its layout, from which the next allocation of that layout is served.
+		No set is freed to its pool, so the pools do not need to be created with EDescriptorPoolCreateFlag::FreeDescriptorSet.
+		A recycled set keeps its previous descriptors, it must be updated before use like a freshly allocated one.
+
+		Like the descriptor pools it owns, the allocator is externally synchronized.
+		*/
+		class DescriptorAllocator
+		{
+		public:
+
+			using LayoutHandle = DescriptorPool::AllocateInfo::PipelineLayoutDescriptorSetHandle;
+
+			/**
+			@brief Default constructor.
+			*/
+			DescriptorAllocator() : currentPool(0), device(nullptr)
+			{
+				poolInfo.MaxSets = 0;
+			}
+
+			/**
+			@brief Constructor with logical device specified.
+			*/
+			DescriptorAllocator(const LogicalDevice& _device) : currentPool(0), device(&_device)
+			{
+				poolInfo.MaxSets = 0;
+			}
+
+			/**
+			@brief Performs a move operation to transfer ownership of the pools to this object.
+			*/
+			DescriptorAllocator(DescriptorAllocator&& _other) noexcept :
+				poolInfo   (_other.poolInfo               ),
+				poolSizes  (std::move(_other.poolSizes   )),
+				pools      (std::move(_other.pools       )),
+				freeLists  (std::move(_other.freeLists   )),
+				currentPool(_other.currentPool            ),
+				device     (_other.device                 )
+			{
+				poolInfo.PoolSizes = poolSizes.data();
+
+				_other.currentPool = 0      ;
+				_other.device      = nullptr;
+			}
+
+			/**
+			@brief Allocate a descriptor set of the layout specified, from the layout's free list if it has a released set.
+			*/
+			EResult Allocate(LayoutHandle _layout, DescriptorSet::Handle& _set)
+			{
+				if (device == nullptr || poolInfo.MaxSets == 0) return EResult::Not_Ready;
+
+				FreeList* freeList = FindFreeList(_layout);
+
+				if (freeList != nullptr && !freeList->Sets.empty())
+				{
+					_set = freeList->Sets.back();
+
+					freeList->Sets.pop_back();
+
+					return EResult::Success;
+				}
+
+				DescriptorPool::AllocateInfo info;
+
+				info.DescriptorSetCount = 1       ;
+				info.SetLayouts         = &_layout;
+
+				EResult returnCode = EResult::Error_OutOfPoolMemory;
+
+				while (true)
+				{
+					if (currentPool == pools.size())
+					{
+						returnCode = AddPool();
+
+						if (returnCode != EResult::Success) return returnCode;
+					}
+
+					info.DescriptorPool = pools[currentPool];
+
+					returnCode = pools[currentPool].Allocate(info, &_set);
+
+					if (!IsPoolExhausted(returnCode)) return returnCode;
+
+					// A fresh pool that cannot fit a single set will never succeed.
+					if (pools[currentPool].IsEmpty()) return returnCode;
+
+					currentPool++;
+				}
+			}
+
+			/**
+			@brief Allocate a descriptor set of the layout specified, from the layout's free list if it has a released set.
+			*/
+			EResult Allocate(LayoutHandle _layout, DescriptorSet& _set)
+			{
+				DescriptorSet::Handle setHandle;
+
+				EResult returnCode = Allocate(_layout, setHandle);
+
+				if (returnCode != EResult::Success) return returnCode;
+
+				_set.Assign(*device, setHandle);
+
+				return EResult::Success;
+			}
+
+			/**
+			@brief Specify the create info used for every pool in the chain. No pool is created until an allocation requires one.
+
+			@details The pool sizes referenced by the create info are copied.
+			*/
+			EResult Create(const DescriptorPool::CreateInfo& _poolInfo)
+			{
+				if (device == nullptr) return EResult::Not_Ready;
+
+				poolInfo = _poolInfo;
+
+				poolSizes.assign(_poolInfo.PoolSizes, _poolInfo.PoolSizes + _poolInfo.PoolSizeCount);
+
+				poolInfo.PoolSizes = poolSizes.data();
+
+				return EResult::Success;
+			}
+
+			/**
+			@brief Specify the create info used for every pool in the chain (logical device specified).
+			*/
+			EResult Create(const LogicalDevice& _device, const DescriptorPool::CreateInfo& _poolInfo)
+			{
+				device = &_device;
+
+				return Create(_poolInfo);
+			}
+
+			/**
+			@brief Destroys every pool of the chain, which frees all of the sets allocated. (The sets must no longer be in use by the device)
+			*/
+			void Destroy()
+			{
+				for (DescriptorPool& pool : pools) pool.Destroy();
+
+				pools    .clear();
+				freeLists.clear();
+
+				currentPool = 0;
+			}
+
+			/**
+			@brief Provides the amount of pools in the chain.
+			*/
+			ui32 GetPoolCount() const
+			{
+				return ui32(pools.size());
+			}
+
+			/**
+			@brief Puts a persistent set back into the free list of its layout. (The set must no longer be in use by the device)
+			*/
+			void Release(LayoutHandle _layout, DescriptorSet::Handle _set)
+			{
+				FreeList* freeList = FindFreeList(_layout);
+
+				if (freeList == nullptr)
+				{
+					freeLists.push_back(FreeList{ _layout, {} });
+
+					freeList = &freeLists.back();
+				}
+
+				freeList->Sets.push_back(_set);
+			}
+
+			/**
+			@brief Returns every set allocated to the pools, with a single reset per pool used. (The sets must no longer be in use by the device)
+
+			@details The free lists are cleared as their sets are returned to the pools as well.
+			*/
+			EResult Reset()
+			{
+				DescriptorPool::ResetFlags flags;
+
+				for (ui32 index = 0; index < pools.size() && index <= currentPool; index++)
+				{
+					EResult returnCode = pools[index].Reset(flags);
+
+					if (returnCode != EResult::Success) return returnCode;
+
+					pools[index].SetEmpty(true);
+				}
+
+				for (FreeList& freeList : freeLists) freeList.Sets.clear();
+
+				currentPool = 0;
+
+				return EResult::Success;
+			}
+
+			/**
+			@brief Performs a move assignment operation to transfer ownership of the pools to this object.
+			*/
+			DescriptorAllocator& operator= (DescriptorAllocator&& _other) noexcept
+			{
+				if (this == &_other)
+					return *this;
+
+				poolInfo    = _other.poolInfo               ;
+				poolSizes   = std::move(_other.poolSizes   );
+				pools       = std::move(_other.pools       );
+				freeLists   = std::move(_other.freeLists   );
+				currentPool = _other.currentPool            ;
+				device      = _other.device                 ;
+
+				poolInfo.PoolSizes = poolSizes.data();
+
+				_other.currentPool = 0      ;
+				_other.device      = nullptr;
+
+				return *this;
+			}
+
+		protected:
+
+			/**
+			@brief Released sets of a layout.
+			*/
+			struct FreeList
+			{
+				LayoutHandle Layout;
+
+				DynamicArray<DescriptorSet::Handle> Sets;
+			};
+
+			/**
+			@brief A pool of the chain, tracking whether anything was allocated from it since its creation or last reset.
+			*/
+			class ChainedPool : public DescriptorPool
+			{
+			public:
+
+				ChainedPool(const LogicalDevice& _device) : DescriptorPool(_device), empty(true)
+				{}
+
+				EResult Allocate(AllocateInfo& _info, DescriptorSet::Handle* _sets)
+				{
+					EResult returnCode = DescriptorPool::Allocate(_info, _sets);
+
+					if (returnCode == EResult::Success) empty = false;
+
+					return returnCode;
+				}
+
+				bool IsEmpty() const
+				{
+					return empty;
+				}
+
+				void SetEmpty(bool _empty)
+				{
+					empty = _empty;
+				}
+
+			protected:
+
+				bool empty;
+			};
+
+			/**
+			@brief Creates another pool at the end of the chain.
+			*/
+			EResult AddPool()
+			{
+				ChainedPool pool(*device);
+
+				EResult returnCode = pool.Create(poolInfo);
+
+				if (returnCode != EResult::Success) return returnCode;
+
+				pools.push_back(std::move(pool));
+
+				return EResult::Success;
+			}
+
+			FreeList* FindFreeList(LayoutHandle _layout)
+			{
+				for (FreeList& freeList : freeLists)
+				{
+					if (freeList.Layout == _layout) return &freeList;
+				}
+
+				return nullptr;
+			}
+
+			/**
+			@brief Whether an allocation failed because the pool ran out of space (as opposed to the device running out of memory).
+			*/
+			static bool IsPoolExhausted(EResult _result)
+			{
+				return _result == EResult::Error_OutOfPoolMemory || _result == EResult::Error_FragmentedPool;
+			}
+
+			DescriptorPool::CreateInfo poolInfo;
+
+			DynamicArray<DescriptorPool::Size> poolSizes;
+
+			DynamicArray<ChainedPool> pools;
+
+			DynamicArray<FreeList> freeLists;
+
+			ui32 currentPool;
+
+			const LogicalDevice* device;
+		};
+
 		/** @} */
 	}
 }
@@ -0,0 +1,446 @@
+/*!
+@file VV_ShaderLibrary.hpp
+
+@brief Vaulted Vulkan: Shader Library
+
+@details Contains a library of shader modules created straight from memory mapped SPIR-V files.
+
+The SPIR-V is never copied: the module create info points into the mapping, which stays mapped for the lifetime of the library.
+Modules are addressed by the hash of their code, so identical code loaded under several names (or from several files) is created once.
+
+<a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#shader-modules">Specification</a>
+*/
+
+
+
+#pragma once
+
+
+
+// VV
+#include "VV_Vaults.hpp"
+#include "VV_APISpecGroups.hpp"
+#include "VV_Platform.hpp"
+#include "VV_CPP_STL.hpp"
+#include "VV_FileIO.hpp"
+#include "VV_Enums.hpp"
+#include "VV_Backend.hpp"
+#include "VV_Types.hpp"
+#include "VV_Constants.hpp"
+#include "VV_Memory_Backend.hpp"
+#include "VV_PhysicalDevice.hpp"
+#include "VV_Initialization.hpp"
+#include "VV_LogicalDevice.hpp"
+#include "VV_Memory.hpp"
+#include "VV_Sampler.hpp"
+#include "VV_Resource.hpp"
+#include "VV_SyncAndCacheControl.hpp"
+#include "VV_Shaders.hpp"
+#include "VV_Pipelines.hpp"
+#include "VV_RenderPass.hpp"
+#include "VV_StructHash.hpp"
+
+
+
+#ifndef VV_Option__Use_Long_Namespace
+namespace VV
+#else
+namespace VaultedVulkan
+#endif
+{
+	namespace V3
+	{
+		/**
+		@addtogroup Vault_3
+		@{
+		*/
+
+		/**
+		@brief A set of named shader modules, loaded from SPIR-V files or packs of them.
+
+		@details
+		A file is either a single SPIR-V module (named by its path), or a pack of named modules (See PackHeader).
+		Several names may refer to the same module if their code is identical.
+
+		Loading and adding modules is not thread safe, finding them is (as long as nothing is being loaded at the same time).
+
+		The library cannot be moved or copied, as the modules it provides are referenced by address.
+		*/
+		class ShaderLibrary
+		{
+		public:
+
+			static constexpr ui32 SPIRV_Magic = 0x07230203;
+
+			/**
+			@brief Header of a shader pack file, followed by its entries. (All offsets are from the start of the file)
+
+			@details The code of every module must be aligned to the SPIR-V word size within the file, so that it can be used in place.
+			*/
+			struct PackHeader
+			{
+				static constexpr ui32 Magic         = 0x4C535656;   // "VVSL"
+				static constexpr ui32 FormatVersion = 1         ;
+
+				ui32 MagicID    ;
+				ui32 Version    ;
+				ui32 ModuleCount;
+				ui32 Reserved   ;
+			};
+
+			/**
+			@brief Location of a module within a shader pack. (Names are not null terminated)
+			*/
+			struct PackEntry
+			{
+				ui32 NameOffset;
+				ui32 NameSize  ;
+				ui32 CodeOffset;
+				ui32 CodeSize  ;
+			};
+
+			/**
+			@brief Default constructor.
+			*/
+			ShaderLibrary() : reuseCount(0), allocator(Memory::DefaultAllocator), device(nullptr)
+			{}
+
+			/**
+			@brief Specifies the logical device.
+			*/
+			ShaderLibrary(const LogicalDevice& _device) : reuseCount(0), allocator(Memory::DefaultAllocator), device(&_device)
+			{}
+
+			/**
+			@brief Specifies the logical device and allocator.
+			*/
+			ShaderLibrary(const LogicalDevice& _device, const Memory::AllocationCallbacks& _allocator) : reuseCount(0), allocator(&_allocator), device(&_device)
+			{}
+
+			ShaderLibrary(const ShaderLibrary&) = delete;
+
+			ShaderLibrary& operator= (const ShaderLibrary&) = delete;
+
+			/**
+			@brief Destroys the modules and unmaps the files.
+			*/
+			~ShaderLibrary()
+			{
+				Destroy();
+			}
+
+			/**
+			@brief Adds a module from code already in memory. (The code is not copied, it must outlive the library)
+
+			@details If a module with identical code exists it is given the name instead of creating a new one.
+			A name already in the library is reassigned to the new code.
+			*/
+			EResult Add(RoCStr _name, const SPIR_V::Bytecode* _code, std::size_t _codeSize)
+			{
+				return Add(std::string(_name), _code, _codeSize);
+			}
+
+			/**
+			@brief Destroys the modules and unmaps the files.
+			*/
+			void Destroy()
+			{
+				for (Module& module : modules) module.Object.Destroy();
+
+				modules .clear();
+				hashes  .clear();
+				names   .clear();
+				files   .clear();
+
+				reuseCount = 0;
+			}
+
+			/**
+			@brief Provides the module of the name specified. (nullptr if not in the library)
+			*/
+			const ShaderModule* Find(RoCStr _name) const
+			{
+				auto found = names.find(_name);
+
+				if (found == names.end()) return nullptr;
+
+				return &modules[found->second].Object;
+			}
+
+			/**
+			@brief Provides the code of the module of the name specified. Returns false if it is not in the library.
+			*/
+			bool GetCode(RoCStr _name, const SPIR_V::Bytecode*& _code, std::size_t& _codeSize) const
+			{
+				auto found = names.find(_name);
+
+				if (found == names.end()) return false;
+
+				_code     = modules[found->second].Code    ;
+				_codeSize = modules[found->second].CodeSize;
+
+				return true;
+			}
+
+			/**
+			@brief Provides the handle of the module of the name specified. (Null if not in the library)
+			*/
+			ShaderModule::Handle GetHandle(RoCStr _name) const
+			{
+				const ShaderModule* module = Find(_name);
+
+				return module != nullptr ? ShaderModule::Handle(*module) : Null<ShaderModule::Handle>;
+			}
+
+			/**
+			@brief Provides the amount of device modules created.
+			*/
+			ui32 GetModuleCount() const
+			{
+				return ui32(modules.size());
+			}
+
+			/**
+			@brief Provides the amount of names in the library.
+			*/
+			ui32 GetNameCount() const
+			{
+				return ui32(names.size());
+			}
+
+			/**
+			@brief Provides how many times a module was shared instead of created, because its code was already in the library.
+			*/
+			ui32 GetReuseCount() const
+			{
+				return reuseCount;
+			}
+
+			/**
+			@brief Maps a SPIR-V file or shader pack, and creates the modules it contains.
+
+			@details
+			Returns EResult::Not_Ready if no device was specified,
+			EResult::Error_Unknown if the file could not be mapped or is not valid SPIR-V or a valid pack.
+			A pack is validated as a whole before any of its modules are created.
+			*/
+			EResult Load(RoCStr _path)
+			{
+				if (device == nullptr) return EResult::Not_Ready;
+
+				MappedFile file;
+
+				if (!file.Open(_path)) return EResult::Error_Unknown;
+
+				const u8*   data = file.GetData();
+				std::size_t size = file.GetSize();
+
+				if (size < sizeof(ui32)) return EResult::Error_Unknown;
+
+				ui32 magic; memcpy(&magic, data, sizeof(ui32));
+
+				if (magic == SPIRV_Magic)
+				{
+					if (!IsValidCode(data, size)) return EResult::Error_Unknown;
+
+					files.push_back(std::move(file));
+
+					EResult returnCode = Add(std::string(_path), reinterpret_cast<const SPIR_V::Bytecode*>(data), size);
+
+					// Nothing refers to the mapping if the module could not be created.
+					if (returnCode != EResult::Success) files.pop_back();
+
+					return returnCode;
+				}
+
+				if (magic != PackHeader::Magic || !IsValidPack(data, size)) return EResult::Error_Unknown;
+
+				// Kept mapped even if a module fails, as the ones created before it refer to the mapping.
+				files.push_back(std::move(file));
+
+				const PackEntry* entries = reinterpret_cast<const PackEntry*>(data + sizeof(PackHeader));
+
+				for (ui32 index = 0; index < GetPackModuleCount(data); index++)
+				{
+					PackEntry entry; memcpy(&entry, entries + index, sizeof(PackEntry));
+
+					std::string name(reinterpret_cast<RoCStr>(data + entry.NameOffset), entry.NameSize);
+
+					EResult returnCode = Add(std::move(name), reinterpret_cast<const SPIR_V::Bytecode*>(data + entry.CodeOffset), entry.CodeSize);
+
+					if (returnCode != EResult::Success) return returnCode;
+				}
+
+				return EResult::Success;
+			}
+
+			/**
+			@brief Writes a shader pack with the modules specified. Returns false if the file could not be written.
+			*/
+			static bool WritePack
+			(
+				      RoCStr                   _path       ,
+				      ui32                     _moduleCount,
+				const RoCStr*                  _names      ,
+				const SPIR_V::Bytecode* const* _codes      ,
+				const std::size_t*             _codeSizes
+			)
+			{
+				PackHeader header {};
+
+				header.MagicID     = PackHeader::Magic        ;
+				header.Version     = PackHeader::FormatVersion;
+				header.ModuleCount = _moduleCount             ;
+
+				DynamicArray<PackEntry> entries(_moduleCount);
+
+				DynamicArray<const void*> blocks    ;
+				DynamicArray<std::size_t> blockSizes;
+
+				blocks    .push_back(&header       ); blockSizes.push_back(sizeof(PackHeader));
+				blocks    .push_back(entries.data()); blockSizes.push_back(sizeof(PackEntry) * _moduleCount);
+
+				std::size_t offset = sizeof(PackHeader) + sizeof(PackEntry) * _moduleCount;
+
+				for (ui32 index = 0; index < _moduleCount; index++)
+				{
+					entries[index].CodeOffset = ui32(offset           );
+					entries[index].CodeSize   = ui32(_codeSizes[index]);
+
+					blocks.push_back(_codes[index]); blockSizes.push_back(_codeSizes[index]);
+
+					offset += _codeSizes[index];
+				}
+
+				// Names are placed after all the code, so that the code stays word aligned.
+				for (ui32 index = 0; index < _moduleCount; index++)
+				{
+					const std::size_t nameSize = strlen(_names[index]);
+
+					entries[index].NameOffset = ui32(offset  );
+					entries[index].NameSize   = ui32(nameSize);
+
+					blocks.push_back(_names[index]); blockSizes.push_back(nameSize);
+
+					offset += nameSize;
+				}
+
+				return WriteFileAtomic(_path, ui32(blocks.size()), blocks.data(), blockSizes.data());
+			}
+
+		protected:
+
+			/**
+			@brief A created module and the code it was created from.
+			*/
+			struct Module
+			{
+				      ShaderModule      Object  ;
+				const SPIR_V::Bytecode* Code    ;
+				      std::size_t       CodeSize;
+				      u64               Hash    ;
+			};
+
+			EResult Add(std::string&& _name, const SPIR_V::Bytecode* _code, std::size_t _codeSize)
+			{
+				if (device == nullptr) return EResult::Not_Ready;
+
+				const u64 hash = HashBytes(_code, _codeSize, 0);
+
+				auto range = hashes.equal_range(hash);
+
+				for (auto candidate = range.first; candidate != range.second; candidate++)
+				{
+					const Module& module = modules[candidate->second];
+
+					if (module.CodeSize == _codeSize && memcmp(module.Code, _code, _codeSize) == 0)
+					{
+						names[std::move(_name)] = candidate->second;
+
+						reuseCount++;
+
+						return EResult::Success;
+					}
+				}
+
+				ShaderModule::CreateInfo info(_code, _codeSize);
+
+				ShaderModule object;
+
+				EResult returnCode = allocator != nullptr ? object.Create(*device, info, *allocator) : object.Create(*device, info);
+
+				if (returnCode != EResult::Success) return returnCode;
+
+				const ui32 index = ui32(modules.size());
+
+				modules.push_back(Module{ std::move(object), _code, _codeSize, hash });
+
+				hashes.emplace(hash, index);
+
+				names[std::move(_name)] = index;
+
+				return EResult::Success;
+			}
+
+			/**
+			@brief Checks the code is a whole amount of words and starts with the SPIR-V magic number.
+			*/
+			static bool IsValidCode(const u8* _code, std::size_t _codeSize)
+			{
+				if (_codeSize < sizeof(ui32) || _codeSize % sizeof(SPIR_V::Bytecode) != 0) return false;
+
+				ui32 magic; memcpy(&magic, _code, sizeof(ui32));
+
+				return magic == SPIRV_Magic;
+			}
+
+			static ui32 GetPackModuleCount(const u8* _data)
+			{
+				PackHeader header; memcpy(&header, _data, sizeof(PackHeader));
+
+				return header.ModuleCount;
+			}
+
+			/**
+			@brief Checks the header, and that every entry is within the file and refers to valid code.
+			*/
+			static bool IsValidPack(const u8* _data, std::size_t _size)
+			{
+				if (_size < sizeof(PackHeader)) return false;
+
+				PackHeader header; memcpy(&header, _data, sizeof(PackHeader));
+
+				if (header.Version != PackHeader::FormatVersion) return false;
+
+				if (u64(header.ModuleCount) * sizeof(PackEntry) > _size - sizeof(PackHeader)) return false;
+
+				for (ui32 index = 0; index < header.ModuleCount; index++)
+				{
+					PackEntry entry; memcpy(&entry, _data + sizeof(PackHeader) + sizeof(PackEntry) * index, sizeof(PackEntry));
+
+					if (u64(entry.NameOffset) + entry.NameSize > _size || u64(entry.CodeOffset) + entry.CodeSize > _size) return false;
+
+					if (entry.CodeOffset % sizeof(SPIR_V::Bytecode) != 0 || !IsValidCode(_data + entry.CodeOffset, entry.CodeSize)) return false;
+				}
+
+				return true;
+			}
+
+			Deque<Module> modules;
+
+			std::unordered_multimap<u64, ui32> hashes;
+
+			std::unordered_map<std::string, ui32> names;
+
+			Deque<MappedFile> files;
+
+			ui32 reuseCount;
+
+			const Memory::AllocationCallbacks* allocator;
+
+			const LogicalDevice* device;
+		};
+
+		/** @} */	// Vault_3
+	}
+}
@@ -0,0 +1,1054 @@
+/*!
+@file VV_ShaderReflection.hpp
+
+@brief Vaulted Vulkan: Shader Reflection
+
+@details Contains a lightweight SPIR-V reflection of the interface of shader modules:
+descriptor bindings, push constant ranges, and vertex inputs, merged across the stages of a pipeline into layouts that exactly match its shaders.
+
+<a href="https://www.khronos.org/registry/spir-v/specs/unified1/SPIRV.html">SPIR-V Specification</a>
+*/
+
+
+
+#pragma once
+
+
+
+// VV
+#include "VV_Vaults.hpp"
+#include "VV_APISpecGroups.hpp"
+#include "VV_Platform.hpp"
+#include "VV_CPP_STL.hpp"
+#include "VV_Enums.hpp"
+#include "VV_Backend.hpp"
+#include "VV_Types.hpp"
+#include "VV_Constants.hpp"
+#include "VV_Memory_Backend.hpp"
+#include "VV_PhysicalDevice.hpp"
+#include "VV_Initialization.hpp"
+#include "VV_LogicalDevice.hpp"
+#include "VV_Memory.hpp"
+#include "VV_Sampler.hpp"
+#include "VV_Resource.hpp"
+#include "VV_SyncAndCacheControl.hpp"
+#include "VV_Shaders.hpp"
+#include "VV_Pipelines.hpp"
+
+
+
+#ifndef VV_Option__Use_Long_Namespace
+namespace VV
+#else
+namespace VaultedVulkan
+#endif
+{
+	namespace V3
+	{
+		/**
+		@addtogroup Vault_3
+		@{
+		*/
+
+		/**
+		@brief The interface of a single shader module, reflected from its SPIR-V.
+
+		@details
+		The module is parsed in a single linear pass: decorations and type declarations are recorded in a table indexed by result id
+		(sized once from the id bound of the module, and reused across reflections), the layout decorations of struct members in a list grouped by struct
+		after the pass (also reused), and the resources are resolved from them afterwards. No allocation is made per instruction.
+
+		Reflected:
+		- Descriptor bindings of every uniform, storage and uniform constant variable with a set and binding.
+		Unsized (runtime) arrays report a count of 0, for the application to provide. (Variable descriptor count)
+		Dynamic buffers cannot be told apart from the SPIR-V, and are reported as their non dynamic type.
+		- The push constant range of the module: from the lowest member offset of the block to the end of its last member.
+		Matrix members are sized by their own matrix stride and majorness. (Not reported if the size of the block cannot be resolved)
+		- The vertex inputs of a vertex shader, packed in location order into a single interleaved binding (0).
+		64-bit three and four component vectors take two locations, as the attributes of their format do.
+
+		If the module has several entry points, the stage is the one of the first, and the resources are those of the whole module.
+		*/
+		class ShaderReflection
+		{
+		public:
+
+			/**
+			@brief A descriptor binding along with the set it belongs to.
+			*/
+			struct DescriptorBinding
+			{
+				ui32                                     Set    ;
+				Pipeline::Layout::DescriptorSet::Binding Binding;
+			};
+
+			/**
+			@brief Default constructor.
+			*/
+			ShaderReflection() : stage(EShaderStageFlag::All), pushConstantRange{}, hasPushConstants(false), vertexBinding{}
+			{}
+
+			/**
+			@brief Provides the descriptor bindings of the module, sorted by set and binding.
+			*/
+			const DynamicArray<DescriptorBinding>& GetBindings() const
+			{
+				return bindings;
+			}
+
+			/**
+			@brief Provides the push constant range of the module. (See HasPushConstants)
+			*/
+			const Pipeline::Layout::PushConstantRange& GetPushConstantRange() const
+			{
+				return pushConstantRange;
+			}
+
+			EShaderStageFlag GetStage() const
+			{
+				return stage;
+			}
+
+			/**
+			@brief Provides the vertex attributes of a vertex shader, sorted by location.
+			*/
+			const DynamicArray<Pipeline::VertexInputState::AttributeDescription>& GetVertexAttributes() const
+			{
+				return vertexAttributes;
+			}
+
+			/**
+			@brief Provides the single binding the vertex attributes are packed in.
+			*/
+			const Pipeline::VertexInputState::BindingDescription& GetVertexBinding() const
+			{
+				return vertexBinding;
+			}
+
+			/**
+			@brief Generates the vertex input state of a vertex shader. (Points to this reflection, which must outlive it)
+			*/
+			Pipeline::VertexInputState::CreateInfo GetVertexInputInfo() const
+			{
+				Pipeline::VertexInputState::CreateInfo info {};
+
+				if (!vertexAttributes.empty())
+				{
+					info.BindingDescriptionCount   = 1                            ;
+					info.BindingDescriptions       = &vertexBinding               ;
+					info.AttributeDescriptionCount = ui32(vertexAttributes.size());
+					info.AttributeDescriptions     = vertexAttributes.data()      ;
+				}
+
+				return info;
+			}
+
+			bool HasPushConstants() const
+			{
+				return hasPushConstants;
+			}
+
+			/**
+			@brief Reflects the module specified. Returns false if the code is not valid SPIR-V (The reflection is then empty).
+			*/
+			bool Reflect(const SPIR_V::Bytecode* _code, std::size_t _codeSize)
+			{
+				Clear();
+
+				const ui32 wordCount = ui32(_codeSize / sizeof(SPIR_V::Bytecode));
+
+				if (_code == nullptr || wordCount < HeaderSize || _code[0] != Magic || _code[3] > MaxBound) return false;
+
+				code      = _code    ;
+				codeWords = wordCount;
+
+				ids.assign(_code[3], IdInfo{});
+
+				if (!Parse())
+				{
+					Clear();
+
+					return false;
+				}
+
+				GroupMembers();
+
+				Resolve();
+
+				return true;
+			}
+
+			/**
+			@brief Reflects the module specified as characters.
+			*/
+			bool Reflect(RoCStr _code, std::size_t _codeSize)
+			{
+				return Reflect(reinterpret_cast<const SPIR_V::Bytecode*>(_code), _codeSize);
+			}
+
+		protected:
+
+			static constexpr ui32 Magic      = 0x07230203;
+			static constexpr ui32 HeaderSize = 5         ;
+			static constexpr ui32 MaxBound   = 4194303   ;   ///< Universal limit of the id bound of a module.
+			static constexpr ui32 MaxDepth   = 16        ;   ///< Limit to the nesting of types when computing sizes.
+			static constexpr ui32 MaxInputs  = 64        ;   ///< Limit to the locations of a vertex input. (Above the maxVertexInputAttributes of any device)
+
+			/** @brief Opcodes of the instructions reflected. */
+			enum EOp : ui32
+			{
+				Op_EntryPoint                = 15  ,
+				Op_TypeBool                  = 20  ,
+				Op_TypeInt                   = 21  ,
+				Op_TypeFloat                 = 22  ,
+				Op_TypeVector                = 23  ,
+				Op_TypeMatrix                = 24  ,
+				Op_TypeImage                 = 25  ,
+				Op_TypeSampler               = 26  ,
+				Op_TypeSampledImage          = 27  ,
+				Op_TypeArray                 = 28  ,
+				Op_TypeRuntimeArray          = 29  ,
+				Op_TypeStruct                = 30  ,
+				Op_TypePointer               = 32  ,
+				Op_Constant                  = 43  ,
+				Op_Function                  = 54  ,
+				Op_Variable                  = 59  ,
+				Op_Decorate                  = 71  ,
+				Op_MemberDecorate            = 72  ,
+				Op_TypeAccelerationStructure = 5341
+			};
+
+			/** @brief Decorations reflected. */
+			enum EDecoration : ui32
+			{
+				Decoration_Block         = 2 ,
+				Decoration_BufferBlock   = 3 ,
+				Decoration_RowMajor      = 4 ,
+				Decoration_ArrayStride   = 6 ,
+				Decoration_MatrixStride  = 7 ,
+				Decoration_BuiltIn       = 11,
+				Decoration_Location      = 30,
+				Decoration_Binding       = 33,
+				Decoration_DescriptorSet = 34,
+				Decoration_Offset        = 35
+			};
+
+			/** @brief Storage classes reflected. */
+			enum EStorageClass : ui32
+			{
+				StorageClass_UniformConstant = 0 ,
+				StorageClass_Input           = 1 ,
+				StorageClass_Uniform         = 2 ,
+				StorageClass_PushConstant    = 9 ,
+				StorageClass_StorageBuffer   = 12
+			};
+
+			/** @brief What is known of an id after the pass. */
+			struct IdInfo
+			{
+				const ui32* Definition;   ///< Instruction declaring the id. (nullptr if not reflected)
+
+				ui32 Set            ;
+				ui32 Binding        ;
+				ui32 Location       ;
+				ui32 ArrayStride    ;
+				ui32 FirstMember    ;   ///< Index of the first layout of the struct's members in the member list.
+				ui32 MemberCount    ;   ///< Amount of the struct's members with a layout decoration.
+				ui32 FirstOffset    ;
+				bool HasSet         ;
+				bool HasBinding     ;
+				bool HasLocation    ;
+				bool HasOffsets     ;
+				bool IsBlock        ;
+				bool IsBufferBlock  ;
+				bool IsBuiltIn      ;
+			};
+
+			/** @brief The layout decorations of a struct member. */
+			struct MemberInfo
+			{
+				ui32 Struct      ;
+				ui32 Member      ;
+				ui32 Offset      ;
+				ui32 MatrixStride;
+				bool HasOffset   ;
+				bool IsRowMajor  ;
+			};
+
+			void Clear()
+			{
+				bindings        .clear();
+				vertexAttributes.clear();
+				members         .clear();
+
+				stage             = EShaderStageFlag::All;
+				pushConstantRange = {}                   ;
+				hasPushConstants  = false                ;
+				vertexBinding     = {}                   ;
+
+				code      = nullptr;
+				codeWords = 0      ;
+			}
+
+			/**
+			@brief Provides the operand of an instruction, 0 if the instruction is too short to have it.
+			*/
+			static ui32 GetOperand(const ui32* _instruction, ui32 _index)
+			{
+				return _index < (_instruction[0] >> 16) ? _instruction[_index] : 0;
+			}
+
+			/**
+			@brief Provides the declaration of an id, nullptr if the id is out of bounds or was not declared.
+			*/
+			const ui32* GetDefinition(ui32 _id) const
+			{
+				return _id < ids.size() ? ids[_id].Definition : nullptr;
+			}
+
+			static ui32 GetOpcode(const ui32* _instruction)
+			{
+				return _instruction != nullptr ? (_instruction[0] & 0xFFFF) : 0;
+			}
+
+			/**
+			@brief Maps a scalar or vector type to a vertex format. (Undefined if not representable)
+			*/
+			static EFormat GetFormat(const ui32* _component, ui32 _componentCount)
+			{
+				static constexpr EFormat Formats[3][3][4] =
+				{
+					{
+						{ EFormat::R16_SFloat, EFormat::R16_G16_SFloat, EFormat::R16_G16_B16_SFloat, EFormat::R16_G16_B16_A16_SFloat },
+						{ EFormat::R32_SFloat, EFormat::R32_G32_SFloat, EFormat::R32_G32_B32_SFloat, EFormat::R32_G32_B32_A32_SFloat },
+						{ EFormat::R64_SFloat, EFormat::R64_G64_SFloat, EFormat::R64_G64_B64_SFloat, EFormat::R64_G64_B64_A64_SFloat }
+					},
+					{
+						{ EFormat::R16_UInt, EFormat::R16_G16_UInt, EFormat::R16_G16_B16_UInt, EFormat::R16_G16_B16_A16_UInt },
+						{ EFormat::R32_UInt, EFormat::R32_G32_UInt, EFormat::R32_G32_B32_UInt, EFormat::R32_G32_B32_A32_UInt },
+						{ EFormat::R64_Uint, EFormat::R64_G64_UInt, EFormat::R64_G64_B64_UInt, EFormat::R64_G64_B64_A64_UInt }
+					},
+					{
+						{ EFormat::R16_SInt, EFormat::R16_G16_SInt, EFormat::R16_G16_B16_SInt, EFormat::R16_G16_B16_A16_SInt },
+						{ EFormat::R32_SInt, EFormat::R32_G32_SInt, EFormat::R32_G32_B32_Sint, EFormat::R32_G32_B32_A32_SInt },
+						{ EFormat::R64_SInt, EFormat::R64_G64_SInt, EFormat::R64_G64_B64_SInt, EFormat::R64_G64_B64_A64_SInt }
+					}
+				};
+
+				const ui32 opcode = GetOpcode(_component);
+
+				if ((opcode != Op_TypeFloat && opcode != Op_TypeInt) || _componentCount < 1 || _componentCount > 4) return EFormat::Undefined;
+
+				ui32 kind;
+
+				if (opcode == Op_TypeFloat) kind = 0;
+				else                        kind = GetOperand(_component, 3) != 0 ? 2 : 1;
+
+				ui32 width;
+
+				switch (GetOperand(_component, 2))
+				{
+					case 16: width = 0; break;
+					case 32: width = 1; break;
+					case 64: width = 2; break;
+
+					default: return EFormat::Undefined;
+				}
+
+				return Formats[kind][width][_componentCount - 1];
+			}
+
+			static EShaderStageFlag GetExecutionStage(ui32 _executionModel)
+			{
+				switch (_executionModel)
+				{
+					case 0   : return EShaderStageFlag::Vertex                ;
+					case 1   : return EShaderStageFlag::TessellationControl   ;
+					case 2   : return EShaderStageFlag::TessellationEvaluation;
+					case 3   : return EShaderStageFlag::Geometry              ;
+					case 4   : return EShaderStageFlag::Fragment              ;
+					case 5   : return EShaderStageFlag::Compute               ;
+					case 5267: return EShaderStageFlag::Task_NV               ;
+					case 5268: return EShaderStageFlag::Mesh_NV               ;
+					case 5313: return EShaderStageFlag::Raygen_KHR            ;
+					case 5314: return EShaderStageFlag::Intersection_KHR      ;
+					case 5315: return EShaderStageFlag::AnyHit_KHR            ;
+					case 5316: return EShaderStageFlag::ClosestHit_KHR        ;
+					case 5317: return EShaderStageFlag::Miss_KHR              ;
+					case 5318: return EShaderStageFlag::Callable_KHR          ;
+
+					default: return EShaderStageFlag::All;
+				}
+			}
+
+			/**
+			@brief Provides the size in bytes of a type, as laid out by its offset and stride decorations. (0 if unsized)
+			*/
+			ui32 GetTypeSize(ui32 _type, ui32 _depth) const
+			{
+				const ui32* definition = GetDefinition(_type);
+
+				if (definition == nullptr || _depth > MaxDepth) return 0;
+
+				switch (GetOpcode(definition))
+				{
+					case Op_TypeBool : return 4;
+					case Op_TypeInt  :
+					case Op_TypeFloat: return GetOperand(definition, 2) / 8;
+
+					case Op_TypeVector:
+					case Op_TypeMatrix:
+					{
+						return GetOperand(definition, 3) * GetTypeSize(GetOperand(definition, 2), _depth + 1);
+					}
+					case Op_TypeArray:
+					{
+						const ui32 stride = ids[_type].ArrayStride;
+
+						return GetArrayLength(definition) * (stride != 0 ? stride : GetTypeSize(GetOperand(definition, 2), _depth + 1));
+					}
+					case Op_TypeStruct:
+					{
+						const IdInfo& info = ids[_type];
+
+						if (!info.HasOffsets)
+						{
+							ui32 size = 0;
+
+							for (ui32 member = 2; member < (definition[0] >> 16); member++) size += GetTypeSize(definition[member], _depth + 1);
+
+							return size;
+						}
+
+						// The end of the member that ends last.
+						ui32 size = 0;
+
+						for (ui32 index = info.FirstMember; index < info.FirstMember + info.MemberCount; index++)
+						{
+							const MemberInfo& member = members[index];
+
+							if (!member.HasOffset || member.Member + 2 >= (definition[0] >> 16)) continue;
+
+							size = (std::max)(size, member.Offset + GetMemberSize(member, definition[2 + member.Member], _depth + 1));
+						}
+
+						return size;
+					}
+
+					default: return 0;
+				}
+			}
+
+			/**
+			@brief Provides the size in bytes of a struct member, a matrix member is laid out by its own matrix stride and majorness.
+			*/
+			ui32 GetMemberSize(const MemberInfo& _member, ui32 _type, ui32 _depth) const
+			{
+				const ui32* definition = GetDefinition(_type);
+
+				if (GetOpcode(definition) != Op_TypeMatrix || _member.MatrixStride == 0) return GetTypeSize(_type, _depth);
+
+				// A stride per column, or per row (the component count of a column) when row major.
+				const ui32 strideCount = _member.IsRowMajor ? GetOperand(GetDefinition(GetOperand(definition, 2)), 3) : GetOperand(definition, 3);
+
+				return strideCount * _member.MatrixStride;
+			}
+
+			/**
+			@brief Merges the layout decorations recorded per member, and groups them by struct.
+			*/
+			void GroupMembers()
+			{
+				std::sort
+				(
+					members.begin(), members.end(),
+					[](const MemberInfo& _left, const MemberInfo& _right)
+					{
+						return _left.Struct != _right.Struct ? _left.Struct < _right.Struct : _left.Member < _right.Member;
+					}
+				);
+
+				ui32 count = 0;
+
+				for (ui32 index = 0; index < members.size(); index++)
+				{
+					const MemberInfo decoration = members[index];
+
+					if (count == 0 || members[count - 1].Struct != decoration.Struct || members[count - 1].Member != decoration.Member)
+					{
+						members[count++] = decoration;
+
+						continue;
+					}
+
+					MemberInfo& member = members[count - 1];
+
+					if (decoration.HasOffset)
+					{
+						member.Offset    = decoration.Offset;
+						member.HasOffset = true             ;
+					}
+
+					if (decoration.MatrixStride != 0) member.MatrixStride = decoration.MatrixStride;
+
+					member.IsRowMajor = member.IsRowMajor || decoration.IsRowMajor;
+				}
+
+				members.resize(count);
+
+				for (ui32 index = 0; index < count; index++)
+				{
+					const MemberInfo& member = members[index];
+
+					IdInfo& info = ids[member.Struct];
+
+					if (info.MemberCount == 0) info.FirstMember = index;
+
+					info.MemberCount++;
+
+					if (!member.HasOffset) continue;
+
+					if (!info.HasOffsets || member.Offset < info.FirstOffset) info.FirstOffset = member.Offset;
+
+					info.HasOffsets = true;
+				}
+			}
+
+			/**
+			@brief Provides the length of an array type. (From its length constant)
+			*/
+			ui32 GetArrayLength(const ui32* _array) const
+			{
+				const ui32* length = GetDefinition(GetOperand(_array, 3));
+
+				return GetOpcode(length) == Op_Constant ? GetOperand(length, 3) : 0;
+			}
+
+			/**
+			@brief Records the decorations and declarations of the module.
+			*/
+			bool Parse()
+			{
+				const ui32 bound = ui32(ids.size());
+
+				bool hasEntryPoint = false;
+
+				for (ui32 offset = HeaderSize; offset < codeWords;)
+				{
+					const ui32* instruction = code + offset;
+
+					const ui32 opcode    = instruction[0] & 0xFFFF;
+					const ui32 wordCount = instruction[0] >> 16   ;
+
+					if (wordCount == 0 || wordCount > codeWords - offset) return false;
+
+					offset += wordCount;
+
+					switch (opcode)
+					{
+						case Op_EntryPoint:
+						{
+							if (!hasEntryPoint) stage = GetExecutionStage(GetOperand(instruction, 1));
+
+							hasEntryPoint = true;
+
+							break;
+						}
+						case Op_Decorate:
+						{
+							const ui32 target = GetOperand(instruction, 1);
+
+							if (target >= bound) return false;
+
+							IdInfo&    info  = ids[target];
+							const ui32 value = GetOperand(instruction, 3);
+
+							switch (GetOperand(instruction, 2))
+							{
+								case Decoration_Block        : info.IsBlock       = true ;                      break;
+								case Decoration_BufferBlock  : info.IsBufferBlock = true ;                      break;
+								case Decoration_ArrayStride  : info.ArrayStride   = value;                      break;
+								case Decoration_BuiltIn      : info.IsBuiltIn     = true ;                      break;
+								case Decoration_Location     : info.Location      = value; info.HasLocation = true; break;
+								case Decoration_Binding      : info.Binding       = value; info.HasBinding  = true; break;
+								case Decoration_DescriptorSet: info.Set           = value; info.HasSet      = true; break;
+							}
+
+							break;
+						}
+						case Op_MemberDecorate:
+						{
+							const ui32 target = GetOperand(instruction, 1);
+
+							if (target >= bound) return false;
+
+							// Each layout decoration is recorded on its own, they are merged per member once the pass is done. (See GroupMembers)
+							MemberInfo member {};
+
+							member.Struct = target                    ;
+							member.Member = GetOperand(instruction, 2);
+
+							const ui32 value = GetOperand(instruction, 4);
+
+							switch (GetOperand(instruction, 3))
+							{
+								case Decoration_BuiltIn     : ids[target].IsBuiltIn = true ;                                                   break;
+								case Decoration_Offset      : member.Offset         = value; member.HasOffset = true; members.push_back(member); break;
+								case Decoration_MatrixStride: member.MatrixStride   = value;                          members.push_back(member); break;
+								case Decoration_RowMajor    : member.IsRowMajor     = true ;                          members.push_back(member); break;
+							}
+
+							break;
+						}
+						case Op_TypeBool        :
+						case Op_TypeInt         :
+						case Op_TypeFloat       :
+						case Op_TypeVector      :
+						case Op_TypeMatrix      :
+						case Op_TypeImage       :
+						case Op_TypeSampler     :
+						case Op_TypeSampledImage:
+						case Op_TypeArray       :
+						case Op_TypeRuntimeArray:
+						case Op_TypeStruct      :
+						case Op_TypePointer     :
+						case Op_TypeAccelerationStructure:
+						{
+							const ui32 result = GetOperand(instruction, 1);
+
+							if (result >= bound) return false;
+
+							ids[result].Definition = instruction;
+
+							break;
+						}
+						case Op_Constant:
+						case Op_Variable:
+						{
+							const ui32 result = GetOperand(instruction, 2);
+
+							if (result >= bound) return false;
+
+							ids[result].Definition = instruction;
+
+							break;
+						}
+					}
+
+					// Nothing past the declarations is reflected.
+					if (opcode == Op_Function) break;
+				}
+
+				return true;
+			}
+
+			/**
+			@brief Resolves the resources of the variables recorded by the pass.
+			*/
+			void Resolve()
+			{
+				for (ui32 id = 0; id < ids.size(); id++)
+				{
+					const ui32* variable = ids[id].Definition;
+
+					if (GetOpcode(variable) != Op_Variable) continue;
+
+					const ui32* pointer = GetDefinition(GetOperand(variable, 1));
+
+					if (GetOpcode(pointer) != Op_TypePointer) continue;
+
+					const ui32 type = GetOperand(pointer, 3);
+
+					switch (GetOperand(variable, 3))
+					{
+						case StorageClass_UniformConstant:
+						case StorageClass_Uniform        :
+						case StorageClass_StorageBuffer  :
+						{
+							ResolveDescriptor(ids[id], type, GetOperand(variable, 3));
+
+							break;
+						}
+						case StorageClass_PushConstant:
+						{
+							if (type >= ids.size()) break;
+
+							const IdInfo& block = ids[type];
+
+							const ui32 offset = block.HasOffsets ? block.FirstOffset : 0;
+							const ui32 size   = GetTypeSize(type, 0)                     ;
+
+							// A block that could not be sized has no valid range.
+							if (size <= offset) break;
+
+							pushConstantRange.StageFlags = stage        ;
+							pushConstantRange.Offset     = offset       ;
+							pushConstantRange.Size       = size - offset;
+
+							hasPushConstants = true;
+
+							break;
+						}
+						case StorageClass_Input:
+						{
+							if (stage == EShaderStageFlag::Vertex && ids[id].HasLocation && !ids[id].IsBuiltIn) ResolveVertexInput(ids[id].Location, type);
+
+							break;
+						}
+					}
+				}
+
+				std::sort
+				(
+					bindings.begin(), bindings.end(),
+					[](const DescriptorBinding& _left, const DescriptorBinding& _right)
+					{
+						return _left.Set != _right.Set ? _left.Set < _right.Set : _left.Binding.BindingID < _right.Binding.BindingID;
+					}
+				);
+
+				std::sort
+				(
+					vertexAttributes.begin(), vertexAttributes.end(),
+					[](const Pipeline::VertexInputState::AttributeDescription& _left, const Pipeline::VertexInputState::AttributeDescription& _right)
+					{
+						return _left.Location < _right.Location;
+					}
+				);
+
+				// Pack the attributes in location order.
+				ui32 stride = 0;
+
+				for (auto& attribute : vertexAttributes)
+				{
+					const ui32 size = attribute.Offset;
+
+					attribute.Offset = stride;
+
+					stride += size;
+				}
+
+				vertexBinding.Binding   = 0                       ;
+				vertexBinding.Stride    = stride                  ;
+				vertexBinding.InputRate = EVertexInputRate::Vertex;
+			}
+
+			void ResolveDescriptor(const IdInfo& _variable, ui32 _type, ui32 _storageClass)
+			{
+				if (!_variable.HasBinding) return;
+
+				ui32 count = 1;
+
+				const ui32* definition = GetDefinition(_type);
+
+				for (ui32 depth = 0; depth < MaxDepth; depth++)
+				{
+					if (GetOpcode(definition) == Op_TypeArray)
+					{
+						count *= GetArrayLength(definition);
+					}
+					else if (GetOpcode(definition) == Op_TypeRuntimeArray)
+					{
+						count = 0;
+					}
+					else break;
+
+					_type      = GetOperand(definition, 2);
+					definition = GetDefinition(_type)     ;
+				}
+
+				EDescriptorType type;
+
+				switch (GetOpcode(definition))
+				{
+					case Op_TypeSampler              : type = EDescriptorType::Sampler                  ; break;
+					case Op_TypeSampledImage         : type = EDescriptorType::CombinedImageSampler     ; break;
+					case Op_TypeAccelerationStructure: type = EDescriptorType::AccelerationStructure_KHR; break;
+
+					case Op_TypeImage:
+					{
+						const ui32 dimension = GetOperand(definition, 3);
+						const ui32 sampled   = GetOperand(definition, 7);
+
+						if      (dimension == 6) type = EDescriptorType::InputAttachment;   // SubpassData
+						else if (dimension == 5) type = sampled == 2 ? EDescriptorType::StorageTexelBuffer : EDescriptorType::UniformTexelBuffer;   // Buffer
+						else                     type = sampled == 2 ? EDescriptorType::StorageImage       : EDescriptorType::SampledImage      ;
+
+						break;
+					}
+					case Op_TypeStruct:
+					{
+						if (_storageClass == StorageClass_StorageBuffer || ids[_type].IsBufferBlock) type = EDescriptorType::StorageBuffer;
+						else                                                                        type = EDescriptorType::UniformBuffer;
+
+						break;
+					}
+
+					default: return;
+				}
+
+				DescriptorBinding binding {};
+
+				binding.Set                       = _variable.HasSet ? _variable.Set : 0;
+				binding.Binding.BindingID         = _variable.Binding                  ;
+				binding.Binding.Type              = type                               ;
+				binding.Binding.Count             = count                              ;
+				binding.Binding.StageFlags        = stage                              ;
+				binding.Binding.ImmutableSamplers = nullptr                            ;
+
+				bindings.push_back(binding);
+			}
+
+			/**
+			@brief Adds the attributes of a vertex input. (Matrices and arrays take a location per column or element, two for 64-bit three and four component vectors)
+
+			@details The size of the attribute is kept in its offset until the attributes are packed.
+			*/
+			void ResolveVertexInput(ui32 _location, ui32 _type)
+			{
+				const ui32* definition = GetDefinition(_type);
+
+				ui32 locationCount = 1;
+
+				if (GetOpcode(definition) == Op_TypeArray)
+				{
+					locationCount = GetArrayLength(definition);
+					definition    = GetDefinition(GetOperand(definition, 2));
+				}
+
+				if (GetOpcode(definition) == Op_TypeMatrix)
+				{
+					locationCount *= GetOperand(definition, 3);
+					definition     = GetDefinition(GetOperand(definition, 2));
+				}
+
+				const ui32* component      = definition;
+				      ui32  componentCount = 1         ;
+
+				if (GetOpcode(definition) == Op_TypeVector)
+				{
+					component      = GetDefinition(GetOperand(definition, 2));
+					componentCount = GetOperand(definition, 3);
+				}
+
+				const EFormat format = GetFormat(component, componentCount);
+
+				const ui32 componentSize  = GetOperand(component, 2) / 8                     ;
+				const ui32 locationStride = componentSize == 8 && componentCount > 2 ? 2 : 1;
+
+				if (format == EFormat::Undefined || locationCount > MaxInputs) return;
+
+				for (ui32 location = 0; location < locationCount; location++)
+				{
+					Pipeline::VertexInputState::AttributeDescription attribute {};
+
+					attribute.Location = _location + location * locationStride          ;
+					attribute.Binding  = 0                                              ;
+					attribute.Format   = format                                         ;
+					attribute.Offset   = componentCount * componentSize                 ;
+
+					vertexAttributes.push_back(attribute);
+				}
+			}
+
+			const SPIR_V::Bytecode* code      = nullptr;
+			      ui32              codeWords = 0      ;
+
+			DynamicArray<IdInfo> ids;
+
+			DynamicArray<MemberInfo> members;
+
+			EShaderStageFlag stage;
+
+			DynamicArray<DescriptorBinding> bindings;
+
+			Pipeline::Layout::PushConstantRange pushConstantRange;
+
+			bool hasPushConstants;
+
+			DynamicArray<Pipeline::VertexInputState::AttributeDescription> vertexAttributes;
+
+			Pipeline::VertexInputState::BindingDescription vertexBinding;
+		};
+
+		/**
+		@brief Merges the reflections of the stages of a pipeline into its descriptor set layouts and push constant ranges.
+
+		@details
+		Bindings shared by several stages get the stage flags of all of them, and the largest count.
+		Push constant ranges that are identical across stages are merged into one, a stage added twice has its ranges combined.
+
+		The create infos provided point to the storage of this object, which must outlive them.
+
+		@code
+		PipelineLayoutReflection layout;
+
+		layout.Add(vertexReflection  );
+		layout.Add(fragmentReflection);
+
+		DynamicArray<Pipeline::Layout::DescriptorSet>         setLayouts      (layout.GetSetCount());
+		DynamicArray<Pipeline::Layout::DescriptorSet::Handle> setLayoutHandles(layout.GetSetCount());
+
+		for (ui32 set = 0; set < layout.GetSetCount(); set++)
+		{
+			setLayouts[set].Create(device, layout.GetSetLayoutInfo(set));
+
+			setLayoutHandles[set] = setLayouts[set];
+		}
+
+		pipelineLayout.Create(device, layout.GetLayoutInfo(setLayoutHandles.data()));
+		@endcode
+		*/
+		class PipelineLayoutReflection
+		{
+		public:
+
+			/**
+			@brief Merges the interface of a stage. Returns false if a binding conflicts with the type of one already merged (It is then skipped).
+			*/
+			bool Add(const ShaderReflection& _stage)
+			{
+				bool compatible = true;
+
+				for (const auto& reflected : _stage.GetBindings())
+				{
+					if (reflected.Set >= sets.size()) sets.resize(reflected.Set + 1);
+
+					DynamicArray<Pipeline::Layout::DescriptorSet::Binding>& set = sets[reflected.Set];
+
+					auto found = std::find_if
+					(
+						set.begin(), set.end(),
+						[&reflected](const Pipeline::Layout::DescriptorSet::Binding& _binding)
+						{
+							return _binding.BindingID == reflected.Binding.BindingID;
+						}
+					);
+
+					if (found == set.end())
+					{
+						auto position = std::find_if
+						(
+							set.begin(), set.end(),
+							[&reflected](const Pipeline::Layout::DescriptorSet::Binding& _binding)
+							{
+								return _binding.BindingID > reflected.Binding.BindingID;
+							}
+						);
+
+						set.insert(position, reflected.Binding);
+
+						continue;
+					}
+
+					if (found->Type != reflected.Binding.Type)
+					{
+						compatible = false;
+
+						continue;
+					}
+
+					found->StageFlags |= reflected.Binding.StageFlags;
+
+					// Unsized arrays (0) take precedence, as their count is provided by the application.
+					if (found->Count != 0) found->Count = reflected.Binding.Count == 0 ? 0 : (std::max)(found->Count, reflected.Binding.Count);
+				}
+
+				if (_stage.HasPushConstants()) AddPushConstantRange(_stage.GetPushConstantRange());
+
+				return compatible;
+			}
+
+			void Clear()
+			{
+				sets              .clear();
+				pushConstantRanges.clear();
+			}
+
+			/**
+			@brief Generates a pipeline layout info using the set layouts specified. (One per set, see GetSetCount)
+			*/
+			Pipeline::Layout::CreateInfo GetLayoutInfo(const Pipeline::Layout::DescriptorSet::Handle* _setLayouts) const
+			{
+				Pipeline::Layout::CreateInfo info {};
+
+				info.SetLayoutCount         = GetSetCount()                  ;
+				info.SetLayouts             = _setLayouts                    ;
+				info.PushConstantRangeCount = ui32(pushConstantRanges.size());
+				info.PushConstantRanges     = pushConstantRanges.data()      ;
+
+				return info;
+			}
+
+			const DynamicArray<Pipeline::Layout::PushConstantRange>& GetPushConstantRanges() const
+			{
+				return pushConstantRanges;
+			}
+
+			/**
+			@brief Provides the bindings of a set, sorted by binding.
+			*/
+			const DynamicArray<Pipeline::Layout::DescriptorSet::Binding>& GetSetBindings(ui32 _set) const
+			{
+				return sets[_set];
+			}
+
+			/**
+			@brief Provides the amount of sets used by the pipeline. (The highest set used + 1, sets in between are empty)
+			*/
+			ui32 GetSetCount() const
+			{
+				return ui32(sets.size());
+			}
+
+			/**
+			@brief Generates the descriptor set layout info of a set.
+			*/
+			Pipeline::Layout::DescriptorSet::CreateInfo GetSetLayoutInfo(ui32 _set) const
+			{
+				Pipeline::Layout::DescriptorSet::CreateInfo info {};
+
+				info.BindingCount = ui32(sets[_set].size());
+				info.Bindings     = sets[_set].data()      ;
+
+				return info;
+			}
+
+		protected:
+
+			void AddPushConstantRange(const Pipeline::Layout::PushConstantRange& _range)
+			{
+				// A stage may only be in a single range.
+				for (auto& range : pushConstantRanges)
+				{
+					if (!(range.StageFlags & _range.StageFlags).HasAnyFlag()) continue;
+
+					const ui32 end = (std::max)(range.Offset + range.Size, _range.Offset + _range.Size);
+
+					range.Offset = (std::min)(range.Offset, _range.Offset);
+					range.Size   = end - range.Offset                  ;
+
+					return;
+				}
+
+				for (auto& range : pushConstantRanges)
+				{
+					if (range.Offset == _range.Offset && range.Size == _range.Size)
+					{
+						range.StageFlags |= _range.StageFlags;
+
+						return;
+					}
+				}
+
+				pushConstantRanges.push_back(_range);
+			}
+
+			DynamicArray<DynamicArray<Pipeline::Layout::DescriptorSet::Binding>> sets;
+
+			DynamicArray<Pipeline::Layout::PushConstantRange> pushConstantRanges;
+		};
+
+		/** @} */	// Vault_3
+	}
+}
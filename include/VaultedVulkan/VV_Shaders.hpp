@@ -142,7 +142,7 @@ namespace VaultedVulkan
 			using Parent = V1::ShaderModule;
 
 			/**
-			@brief Offers a default constructor and one code/code size parameters.
+			@brief Offers a default constructor and code/code size parameters. (As characters or as SPIR-V words)
 			*/
 			struct CreateInfo : public Parent::CreateInfo
 			{
@@ -160,6 +160,14 @@ namespace VaultedVulkan
 					CodeSize = _codeSize;
 					Code     = reinterpret_cast<const Bytecode*>(_code);
 				}
+
+				CreateInfo(const SPIR_V::Bytecode* _code, std::size_t _codeSize)
+				{
+					SType    = STypeEnum;
+					Next     = nullptr  ;
+					CodeSize = _codeSize;
+					Code     = _code    ;
+				}
 			};
 
 			/**
@@ -0,0 +1,1214 @@
+/*!
+@file VV_StructHash.hpp
+
+@brief Vaulted Vulkan: Structure Hashing
+
+@details Contains structural hashing and deep equality for the create info structures, used to deduplicate objects created from identical descriptions.
+
+Both follow the pointer members of a structure (stage arrays, binding arrays, fixed function states, etc) and hash or compare what they point to,
+so that two descriptions built separately compare equal if they describe the same object.
+
+Handles are compared by value (Two layouts created separately are different objects even if their descriptions match).
+Structures chained through Next are followed when their structure type is known to the library, otherwise they are compared by address.
+
+Hashes are only meant to be used within a run of the application (They depend on the host's endianness and on handle values).
+*/
+
+
+
+#pragma once
+
+
+
+// VV
+#include "VV_Vaults.hpp"
+#include "VV_APISpecGroups.hpp"
+#include "VV_Platform.hpp"
+#include "VV_CPP_STL.hpp"
+#include "VV_Enums.hpp"
+#include "VV_Backend.hpp"
+#include "VV_Types.hpp"
+#include "VV_Constants.hpp"
+#include "VV_Memory_Backend.hpp"
+#include "VV_PhysicalDevice.hpp"
+#include "VV_Initialization.hpp"
+#include "VV_LogicalDevice.hpp"
+#include "VV_Memory.hpp"
+#include "VV_Sampler.hpp"
+#include "VV_Resource.hpp"
+#include "VV_SyncAndCacheControl.hpp"
+#include "VV_Shaders.hpp"
+#include "VV_Pipelines.hpp"
+#include "VV_RenderPass.hpp"
+
+
+
+#ifndef VV_Option__Use_Long_Namespace
+namespace VV
+#else
+namespace VaultedVulkan
+#endif
+{
+	namespace V0
+	{
+		/**
+		@addtogroup Vault_0
+		@{
+		*/
+
+		/**
+		@brief Constants and steps shared by the 64-bit hashing functions.
+		*/
+		struct HashPrimes
+		{
+			static constexpr u64 Prime1 = 0x9E3779B185EBCA87ULL;
+			static constexpr u64 Prime2 = 0xC2B2AE3D27D4EB4FULL;
+			static constexpr u64 Prime3 = 0x165667B19E3779F9ULL;
+			static constexpr u64 Prime4 = 0x85EBCA77C2B2AE63ULL;
+			static constexpr u64 Prime5 = 0x27D4EB2F165667C5ULL;
+
+			static constexpr u64 Rotate(u64 _value, ui32 _amount)
+			{
+				return (_value << _amount) | (_value >> (64 - _amount));
+			}
+
+			static constexpr u64 Round(u64 _accumulator, u64 _word)
+			{
+				return Rotate(_accumulator + _word * Prime2, 31) * Prime1;
+			}
+
+			/**
+			@brief Mixes the bits of the hash so that every input bit affects every output bit.
+			*/
+			static constexpr u64 Avalanche(u64 _hash)
+			{
+				_hash ^= _hash >> 33;
+				_hash *= Prime2     ;
+				_hash ^= _hash >> 29;
+				_hash *= Prime3     ;
+				_hash ^= _hash >> 32;
+
+				return _hash;
+			}
+		};
+
+		/**
+		@brief Hashes a block of bytes to 64 bits.
+
+		@details
+		Blocks of 32 bytes are consumed as four independent 64-bit lanes, which lets the lanes be processed in parallel
+		(either by the compiler's vectorization or by the processor's instruction pipelining). The remainder is consumed a word, then a byte, at a time.
+		*/
+		inline u64 HashBytes(const void* _data, std::size_t _size, u64 _seed)
+		{
+			using P = HashPrimes;
+
+			const u8*       bytes = static_cast<const u8*>(_data);
+			const u8* const end   = bytes + _size                ;
+
+			u64 hash;
+
+			if (_size >= 32)
+			{
+				u64 lanes[4] = { _seed + P::Prime1 + P::Prime2, _seed + P::Prime2, _seed, _seed - P::Prime1 };
+
+				do
+				{
+					for (ui32 lane = 0; lane < 4; lane++)
+					{
+						u64 word;
+
+						std::memcpy(&word, bytes + lane * sizeof(u64), sizeof(u64));
+
+						lanes[lane] = P::Round(lanes[lane], word);
+					}
+
+					bytes += 32;
+				}
+				while (end - bytes >= 32);
+
+				hash = P::Rotate(lanes[0], 1) + P::Rotate(lanes[1], 7) + P::Rotate(lanes[2], 12) + P::Rotate(lanes[3], 18);
+
+				for (ui32 lane = 0; lane < 4; lane++)
+				{
+					hash = (hash ^ P::Round(0, lanes[lane])) * P::Prime1 + P::Prime4;
+				}
+			}
+			else
+			{
+				hash = _seed + P::Prime5;
+			}
+
+			hash += u64(_size);
+
+			for (; end - bytes >= 8; bytes += 8)
+			{
+				u64 word;
+
+				std::memcpy(&word, bytes, sizeof(u64));
+
+				hash = P::Rotate(hash ^ P::Round(0, word), 27) * P::Prime1 + P::Prime4;
+			}
+
+			for (; bytes < end; bytes++)
+			{
+				hash = P::Rotate(hash ^ (u64(*bytes) * P::Prime5), 11) * P::Prime1;
+			}
+
+			return P::Avalanche(hash);
+		}
+
+		/**
+		@brief Combines a value into a running hash. (Order dependent)
+		*/
+		inline u64 HashCombine(u64 _hash, u64 _value)
+		{
+			return HashPrimes::Rotate(_hash ^ HashPrimes::Round(0, _value), 27) * HashPrimes::Prime1 + HashPrimes::Prime4;
+		}
+
+		/** @} */
+	}
+
+	namespace Corridors
+	{
+		using V0::HashBytes  ;
+		using V0::HashCombine;
+	}
+
+	namespace V1
+	{
+		/**
+		@addtogroup Vault_1
+		@{
+		*/
+
+		/**
+		@brief Accumulates a structural hash of create info structures.
+
+		@details
+		Structures are added field by field: padding and pointer values never contribute to the hash, what the pointers reference does.
+		Arrays of structures without pointers or padding are hashed as a single block.
+
+		The hash agrees with StructComparer: structures that compare equal always produce the same hash.
+		*/
+		class StructHasher
+		{
+		public:
+
+			/**
+			@brief Default constructor.
+			*/
+			StructHasher() : hash(V0::HashPrimes::Prime5)
+			{}
+
+			/**
+			@brief Provides the hash of everything added so far.
+			*/
+			u64 GetHash() const
+			{
+				return V0::HashPrimes::Avalanche(hash);
+			}
+
+			// Create infos
+
+			void Add(const Buffer::CreateInfo& _info)
+			{
+				AddValue(_info.SType      );
+				AddChain(_info.Next       );
+				AddValue(_info.Flags      );
+				AddValue(_info.Size       );
+				AddValue(_info.Usage      );
+				AddValue(_info.SharingMode);
+
+				AddPacked(_info.QueueFamilyIndexCount, _info.QueueFamilyIndices);
+			}
+
+			void Add(const BufferView::CreateInfo& _info)
+			{
+				AddValue(_info.SType  );
+				AddChain(_info.Next   );
+				AddValue(_info.Flags  );
+				AddValue(_info.VBuffer);
+				AddValue(_info.Format );
+				AddValue(_info.Offset );
+				AddValue(_info.Range  );
+			}
+
+			void Add(const DescriptorPool::CreateInfo& _info)
+			{
+				AddValue(_info.SType  );
+				AddChain(_info.Next   );
+				AddValue(_info.Flags  );
+				AddValue(_info.MaxSets);
+
+				AddPacked(_info.PoolSizeCount, _info.PoolSizes);
+			}
+
+			void Add(const Framebuffer::CreateInfo& _info)
+			{
+				AddValue(_info.SType     );
+				AddChain(_info.Next      );
+				AddValue(_info.Flags     );
+				AddValue(_info.RenderPass);
+
+				AddPacked(_info.AttachmentCount, _info.Attachments);
+
+				AddValue(_info.Width );
+				AddValue(_info.Height);
+				AddValue(_info.Layers);
+			}
+
+			void Add(const Image::CreateInfo& _info)
+			{
+				AddValue (_info.SType       );
+				AddChain (_info.Next        );
+				AddValue (_info.Flags       );
+				AddValue (_info.ImageType   );
+				AddValue (_info.Format      );
+				AddPacked(1, &_info.Extent  );
+				AddValue (_info.MipmapLevels);
+				AddValue (_info.ArrayLayers );
+				AddValue (_info.Samples     );
+				AddValue (_info.Tiling      );
+				AddValue (_info.Usage       );
+				AddValue (_info.SharingMode );
+
+				AddPacked(_info.QueueFamilyIndexCount, _info.QueueFamilyIndices);
+
+				AddValue(_info.InitalLayout);
+			}
+
+			void Add(const ImageView::CreateInfo& _info)
+			{
+				AddValue (_info.SType   );
+				AddChain (_info.Next    );
+				AddValue (_info.Flags   );
+				AddValue (_info.Image   );
+				AddValue (_info.ViewType);
+				AddValue (_info.Format  );
+
+				AddPacked(1, &_info.Components      );
+				AddPacked(1, &_info.SubresourceRange);
+			}
+
+			void Add(const Pipeline::Compute::CreateInfo& _info)
+			{
+				AddValue(_info.SType             );
+				AddChain(_info.Next              );
+				AddValue(_info.Flags             );
+				Add     (_info.ShaderStage       );
+				AddValue(_info.Layout            );
+				AddValue(_info.BasePipelineHandle);
+				AddValue(_info.BasePipelineIndex );
+			}
+
+			void Add(const Pipeline::Graphics::CreateInfo& _info)
+			{
+				AddValue(_info.SType);
+				AddChain(_info.Next );
+				AddValue(_info.Flags);
+
+				AddArray(_info.StageCount, _info.Stages);
+
+				AddOptional(_info.VertexInputState  );
+				AddOptional(_info.InputAssemblyState);
+				AddOptional(_info.TessellationState );
+				AddOptional(_info.ViewportState     , _info.DynamicState);
+				AddOptional(_info.RasterizationState);
+				AddOptional(_info.MultisampleState  );
+				AddOptional(_info.DepthStencilState );
+				AddOptional(_info.ColorBlendState   );
+				AddOptional(_info.DynamicState      );
+
+				AddValue(_info.Layout            );
+				AddValue(_info.RenderPass        );
+				AddValue(_info.Subpass           );
+				AddValue(_info.BasePipelineHandle);
+				AddValue(_info.BasePipelineIndex );
+			}
+
+			void Add(const Pipeline::Layout::CreateInfo& _info)
+			{
+				AddValue(_info.SType);
+				AddChain(_info.Next );
+				AddValue(_info.Flags);
+
+				AddPacked(_info.SetLayoutCount        , _info.SetLayouts        );
+				AddPacked(_info.PushConstantRangeCount, _info.PushConstantRanges);
+			}
+
+			void Add(const Pipeline::Layout::DescriptorSet::CreateInfo& _info)
+			{
+				AddValue(_info.SType);
+				AddChain(_info.Next );
+				AddValue(_info.Flags);
+
+				AddArray(_info.BindingCount, _info.Bindings);
+			}
+
+			void Add(const RenderPass::CreateInfo& _info)
+			{
+				AddValue(_info.SType);
+				AddChain(_info.Next );
+				AddValue(_info.Flags);
+
+				AddPacked(_info.AttachmentCount, _info.Attachments );
+				AddArray (_info.SubpassCount   , _info.Subpasses   );
+				AddPacked(_info.DependencyCount, _info.Dependencies);
+			}
+
+			void Add(const Sampler::CreateInfo& _info)
+			{
+				AddValue(_info.SType                  );
+				AddChain(_info.Next                   );
+				AddValue(_info.Flags                  );
+				AddValue(_info.MagnificationFilter    );
+				AddValue(_info.MinimumFilter          );
+				AddValue(_info.MipmapMode             );
+				AddValue(_info.AddressModeU           );
+				AddValue(_info.AddressModeV           );
+				AddValue(_info.AddressModeW           );
+				AddValue(_info.MipLodBias             );
+				AddValue(_info.AnisotropyEnable       );
+				AddValue(_info.MaxAnisotropy          );
+				AddValue(_info.CompareEnable          );
+				AddValue(_info.CompareOperation       );
+				AddValue(_info.MinimumLod             );
+				AddValue(_info.MaxLod                 );
+				AddValue(_info.BorderColor            );
+				AddValue(_info.UnnormalizedCoordinates);
+			}
+
+			void Add(const ShaderModule::CreateInfo& _info)
+			{
+				AddValue(_info.SType);
+				AddChain(_info.Next );
+				AddValue(_info.Flags);
+
+				AddBytes(_info.Code, _info.CodeSize);
+			}
+
+			// Members of create infos
+
+			void Add(const Pipeline::ColorBlendState::CreateInfo& _info)
+			{
+				AddValue(_info.SType                );
+				AddChain(_info.Next                 );
+				AddValue(_info.Flags                );
+				AddValue(_info.EnableLogicOperations);
+				AddValue(_info.LogicOperation       );
+
+				AddPacked(_info.AttachmentCount, _info.Attachments   );
+				AddPacked(4                    , _info.BlendConstants);
+			}
+
+			void Add(const Pipeline::DepthStencilState::CreateInfo& _info)
+			{
+				AddValue (_info.SType                );
+				AddChain (_info.Next                 );
+				AddValue (_info.Flags                );
+				AddValue (_info.DepthTestEnable      );
+				AddValue (_info.DepthWriteEnable     );
+				AddValue (_info.DepthCompareOp       );
+				AddValue (_info.DepthBoundsTestEnable);
+				AddValue (_info.StencilTestEnable    );
+				AddPacked(1, &_info.Front            );
+				AddPacked(1, &_info.Back             );
+				AddValue (_info.MinDepthBounds       );
+				AddValue (_info.MaxDepthBounds       );
+			}
+
+			void Add(const Pipeline::DynamicState::CreateInfo& _info)
+			{
+				AddValue(_info.SType);
+				AddChain(_info.Next );
+				AddValue(_info.Flags);
+
+				AddPacked(_info.StateCount, _info.States);
+			}
+
+			void Add(const Pipeline::InputAssemblyState::CreateInfo& _info)
+			{
+				AddValue(_info.SType                 );
+				AddChain(_info.Next                  );
+				AddValue(_info.Flags                 );
+				AddValue(_info.Topology              );
+				AddValue(_info.PrimitiveRestartEnable);
+			}
+
+			void Add(const Pipeline::Layout::DescriptorSet::Binding& _binding)
+			{
+				AddValue(_binding.BindingID );
+				AddValue(_binding.Type      );
+				AddValue(_binding.Count     );
+				AddValue(_binding.StageFlags);
+
+				// Only sampler bindings read their immutable samplers, the pointer of any other binding is ignored (and may be garbage).
+				if (TakesImmutableSamplers(_binding.Type)) AddPacked(_binding.Count, _binding.ImmutableSamplers);
+			}
+
+			void Add(const Pipeline::MultiSampleState::CreateInfo& _info)
+			{
+				AddValue(_info.SType               );
+				AddChain(_info.Next                );
+				AddValue(_info.Flags               );
+				AddValue(_info.RasterizationSamples);
+				AddValue(_info.EnableSampleShading );
+				AddValue(_info.MinSampleShading    );
+
+				AddPacked(GetSampleMaskCount(_info.RasterizationSamples), _info.SampleMask);
+
+				AddValue(_info.EnableAlphaToCoverage);
+				AddValue(_info.EnableAlphaToOne     );
+			}
+
+			void Add(const Pipeline::RasterizationState::CreateInfo& _info)
+			{
+				AddValue(_info.SType                  );
+				AddChain(_info.Next                   );
+				AddValue(_info.Flags                  );
+				AddValue(_info.EnableDepthClamp       );
+				AddValue(_info.EnableRasterizerDiscard);
+				AddValue(_info.PolygonMode            );
+				AddValue(_info.CullMode               );
+				AddValue(_info.FrontFace              );
+				AddValue(_info.EnableDepthBias        );
+				AddValue(_info.DepthBiasConstantFactor);
+				AddValue(_info.DepthBiasClamp         );
+				AddValue(_info.DepthBiasSlopeFactor   );
+				AddValue(_info.LineWidth              );
+			}
+
+			void Add(const Pipeline::ShaderStage::CreateInfo& _info)
+			{
+				AddValue   (_info.SType         );
+				AddChain   (_info.Next          );
+				AddValue   (_info.Flags         );
+				AddValue   (_info.Stage         );
+				AddValue   (_info.Module        );
+				AddString  (_info.Name          );
+				AddOptional(_info.Specialization);
+			}
+
+			void Add(const Pipeline::Specialization::Info& _info)
+			{
+				AddPacked(_info.MapEntryCount, _info.MapEntires);
+				AddBytes (_info.Data         , _info.SizeOfData);
+			}
+
+			void Add(const Pipeline::TessellationState::CreateInfo& _info)
+			{
+				AddValue(_info.SType             );
+				AddChain(_info.Next              );
+				AddValue(_info.Flags             );
+				AddValue(_info.PatchControlPoints);
+			}
+
+			void Add(const Pipeline::VertexInputState::CreateInfo& _info)
+			{
+				AddValue(_info.SType);
+				AddChain(_info.Next );
+				AddValue(_info.Flags);
+
+				AddPacked(_info.BindingDescriptionCount  , _info.BindingDescriptions  );
+				AddPacked(_info.AttributeDescriptionCount, _info.AttributeDescriptions);
+			}
+
+			void Add(const Pipeline::ViewportState::CreateInfo& _info, const Pipeline::DynamicState::CreateInfo* _dynamicState)
+			{
+				AddValue(_info.SType);
+				AddChain(_info.Next );
+				AddValue(_info.Flags);
+
+				// The arrays are ignored (and may be garbage) when the viewports or scissors are dynamic state, the counts are still used.
+				if (HasDynamicState(_dynamicState, EDynamicState::Viewport)) AddValue(_info.ViewportCount);
+				else                                                         AddPacked(_info.ViewportCount, _info.Viewports);
+
+				if (HasDynamicState(_dynamicState, EDynamicState::Scissor)) AddValue(_info.ScissorCount);
+				else                                                        AddPacked(_info.ScissorCount , _info.Scissors );
+			}
+
+			void Add(const RenderPass::SubpassDescription& _subpass)
+			{
+				AddValue(_subpass.Flags            );
+				AddValue(_subpass.PipelineBindPoint);
+
+				AddPacked(_subpass.InputAttachmentCount   , _subpass.InputAttachments      );
+				AddPacked(_subpass.ColorAttachmentCount   , _subpass.ColorAttachments      );
+				AddPacked(_subpass.ColorAttachmentCount   , _subpass.ResolveAttachments    );
+				AddPacked(1                               , _subpass.DepthStencilAttachment);
+				AddPacked(_subpass.PreserveAttachmentCount, _subpass.PreserveAttachments   );
+			}
+
+			// Building blocks
+
+			/**
+			@brief Adds an array of structures that contain neither pointers nor padding as a single block.
+			(A null array only contributes its count)
+			*/
+			template<typename Type>
+			void AddPacked(ui32 _count, const Type* _entries)
+			{
+				static_assert(std::is_trivially_copyable<Type>::value, "Packed entries must be trivially copyable.");
+
+				AddValue(_count);
+
+				if (_count == 0) return;
+
+				if (_entries == nullptr)
+				{
+					hash = HashCombine(hash, 0);
+
+					return;
+				}
+
+				hash = HashCombine(hash, HashBytes(_entries, sizeof(Type) * _count, V0::HashPrimes::Prime3));
+			}
+
+			/**
+			@brief Adds an array of structures that are added member by member.
+			*/
+			template<typename Type>
+			void AddArray(ui32 _count, const Type* _entries)
+			{
+				AddValue(_count);
+
+				if (_count == 0) return;
+
+				if (_entries == nullptr)
+				{
+					hash = HashCombine(hash, 0);
+
+					return;
+				}
+
+				for (ui32 index = 0; index < _count; index++) Add(_entries[index]);
+			}
+
+			/**
+			@brief Adds a block of bytes. (Null data is treated as empty)
+			*/
+			void AddBytes(const void* _data, std::size_t _size)
+			{
+				if (_data == nullptr) _size = 0;
+
+				hash = HashCombine(hash, HashBytes(_data, _size, V0::HashPrimes::Prime3));
+			}
+
+			/**
+			@brief Adds the structures chained to a Next member.
+			*/
+			void AddChain(const void* _next)
+			{
+				for (const VkBaseInStructure* link = static_cast<const VkBaseInStructure*>(_next); link != nullptr; link = link->pNext)
+				{
+					AddValue(link->sType);
+
+					switch (EStructureType(link->sType))
+					{
+						case EStructureType::Descriptor_SetLayoutBindingFlags_CreateInfo:
+						{
+							using FlagsCreateInfo = Pipeline::Layout::DescriptorSet::Binding::FlagsCreateInfo;
+
+							const FlagsCreateInfo& flagsInfo = *reinterpret_cast<const FlagsCreateInfo*>(link);
+
+							AddPacked(flagsInfo.BindingCount, flagsInfo.BindingFlags);
+
+							break;
+						}
+						default:
+						{
+							// Unknown structures can only be identified by their address.
+							AddValue(link);
+
+							break;
+						}
+					}
+				}
+
+				hash = HashCombine(hash, 0);
+			}
+
+			/**
+			@brief Adds a structure referenced by a pointer that may be null.
+			*/
+			template<typename Type, typename... Context>
+			void AddOptional(const Type* _structure, const Context&... _context)
+			{
+				if (_structure == nullptr)
+				{
+					hash = HashCombine(hash, 0);
+
+					return;
+				}
+
+				hash = HashCombine(hash, 1);
+
+				Add(*_structure, _context...);
+			}
+
+			/**
+			@brief Adds a null-terminated string. (Null is treated as empty)
+			*/
+			void AddString(RoCStr _string)
+			{
+				AddBytes(_string, _string != nullptr ? std::strlen(_string) : 0);
+			}
+
+			/**
+			@brief Adds a value (integer, enum, flags, handle, float) by its bits.
+			*/
+			template<typename Type>
+			void AddValue(const Type& _value)
+			{
+				static_assert(std::is_trivially_copyable<Type>::value && sizeof(Type) <= sizeof(u64), "Values must be trivially copyable and fit in 64 bits.");
+
+				u64 bits = 0;
+
+				std::memcpy(&bits, &_value, sizeof(Type));
+
+				hash = HashCombine(hash, bits);
+			}
+
+			/**
+			@brief Provides the amount of sample mask words used by a multisample state.
+			*/
+			static ui32 GetSampleMaskCount(ESampleCount _samples)
+			{
+				return (ui32(_samples) + 31) / 32;
+			}
+
+			/**
+			@brief Whether the dynamic state info (which may be null) lists the state given.
+			*/
+			static bool HasDynamicState(const Pipeline::DynamicState::CreateInfo* _info, EDynamicState _state)
+			{
+				if (_info == nullptr || _info->States == nullptr) return false;
+
+				return std::find(_info->States, _info->States + _info->StateCount, _state) != _info->States + _info->StateCount;
+			}
+
+			/**
+			@brief Whether a binding of the type given reads its immutable samplers.
+			*/
+			static bool TakesImmutableSamplers(EDescriptorType _type)
+			{
+				return _type == EDescriptorType::Sampler || _type == EDescriptorType::CombinedImageSampler;
+			}
+
+		protected:
+
+			u64 hash;
+		};
+
+		/**
+		@brief Compares create info structures member by member, following their pointers.
+
+		@details Values are compared by their bits, so floats compare as the hasher sees them (-0 and 0 differ, a NaN equals itself).
+		*/
+		class StructComparer
+		{
+		public:
+
+			// Create infos
+
+			static bool Equal(const Buffer::CreateInfo& _left, const Buffer::CreateInfo& _right)
+			{
+				return
+					EqualValue (_left.SType      , _right.SType      ) &&
+					EqualChain (_left.Next       , _right.Next       ) &&
+					EqualValue (_left.Flags      , _right.Flags      ) &&
+					EqualValue (_left.Size       , _right.Size       ) &&
+					EqualValue (_left.Usage      , _right.Usage      ) &&
+					EqualValue (_left.SharingMode, _right.SharingMode) &&
+					EqualPacked(_left.QueueFamilyIndexCount, _left.QueueFamilyIndices, _right.QueueFamilyIndexCount, _right.QueueFamilyIndices);
+			}
+
+			static bool Equal(const BufferView::CreateInfo& _left, const BufferView::CreateInfo& _right)
+			{
+				return
+					EqualValue(_left.SType  , _right.SType  ) &&
+					EqualChain(_left.Next   , _right.Next   ) &&
+					EqualValue(_left.Flags  , _right.Flags  ) &&
+					EqualValue(_left.VBuffer, _right.VBuffer) &&
+					EqualValue(_left.Format , _right.Format ) &&
+					EqualValue(_left.Offset , _right.Offset ) &&
+					EqualValue(_left.Range  , _right.Range  );
+			}
+
+			static bool Equal(const DescriptorPool::CreateInfo& _left, const DescriptorPool::CreateInfo& _right)
+			{
+				return
+					EqualValue (_left.SType  , _right.SType  ) &&
+					EqualChain (_left.Next   , _right.Next   ) &&
+					EqualValue (_left.Flags  , _right.Flags  ) &&
+					EqualValue (_left.MaxSets, _right.MaxSets) &&
+					EqualPacked(_left.PoolSizeCount, _left.PoolSizes, _right.PoolSizeCount, _right.PoolSizes);
+			}
+
+			static bool Equal(const Framebuffer::CreateInfo& _left, const Framebuffer::CreateInfo& _right)
+			{
+				return
+					EqualValue (_left.SType     , _right.SType     ) &&
+					EqualChain (_left.Next      , _right.Next      ) &&
+					EqualValue (_left.Flags     , _right.Flags     ) &&
+					EqualValue (_left.RenderPass, _right.RenderPass) &&
+					EqualPacked(_left.AttachmentCount, _left.Attachments, _right.AttachmentCount, _right.Attachments) &&
+					EqualValue (_left.Width     , _right.Width     ) &&
+					EqualValue (_left.Height    , _right.Height    ) &&
+					EqualValue (_left.Layers    , _right.Layers    );
+			}
+
+			static bool Equal(const Image::CreateInfo& _left, const Image::CreateInfo& _right)
+			{
+				return
+					EqualValue (_left.SType       , _right.SType       ) &&
+					EqualChain (_left.Next        , _right.Next        ) &&
+					EqualValue (_left.Flags       , _right.Flags       ) &&
+					EqualValue (_left.ImageType   , _right.ImageType   ) &&
+					EqualValue (_left.Format      , _right.Format      ) &&
+					EqualPacked(1, &_left.Extent  , 1, &_right.Extent  ) &&
+					EqualValue (_left.MipmapLevels, _right.MipmapLevels) &&
+					EqualValue (_left.ArrayLayers , _right.ArrayLayers ) &&
+					EqualValue (_left.Samples     , _right.Samples     ) &&
+					EqualValue (_left.Tiling      , _right.Tiling      ) &&
+					EqualValue (_left.Usage       , _right.Usage       ) &&
+					EqualValue (_left.SharingMode , _right.SharingMode ) &&
+					EqualPacked(_left.QueueFamilyIndexCount, _left.QueueFamilyIndices, _right.QueueFamilyIndexCount, _right.QueueFamilyIndices) &&
+					EqualValue (_left.InitalLayout, _right.InitalLayout);
+			}
+
+			static bool Equal(const ImageView::CreateInfo& _left, const ImageView::CreateInfo& _right)
+			{
+				return
+					EqualValue (_left.SType   , _right.SType   ) &&
+					EqualChain (_left.Next    , _right.Next    ) &&
+					EqualValue (_left.Flags   , _right.Flags   ) &&
+					EqualValue (_left.Image   , _right.Image   ) &&
+					EqualValue (_left.ViewType, _right.ViewType) &&
+					EqualValue (_left.Format  , _right.Format  ) &&
+					EqualPacked(1, &_left.Components      , 1, &_right.Components      ) &&
+					EqualPacked(1, &_left.SubresourceRange, 1, &_right.SubresourceRange);
+			}
+
+			static bool Equal(const Pipeline::Compute::CreateInfo& _left, const Pipeline::Compute::CreateInfo& _right)
+			{
+				return
+					EqualValue(_left.SType             , _right.SType             ) &&
+					EqualChain(_left.Next              , _right.Next              ) &&
+					EqualValue(_left.Flags             , _right.Flags             ) &&
+					Equal     (_left.ShaderStage       , _right.ShaderStage       ) &&
+					EqualValue(_left.Layout            , _right.Layout            ) &&
+					EqualValue(_left.BasePipelineHandle, _right.BasePipelineHandle) &&
+					EqualValue(_left.BasePipelineIndex , _right.BasePipelineIndex );
+			}
+
+			static bool Equal(const Pipeline::Graphics::CreateInfo& _left, const Pipeline::Graphics::CreateInfo& _right)
+			{
+				return
+					EqualValue   (_left.SType, _right.SType) &&
+					EqualChain   (_left.Next , _right.Next ) &&
+					EqualValue   (_left.Flags, _right.Flags) &&
+					EqualArray   (_left.StageCount, _left.Stages, _right.StageCount, _right.Stages) &&
+					EqualOptional(_left.VertexInputState  , _right.VertexInputState  ) &&
+					EqualOptional(_left.InputAssemblyState, _right.InputAssemblyState) &&
+					EqualOptional(_left.TessellationState , _right.TessellationState ) &&
+					EqualOptional(_left.ViewportState     , _right.ViewportState     , _left.DynamicState, _right.DynamicState) &&
+					EqualOptional(_left.RasterizationState, _right.RasterizationState) &&
+					EqualOptional(_left.MultisampleState  , _right.MultisampleState  ) &&
+					EqualOptional(_left.DepthStencilState , _right.DepthStencilState ) &&
+					EqualOptional(_left.ColorBlendState   , _right.ColorBlendState   ) &&
+					EqualOptional(_left.DynamicState      , _right.DynamicState      ) &&
+					EqualValue   (_left.Layout            , _right.Layout            ) &&
+					EqualValue   (_left.RenderPass        , _right.RenderPass        ) &&
+					EqualValue   (_left.Subpass           , _right.Subpass           ) &&
+					EqualValue   (_left.BasePipelineHandle, _right.BasePipelineHandle) &&
+					EqualValue   (_left.BasePipelineIndex , _right.BasePipelineIndex );
+			}
+
+			static bool Equal(const Pipeline::Layout::CreateInfo& _left, const Pipeline::Layout::CreateInfo& _right)
+			{
+				return
+					EqualValue (_left.SType, _right.SType) &&
+					EqualChain (_left.Next , _right.Next ) &&
+					EqualValue (_left.Flags, _right.Flags) &&
+					EqualPacked(_left.SetLayoutCount        , _left.SetLayouts        , _right.SetLayoutCount        , _right.SetLayouts        ) &&
+					EqualPacked(_left.PushConstantRangeCount, _left.PushConstantRanges, _right.PushConstantRangeCount, _right.PushConstantRanges);
+			}
+
+			static bool Equal(const Pipeline::Layout::DescriptorSet::CreateInfo& _left, const Pipeline::Layout::DescriptorSet::CreateInfo& _right)
+			{
+				return
+					EqualValue(_left.SType, _right.SType) &&
+					EqualChain(_left.Next , _right.Next ) &&
+					EqualValue(_left.Flags, _right.Flags) &&
+					EqualArray(_left.BindingCount, _left.Bindings, _right.BindingCount, _right.Bindings);
+			}
+
+			static bool Equal(const RenderPass::CreateInfo& _left, const RenderPass::CreateInfo& _right)
+			{
+				return
+					EqualValue (_left.SType, _right.SType) &&
+					EqualChain (_left.Next , _right.Next ) &&
+					EqualValue (_left.Flags, _right.Flags) &&
+					EqualPacked(_left.AttachmentCount, _left.Attachments , _right.AttachmentCount, _right.Attachments ) &&
+					EqualArray (_left.SubpassCount   , _left.Subpasses   , _right.SubpassCount   , _right.Subpasses   ) &&
+					EqualPacked(_left.DependencyCount, _left.Dependencies, _right.DependencyCount, _right.Dependencies);
+			}
+
+			static bool Equal(const Sampler::CreateInfo& _left, const Sampler::CreateInfo& _right)
+			{
+				return
+					EqualValue(_left.SType                  , _right.SType                  ) &&
+					EqualChain(_left.Next                   , _right.Next                   ) &&
+					EqualValue(_left.Flags                  , _right.Flags                  ) &&
+					EqualValue(_left.MagnificationFilter    , _right.MagnificationFilter    ) &&
+					EqualValue(_left.MinimumFilter          , _right.MinimumFilter          ) &&
+					EqualValue(_left.MipmapMode             , _right.MipmapMode             ) &&
+					EqualValue(_left.AddressModeU           , _right.AddressModeU           ) &&
+					EqualValue(_left.AddressModeV           , _right.AddressModeV           ) &&
+					EqualValue(_left.AddressModeW           , _right.AddressModeW           ) &&
+					EqualValue(_left.MipLodBias             , _right.MipLodBias             ) &&
+					EqualValue(_left.AnisotropyEnable       , _right.AnisotropyEnable       ) &&
+					EqualValue(_left.MaxAnisotropy          , _right.MaxAnisotropy          ) &&
+					EqualValue(_left.CompareEnable          , _right.CompareEnable          ) &&
+					EqualValue(_left.CompareOperation       , _right.CompareOperation       ) &&
+					EqualValue(_left.MinimumLod             , _right.MinimumLod             ) &&
+					EqualValue(_left.MaxLod                 , _right.MaxLod                 ) &&
+					EqualValue(_left.BorderColor            , _right.BorderColor            ) &&
+					EqualValue(_left.UnnormalizedCoordinates, _right.UnnormalizedCoordinates);
+			}
+
+			static bool Equal(const ShaderModule::CreateInfo& _left, const ShaderModule::CreateInfo& _right)
+			{
+				return
+					EqualValue(_left.SType, _right.SType) &&
+					EqualChain(_left.Next , _right.Next ) &&
+					EqualValue(_left.Flags, _right.Flags) &&
+					EqualBytes(_left.Code, _left.CodeSize, _right.Code, _right.CodeSize);
+			}
+
+			// Members of create infos
+
+			static bool Equal(const Pipeline::ColorBlendState::CreateInfo& _left, const Pipeline::ColorBlendState::CreateInfo& _right)
+			{
+				return
+					EqualValue (_left.SType                , _right.SType                ) &&
+					EqualChain (_left.Next                 , _right.Next                 ) &&
+					EqualValue (_left.Flags                , _right.Flags                ) &&
+					EqualValue (_left.EnableLogicOperations, _right.EnableLogicOperations) &&
+					EqualValue (_left.LogicOperation       , _right.LogicOperation       ) &&
+					EqualPacked(_left.AttachmentCount, _left.Attachments   , _right.AttachmentCount, _right.Attachments   ) &&
+					EqualPacked(4                    , _left.BlendConstants, 4                     , _right.BlendConstants);
+			}
+
+			static bool Equal(const Pipeline::DepthStencilState::CreateInfo& _left, const Pipeline::DepthStencilState::CreateInfo& _right)
+			{
+				return
+					EqualValue (_left.SType                , _right.SType                ) &&
+					EqualChain (_left.Next                 , _right.Next                 ) &&
+					EqualValue (_left.Flags                , _right.Flags                ) &&
+					EqualValue (_left.DepthTestEnable      , _right.DepthTestEnable      ) &&
+					EqualValue (_left.DepthWriteEnable     , _right.DepthWriteEnable     ) &&
+					EqualValue (_left.DepthCompareOp       , _right.DepthCompareOp       ) &&
+					EqualValue (_left.DepthBoundsTestEnable, _right.DepthBoundsTestEnable) &&
+					EqualValue (_left.StencilTestEnable    , _right.StencilTestEnable    ) &&
+					EqualPacked(1, &_left.Front, 1, &_right.Front) &&
+					EqualPacked(1, &_left.Back , 1, &_right.Back ) &&
+					EqualValue (_left.MinDepthBounds       , _right.MinDepthBounds       ) &&
+					EqualValue (_left.MaxDepthBounds       , _right.MaxDepthBounds       );
+			}
+
+			static bool Equal(const Pipeline::DynamicState::CreateInfo& _left, const Pipeline::DynamicState::CreateInfo& _right)
+			{
+				return
+					EqualValue (_left.SType, _right.SType) &&
+					EqualChain (_left.Next , _right.Next ) &&
+					EqualValue (_left.Flags, _right.Flags) &&
+					EqualPacked(_left.StateCount, _left.States, _right.StateCount, _right.States);
+			}
+
+			static bool Equal(const Pipeline::InputAssemblyState::CreateInfo& _left, const Pipeline::InputAssemblyState::CreateInfo& _right)
+			{
+				return
+					EqualValue(_left.SType                 , _right.SType                 ) &&
+					EqualChain(_left.Next                  , _right.Next                  ) &&
+					EqualValue(_left.Flags                 , _right.Flags                 ) &&
+					EqualValue(_left.Topology              , _right.Topology              ) &&
+					EqualValue(_left.PrimitiveRestartEnable, _right.PrimitiveRestartEnable);
+			}
+
+			static bool Equal(const Pipeline::Layout::DescriptorSet::Binding& _left, const Pipeline::Layout::DescriptorSet::Binding& _right)
+			{
+				return
+					EqualValue (_left.BindingID , _right.BindingID ) &&
+					EqualValue (_left.Type      , _right.Type      ) &&
+					EqualValue (_left.Count     , _right.Count     ) &&
+					EqualValue (_left.StageFlags, _right.StageFlags) &&
+					(
+						!StructHasher::TakesImmutableSamplers(_left.Type) ||
+						EqualPacked(_left.Count, _left.ImmutableSamplers, _right.Count, _right.ImmutableSamplers)
+					);
+			}
+
+			static bool Equal(const Pipeline::MultiSampleState::CreateInfo& _left, const Pipeline::MultiSampleState::CreateInfo& _right)
+			{
+				return
+					EqualValue (_left.SType               , _right.SType               ) &&
+					EqualChain (_left.Next                , _right.Next                ) &&
+					EqualValue (_left.Flags               , _right.Flags               ) &&
+					EqualValue (_left.RasterizationSamples, _right.RasterizationSamples) &&
+					EqualValue (_left.EnableSampleShading , _right.EnableSampleShading ) &&
+					EqualValue (_left.MinSampleShading    , _right.MinSampleShading    ) &&
+					EqualPacked
+					(
+						StructHasher::GetSampleMaskCount(_left .RasterizationSamples), _left .SampleMask,
+						StructHasher::GetSampleMaskCount(_right.RasterizationSamples), _right.SampleMask
+					) &&
+					EqualValue (_left.EnableAlphaToCoverage, _right.EnableAlphaToCoverage) &&
+					EqualValue (_left.EnableAlphaToOne     , _right.EnableAlphaToOne     );
+			}
+
+			static bool Equal(const Pipeline::RasterizationState::CreateInfo& _left, const Pipeline::RasterizationState::CreateInfo& _right)
+			{
+				return
+					EqualValue(_left.SType                  , _right.SType                  ) &&
+					EqualChain(_left.Next                   , _right.Next                   ) &&
+					EqualValue(_left.Flags                  , _right.Flags                  ) &&
+					EqualValue(_left.EnableDepthClamp       , _right.EnableDepthClamp       ) &&
+					EqualValue(_left.EnableRasterizerDiscard, _right.EnableRasterizerDiscard) &&
+					EqualValue(_left.PolygonMode            , _right.PolygonMode            ) &&
+					EqualValue(_left.CullMode               , _right.CullMode               ) &&
+					EqualValue(_left.FrontFace              , _right.FrontFace              ) &&
+					EqualValue(_left.EnableDepthBias        , _right.EnableDepthBias        ) &&
+					EqualValue(_left.DepthBiasConstantFactor, _right.DepthBiasConstantFactor) &&
+					EqualValue(_left.DepthBiasClamp         , _right.DepthBiasClamp         ) &&
+					EqualValue(_left.DepthBiasSlopeFactor   , _right.DepthBiasSlopeFactor   ) &&
+					EqualValue(_left.LineWidth              , _right.LineWidth              );
+			}
+
+			static bool Equal(const Pipeline::ShaderStage::CreateInfo& _left, const Pipeline::ShaderStage::CreateInfo& _right)
+			{
+				return
+					EqualValue   (_left.SType         , _right.SType         ) &&
+					EqualChain   (_left.Next          , _right.Next          ) &&
+					EqualValue   (_left.Flags         , _right.Flags         ) &&
+					EqualValue   (_left.Stage         , _right.Stage         ) &&
+					EqualValue   (_left.Module        , _right.Module        ) &&
+					EqualString  (_left.Name          , _right.Name          ) &&
+					EqualOptional(_left.Specialization, _right.Specialization);
+			}
+
+			static bool Equal(const Pipeline::Specialization::Info& _left, const Pipeline::Specialization::Info& _right)
+			{
+				return
+					EqualPacked(_left.MapEntryCount, _left.MapEntires, _right.MapEntryCount, _right.MapEntires) &&
+					EqualBytes (_left.Data, _left.SizeOfData, _right.Data, _right.SizeOfData);
+			}
+
+			static bool Equal(const Pipeline::TessellationState::CreateInfo& _left, const Pipeline::TessellationState::CreateInfo& _right)
+			{
+				return
+					EqualValue(_left.SType             , _right.SType             ) &&
+					EqualChain(_left.Next              , _right.Next              ) &&
+					EqualValue(_left.Flags             , _right.Flags             ) &&
+					EqualValue(_left.PatchControlPoints, _right.PatchControlPoints);
+			}
+
+			static bool Equal(const Pipeline::VertexInputState::CreateInfo& _left, const Pipeline::VertexInputState::CreateInfo& _right)
+			{
+				return
+					EqualValue (_left.SType, _right.SType) &&
+					EqualChain (_left.Next , _right.Next ) &&
+					EqualValue (_left.Flags, _right.Flags) &&
+					EqualPacked(_left.BindingDescriptionCount  , _left.BindingDescriptions  , _right.BindingDescriptionCount  , _right.BindingDescriptions  ) &&
+					EqualPacked(_left.AttributeDescriptionCount, _left.AttributeDescriptions, _right.AttributeDescriptionCount, _right.AttributeDescriptions);
+			}
+
+			static bool Equal
+			(
+				const Pipeline::ViewportState::CreateInfo& _left       , const Pipeline::ViewportState::CreateInfo& _right       ,
+				const Pipeline::DynamicState::CreateInfo*  _leftDynamic, const Pipeline::DynamicState::CreateInfo*  _rightDynamic
+			)
+			{
+				const bool dynamicViewports = StructHasher::HasDynamicState(_leftDynamic, EDynamicState::Viewport);
+				const bool dynamicScissors  = StructHasher::HasDynamicState(_leftDynamic, EDynamicState::Scissor );
+
+				// The dynamic states differ: the arrays of one side may not be read.
+				if (dynamicViewports != StructHasher::HasDynamicState(_rightDynamic, EDynamicState::Viewport)) return false;
+				if (dynamicScissors  != StructHasher::HasDynamicState(_rightDynamic, EDynamicState::Scissor )) return false;
+
+				return
+					EqualValue(_left.SType        , _right.SType        ) &&
+					EqualChain(_left.Next         , _right.Next         ) &&
+					EqualValue(_left.Flags        , _right.Flags        ) &&
+					EqualValue(_left.ViewportCount, _right.ViewportCount) &&
+					EqualValue(_left.ScissorCount , _right.ScissorCount ) &&
+					(dynamicViewports || EqualPacked(_left.ViewportCount, _left.Viewports, _right.ViewportCount, _right.Viewports)) &&
+					(dynamicScissors  || EqualPacked(_left.ScissorCount , _left.Scissors , _right.ScissorCount , _right.Scissors ));
+			}
+
+			static bool Equal(const RenderPass::SubpassDescription& _left, const RenderPass::SubpassDescription& _right)
+			{
+				return
+					EqualValue (_left.Flags            , _right.Flags            ) &&
+					EqualValue (_left.PipelineBindPoint, _right.PipelineBindPoint) &&
+					EqualPacked(_left.InputAttachmentCount   , _left.InputAttachments      , _right.InputAttachmentCount   , _right.InputAttachments      ) &&
+					EqualPacked(_left.ColorAttachmentCount   , _left.ColorAttachments      , _right.ColorAttachmentCount   , _right.ColorAttachments      ) &&
+					EqualPacked(_left.ColorAttachmentCount   , _left.ResolveAttachments    , _right.ColorAttachmentCount   , _right.ResolveAttachments    ) &&
+					EqualPacked(1                            , _left.DepthStencilAttachment, 1                             , _right.DepthStencilAttachment) &&
+					EqualPacked(_left.PreserveAttachmentCount, _left.PreserveAttachments   , _right.PreserveAttachmentCount, _right.PreserveAttachments   );
+			}
+
+			// Building blocks
+
+			/**
+			@brief Compares arrays of structures that contain neither pointers nor padding as single blocks.
+			*/
+			template<typename Type>
+			static bool EqualPacked(ui32 _leftCount, const Type* _left, ui32 _rightCount, const Type* _right)
+			{
+				if (_leftCount != _rightCount) return false;
+
+				if (_leftCount == 0 || _left == _right) return true;
+
+				if (_left == nullptr || _right == nullptr) return false;
+
+				return std::memcmp(_left, _right, sizeof(Type) * _leftCount) == 0;
+			}
+
+			/**
+			@brief Compares arrays of structures member by member.
+			*/
+			template<typename Type>
+			static bool EqualArray(ui32 _leftCount, const Type* _left, ui32 _rightCount, const Type* _right)
+			{
+				if (_leftCount != _rightCount) return false;
+
+				if (_leftCount == 0 || _left == _right) return true;
+
+				if (_left == nullptr || _right == nullptr) return false;
+
+				for (ui32 index = 0; index < _leftCount; index++)
+				{
+					if (!Equal(_left[index], _right[index])) return false;
+				}
+
+				return true;
+			}
+
+			/**
+			@brief Compares blocks of bytes. (Null data is treated as empty)
+			*/
+			static bool EqualBytes(const void* _left, std::size_t _leftSize, const void* _right, std::size_t _rightSize)
+			{
+				if (_left  == nullptr) _leftSize  = 0;
+				if (_right == nullptr) _rightSize = 0;
+
+				if (_leftSize != _rightSize) return false;
+
+				return _leftSize == 0 || _left == _right || std::memcmp(_left, _right, _leftSize) == 0;
+			}
+
+			/**
+			@brief Compares the structures chained to Next members.
+			*/
+			static bool EqualChain(const void* _left, const void* _right)
+			{
+				const VkBaseInStructure* left  = static_cast<const VkBaseInStructure*>(_left );
+				const VkBaseInStructure* right = static_cast<const VkBaseInStructure*>(_right);
+
+				for (; left != nullptr && right != nullptr; left = left->pNext, right = right->pNext)
+				{
+					if (left->sType != right->sType) return false;
+
+					switch (EStructureType(left->sType))
+					{
+						case EStructureType::Descriptor_SetLayoutBindingFlags_CreateInfo:
+						{
+							using FlagsCreateInfo = Pipeline::Layout::DescriptorSet::Binding::FlagsCreateInfo;
+
+							const FlagsCreateInfo& leftFlags  = *reinterpret_cast<const FlagsCreateInfo*>(left );
+							const FlagsCreateInfo& rightFlags = *reinterpret_cast<const FlagsCreateInfo*>(right);
+
+							if (!EqualPacked(leftFlags.BindingCount, leftFlags.BindingFlags, rightFlags.BindingCount, rightFlags.BindingFlags))
+								return false;
+
+							break;
+						}
+						default:
+						{
+							if (left != right) return false;
+
+							break;
+						}
+					}
+				}
+
+				return left == right;
+			}
+
+			/**
+			@brief Compares structures referenced by pointers that may be null.
+			*/
+			template<typename Type, typename... Context>
+			static bool EqualOptional(const Type* _left, const Type* _right, const Context&... _context)
+			{
+				if (_left == _right) return true;
+
+				if (_left == nullptr || _right == nullptr) return false;
+
+				return Equal(*_left, *_right, _context...);
+			}
+
+			/**
+			@brief Compares null-terminated strings. (Null is treated as empty)
+			*/
+			static bool EqualString(RoCStr _left, RoCStr _right)
+			{
+				return std::strcmp(_left != nullptr ? _left : "", _right != nullptr ? _right : "") == 0;
+			}
+
+			/**
+			@brief Compares values by their bits.
+			*/
+			template<typename Type>
+			static bool EqualValue(const Type& _left, const Type& _right)
+			{
+				static_assert(std::is_trivially_copyable<Type>::value, "Values must be trivially copyable.");
+
+				return std::memcmp(&_left, &_right, sizeof(Type)) == 0;
+			}
+		};
+
+		/**
+		@brief Hash function object for unordered containers keyed by create infos.
+		*/
+		template<typename InfoType>
+		struct StructHash
+		{
+			std::size_t operator() (const InfoType& _info) const
+			{
+				StructHasher hasher;
+
+				hasher.Add(_info);
+
+				return std::size_t(hasher.GetHash());
+			}
+		};
+
+		/**
+		@brief Equality function object for unordered containers keyed by create infos.
+		*/
+		template<typename InfoType>
+		struct StructEqual
+		{
+			bool operator() (const InfoType& _left, const InfoType& _right) const
+			{
+				return StructComparer::Equal(_left, _right);
+			}
+		};
+
+		/** @} */
+	}
+}
@@ -724,7 +724,7 @@ namespace VualtedVulkan
 			 * \param _fenceCount
 			 * \return 
 			 */
-			static EResult Reset(LogicalDevice::Handle _logicalDevice, Handle* _fences, ui32 _fenceCount)
+			static EResult Reset(LogicalDevice::Handle _logicalDevice, const Handle* _fences, ui32 _fenceCount)
 			{
 				return EResult(vkResetFences(_logicalDevice, _fenceCount, _fences));
 			}
@@ -803,10 +803,10 @@ namespace VualtedVulkan
 			/** @brief <a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#VkSemaphoreTypeCreateInfo">Specification</a> @ingroup APISpec_Synchronization_and_Cache_Control */
 			struct TypeSpecifiedCreateInfo : V0::VKStruct_Base<VkSemaphoreTypeCreateInfo, EStructureType::SemaphoreType_CreateInfo>
 			{
-				      EType  SType         = STypeEnum;
-				const void*  Next          = nullptr  ;
-				      Handle SemaphoreType;
-				      u64   InitialValue ;
+				      EType          SType         = STypeEnum;
+				const void*          Next          = nullptr  ;
+				      ESemaphoreType SemaphoreType;
+				      u64            InitialValue ;
 			};
 
 			/** @brief <a href="https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#VkSemaphoreWaitInfo">Specification</a> @ingroup APISpec_Synchronization_and_Cache_Control */
@@ -1450,15 +1450,40 @@ namespace VualtedVulkan
 			/**
 			@brief Reset the fences in the provided container.
 			*/
-			static EResult Reset(DynamicArray<Fence> _fences)
+			static EResult Reset(const DynamicArray<Fence>& _fences)
 			{
-				auto device = _fences[0].GetDeviceHandle();
+				return Reset(static_cast<ui32>(_fences.size()), _fences.data());
+			}
+
+			/**
+			@brief Reset a contiguous range of fences. (Handles are gathered on the stack for up to GatherLimit fences)
+			*/
+			static EResult Reset(ui32 _fenceCount, const Fence* _fences)
+			{
+				if (_fenceCount == 0) return EResult::Success;
+
+				if (_fenceCount > GatherLimit)
+				{
+					DynamicArray<Handle> handles(_fenceCount);
+
+					Gather(_fenceCount, _fences, handles.data());
 
-				DynamicArray<Fence::Handle> handles;
+					return Parent::Reset(_fences[0].GetDeviceHandle(), handles.data(), _fenceCount);
+				}
 
-				for (auto& fence : _fences) handles.push_back(fence);
+				Handle handles[GatherLimit];
 
-				return Parent::Reset(device, handles.data(), static_cast<ui32>(_fences.size()));
+				Gather(_fenceCount, _fences, handles);
+
+				return Parent::Reset(_fences[0].GetDeviceHandle(), handles, _fenceCount);
+			}
+
+			/**
+			@brief Reset a contiguous range of fence handles. (No copies are made)
+			*/
+			static EResult Reset(const LogicalDevice& _device, ui32 _fenceCount, const Handle* _fences)
+			{
+				return Parent::Reset(_device, _fences, _fenceCount);
 			}
 
 			/**
@@ -1472,15 +1497,40 @@ namespace VualtedVulkan
 			/**
 			@brief Wait for one or more fences to enter the signaled state on the host.
 			*/
-			static EResult WaitForFence(DynamicArray<Fence> _fences, bool _waitForAll, u64 _timeout)
+			static EResult WaitForFence(const DynamicArray<Fence>& _fences, bool _waitForAll, u64 _timeout)
+			{
+				return WaitForFence(static_cast<ui32>(_fences.size()), _fences.data(), _waitForAll, _timeout);
+			}
+
+			/**
+			@brief Wait for one or more fences of a contiguous range to enter the signaled state on the host. (Handles are gathered on the stack for up to GatherLimit fences)
+			*/
+			static EResult WaitForFence(ui32 _fenceCount, const Fence* _fences, bool _waitForAll, u64 _timeout)
 			{
-				auto device = _fences[0].GetDeviceHandle();
+				if (_fenceCount == 0) return EResult::Success;
+
+				if (_fenceCount > GatherLimit)
+				{
+					DynamicArray<Handle> handles(_fenceCount);
+
+					Gather(_fenceCount, _fences, handles.data());
+
+					return Parent::WaitForFences(_fences[0].GetDeviceHandle(), _fenceCount, handles.data(), _waitForAll, _timeout);
+				}
 
-				DynamicArray<Fence::Handle> handles;
+				Handle handles[GatherLimit];
 
-				for (auto& fence : _fences) handles.push_back(fence);
+				Gather(_fenceCount, _fences, handles);
 
-				return Parent::WaitForFences(device, static_cast<ui32>(_fences.size()), handles.data(), _waitForAll, _timeout);
+				return Parent::WaitForFences(_fences[0].GetDeviceHandle(), _fenceCount, handles, _waitForAll, _timeout);
+			}
+
+			/**
+			@brief Wait for one or more fences of a contiguous range of handles to enter the signaled state on the host. (No copies are made)
+			*/
+			static EResult WaitForFence(const LogicalDevice& _device, ui32 _fenceCount, const Handle* _fences, bool _waitForAll, u64 _timeout)
+			{
+				return Parent::WaitForFences(_device, _fenceCount, _fences, _waitForAll, _timeout);
 			}
 
 			/**
@@ -1534,8 +1584,18 @@ namespace VualtedVulkan
 				return *this;
 			}
 
+			/**
+			@brief Maximum amount of fences the container based batch functions gather on the stack before resorting to a heap allocation.
+			*/
+			static constexpr ui32 GatherLimit = 16;
+
 		protected:
 
+			static void Gather(ui32 _fenceCount, const Fence* _fences, Handle* _handles)
+			{
+				for (ui32 index = 0; index < _fenceCount; index++) _handles[index] = _fences[index].handle;
+			}
+
 			Handle handle;
 
 			const Memory::AllocationCallbacks* allocator;
@@ -1543,6 +1603,132 @@ namespace VualtedVulkan
 			const LogicalDevice* device;
 		};
 
+		/**
+		@brief A set of fence handles kept contiguous so they can be waited on or reset together without gathering them per call.
+
+		@details
+		The handles are stored in a small inline buffer, spilling to a heap allocated array only if more than InlineCount fences are added.
+		Clearing keeps the storage, so a set rebuilt every frame does not allocate after its first use.
+
+		The set does not own the fences. All fences must belong to the same logical device.
+		*/
+		class FenceSet
+		{
+		public:
+
+			using Handle = Fence::Handle;
+
+			/**
+			@brief Amount of handles stored without a heap allocation.
+			*/
+			static constexpr ui32 InlineCount = 8;
+
+			/**
+			@brief Default constructor.
+			*/
+			FenceSet() : count(0), device(nullptr)
+			{}
+
+			/**
+			@brief Logical device specified.
+			*/
+			FenceSet(const LogicalDevice& _device) : count(0), device(&_device)
+			{}
+
+			/**
+			@brief Add a fence to the set.
+			*/
+			void Add(const Fence& _fence)
+			{
+				Add(static_cast<const Handle&>(_fence));
+			}
+
+			/**
+			@brief Add a fence handle to the set.
+			*/
+			void Add(Handle _fence)
+			{
+				if (count < InlineCount && overflow.empty())
+				{
+					inlineHandles[count] = _fence;
+				}
+				else
+				{
+					if (overflow.empty()) overflow.assign(inlineHandles.begin(), inlineHandles.end());
+
+					overflow.push_back(_fence);
+				}
+
+				count++;
+			}
+
+			/**
+			@brief Assign the logical device the fences belong to.
+			*/
+			void Assign(const LogicalDevice& _device)
+			{
+				device = &_device;
+			}
+
+			/**
+			@brief Remove all fences from the set. (Storage is kept)
+			*/
+			void Clear()
+			{
+				overflow.clear();
+
+				count = 0;
+			}
+
+			ui32 GetCount() const
+			{
+				return count;
+			}
+
+			/**
+			@brief Provides the contiguous handles of the set.
+			*/
+			const Handle* GetHandles() const
+			{
+				return overflow.empty() ? inlineHandles.data() : overflow.data();
+			}
+
+			bool IsEmpty() const
+			{
+				return count == 0;
+			}
+
+			/**
+			@brief Set the state of the fences to unsignaled from the host.
+			*/
+			EResult Reset() const
+			{
+				if (count == 0) return EResult::Success;
+
+				return Fence::Reset(*device, count, GetHandles());
+			}
+
+			/**
+			@brief Wait for one or all of the fences to enter the signaled state on the host.
+			*/
+			EResult WaitFor(bool _waitForAll, u64 _timeout) const
+			{
+				if (count == 0) return EResult::Success;
+
+				return Fence::WaitForFence(*device, count, GetHandles(), _waitForAll, _timeout);
+			}
+
+		protected:
+
+			std::array<Handle, InlineCount> inlineHandles;
+
+			DynamicArray<Handle> overflow;
+
+			ui32 count;
+
+			const LogicalDevice* device;
+		};
+
 		/**
 		@brief Semaphores are a synchronization primitive that can be used to insert a dependency between queue operations or between a queue operation and the host.
 		Binary semaphores have two states - signaled and unsignaled.
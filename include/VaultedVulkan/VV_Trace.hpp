@@ -0,0 +1,573 @@
+/*!
+@file VV_Trace.hpp
+
+@brief Vaulted Vulkan: Trace
+
+@details Contains a trace sink that writes a timeline of host and device events in the Chrome trace event format (JSON array format),
+viewable with chrome://tracing or the Perfetto UI.
+
+Host events are scopes and instants recorded by the application, and the instrumented API calls when VV_Option__Instrument_Calls is defined.
+(Queue submissions, fence and semaphore waits, swapchain acquires and presents, or every call)
+
+Device events are the scopes measured by a GPU_Profiler, placed on the host's timeline with a TimestampCalibration.
+
+Events are pushed into a lock-free ring buffer, and written to the file by a background thread.
+If the ring buffer is full the event is dropped instead of waiting on the writer.
+The array format does not require the file to be terminated, so a trace remains readable if the application exits abruptly.
+
+<a href="https://docs.google.com/document/d/1CvAClvFfyA5R-PhYUmn5OOQtYMH4h6I0nSsKchNAySU">Trace Event Format</a>
+*/
+
+
+
+#pragma once
+
+
+
+// VV
+#include "VV_Vaults.hpp"
+#include "VV_APISpecGroups.hpp"
+#include "VV_Platform.hpp"
+#include "VV_CPP_STL.hpp"
+#include "VV_Instrumentation.hpp"
+#include "VV_Enums.hpp"
+#include "VV_Backend.hpp"
+#include "VV_Types.hpp"
+#include "VV_Constants.hpp"
+#include "VV_Memory_Backend.hpp"
+#include "VV_PhysicalDevice.hpp"
+#include "VV_Initialization.hpp"
+#include "VV_LogicalDevice.hpp"
+#include "VV_Memory.hpp"
+#include "VV_Sampler.hpp"
+#include "VV_Resource.hpp"
+#include "VV_SyncAndCacheControl.hpp"
+#include "VV_Query.hpp"
+#include "VV_Shaders.hpp"
+#include "VV_Pipelines.hpp"
+#include "VV_RenderPass.hpp"
+#include "VV_Command.hpp"
+#include "VV_Profiler.hpp"
+
+#include <cstdio>
+
+
+
+#ifndef VV_Option__Use_Long_Namespace
+namespace VV
+#else
+namespace VaultedVulkan
+#endif
+{
+	namespace V3
+	{
+		/**
+		@addtogroup Vault_3
+		@{
+		*/
+
+		/**
+		@brief Writes a timeline of host and device events to a Chrome trace file.
+
+		@details
+		Events may be recorded from any thread while the sink is open. Each thread has its own track on the host's timeline.
+		Categories must be string literals (or otherwise outlive the sink), names are copied. (Truncated to NameLength)
+
+		The sink must not be closed or destroyed while other threads may still be recording to it.
+		*/
+		class TraceSink
+		{
+		public:
+
+			using Clock = std::chrono::steady_clock;
+
+			static constexpr ui32 NameLength = 64;
+
+			static constexpr ui32 HostProcess   = 1;
+			static constexpr ui32 DeviceProcess = 2;
+
+			/**
+			@brief Records a host event for the lifetime of the object.
+			*/
+			class Scope
+			{
+			public:
+
+				Scope(TraceSink& _sink, RoCStr _category, RoCStr _name) :
+					sink(&_sink), category(_category), name(_name), start(Clock::now())
+				{}
+
+				Scope(const Scope&) = delete;
+
+				Scope& operator= (const Scope&) = delete;
+
+				~Scope()
+				{
+					sink->Complete(category, name, start, Clock::now());
+				}
+
+			protected:
+
+				TraceSink* sink;
+
+				RoCStr category;
+
+				RoCStr name;
+
+				Clock::time_point start;
+			};
+
+		#ifdef VV_Option__Instrument_Calls
+
+			/**
+			@brief The instrumented calls that are traced.
+			*/
+			enum class ECallTracing
+			{
+				None           ,
+				Synchronization,   ///< Queue submissions, waits, and swapchain acquires and presents.
+				All
+			};
+
+		#endif
+
+			/**
+			@brief Default constructor.
+			*/
+			TraceSink() :
+				file(nullptr), capacityMask(0), dequeuePosition(0), epoch(0), enqueuePosition(0), droppedCount(0), open(false)
+			{}
+
+			TraceSink(const TraceSink&) = delete;
+
+			TraceSink& operator= (const TraceSink&) = delete;
+
+			/**
+			@brief Closes the trace if open.
+			*/
+			~TraceSink()
+			{
+				Close();
+			}
+
+			/**
+			@brief Stop recording, write the events left, and close the file.
+			*/
+			void Close()
+			{
+			#ifdef VV_Option__Instrument_Calls
+
+				TraceCalls(ECallTracing::None);
+
+			#endif
+
+				if (!open.exchange(false)) return;
+
+				writer.join();
+
+				std::fclose(file);
+
+				file = nullptr;
+			}
+
+			/**
+			@brief Record a host event on the calling thread's track.
+			*/
+			void Complete(RoCStr _category, RoCStr _name, Clock::time_point _start, Clock::time_point _end)
+			{
+				Push(EPhase::Complete, HostProcess, GetThreadTrack(), _category, _name, ToNanoseconds(_start) - epoch, ToNanoseconds(_end) - ToNanoseconds(_start));
+			}
+
+			/**
+			@brief Provides the amount of events dropped because the ring buffer was full.
+			*/
+			u64 GetDroppedCount() const
+			{
+				return droppedCount.load(std::memory_order_relaxed);
+			}
+
+			/**
+			@brief Record an instant event on the calling thread's track.
+			*/
+			void Instant(RoCStr _category, RoCStr _name)
+			{
+				Push(EPhase::Instant, HostProcess, GetThreadTrack(), _category, _name, ToNanoseconds(Clock::now()) - epoch, 0);
+			}
+
+			/**
+			@brief Checks to see if the sink is open.
+			*/
+			bool IsOpen() const
+			{
+				return open.load(std::memory_order_acquire);
+			}
+
+			/**
+			@brief Create the file and start the writer thread. Returns false if already open or the file could not be created.
+
+			@param _capacity Amount of events the ring buffer holds. (Rounded up to a power of two)
+			*/
+			bool Open(RoCStr _path, ui32 _capacity)
+			{
+				if (IsOpen() || _capacity == 0) return false;
+
+				file = std::fopen(_path, "wb");
+
+				if (file == nullptr) return false;
+
+				ui32 capacity = 1;
+
+				while (capacity < _capacity) capacity <<= 1;
+
+				if (capacity != capacityMask + 1 || cells == nullptr) cells.reset(new Cell[capacity]);
+
+				for (ui32 index = 0; index < capacity; index++) cells[index].Sequence.store(index, std::memory_order_relaxed);
+
+				capacityMask    = capacity - 1;
+				dequeuePosition = 0           ;
+
+				enqueuePosition.store(0, std::memory_order_relaxed);
+				droppedCount   .store(0, std::memory_order_relaxed);
+
+				epoch = ToNanoseconds(Clock::now());
+
+				std::fputs("[\n", file);
+
+				std::fprintf(file, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%u,\"args\":{\"name\":\"Host\"}},\n"  , HostProcess  );
+				std::fprintf(file, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%u,\"args\":{\"name\":\"Device\"}},\n", DeviceProcess);
+
+				open.store(true, std::memory_order_release);
+
+				writer = std::thread(&TraceSink::Write, this);
+
+				return true;
+			}
+
+			/**
+			@brief Record the device scopes kept by a profiler, converted to the host's timeline.
+
+			@details
+			The profiler must keep its samples. (See GPU_Profiler::KeepSamples)
+			The calibration should be recent (ex: redone every second), as the device and host clocks drift apart.
+			Not thread safe: the samples taken are staged in the sink.
+
+			@param _track Track of the device's timeline to place the scopes on. (ex: one per queue)
+
+			@return The amount of scopes recorded.
+			*/
+			ui32 RecordDevice(GPU_Profiler& _profiler, const TimestampCalibration& _calibration, ui32 _track = 0)
+			{
+				staged.clear();
+
+				_profiler.TakeSamples(staged);
+
+				if (!IsOpen() || !_calibration.IsCalibrated()) return 0;
+
+				for (const GPU_Profiler::Sample& sample : staged)
+				{
+					s64 start = _calibration.ToHostNanoseconds(sample.Begin);
+					s64 end   = _calibration.ToHostNanoseconds(sample.End  );
+
+					Push(EPhase::Complete, DeviceProcess, _track + 1, "Device", _profiler.GetScopeName(sample.Scope), start - epoch, end - start);
+				}
+
+				return ui32(staged.size());
+			}
+
+		#ifdef VV_Option__Instrument_Calls
+
+			/**
+			@brief Record the instrumented calls made on every thread, on their thread's track.
+
+			@details Only one sink traces the calls at a time, the previous one stops tracing them.
+			*/
+			void TraceCalls(ECallTracing _tracing)
+			{
+				if (_tracing == ECallTracing::None)
+				{
+					TraceSink* expected = this;
+
+					if (CallSink().compare_exchange_strong(expected, nullptr)) Instrumentation::SetCallObserver(nullptr);
+
+					return;
+				}
+
+				callTracing.store(_tracing, std::memory_order_relaxed);
+
+				CallSink().store(this, std::memory_order_release);
+
+				Instrumentation::SetCallObserver(&TraceSink::ObserveCall);
+			}
+
+		#endif
+
+		protected:
+
+			enum class EPhase : char
+			{
+				Complete = 'X',
+				Instant  = 'i'
+			};
+
+			struct Event
+			{
+				EPhase Phase             ;
+				ui32   Process           ;
+				ui32   Track             ;
+				s64    Start             ;   ///< Nanoseconds since the sink was opened.
+				s64    Duration          ;   ///< Nanoseconds.
+				RoCStr Category          ;
+				char   Name[NameLength]  ;
+			};
+
+			/**
+			@brief A slot of the ring buffer, its sequence tells if it is free to write or ready to read.
+			*/
+			struct Cell
+			{
+				std::atomic<u64> Sequence;
+				Event            Data    ;
+			};
+
+			static ui32 GetThreadTrack()
+			{
+				static std::atomic<ui32> nextTrack { 1 };
+
+				thread_local ui32 track = nextTrack.fetch_add(1, std::memory_order_relaxed);
+
+				return track;
+			}
+
+			static s64 ToNanoseconds(Clock::time_point _time)
+			{
+				return s64(std::chrono::duration_cast<std::chrono::nanoseconds>(_time.time_since_epoch()).count());
+			}
+
+			/**
+			@brief Bounded multi-producer queue push, drops the event if the ring buffer is full.
+			*/
+			void Push(EPhase _phase, ui32 _process, ui32 _track, RoCStr _category, RoCStr _name, s64 _start, s64 _duration)
+			{
+				if (!open.load(std::memory_order_acquire)) return;
+
+				Cell* cell;
+
+				u64 position = enqueuePosition.load(std::memory_order_relaxed);
+
+				for (;;)
+				{
+					cell = &cells[position & capacityMask];
+
+					s64 difference = s64(cell->Sequence.load(std::memory_order_acquire)) - s64(position);
+
+					if (difference == 0)
+					{
+						if (enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) break;
+					}
+					else if (difference < 0)
+					{
+						droppedCount.fetch_add(1, std::memory_order_relaxed);
+
+						return;
+					}
+					else
+					{
+						position = enqueuePosition.load(std::memory_order_relaxed);
+					}
+				}
+
+				Event& event = cell->Data;
+
+				event.Phase    = _phase   ;
+				event.Process  = _process ;
+				event.Track    = _track   ;
+				event.Start    = _start   ;
+				event.Duration = _duration;
+				event.Category = _category;
+
+				std::strncpy(event.Name, _name, NameLength - 1);
+
+				event.Name[NameLength - 1] = '\0';
+
+				cell->Sequence.store(position + 1, std::memory_order_release);
+			}
+
+			/**
+			@brief Single consumer pop, used by the writer thread.
+			*/
+			bool Pop(Event& _event)
+			{
+				Cell& cell = cells[dequeuePosition & capacityMask];
+
+				if (cell.Sequence.load(std::memory_order_acquire) != dequeuePosition + 1) return false;
+
+				_event = cell.Data;
+
+				cell.Sequence.store(dequeuePosition + capacityMask + 1, std::memory_order_release);
+
+				dequeuePosition++;
+
+				return true;
+			}
+
+			/**
+			@brief Writer thread: drains the ring buffer into the file, flushing whenever it runs empty.
+			*/
+			void Write()
+			{
+				Event event;
+
+				while (open.load(std::memory_order_acquire))
+				{
+					if (Pop(event))
+					{
+						WriteEvent(event);
+
+						continue;
+					}
+
+					std::fflush(file);
+
+					std::this_thread::sleep_for(std::chrono::milliseconds(1));
+				}
+
+				while (Pop(event)) WriteEvent(event);
+
+				std::fflush(file);
+			}
+
+			void WriteEvent(const Event& _event)
+			{
+				std::fputs("{\"name\":\"", file);
+
+				WriteEscaped(_event.Name);
+
+				std::fputs("\",\"cat\":\"", file);
+
+				WriteEscaped(_event.Category);
+
+				std::fprintf
+				(
+					file, "\",\"ph\":\"%c\",\"pid\":%u,\"tid\":%u,\"ts\":%.3f",
+					char(_event.Phase), _event.Process, _event.Track, f64(_event.Start) / 1000.0
+				);
+
+				if (_event.Phase == EPhase::Complete)
+				{
+					std::fprintf(file, ",\"dur\":%.3f},\n", f64(_event.Duration) / 1000.0);
+				}
+				else
+				{
+					std::fputs(",\"s\":\"t\"},\n", file);
+				}
+			}
+
+			void WriteEscaped(RoCStr _string)
+			{
+				for (; *_string != '\0'; _string++)
+				{
+					char character = *_string;
+
+					if (character == '"' || character == '\\')
+					{
+						std::fputc('\\'     , file);
+						std::fputc(character, file);
+					}
+					else if (u8(character) < 0x20)
+					{
+						std::fprintf(file, "\\u%04x", unsigned(u8(character)));
+					}
+					else
+					{
+						std::fputc(character, file);
+					}
+				}
+			}
+
+		#ifdef VV_Option__Instrument_Calls
+
+			static std::atomic<TraceSink*>& CallSink()
+			{
+				static std::atomic<TraceSink*> sink { nullptr };
+
+				return sink;
+			}
+
+			/**
+			@brief Provides the category of a synchronization call. (nullptr for the other calls)
+			*/
+			static RoCStr GetSynchronizationCategory(Instrumentation::ECall _call)
+			{
+				using Instrumentation::ECall;
+
+				switch (_call)
+				{
+					case ECall::vkQueueSubmit:
+					{
+						return "Submit";
+					}
+					case ECall::vkDeviceWaitIdle:
+					case ECall::vkQueueWaitIdle :
+					case ECall::vkWaitForFences :
+					case ECall::vkWaitSemaphores:
+					{
+						return "Wait";
+					}
+					case ECall::vkAcquireNextImageKHR:
+					case ECall::vkQueuePresentKHR    :
+					{
+						return "Swapchain";
+					}
+					default:
+					{
+						return nullptr;
+					}
+				}
+			}
+
+			static void ObserveCall(Instrumentation::ECall _call, u64 _start, u64 _end)
+			{
+				TraceSink* sink = CallSink().load(std::memory_order_acquire);
+
+				if (sink == nullptr) return;
+
+				RoCStr category = GetSynchronizationCategory(_call);
+
+				if (category == nullptr)
+				{
+					if (sink->callTracing.load(std::memory_order_relaxed) == ECallTracing::Synchronization) return;
+
+					category = "Call";
+				}
+
+				sink->Push(EPhase::Complete, HostProcess, GetThreadTrack(), category, Instrumentation::GetCallName(_call), s64(_start) - sink->epoch, s64(_end - _start));
+			}
+
+			std::atomic<ECallTracing> callTracing { ECallTracing::None };
+
+		#endif
+
+			std::FILE* file;
+
+			std::unique_ptr<Cell[]> cells;
+
+			u64 capacityMask;
+
+			u64 dequeuePosition;   ///< Only used by the writer thread.
+
+			s64 epoch;   ///< Nanoseconds of the steady clock when opened.
+
+			DynamicArray<GPU_Profiler::Sample> staged;
+
+			std::thread writer;
+
+			alignas(64) std::atomic<u64> enqueuePosition;
+
+			std::atomic<u64> droppedCount;
+
+			std::atomic<bool> open;
+		};
+
+		/** @} */
+	}
+}
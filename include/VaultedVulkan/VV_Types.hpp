@@ -447,7 +447,7 @@ namespace VaultedVulkan
 
 		constexpr DeviceSize UUID_Size = VK_UUID_SIZE;
 
-		using UUID = unsigned int[UUID_Size];   ///< Universally unique identifier.
+		using UUID = u8[UUID_Size];   ///< Universally unique identifier.
 
 
 		// TODO: Move these later...
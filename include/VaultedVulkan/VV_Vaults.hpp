@@ -20,7 +20,11 @@ If the vault is not open, it will define the open definition itself implicitly.
 Opening the MagmaChamber vault is unique in that it affects all other vaults.
 When opened, the definition will change the loader interfaced with for all the implementation
 in the other vaults to the loader generated by the MagmaChamber vault.
-Define macro: VT_Vault_MagmaChamber_Open if you want this. [Note: Currently not implemented
+Define macro: VT_Vault_MagmaChamber_Open if you want this. (See VV_MagmaChamber.hpp)
+
+Call instrumentation is not a vault but works the same way: when VV_Option__Instrument_Calls is defined
+the API procedures called by all the vaults are routed through timed wrappers. (See VV_Instrumentation.hpp)
+Call capture (VV_Option__Capture_Calls) is done by those wrappers, so it defines VV_Option__Instrument_Calls implicitly. (See VV_Capture.hpp)
 */
 
 
@@ -29,6 +33,12 @@ Define macro: VT_Vault_MagmaChamber_Open if you want this. [Note: Currently not
 
 
 
+#if defined(VV_Option__Capture_Calls) && !defined(VV_Option__Instrument_Calls)
+	#define VV_Option__Instrument_Calls
+#endif
+
+
+
 #ifndef VV_Option__Use_Long_Namespace
 /**
 @defgroup VaultedThermals
@@ -71,11 +81,40 @@ namespace VaultedVulkan
 
 	@details When the heat at the control gate isn't enough.
 
+	Device level procedures are loaded per logical device into a dispatch table,
+	the other vaults call through the table of the device an object belongs to instead of the loader exports.
+
 	Namespace: Vault_MagmaChamber
+	*/
+	namespace Vault_MagmaChamber { using namespace Corridors; }
+	/** @} */
+
+	/** 
+	@ingroup VaultedThermals
+	@defgroup Instrumentation
+	@{
+
+	@brief Host side call instrumentation.
+
+	@details Only defined when VV_Option__Instrument_Calls is. (See VV_Instrumentation.hpp)
+
+	Namespace: Instrumentation
+	*/
+	namespace Instrumentation { using namespace Corridors; }
+	/** @} */
+
+	/** 
+	@ingroup VaultedThermals
+	@defgroup Capture
+	@{
+
+	@brief Capture of the API calls into a binary stream, and its replay.
+
+	@details Only defined when VV_Option__Capture_Calls is. (See VV_Capture.hpp)
 
-	@todo #TODO Look into possibly implementing with the Volk library.
+	Namespace: Capture
 	*/
-	namespace Vault_MagmaChamber {}
+	namespace Capture { using namespace Corridors; }
 	/** @} */
 
 	/** 
@@ -0,0 +1,149 @@
+#include <doctest/doctest.h>
+
+#include <VaultedVulkan.hpp>
+
+
+
+using namespace VV::V3;
+
+
+
+namespace
+{
+	// Handles are never dereferenced by the cache, so any distinct value serves as a handle.
+	template<typename HandleType>
+	HandleType MakeHandle(std::uintptr_t _value)
+	{
+		if constexpr (std::is_pointer<HandleType>::value)
+		{
+			return reinterpret_cast<HandleType>(_value);
+		}
+		else
+		{
+			return HandleType(_value);
+		}
+	}
+}
+
+TEST_CASE("CommandStateCache: rebinding the same pipeline is elided per bind point")
+{
+	CommandStateCache cache;
+
+	Pipeline::Handle graphics = MakeHandle<Pipeline::Handle>(0x10);
+	Pipeline::Handle compute  = MakeHandle<Pipeline::Handle>(0x20);
+
+	CHECK      (cache.TrackBindPipeline(EPipelineBindPoint::Graphics, graphics));
+	CHECK_FALSE(cache.TrackBindPipeline(EPipelineBindPoint::Graphics, graphics));
+	CHECK      (cache.TrackBindPipeline(EPipelineBindPoint::Compute , graphics));
+	CHECK      (cache.TrackBindPipeline(EPipelineBindPoint::Compute , compute ));
+	CHECK_FALSE(cache.TrackBindPipeline(EPipelineBindPoint::Compute , compute ));
+
+	CHECK(cache.GetStatistics().BindPipeline == 2);
+	CHECK(cache.GetStatistics().GetTotal  () == 2);
+}
+
+TEST_CASE("CommandStateCache: descriptor sets are redundant only with the same layout, sets and offsets")
+{
+	CommandStateCache cache;
+
+	Pipeline::Layout::Handle layout      = MakeHandle<Pipeline::Layout::Handle>(0x100);
+	Pipeline::Layout::Handle otherLayout = MakeHandle<Pipeline::Layout::Handle>(0x200);
+
+	DescriptorSet::Handle sets[2] = { MakeHandle<DescriptorSet::Handle>(0x1), MakeHandle<DescriptorSet::Handle>(0x2) };
+
+	ui32 offsets     [1] = { 256 };
+	ui32 otherOffsets[1] = { 512 };
+
+	const EPipelineBindPoint point = EPipelineBindPoint::Graphics;
+
+	CHECK      (cache.TrackBindDescriptorSets(point, layout, 0, 2, sets, 1, offsets));
+	CHECK_FALSE(cache.TrackBindDescriptorSets(point, layout, 0, 2, sets, 1, offsets));
+
+	// A subset of what is bound is redundant as well.
+	CHECK_FALSE(cache.TrackBindDescriptorSets(point, layout, 1, 1, sets + 1, 0, nullptr));
+
+	CHECK      (cache.TrackBindDescriptorSets(point, layout     , 0, 2, sets, 1, otherOffsets));
+	CHECK      (cache.TrackBindDescriptorSets(point, otherLayout, 0, 2, sets, 1, otherOffsets));
+	CHECK_FALSE(cache.TrackBindDescriptorSets(point, otherLayout, 0, 2, sets, 1, otherOffsets));
+
+	// Binding beyond what can be tracked always goes through.
+	CHECK(cache.TrackBindDescriptorSets(point, otherLayout, CommandStateCache::MaxDescriptorSets, 1, sets, 0, nullptr));
+	CHECK(cache.TrackBindDescriptorSets(point, otherLayout, CommandStateCache::MaxDescriptorSets, 1, sets, 0, nullptr));
+
+	CHECK(cache.GetStatistics().BindDescriptorSets == 3);
+}
+
+TEST_CASE("CommandStateCache: vertex and index buffers compare every argument")
+{
+	CommandStateCache cache;
+
+	Buffer::Handle buffers[2] = { MakeHandle<Buffer::Handle>(0x1), MakeHandle<Buffer::Handle>(0x2) };
+
+	DeviceSize offsets     [2] = { 0, 64  };
+	DeviceSize otherOffsets[2] = { 0, 128 };
+
+	CHECK      (cache.TrackBindVertexBuffers(0, 2, buffers, offsets     ));
+	CHECK_FALSE(cache.TrackBindVertexBuffers(0, 2, buffers, offsets     ));
+	CHECK_FALSE(cache.TrackBindVertexBuffers(1, 1, buffers + 1, offsets + 1));
+	CHECK      (cache.TrackBindVertexBuffers(0, 2, buffers, otherOffsets));
+
+	// Slot 2 was never bound.
+	CHECK(cache.TrackBindVertexBuffers(1, 2, buffers, offsets));
+
+	CHECK      (cache.TrackBindIndexBuffer(buffers[0], 0 , EIndexType::uInt16));
+	CHECK_FALSE(cache.TrackBindIndexBuffer(buffers[0], 0 , EIndexType::uInt16));
+	CHECK      (cache.TrackBindIndexBuffer(buffers[0], 0 , EIndexType::uInt32));
+	CHECK      (cache.TrackBindIndexBuffer(buffers[0], 16, EIndexType::uInt32));
+	CHECK      (cache.TrackBindIndexBuffer(buffers[1], 16, EIndexType::uInt32));
+
+	CHECK(cache.GetStatistics().BindVertexBuffers == 2);
+	CHECK(cache.GetStatistics().BindIndexBuffer   == 1);
+}
+
+TEST_CASE("CommandStateCache: a graphics pipeline change forgets viewports and scissors")
+{
+	CommandStateCache cache;
+
+	Viewport viewport {};
+	Rect2D   scissor  {};
+
+	viewport.Width  = 640.0f;
+	viewport.Height = 480.0f;
+
+	CHECK      (cache.TrackSetViewport(0, 1, &viewport));
+	CHECK_FALSE(cache.TrackSetViewport(0, 1, &viewport));
+	CHECK      (cache.TrackSetScissor (0, 1, &scissor ));
+	CHECK_FALSE(cache.TrackSetScissor (0, 1, &scissor ));
+
+	CHECK(cache.TrackBindPipeline(EPipelineBindPoint::Compute, MakeHandle<Pipeline::Handle>(0x1)));
+
+	CHECK_FALSE(cache.TrackSetViewport(0, 1, &viewport));
+
+	CHECK(cache.TrackBindPipeline(EPipelineBindPoint::Graphics, MakeHandle<Pipeline::Handle>(0x2)));
+
+	CHECK(cache.TrackSetViewport(0, 1, &viewport));
+	CHECK(cache.TrackSetScissor (0, 1, &scissor ));
+
+	CHECK(cache.GetStatistics().SetViewport == 2);
+	CHECK(cache.GetStatistics().SetScissor  == 1);
+}
+
+TEST_CASE("CommandStateCache: invalidation forgets everything but the statistics")
+{
+	CommandStateCache cache;
+
+	Pipeline::Handle pipeline = MakeHandle<Pipeline::Handle>(0x1);
+
+	CHECK      (cache.TrackBindPipeline(EPipelineBindPoint::Graphics, pipeline));
+	CHECK_FALSE(cache.TrackBindPipeline(EPipelineBindPoint::Graphics, pipeline));
+
+	cache.Invalidate();
+
+	CHECK(cache.TrackBindPipeline(EPipelineBindPoint::Graphics, pipeline));
+
+	CHECK(cache.GetStatistics().BindPipeline == 1);
+
+	cache.ResetStatistics();
+
+	CHECK(cache.GetStatistics().GetTotal() == 0);
+}
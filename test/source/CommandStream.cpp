@@ -0,0 +1,279 @@
+#include <doctest/doctest.h>
+
+#include <VaultedVulkan.hpp>
+
+
+
+using namespace VV::V3;
+
+
+
+namespace
+{
+	void RecordCommands(CommandStream& _stream)
+	{
+		Viewport viewports[2] {};
+
+		viewports[1].Width  = 640.0f;
+		viewports[1].Height = 480.0f;
+
+		Buffer::Handle buffers[3] {};
+		DeviceSize     offsets[3] { 0, 256, 512 };
+
+		_stream.SetViewport      (0, 2, viewports      );
+		_stream.BindVertexBuffers(0, 3, buffers, offsets);
+		_stream.Draw             (0, 3, 0, 1           );
+		_stream.DrawIndexed      (6, 1, 0, -2, 0       );
+	}
+
+	struct RecordHeader
+	{
+		ui32 Op  ;
+		ui32 Size;
+	};
+
+	DynamicArray<u8> MakeRecord(ui32 _op, ui32 _size)
+	{
+		DynamicArray<u8> bytes(_size < sizeof(RecordHeader) ? sizeof(RecordHeader) : _size);
+
+		RecordHeader header { _op, _size };
+
+		memcpy(bytes.data(), &header, sizeof(header));
+
+		return bytes;
+	}
+}
+
+TEST_CASE("CommandStream: a serialized stream loads back into the same records")
+{
+	CommandStream stream;
+
+	RecordCommands(stream);
+
+	CHECK(stream.GetCommandCount() == 4);
+
+	DynamicArray<u8> bytes;
+
+	stream.Serialize(bytes);
+
+	CHECK(bytes.size() == stream.GetSize());
+
+	CommandStream loaded;
+
+	REQUIRE(loaded.Load(bytes.data(), bytes.size()));
+
+	CHECK(loaded.GetCommandCount() == stream.GetCommandCount());
+
+	DynamicArray<u8> reserialized;
+
+	loaded.Serialize(reserialized);
+
+	CHECK(reserialized == bytes);
+}
+
+TEST_CASE("CommandStream: records spanning several pages are kept whole")
+{
+	CommandStream stream(64);
+
+	for (ui32 index = 0; index < 32; index++) stream.Draw(index, 3, 0, 1);
+
+	CHECK(stream.GetCommandCount() == 32);
+
+	DynamicArray<u8> bytes;
+
+	stream.Serialize(bytes);
+
+	CommandStream loaded(64);
+
+	REQUIRE(loaded.Load(bytes.data(), bytes.size()));
+
+	CHECK(loaded.GetCommandCount() == 32);
+	CHECK(loaded.GetSize        () == stream.GetSize());
+}
+
+TEST_CASE("CommandStream: clearing keeps the stream reusable")
+{
+	CommandStream stream;
+
+	RecordCommands(stream);
+
+	DeviceSize size = stream.GetSize();
+
+	stream.Clear();
+
+	CHECK(stream.IsEmpty());
+	CHECK(stream.GetSize() == 0);
+
+	RecordCommands(stream);
+
+	CHECK(stream.GetSize() == size);
+}
+
+TEST_CASE("CommandStream: loading malformed data appends nothing")
+{
+	CommandStream source;
+
+	RecordCommands(source);
+
+	DynamicArray<u8> valid;
+
+	source.Serialize(valid);
+
+	CommandStream stream;
+
+	SUBCASE("Truncated record")
+	{
+		CHECK_FALSE(stream.Load(valid.data(), valid.size() - 8));
+	}
+
+	SUBCASE("Truncated header")
+	{
+		DynamicArray<u8> bytes = valid;
+
+		bytes.resize(bytes.size() + 4);
+
+		CHECK_FALSE(stream.Load(bytes.data(), bytes.size()));
+	}
+
+	SUBCASE("Record of size zero")
+	{
+		DynamicArray<u8> bytes = MakeRecord(0, 0);
+
+		CHECK_FALSE(stream.Load(bytes.data(), bytes.size()));
+	}
+
+	SUBCASE("Record larger than the data")
+	{
+		DynamicArray<u8> bytes = MakeRecord(0, 64);
+
+		CHECK_FALSE(stream.Load(bytes.data(), 32));
+	}
+
+	SUBCASE("Unaligned record size")
+	{
+		DynamicArray<u8> bytes = MakeRecord(0, 12);
+
+		CHECK_FALSE(stream.Load(bytes.data(), bytes.size()));
+	}
+
+	SUBCASE("Unknown operation")
+	{
+		DynamicArray<u8> bytes = MakeRecord(1000, 16);
+
+		CHECK_FALSE(stream.Load(bytes.data(), bytes.size()));
+	}
+
+	CHECK(stream.IsEmpty());
+	CHECK(stream.GetSize() == 0);
+}
+
+TEST_CASE("CommandStream: loading a record too short for its parameters appends nothing")
+{
+	CommandStream source;
+
+	ClearValue             clearValues[2] {};
+	DescriptorSet::Handle  sets       [2] {};
+	ui32                   dynamic    [1] { 256 };
+	Buffer::Handle         buffers    [2] {};
+	DeviceSize             offsets    [2] {};
+	Buffer::CopyInfo       copies     [1] {};
+	Rect2D                 scissors   [1] {};
+	Viewport               viewports  [1] {};
+	CommandBuffer::Handle  secondaries[1] {};
+	Memory::Barrier        barriers   [1] {};
+
+	CommandBuffer::BufferImageRegion regions[1] {};
+
+	SUBCASE("BeginRenderPass")
+	{
+		RenderPass::BeginInfo info;
+
+		info.ClearValueCount = 2;
+		info.ClearValues     = clearValues;
+
+		source.BeginRenderPass(info, ESubpassContents::Inline);
+	}
+
+	SUBCASE("BindDescriptorSets") { source.BindDescriptorSets(EPipelineBindPoint::Graphics, nullptr, 0, 2, sets, 1, dynamic); }
+	SUBCASE("BindVertexBuffers" ) { source.BindVertexBuffers (0, 2, buffers, offsets);                                        }
+	SUBCASE("CopyBuffer"        ) { source.CopyBuffer        (nullptr, nullptr, 1, copies);                                   }
+	SUBCASE("CopyBufferToImage" ) { source.CopyBufferToImage (nullptr, nullptr, EImageLayout::General, 1, regions);          }
+	SUBCASE("Execute"           ) { source.Execute           (1, secondaries);                                                }
+	SUBCASE("SetScissor"        ) { source.SetScissor        (0, 1, scissors);                                                }
+	SUBCASE("SetViewport"       ) { source.SetViewport       (0, 1, viewports);                                               }
+	SUBCASE("SubmitPipelineBarrier")
+	{
+		source.SubmitPipelineBarrier
+		(
+			Pipeline::StageFlags(), Pipeline::StageFlags(), DependencyFlags(), 1, barriers, 0, nullptr, 0, nullptr
+		);
+	}
+
+	DynamicArray<u8> bytes;
+
+	source.Serialize(bytes);
+
+	REQUIRE(bytes.size() > 8);
+
+	CommandStream loaded;
+
+	REQUIRE(loaded.Load(bytes.data(), bytes.size()));
+
+	// Drop the record's last 8 bytes: its counts are left larger than its arrays.
+	RecordHeader header;
+
+	memcpy(&header, bytes.data(), sizeof(header));
+
+	header.Size -= 8;
+
+	memcpy(bytes.data(), &header, sizeof(header));
+
+	bytes.resize(header.Size);
+
+	CommandStream stream;
+
+	CHECK_FALSE(stream.Load(bytes.data(), bytes.size()));
+
+	CHECK(stream.IsEmpty());
+	CHECK(stream.GetSize() == 0);
+}
+
+TEST_CASE("CommandStream: loading a record with an inflated count appends nothing")
+{
+	CommandStream source;
+
+	Viewport viewports[2] {};
+
+	source.SetViewport(0, 2, viewports);
+
+	DynamicArray<u8> bytes;
+
+	source.Serialize(bytes);
+
+	// The parameters follow the header: the index of the first viewport, then the count.
+	ui32 count = UINT32_MAX;
+
+	memcpy(bytes.data() + sizeof(RecordHeader) + sizeof(ui32), &count, sizeof(count));
+
+	CommandStream stream;
+
+	CHECK_FALSE(stream.Load(bytes.data(), bytes.size()));
+	CHECK(stream.IsEmpty());
+}
+
+TEST_CASE("CommandStream: loading a record too short for its fixed parameters appends nothing")
+{
+	// A draw with only its header.
+	DynamicArray<u8> bytes = MakeRecord(ui32(CommandStream::EOp::Draw), sizeof(RecordHeader));
+
+	CommandStream stream;
+
+	CHECK_FALSE(stream.Load(bytes.data(), bytes.size()));
+	CHECK(stream.IsEmpty());
+
+	// A record with no parameters is whole.
+	bytes = MakeRecord(ui32(CommandStream::EOp::EndRenderPass), sizeof(RecordHeader));
+
+	CHECK(stream.Load(bytes.data(), bytes.size()));
+	CHECK(stream.GetCommandCount() == 1);
+}
@@ -0,0 +1,133 @@
+#include <doctest/doctest.h>
+
+#include <VaultedVulkan.hpp>
+
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+
+using namespace VV::V3;
+
+
+
+namespace
+{
+	std::string TestPath(const char* _name)
+	{
+		return (std::filesystem::temp_directory_path() / _name).string();
+	}
+
+	bool WriteString(const std::string& _path, const std::string& _contents)
+	{
+		const void*       blocks    [1] = { _contents.data() };
+		const std::size_t blockSizes[1] = { _contents.size() };
+
+		return WriteFileAtomic(_path.c_str(), 1, blocks, blockSizes);
+	}
+
+	std::string ReadString(const std::string& _path)
+	{
+		MappedFile file;
+
+		if (!file.Open(_path.c_str())) return std::string();
+
+		return std::string(reinterpret_cast<const char*>(file.GetData()), file.GetSize());
+	}
+
+	// Counts the files left next to the path by the writes (anything but the destination).
+	std::size_t CountLeftovers(const std::string& _path)
+	{
+		const std::filesystem::path destination(_path);
+
+		std::size_t count = 0;
+
+		for (const auto& entry : std::filesystem::directory_iterator(destination.parent_path()))
+		{
+			const std::string name = entry.path().filename().string();
+
+			if (name != destination.filename().string() && name.rfind(destination.filename().string(), 0) == 0) count++;
+		}
+
+		return count;
+	}
+}
+
+TEST_CASE("FileIO: blocks written atomically map back in order")
+{
+	const std::string path = TestPath("VV_FileIO_Blocks.bin");
+
+	const char        first [] = "Vaulted";
+	const char        second[] = "Vulkan" ;
+	const void*       blocks    [2] = { first, second };
+	const std::size_t blockSizes[2] = { sizeof(first) - 1, sizeof(second) - 1 };
+
+	REQUIRE(WriteFileAtomic(path.c_str(), 2, blocks, blockSizes));
+
+	CHECK(ReadString(path) == "VaultedVulkan");
+
+	REQUIRE(WriteString(path, "Replaced"));
+
+	CHECK(ReadString(path) == "Replaced");
+
+	CHECK(CountLeftovers(path) == 0);
+
+	std::filesystem::remove(path);
+}
+
+TEST_CASE("FileIO: temporary paths are unique per call")
+{
+	const std::string first  = MakeTemporaryPath("Cache.bin");
+	const std::string second = MakeTemporaryPath("Cache.bin");
+
+	CHECK(first != second);
+
+	CHECK(first .rfind("Cache.bin.", 0) == 0);
+	CHECK(second.rfind("Cache.bin.", 0) == 0);
+}
+
+TEST_CASE("FileIO: concurrent writers to the same path never mix their contents")
+{
+	const std::string path = TestPath("VV_FileIO_Concurrent.bin");
+
+	constexpr ui32 WriterCount = 8 ;
+	constexpr ui32 WriteCount  = 25;
+
+	std::vector<std::string> contents;
+
+	for (ui32 writer = 0; writer < WriterCount; writer++) contents.emplace_back(4096 + writer * 512, char('A' + writer));
+
+	std::atomic<ui32> failures { 0 };
+
+	std::vector<std::thread> writers;
+
+	for (ui32 writer = 0; writer < WriterCount; writer++)
+	{
+		writers.emplace_back([&, writer]()
+		{
+			for (ui32 write = 0; write < WriteCount; write++)
+			{
+				if (!WriteString(path, contents[writer])) failures++;
+			}
+		});
+	}
+
+	for (std::thread& writer : writers) writer.join();
+
+	// Replacing a file that is being replaced can fail on Windows, but a write must never be torn.
+	CHECK(failures < WriterCount * WriteCount);
+
+	const std::string result = ReadString(path);
+
+	bool matchesAWriter = false;
+
+	for (const std::string& written : contents) matchesAWriter = matchesAWriter || result == written;
+
+	CHECK(matchesAWriter);
+
+	CHECK(CountLeftovers(path) == 0);
+
+	std::filesystem::remove(path);
+}
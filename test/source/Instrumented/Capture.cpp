@@ -0,0 +1,487 @@
+#include <doctest/doctest.h>
+
+#include <VaultedVulkan.hpp>
+
+#include <cstdio>
+#include <cstring>
+
+
+
+using namespace VV::V3;
+
+
+
+namespace
+{
+	namespace Capture = VV::Capture;
+
+	using Capture::ERecord;
+
+	constexpr RoCStr CapturePath = "VV_Tests_Capture.vvcap";
+
+	template<typename HandleType>
+	HandleType MakeHandle(std::uintptr_t _value)
+	{
+		return reinterpret_cast<HandleType>(_value);
+	}
+
+	/**
+	@brief Decode the record at the position given, and move past it. Returns false if the bytes left do not make a record.
+	*/
+	template<typename Record>
+	bool ReadRecord(const VV::V0::MappedFile& _file, std::size_t& _position, Capture::Arena& _arena, Record& _record)
+	{
+		if (_file.GetSize() - _position < Capture::Replayer::RecordSize) return false;
+
+		u16 type; u32 size;
+
+		std::memcpy(&type, _file.GetData() + _position              , sizeof(u16));
+		std::memcpy(&size, _file.GetData() + _position + sizeof(u16), sizeof(u32));
+
+		_position += Capture::Replayer::RecordSize;
+
+		if (ERecord(type) != Record::Type || _file.GetSize() - _position < size) return false;
+
+		Capture::Reader reader(_file.GetData() + _position, size, _arena);
+
+		_record.Transfer(reader);
+
+		_position += size;
+
+		return !reader.HasFailed() && reader.IsAtEnd() && reader.GetUnresolvedCount() == 0;
+	}
+
+	/**
+	@brief Write the bytes given to the file at the path given.
+	*/
+	bool WriteFile(RoCStr _path, const u8* _data, std::size_t _size)
+	{
+		std::FILE* file = std::fopen(_path, "wb");
+
+		if (file == nullptr) return false;
+
+		bool written = std::fwrite(_data, 1, _size, file) == _size;
+
+		return std::fclose(file) == 0 && written;
+	}
+}
+
+TEST_CASE("Capture: the records written map back with their arguments")
+{
+	// Handles of no object, the records are written without being issued.
+	const VkDevice         device        = MakeHandle<VkDevice        >(0x1000);
+	const VkCommandBuffer  commandBuffer = MakeHandle<VkCommandBuffer >(0x2000);
+	const VkPipelineLayout layout        = MakeHandle<VkPipelineLayout>(0x3000);
+	const VkDescriptorSet  sets[2]       = { MakeHandle<VkDescriptorSet>(0x4000), MakeHandle<VkDescriptorSet>(0x5000) };
+	const VkDescriptorSet  untracked     = MakeHandle<VkDescriptorSet >(0x6000);
+
+	Capture::HandleRegistry& registry = Capture::GetRegistry();
+
+	registry.Reset();
+
+	registry.Track(&device       , 1);
+	registry.Track(&commandBuffer, 1);
+	registry.Track(&layout       , 1);
+	registry.Track(sets          , 2);
+
+	REQUIRE(Capture::Start(CapturePath));
+
+	Capture::Session& session = Capture::GetSession();
+
+	const u32 offsets[1] = { 256 };
+
+	Capture::Records::CmdBindDescriptorSets bind { commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, layout, 1, 2, sets, 1, offsets };
+
+	session.Write(bind);
+
+	const float pushed[4] = { 1.0f, 2.0f, 3.0f, 4.0f };
+
+	Capture::Records::CmdPushConstants push { commandBuffer, layout, VK_SHADER_STAGE_VERTEX_BIT, 16, sizeof(pushed), pushed };
+
+	session.Write(push);
+
+	// The chained structure is not supported: it is skipped.
+	VkApplicationInfo unsupported {};
+
+	unsupported.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+
+	VkMemoryBarrier memoryBarrier {};
+
+	memoryBarrier.sType         = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+	memoryBarrier.pNext         = &unsupported;
+	memoryBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+	memoryBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+
+	Capture::Records::CmdPipelineBarrier barrier
+	{
+		commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0,
+		1, &memoryBarrier, 0, nullptr, 0, nullptr
+	};
+
+	session.Write(barrier);
+
+	Capture::Records::CmdDrawIndexed draw { commandBuffer, 36, 2, 6, -3, 1 };
+
+	session.Write(draw);
+
+	Capture::MarkFrame();
+
+	// The set was never tracked: it is unresolved.
+	Capture::Records::CmdBindDescriptorSets bindUntracked { commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, layout, 0, 1, &untracked, 0, nullptr };
+
+	session.Write(bindUntracked);
+
+	Capture::Records::UpdateDescriptorSets update { device, 0, nullptr, 0, nullptr };
+
+	session.Write(update);
+
+	Capture::MarkFrame();
+
+	CHECK(session.GetRecordCount    () == 8);
+	CHECK(session.GetSkippedCount   () == 1);
+	CHECK(session.GetUnresolvedCount() == 1);
+
+	Capture::Stop();
+
+	CHECK(!session.IsCapturing());
+
+	SUBCASE("The stream holds the records in the order they were written")
+	{
+		VV::V0::MappedFile file;
+
+		REQUIRE(file.Open(CapturePath));
+		REQUIRE(file.GetSize() >= Capture::Replayer::HeaderSize);
+
+		u32 magic, version;
+
+		std::memcpy(&magic  , file.GetData()              , sizeof(u32));
+		std::memcpy(&version, file.GetData() + sizeof(u32), sizeof(u32));
+
+		CHECK(magic   == Capture::Magic  );
+		CHECK(version == Capture::Version);
+
+		Capture::Arena arena;
+
+		std::size_t position = Capture::Replayer::HeaderSize;
+
+		Capture::Records::CmdBindDescriptorSets bindRead {};
+
+		REQUIRE(ReadRecord(file, position, arena, bindRead));
+
+		CHECK(bindRead.CommandBuffer      == commandBuffer                  );
+		CHECK(bindRead.BindPoint          == VK_PIPELINE_BIND_POINT_GRAPHICS);
+		CHECK(bindRead.Layout             == layout                         );
+		CHECK(bindRead.FirstSet           == 1                              );
+		CHECK(bindRead.SetCount           == 2                              );
+		CHECK(bindRead.DynamicOffsetCount == 1                              );
+
+		REQUIRE(bindRead.Sets           != nullptr);
+		REQUIRE(bindRead.DynamicOffsets != nullptr);
+
+		CHECK(bindRead.Sets[0]           == sets[0]);
+		CHECK(bindRead.Sets[1]           == sets[1]);
+		CHECK(bindRead.DynamicOffsets[0] == 256    );
+
+		Capture::Records::CmdPushConstants pushRead {};
+
+		REQUIRE(ReadRecord(file, position, arena, pushRead));
+
+		CHECK(pushRead.Layout == layout                    );
+		CHECK(pushRead.Stages == VK_SHADER_STAGE_VERTEX_BIT);
+		CHECK(pushRead.Offset == 16                        );
+		CHECK(pushRead.Size   == sizeof(pushed)            );
+
+		REQUIRE(pushRead.Values != nullptr);
+
+		CHECK(std::memcmp(pushRead.Values, pushed, sizeof(pushed)) == 0);
+
+		Capture::Records::CmdPipelineBarrier barrierRead {};
+
+		REQUIRE(ReadRecord(file, position, arena, barrierRead));
+
+		CHECK(barrierRead.SourceStages       == VK_PIPELINE_STAGE_TRANSFER_BIT       );
+		CHECK(barrierRead.DestStages         == VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT);
+		CHECK(barrierRead.MemoryBarrierCount == 1                                    );
+		CHECK(barrierRead.BufferBarriers     == nullptr                              );
+		CHECK(barrierRead.ImageBarriers      == nullptr                              );
+
+		REQUIRE(barrierRead.MemoryBarriers != nullptr);
+
+		CHECK(barrierRead.MemoryBarriers[0].pNext         == nullptr                     );
+		CHECK(barrierRead.MemoryBarriers[0].srcAccessMask == VK_ACCESS_TRANSFER_WRITE_BIT);
+		CHECK(barrierRead.MemoryBarriers[0].dstAccessMask == VK_ACCESS_SHADER_READ_BIT   );
+
+		Capture::Records::CmdDrawIndexed drawRead {};
+
+		REQUIRE(ReadRecord(file, position, arena, drawRead));
+
+		CHECK(drawRead.CommandBuffer == commandBuffer);
+		CHECK(drawRead.IndexCount    == 36           );
+		CHECK(drawRead.InstanceCount == 2            );
+		CHECK(drawRead.FirstIndex    == 6            );
+		CHECK(drawRead.VertexOffset  == -3           );
+		CHECK(drawRead.FirstInstance == 1            );
+
+		Capture::Records::Frame frame;
+
+		REQUIRE(ReadRecord(file, position, arena, frame));
+
+		// Its set has no handle in this process.
+		Capture::Records::CmdBindDescriptorSets untrackedRead {};
+
+		CHECK(!ReadRecord(file, position, arena, untrackedRead));
+
+		Capture::Records::UpdateDescriptorSets updateRead {};
+
+		REQUIRE(ReadRecord(file, position, arena, updateRead));
+
+		CHECK(updateRead.Device     == device );
+		CHECK(updateRead.WriteCount == 0      );
+		CHECK(updateRead.Writes     == nullptr);
+
+		REQUIRE(ReadRecord(file, position, arena, frame));
+
+		CHECK(position == file.GetSize());
+	}
+
+	SUBCASE("The replayer skips the calls whose handles do not resolve")
+	{
+		// Without the handles no call is issued.
+		registry.Reset();
+
+		Capture::Replayer replayer;
+
+		REQUIRE(replayer.Open(CapturePath));
+
+		CHECK(replayer.ReplayFrame());
+		CHECK(replayer.GetSkippedCount() == 4);
+
+		CHECK(replayer.Replay() == 1);
+		CHECK(replayer.GetSkippedCount() == 6);
+		CHECK(!replayer.HasFailed());
+
+		replayer.Rewind();
+
+		CHECK(replayer.Replay() == 2);
+		CHECK(replayer.GetSkippedCount() == 6);
+
+		replayer.Close();
+	}
+
+	registry.Reset();
+
+	std::remove(CapturePath);
+}
+
+TEST_CASE("Capture: an acquire records the image index it acquired")
+{
+	const VkDevice       device    = MakeHandle<VkDevice      >(0x1000);
+	const VkSwapchainKHR swapchain = MakeHandle<VkSwapchainKHR>(0x2000);
+
+	Capture::HandleRegistry& registry = Capture::GetRegistry();
+
+	registry.Reset();
+
+	registry.Track(&device   , 1);
+	registry.Track(&swapchain, 1);
+
+	REQUIRE(Capture::Start(CapturePath));
+
+	uint32_t imageIndex = 2;
+
+	Capture::Records::AcquireNextImageKHR acquire { device, swapchain, UINT64_MAX, VK_NULL_HANDLE, VK_NULL_HANDLE, &imageIndex, imageIndex, 0 };
+
+	Capture::GetSession().Write(acquire);
+
+	Capture::Stop();
+
+	VV::V0::MappedFile file;
+
+	REQUIRE(file.Open(CapturePath));
+
+	Capture::Arena arena;
+
+	std::size_t position = Capture::Replayer::HeaderSize;
+
+	Capture::Records::AcquireNextImageKHR acquireRead {};
+
+	REQUIRE(ReadRecord(file, position, arena, acquireRead));
+
+	CHECK(acquireRead.Swapchain     == swapchain                 );
+	CHECK(acquireRead.AcquiredIndex == 2                         );
+	CHECK(acquireRead.ImageIndex    == &acquireRead.ReplayedIndex);
+
+	file.Close();
+
+	registry.Reset();
+
+	std::remove(CapturePath);
+}
+
+TEST_CASE("Capture: the inheritance info is only recorded for secondary command buffers")
+{
+	const VkCommandBuffer primary    = MakeHandle<VkCommandBuffer>(0x1000);
+	const VkCommandBuffer secondary  = MakeHandle<VkCommandBuffer>(0x2000);
+	const VkRenderPass    renderPass = MakeHandle<VkRenderPass   >(0x3000);
+
+	Capture::HandleRegistry& registry = Capture::GetRegistry();
+
+	registry.Reset();
+
+	registry.Track(&primary   , 1);
+	registry.Track(&secondary , 1);
+	registry.Track(&renderPass, 1);
+
+	registry.SetLevel(&secondary, 1, VK_COMMAND_BUFFER_LEVEL_SECONDARY);
+
+	REQUIRE(Capture::Start(CapturePath));
+
+	VkCommandBufferInheritanceInfo inheritance {};
+
+	inheritance.sType      = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+	inheritance.renderPass = renderPass                                       ;
+	inheritance.subpass    = 1                                                ;
+
+	VkCommandBufferBeginInfo primaryBegin {}, secondaryBegin {};
+
+	// Would fault if it was followed.
+	primaryBegin.sType            = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO                ;
+	primaryBegin.pInheritanceInfo = MakeHandle<const VkCommandBufferInheritanceInfo*>(0x10);
+
+	secondaryBegin.sType            = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO     ;
+	secondaryBegin.flags            = VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+	secondaryBegin.pInheritanceInfo = &inheritance                                    ;
+
+	Capture::Records::BeginCommandBuffer beginPrimary   { primary  , &primaryBegin   };
+	Capture::Records::BeginCommandBuffer beginSecondary { secondary, &secondaryBegin };
+
+	Capture::GetSession().Write(beginPrimary  );
+	Capture::GetSession().Write(beginSecondary);
+
+	Capture::Stop();
+
+	VV::V0::MappedFile file;
+
+	REQUIRE(file.Open(CapturePath));
+
+	Capture::Arena arena;
+
+	std::size_t position = Capture::Replayer::HeaderSize;
+
+	Capture::Records::BeginCommandBuffer primaryRead {}, secondaryRead {};
+
+	REQUIRE(ReadRecord(file, position, arena, primaryRead  ));
+	REQUIRE(ReadRecord(file, position, arena, secondaryRead));
+
+	REQUIRE(primaryRead  .BeginInfo != nullptr);
+	REQUIRE(secondaryRead.BeginInfo != nullptr);
+
+	CHECK(primaryRead.BeginInfo->pInheritanceInfo == nullptr);
+
+	REQUIRE(secondaryRead.BeginInfo->pInheritanceInfo != nullptr);
+
+	CHECK(secondaryRead.BeginInfo->flags                        == VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT);
+	CHECK(secondaryRead.BeginInfo->pInheritanceInfo->renderPass == renderPass                                      );
+	CHECK(secondaryRead.BeginInfo->pInheritanceInfo->subpass    == 1                                               );
+
+	file.Close();
+
+	registry.Reset();
+
+	std::remove(CapturePath);
+}
+
+TEST_CASE("Capture: the replayer fails on a corrupt stream")
+{
+	const VkCommandBuffer  commandBuffer = MakeHandle<VkCommandBuffer >(0x1000);
+	const VkPipelineLayout layout        = MakeHandle<VkPipelineLayout>(0x2000);
+	const VkDescriptorSet  sets[2]       = { MakeHandle<VkDescriptorSet>(0x3000), MakeHandle<VkDescriptorSet>(0x4000) };
+
+	Capture::HandleRegistry& registry = Capture::GetRegistry();
+
+	registry.Reset();
+
+	registry.Track(&commandBuffer, 1);
+	registry.Track(&layout       , 1);
+	registry.Track(sets          , 2);
+
+	REQUIRE(Capture::Start(CapturePath));
+
+	const u32 offsets[1] = { 256 };
+
+	Capture::Records::CmdBindDescriptorSets bind { commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, layout, 0, 2, sets, 1, offsets };
+
+	Capture::GetSession().Write(bind);
+
+	Capture::MarkFrame();
+
+	Capture::Records::CmdDrawIndexed draw { commandBuffer, 36, 1, 0, 0, 0 };
+
+	Capture::GetSession().Write(draw);
+
+	Capture::MarkFrame();
+
+	Capture::Stop();
+
+	DynamicArray<u8> bytes;
+
+	{
+		VV::V0::MappedFile file;
+
+		REQUIRE(file.Open(CapturePath));
+
+		bytes.assign(file.GetData(), file.GetData() + file.GetSize());
+	}
+
+	// Without the handles no call is issued.
+	registry.Reset();
+
+	// The set count of the bind: after the command buffer, bind point, layout and first set.
+	const std::size_t setCountOffset = Capture::Replayer::HeaderSize + Capture::Replayer::RecordSize + sizeof(u32) * 4;
+
+	u32 setCount;
+
+	std::memcpy(&setCount, bytes.data() + setCountOffset, sizeof(u32));
+
+	REQUIRE(setCount == 2);
+
+	bool firstFrameReplays = true;
+
+	SUBCASE("Cut short")
+	{
+		bytes.resize(bytes.size() - 3);
+	}
+
+	SUBCASE("Inflated count")
+	{
+		// More sets than the record holds.
+		setCount = 4;
+
+		std::memcpy(bytes.data() + setCountOffset, &setCount, sizeof(u32));
+
+		firstFrameReplays = false;
+	}
+
+	SUBCASE("Deflated count")
+	{
+		// The record holds bytes past its arguments.
+		setCount = 1;
+
+		std::memcpy(bytes.data() + setCountOffset, &setCount, sizeof(u32));
+
+		firstFrameReplays = false;
+	}
+
+	REQUIRE(WriteFile(CapturePath, bytes.data(), bytes.size()));
+
+	Capture::Replayer replayer;
+
+	REQUIRE(replayer.Open(CapturePath));
+
+	CHECK(replayer.Replay() == (firstFrameReplays ? 1 : 0));
+	CHECK(replayer.HasFailed());
+
+	replayer.Close();
+
+	std::remove(CapturePath);
+}
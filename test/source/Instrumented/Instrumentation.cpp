@@ -0,0 +1,50 @@
+#include <doctest/doctest.h>
+
+#include <VaultedVulkan.hpp>
+
+#include <type_traits>
+
+
+
+using namespace VV::V3;
+
+
+
+namespace VV
+{
+	namespace V1
+	{
+		namespace
+		{
+			// Looked up from V1 as its functions do: the name must find the wrapper object, which leaves nothing for argument dependent lookup to add.
+			// (These calls only take Vulkan handles and integers, so the API prototypes would otherwise be preferred over wrapper templates)
+			#define VV_Test_ResolvesToWrapper(_PROCEDURE)                                                                         \
+			static_assert(std::is_same<decltype(_PROCEDURE), decltype(Instrumentation::Calls::_PROCEDURE)>::value, #_PROCEDURE " bypasses its wrapper.");
+
+			VV_Test_ResolvesToWrapper(vkCmdDraw         )
+			VV_Test_ResolvesToWrapper(vkCmdDrawIndexed  )
+			VV_Test_ResolvesToWrapper(vkCmdEndRenderPass)
+			VV_Test_ResolvesToWrapper(vkEndCommandBuffer)
+			VV_Test_ResolvesToWrapper(vkQueueWaitIdle   )
+			VV_Test_ResolvesToWrapper(vkDeviceWaitIdle  )
+
+			#undef VV_Test_ResolvesToWrapper
+		}
+	}
+}
+
+TEST_CASE("Instrumentation: a V1 call is counted by its wrapper")
+{
+	using VV::Instrumentation::ECall;
+
+	VV::Instrumentation::Reset();
+
+	ui32 version = 0;
+
+	VV::V1::AppInstance::GetVersion(version);
+
+	const DynamicArray<VV::Instrumentation::CallStatistics> statistics = VV::Instrumentation::Collect();
+
+	CHECK(statistics[ui32(ECall::vkEnumerateInstanceVersion)].Count == 1);
+	CHECK(statistics[ui32(ECall::vkCmdDraw                 )].Count == 0);
+}
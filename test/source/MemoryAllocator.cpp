@@ -0,0 +1,106 @@
+#include <doctest/doctest.h>
+
+#include <VaultedVulkan.hpp>
+
+
+
+using namespace VV::V3;
+
+
+
+TEST_CASE("MemoryBlockAllocator: allocations are aligned and do not overlap")
+{
+	MemoryBlockAllocator block(1 << 20, 1);
+
+	MemoryBlockAllocator::Allocation first, second, third;
+
+	REQUIRE(block.Allocate(100 , 1  , EImageTiling::Linear, first ));
+	REQUIRE(block.Allocate(256 , 256, EImageTiling::Linear, second));
+	REQUIRE(block.Allocate(1000, 64 , EImageTiling::Linear, third ));
+
+	CHECK(second.Offset % 256 == 0);
+	CHECK(third .Offset % 64  == 0);
+
+	CHECK(first .Offset + first .Size <= second.Offset);
+	CHECK(second.Offset + second.Size <= third .Offset);
+
+	CHECK(block.GetAllocationCount() == 3                );
+	CHECK(block.GetUsedSize       () == 100 + 256 + 1000);
+}
+
+TEST_CASE("MemoryBlockAllocator: freed regions merge back into the whole block")
+{
+	constexpr DeviceSize Capacity = 4096;
+
+	MemoryBlockAllocator block(Capacity, 1);
+
+	MemoryBlockAllocator::Allocation allocations[4];
+
+	for (auto& allocation : allocations) REQUIRE(block.Allocate(Capacity / 4, 1, EImageTiling::Linear, allocation));
+
+	MemoryBlockAllocator::Allocation overflow;
+
+	CHECK_FALSE(block.Allocate(1, 1, EImageTiling::Linear, overflow));
+
+	// Free out of order so both the previous and next neighbors get merged.
+	block.Free(allocations[1]);
+	block.Free(allocations[3]);
+	block.Free(allocations[2]);
+	block.Free(allocations[0]);
+
+	CHECK(block.IsEmpty());
+	CHECK(block.GetUsedSize() == 0);
+
+	MemoryBlockAllocator::Allocation whole;
+
+	REQUIRE(block.Allocate(Capacity, 1, EImageTiling::Linear, whole));
+
+	CHECK(whole.Offset == 0);
+}
+
+TEST_CASE("MemoryBlockAllocator: freeing twice is ignored")
+{
+	MemoryBlockAllocator block(1024, 1);
+
+	MemoryBlockAllocator::Allocation allocation;
+
+	REQUIRE(block.Allocate(512, 1, EImageTiling::Linear, allocation));
+
+	block.Free(allocation);
+	block.Free(allocation);
+
+	CHECK(block.GetUsedSize       () == 0);
+	CHECK(block.GetAllocationCount() == 0);
+}
+
+TEST_CASE("MemoryBlockAllocator: linear and optimal resources never share a granularity page")
+{
+	constexpr DeviceSize Granularity = 1024;
+
+	MemoryBlockAllocator block(1 << 16, Granularity);
+
+	MemoryBlockAllocator::Allocation buffer, image, otherBuffer;
+
+	REQUIRE(block.Allocate(100, 16, EImageTiling::Linear , buffer     ));
+	REQUIRE(block.Allocate(100, 16, EImageTiling::Optimal, image      ));
+	REQUIRE(block.Allocate(100, 16, EImageTiling::Linear , otherBuffer));
+
+	auto Page = [&](DeviceSize _offset) { return _offset / Granularity; };
+
+	CHECK(Page(buffer.Offset + buffer.Size - 1) != Page(image      .Offset));
+	CHECK(Page(image .Offset + image .Size - 1) != Page(otherBuffer.Offset));
+}
+
+TEST_CASE("MemoryBlockAllocator: requests larger than the free space fail")
+{
+	MemoryBlockAllocator block(1000, 1);
+
+	MemoryBlockAllocator::Allocation allocation;
+
+	CHECK_FALSE(block.Allocate(0   , 1, EImageTiling::Linear, allocation));
+	CHECK_FALSE(block.Allocate(1001, 1, EImageTiling::Linear, allocation));
+
+	REQUIRE(block.Allocate(600, 1, EImageTiling::Linear, allocation));
+
+	CHECK_FALSE(block.Allocate(500, 1, EImageTiling::Linear, allocation));
+}
@@ -0,0 +1,98 @@
+#include <doctest/doctest.h>
+
+#include <VaultedVulkan.hpp>
+
+
+
+using namespace VV::V3;
+
+
+
+TEST_CASE("RingAllocator: allocations are aligned and advance the head")
+{
+	RingAllocator ring(1024);
+
+	DeviceSize first, second;
+
+	REQUIRE(ring.Allocate(10, 1 , first ));
+	REQUIRE(ring.Allocate(10, 16, second));
+
+	CHECK(first  == 0 );
+	CHECK(second == 16);
+
+	CHECK(ring.GetHead    () == 26);
+	CHECK(ring.GetUsedSize() == 26);
+}
+
+TEST_CASE("RingAllocator: space is only reclaimed when frames are retired")
+{
+	RingAllocator ring(100);
+
+	DeviceSize offset;
+
+	REQUIRE(ring.Allocate(60, 1, offset)); ring.EndFrame(1);
+	REQUIRE(ring.Allocate(30, 1, offset)); ring.EndFrame(2);
+
+	CHECK_FALSE(ring.Allocate(20, 1, offset));
+
+	ring.Retire(1);
+
+	CHECK(ring.GetUsedSize() == 30);
+
+	// Does not fit before the end (90 + 20 > 100), wraps to the start.
+	REQUIRE(ring.Allocate(20, 1, offset));
+
+	CHECK(offset == 0);
+
+	// The wrap wasted the 10 bytes at the end.
+	CHECK(ring.GetUsedSize() == 60);
+
+	CHECK_FALSE(ring.Allocate(50, 1, offset));
+
+	REQUIRE(ring.Allocate(40, 1, offset));
+
+	CHECK(offset == 20);
+}
+
+TEST_CASE("RingAllocator: an empty ring can hold a request of its full size wherever its head was")
+{
+	RingAllocator ring(100);
+
+	DeviceSize offset;
+
+	REQUIRE(ring.Allocate(95, 1, offset)); ring.EndFrame(1);
+
+	ring.EndFrame(2);   // A frame with nothing allocated.
+
+	ring.Retire(1);
+
+	CHECK(ring.GetUsedSize() == 0);
+
+	REQUIRE(ring.Allocate(100, 1, offset));
+
+	CHECK(offset == 0);
+
+	ring.EndFrame(3);
+
+	// Retiring the empty frame made before the rewind must not move the tail back past the allocation.
+	ring.Retire(2);
+
+	CHECK(ring.GetUsedSize() == 100);
+	CHECK_FALSE(ring.Allocate(1, 1, offset));
+
+	ring.Retire(3);
+
+	REQUIRE(ring.Allocate(100, 1, offset));
+
+	CHECK(offset == 0);
+}
+
+TEST_CASE("RingAllocator: requests larger than the ring fail")
+{
+	RingAllocator ring(64);
+
+	DeviceSize offset;
+
+	CHECK_FALSE(ring.Allocate(0 , 1, offset));
+	CHECK_FALSE(ring.Allocate(65, 1, offset));
+}
@@ -0,0 +1,309 @@
+#include <doctest/doctest.h>
+
+#include <VaultedVulkan.hpp>
+
+#include <initializer_list>
+
+
+
+using namespace VV::V3;
+
+
+
+namespace
+{
+	// Opcodes
+	constexpr ui32 Op_EntryPoint     = 15;
+	constexpr ui32 Op_TypeInt        = 21;
+	constexpr ui32 Op_TypeFloat      = 22;
+	constexpr ui32 Op_TypeVector     = 23;
+	constexpr ui32 Op_TypeMatrix     = 24;
+	constexpr ui32 Op_TypeArray      = 28;
+	constexpr ui32 Op_TypeStruct     = 30;
+	constexpr ui32 Op_TypePointer    = 32;
+	constexpr ui32 Op_Constant       = 43;
+	constexpr ui32 Op_Variable       = 59;
+	constexpr ui32 Op_Decorate       = 71;
+	constexpr ui32 Op_MemberDecorate = 72;
+
+	// Decorations
+	constexpr ui32 Block         = 2 ;
+	constexpr ui32 RowMajor      = 4 ;
+	constexpr ui32 ColMajor      = 5 ;
+	constexpr ui32 MatrixStride  = 7 ;
+	constexpr ui32 Location      = 30;
+	constexpr ui32 Binding       = 33;
+	constexpr ui32 DescriptorSet = 34;
+	constexpr ui32 Offset        = 35;
+
+	// Storage classes
+	constexpr ui32 Input        = 1;
+	constexpr ui32 Uniform      = 2;
+	constexpr ui32 PushConstant = 9;
+
+	constexpr ui32 Name_main = 0x6E69616D;   ///< "main"
+
+	/**
+	@brief Assembles a module word by word.
+	*/
+	struct Module
+	{
+		DynamicArray<SPIR_V::Bytecode> Words;
+
+		Module(ui32 _bound) : Words{ 0x07230203, 0x00010000, 0, _bound, 0 }
+		{}
+
+		void Op(ui32 _opcode, std::initializer_list<ui32> _operands)
+		{
+			Words.push_back(ui32(_operands.size() + 1) << 16 | _opcode);
+
+			Words.insert(Words.end(), _operands.begin(), _operands.end());
+		}
+
+		void EntryPoint(ui32 _executionModel, ui32 _function)
+		{
+			Op(Op_EntryPoint, { _executionModel, _function, Name_main, 0 });
+		}
+
+		bool Reflect(ShaderReflection& _reflection) const
+		{
+			return _reflection.Reflect(Words.data(), Words.size() * sizeof(SPIR_V::Bytecode));
+		}
+	};
+
+	// Ids shared by the modules.
+	enum : ui32
+	{
+		Id_Main = 1,
+		Id_Float   ,
+		Id_Vec4    ,
+		Id_Mat2x4  ,   ///< Two columns of vec4.
+		Id_Block   ,
+		Id_Pointer ,
+		Id_Variable,
+		Id_Bound
+	};
+
+	/**
+	@brief A block of a column major and a row major matrix (both with two columns of vec4 and a stride of 16), as a push constant or a uniform buffer.
+
+	@details The column major matrix spans 2 strides, the row major one 4 strides (one per row).
+	*/
+	Module MakeMatrixBlock(ui32 _storageClass, bool _strideBeforeOffset)
+	{
+		Module module(Id_Bound);
+
+		module.EntryPoint(0, Id_Main);
+
+		if (_storageClass == Uniform)
+		{
+			module.Op(Op_Decorate, { Id_Variable, DescriptorSet, 1 });
+			module.Op(Op_Decorate, { Id_Variable, Binding      , 3 });
+		}
+
+		module.Op(Op_Decorate, { Id_Block, Block });
+
+		if (_strideBeforeOffset)
+		{
+			module.Op(Op_MemberDecorate, { Id_Block, 1, RowMajor         });
+			module.Op(Op_MemberDecorate, { Id_Block, 1, MatrixStride, 16 });
+			module.Op(Op_MemberDecorate, { Id_Block, 1, Offset      , 32 });
+			module.Op(Op_MemberDecorate, { Id_Block, 0, ColMajor         });
+			module.Op(Op_MemberDecorate, { Id_Block, 0, MatrixStride, 16 });
+			module.Op(Op_MemberDecorate, { Id_Block, 0, Offset      , 0  });
+		}
+		else
+		{
+			module.Op(Op_MemberDecorate, { Id_Block, 0, Offset      , 0  });
+			module.Op(Op_MemberDecorate, { Id_Block, 0, ColMajor         });
+			module.Op(Op_MemberDecorate, { Id_Block, 0, MatrixStride, 16 });
+			module.Op(Op_MemberDecorate, { Id_Block, 1, Offset      , 32 });
+			module.Op(Op_MemberDecorate, { Id_Block, 1, RowMajor         });
+			module.Op(Op_MemberDecorate, { Id_Block, 1, MatrixStride, 16 });
+		}
+
+		module.Op(Op_TypeFloat  , { Id_Float  , 32                      });
+		module.Op(Op_TypeVector , { Id_Vec4   , Id_Float, 4             });
+		module.Op(Op_TypeMatrix , { Id_Mat2x4 , Id_Vec4 , 2             });
+		module.Op(Op_TypeStruct , { Id_Block  , Id_Mat2x4, Id_Mat2x4    });
+		module.Op(Op_TypePointer, { Id_Pointer, _storageClass, Id_Block });
+		module.Op(Op_Variable   , { Id_Pointer, Id_Variable, _storageClass });
+
+		return module;
+	}
+}
+
+TEST_CASE("ShaderReflection: rejects what is not SPIR-V")
+{
+	ShaderReflection reflection;
+
+	const SPIR_V::Bytecode notSPIR_V[5] = { 0x12345678, 0x00010000, 0, 8, 0 };
+
+	CHECK_FALSE(reflection.Reflect(notSPIR_V, sizeof(notSPIR_V)));
+
+	// An instruction longer than the module.
+	Module truncated(Id_Bound);
+
+	truncated.Words.push_back(8 << 16 | Op_TypeFloat);
+
+	CHECK_FALSE(truncated.Reflect(reflection));
+
+	CHECK_FALSE(reflection.HasPushConstants());
+	CHECK(reflection.GetBindings().empty());
+}
+
+TEST_CASE("ShaderReflection: a push constant block is sized by the layout of each matrix member")
+{
+	ShaderReflection reflection;
+
+	SUBCASE("Offsets decorated first")
+	{
+		REQUIRE(MakeMatrixBlock(PushConstant, false).Reflect(reflection));
+	}
+
+	SUBCASE("Strides decorated first")
+	{
+		REQUIRE(MakeMatrixBlock(PushConstant, true).Reflect(reflection));
+	}
+
+	REQUIRE(reflection.HasPushConstants());
+
+	CHECK(reflection.GetStage() == EShaderStageFlag::Vertex);
+
+	const Pipeline::Layout::PushConstantRange& range = reflection.GetPushConstantRange();
+
+	// The row major matrix at 32 takes a stride per row: 4 * 16.
+	CHECK(range.Offset == 0          );
+	CHECK(range.Size   == 32 + 4 * 16);
+
+	CHECK(range.StageFlags.HasExactly(EShaderStageFlag::Vertex));
+}
+
+TEST_CASE("ShaderReflection: a uniform block with matrices is a uniform buffer binding")
+{
+	ShaderReflection reflection;
+
+	REQUIRE(MakeMatrixBlock(Uniform, true).Reflect(reflection));
+
+	CHECK_FALSE(reflection.HasPushConstants());
+
+	REQUIRE(reflection.GetBindings().size() == 1);
+
+	const ShaderReflection::DescriptorBinding& binding = reflection.GetBindings()[0];
+
+	CHECK(binding.Set                       == 1                             );
+	CHECK(binding.Binding.BindingID         == 3                             );
+	CHECK(binding.Binding.Type              == EDescriptorType::UniformBuffer);
+	CHECK(binding.Binding.Count             == 1                             );
+	CHECK(binding.Binding.ImmutableSamplers == nullptr                       );
+}
+
+TEST_CASE("ShaderReflection: a push constant range starts at the lowest member offset")
+{
+	Module module(Id_Bound);
+
+	module.EntryPoint(4, Id_Main);
+
+	module.Op(Op_Decorate      , { Id_Block, Block          });
+	module.Op(Op_MemberDecorate, { Id_Block, 1, Offset, 32  });
+	module.Op(Op_MemberDecorate, { Id_Block, 0, Offset, 16  });
+
+	module.Op(Op_TypeFloat  , { Id_Float  , 32                     });
+	module.Op(Op_TypeVector , { Id_Vec4   , Id_Float, 4            });
+	module.Op(Op_TypeStruct , { Id_Block  , Id_Vec4, Id_Float      });
+	module.Op(Op_TypePointer, { Id_Pointer, PushConstant, Id_Block });
+	module.Op(Op_Variable   , { Id_Pointer, Id_Variable, PushConstant });
+
+	ShaderReflection reflection;
+
+	REQUIRE(module.Reflect(reflection));
+	REQUIRE(reflection.HasPushConstants());
+
+	CHECK(reflection.GetStage() == EShaderStageFlag::Fragment);
+
+	CHECK(reflection.GetPushConstantRange().Offset == 16         );
+	CHECK(reflection.GetPushConstantRange().Size   == 32 + 4 - 16);
+}
+
+TEST_CASE("ShaderReflection: a push constant block that cannot be sized has no range")
+{
+	// The block's members are decorated, but its type is never declared.
+	Module module(Id_Bound);
+
+	module.EntryPoint(0, Id_Main);
+
+	module.Op(Op_Decorate      , { Id_Block, Block         });
+	module.Op(Op_MemberDecorate, { Id_Block, 0, Offset, 16 });
+
+	module.Op(Op_TypePointer, { Id_Pointer, PushConstant, Id_Block });
+	module.Op(Op_Variable   , { Id_Pointer, Id_Variable, PushConstant });
+
+	ShaderReflection reflection;
+
+	REQUIRE(module.Reflect(reflection));
+
+	CHECK_FALSE(reflection.HasPushConstants());
+	CHECK(reflection.GetPushConstantRange().Size == 0);
+}
+
+TEST_CASE("ShaderReflection: 64-bit vertex inputs of three or four components take two locations")
+{
+	enum : ui32
+	{
+		Input_Main = 1     ,
+		Input_UInt         ,
+		Input_Two          ,
+		Input_Float        ,
+		Input_Double       ,
+		Input_Vec2         ,
+		Input_DVec4        ,
+		Input_DVec4Array   ,
+		Input_ArrayPointer ,
+		Input_Vec2Pointer  ,
+		Input_Positions    ,
+		Input_Coordinates  ,
+		Input_Bound
+	};
+
+	Module module(Input_Bound);
+
+	module.EntryPoint(0, Input_Main);
+
+	module.Op(Op_Decorate, { Input_Positions  , Location, 0 });
+	module.Op(Op_Decorate, { Input_Coordinates, Location, 4 });
+
+	module.Op(Op_TypeInt    , { Input_UInt        , 32, 0                     });
+	module.Op(Op_Constant   , { Input_UInt        , Input_Two, 2              });
+	module.Op(Op_TypeFloat  , { Input_Float       , 32                        });
+	module.Op(Op_TypeFloat  , { Input_Double      , 64                        });
+	module.Op(Op_TypeVector , { Input_Vec2        , Input_Float , 2           });
+	module.Op(Op_TypeVector , { Input_DVec4       , Input_Double, 4           });
+	module.Op(Op_TypeArray  , { Input_DVec4Array  , Input_DVec4 , Input_Two   });
+	module.Op(Op_TypePointer, { Input_ArrayPointer, Input, Input_DVec4Array   });
+	module.Op(Op_TypePointer, { Input_Vec2Pointer , Input, Input_Vec2         });
+	module.Op(Op_Variable   , { Input_ArrayPointer, Input_Positions  , Input  });
+	module.Op(Op_Variable   , { Input_Vec2Pointer , Input_Coordinates, Input  });
+
+	ShaderReflection reflection;
+
+	REQUIRE(module.Reflect(reflection));
+
+	const auto& attributes = reflection.GetVertexAttributes();
+
+	REQUIRE(attributes.size() == 3);
+
+	// A dvec4[2] at location 0 takes locations 0 to 3, the vec2 follows at 4.
+	CHECK(attributes[0].Location == 0);
+	CHECK(attributes[1].Location == 2);
+	CHECK(attributes[2].Location == 4);
+
+	CHECK(attributes[0].Format == EFormat::R64_G64_B64_A64_SFloat);
+	CHECK(attributes[1].Format == EFormat::R64_G64_B64_A64_SFloat);
+	CHECK(attributes[2].Format == EFormat::R32_G32_SFloat        );
+
+	CHECK(attributes[0].Offset == 0 );
+	CHECK(attributes[1].Offset == 32);
+	CHECK(attributes[2].Offset == 64);
+
+	CHECK(reflection.GetVertexBinding().Stride == 72);
+}
@@ -0,0 +1,304 @@
+#include <doctest/doctest.h>
+
+#include <VaultedVulkan.hpp>
+
+#include <unordered_set>
+
+
+
+using namespace VV::V3;
+
+
+
+namespace
+{
+	template<typename HandleType>
+	HandleType MakeHandle(std::uintptr_t _value)
+	{
+		if constexpr (std::is_pointer<HandleType>::value)
+		{
+			return reinterpret_cast<HandleType>(_value);
+		}
+		else
+		{
+			return HandleType(_value);
+		}
+	}
+
+	template<typename InfoType>
+	u64 Hash(const InfoType& _info)
+	{
+		return VV::V1::StructHash<InfoType>()(_info);
+	}
+
+	template<typename InfoType>
+	bool Equal(const InfoType& _left, const InfoType& _right)
+	{
+		return VV::V1::StructEqual<InfoType>()(_left, _right);
+	}
+
+	/**
+	@brief Owns everything a graphics pipeline create info points to, so that two identical descriptions live at different addresses.
+	*/
+	struct GraphicsDescription
+	{
+		using Specialization = VV::V1::Pipeline::Specialization  ;
+		using VertexInput    = VV::V1::Pipeline::VertexInputState;
+
+		char EntryPoint[8] = "main";
+
+		u32 SpecializationData[2] = { 16, 4 };
+
+		Specialization::MapEntry MapEntries[2] {};
+		Specialization::Info     SpecializationInfo {};
+
+		Pipeline::ShaderStage::CreateInfo Stages[2] {};
+
+		VertexInput::BindingDescription   Binding       {};
+		VertexInput::AttributeDescription Attributes[2] {};
+		VertexInput::CreateInfo           VertexInputInfo {};
+
+		Pipeline::MultiSampleState::SampleMask SampleMask = 0xFFFFFFFF;
+		Pipeline::MultiSampleState::CreateInfo MultisampleInfo {};
+
+		Viewport                            ViewportArea {};
+		Rect2D                              ScissorArea  {};
+		Pipeline::ViewportState::CreateInfo ViewportInfo {};
+
+		EDynamicState                      DynamicStates[2] = { EDynamicState::Viewport, EDynamicState::Scissor };
+		Pipeline::DynamicState::CreateInfo DynamicInfo {};
+
+		Pipeline::Graphics::CreateInfo Info {};
+
+		GraphicsDescription()
+		{
+			MapEntries[0].ConstantID = 0; MapEntries[0].Offset = 0; MapEntries[0].Size = sizeof(u32);
+			MapEntries[1].ConstantID = 1; MapEntries[1].Offset = 4; MapEntries[1].Size = sizeof(u32);
+
+			SpecializationInfo.MapEntryCount = 2                         ;
+			SpecializationInfo.MapEntires    = MapEntries                ;
+			SpecializationInfo.SizeOfData    = sizeof(SpecializationData);
+			SpecializationInfo.Data          = SpecializationData        ;
+
+			Stages[0].Stage  = EShaderStageFlag::Vertex               ;
+			Stages[0].Module = MakeHandle<ShaderModule::Handle>(0x100);
+			Stages[0].Name   = EntryPoint                             ;
+
+			Stages[1].Stage          = EShaderStageFlag::Fragment               ;
+			Stages[1].Module         = MakeHandle<ShaderModule::Handle>(0x200);
+			Stages[1].Name           = EntryPoint                             ;
+			Stages[1].Specialization = &SpecializationInfo                    ;
+
+			Binding.Binding   = 0                       ;
+			Binding.Stride    = 20                      ;
+			Binding.InputRate = EVertexInputRate::Vertex;
+
+			Attributes[0].Location = 0; Attributes[0].Format = EFormat::R32_G32_B32_SFloat; Attributes[0].Offset = 0 ;
+			Attributes[1].Location = 1; Attributes[1].Format = EFormat::R32_G32_SFloat    ; Attributes[1].Offset = 12;
+
+			VertexInputInfo.BindingDescriptionCount   = 1         ;
+			VertexInputInfo.BindingDescriptions       = &Binding  ;
+			VertexInputInfo.AttributeDescriptionCount = 2         ;
+			VertexInputInfo.AttributeDescriptions     = Attributes;
+
+			MultisampleInfo.RasterizationSamples = ESampleCount::_4;
+			MultisampleInfo.SampleMask           = &SampleMask     ;
+
+			ViewportArea.Width  = 1280.0f;
+			ViewportArea.Height =  720.0f;
+
+			ScissorArea.Extent.Width  = 1280;
+			ScissorArea.Extent.Height =  720;
+
+			ViewportInfo.ViewportCount = 1            ;
+			ViewportInfo.Viewports     = &ViewportArea;
+			ViewportInfo.ScissorCount  = 1            ;
+			ViewportInfo.Scissors      = &ScissorArea ;
+
+			DynamicInfo.StateCount = 2            ;
+			DynamicInfo.States     = DynamicStates;
+
+			Info.StageCount       = 2                                         ;
+			Info.Stages           = Stages                                    ;
+			Info.VertexInputState = &VertexInputInfo                          ;
+			Info.ViewportState    = &ViewportInfo                             ;
+			Info.MultisampleState = &MultisampleInfo                          ;
+			Info.DynamicState     = &DynamicInfo                              ;
+			Info.Layout           = MakeHandle<Pipeline::Layout::Handle>(0x300);
+			Info.RenderPass       = MakeHandle<RenderPass::Handle>      (0x400);
+		}
+
+		GraphicsDescription(const GraphicsDescription&) = delete;
+	};
+}
+
+TEST_CASE("StructHash: descriptions built separately hash and compare equal")
+{
+	GraphicsDescription first, second;
+
+	REQUIRE(first.Info.Stages != second.Info.Stages);
+
+	CHECK(Equal(first.Info, second.Info));
+	CHECK(Hash (first.Info) == Hash(second.Info));
+}
+
+TEST_CASE("StructHash: differences behind pointers are seen by both the hash and the comparison")
+{
+	GraphicsDescription reference, changed;
+
+	SUBCASE("Specialization data")
+	{
+		changed.SpecializationData[1] = 8;
+	}
+
+	SUBCASE("Entry point")
+	{
+		changed.EntryPoint[0] = 'M';
+	}
+
+	SUBCASE("Vertex attribute")
+	{
+		changed.Attributes[1].Offset = 16;
+	}
+
+	SUBCASE("Sample mask")
+	{
+		changed.SampleMask = 0x0000000F;
+	}
+
+	SUBCASE("Dynamic state order")
+	{
+		changed.DynamicStates[0] = EDynamicState::Scissor ;
+		changed.DynamicStates[1] = EDynamicState::Viewport;
+	}
+
+	SUBCASE("Missing state")
+	{
+		changed.Info.DynamicState = nullptr;
+	}
+
+	SUBCASE("Static scissor")
+	{
+		// Only the viewport is left dynamic, the scissor array is read.
+		reference.DynamicInfo.StateCount = 1;
+		changed  .DynamicInfo.StateCount = 1;
+
+		changed.ScissorArea.Extent.Width = 640;
+	}
+
+	CHECK_FALSE(Equal(reference.Info, changed.Info));
+	CHECK      (Hash (reference.Info) != Hash(changed.Info));
+}
+
+TEST_CASE("StructHash: the viewport and scissor arrays of dynamic states are not read")
+{
+	GraphicsDescription first, second;
+
+	// Would fault if they were followed.
+	second.ViewportInfo.Viewports = MakeHandle<const Viewport*>(0x10);
+	second.ViewportInfo.Scissors  = MakeHandle<const Rect2D*  >(0x20);
+
+	CHECK(Equal(first.Info, second.Info));
+	CHECK(Hash (first.Info) == Hash(second.Info));
+
+	second.ViewportInfo.ScissorCount = 2;
+
+	CHECK_FALSE(Equal(first.Info, second.Info));
+	CHECK      (Hash (first.Info) != Hash(second.Info));
+}
+
+TEST_CASE("StructHash: only sampler bindings read their immutable samplers")
+{
+	using DescriptorSet = Pipeline::Layout::DescriptorSet;
+
+	const Sampler::Handle samplers[2] = { MakeHandle<Sampler::Handle>(0x10), MakeHandle<Sampler::Handle>(0x20) };
+
+	DescriptorSet::Binding first {}, second {};
+
+	first.BindingID = 0; first.Count = 1; first.StageFlags = EShaderStageFlag::Fragment;
+
+	second = first;
+
+	DescriptorSet::CreateInfo firstInfo {}, secondInfo {};
+
+	firstInfo .BindingCount = 1; firstInfo .Bindings = &first ;
+	secondInfo.BindingCount = 1; secondInfo.Bindings = &second;
+
+	SUBCASE("Uniform buffer")
+	{
+		// Would fault if they were followed.
+		first .Type = EDescriptorType::UniformBuffer; first .ImmutableSamplers = MakeHandle<const Sampler::Handle*>(0x10);
+		second.Type = EDescriptorType::UniformBuffer; second.ImmutableSamplers = MakeHandle<const Sampler::Handle*>(0x20);
+
+		CHECK(Equal(firstInfo, secondInfo));
+		CHECK(Hash (firstInfo) == Hash(secondInfo));
+	}
+
+	SUBCASE("Combined image sampler")
+	{
+		first .Type = EDescriptorType::CombinedImageSampler; first .ImmutableSamplers = &samplers[0];
+		second.Type = EDescriptorType::CombinedImageSampler; second.ImmutableSamplers = &samplers[1];
+
+		CHECK_FALSE(Equal(firstInfo, secondInfo));
+		CHECK      (Hash (firstInfo) != Hash(secondInfo));
+	}
+}
+
+TEST_CASE("StructHash: empty arrays are equal whether or not their pointer is null")
+{
+	Pipeline::Layout::CreateInfo withNull {}, withPointer {};
+
+	Pipeline::Layout::DescriptorSet::Handle unused = MakeHandle<Pipeline::Layout::DescriptorSet::Handle>(0x1);
+
+	withPointer.SetLayoutCount = 0      ;
+	withPointer.SetLayouts     = &unused;
+
+	CHECK(Equal(withNull, withPointer));
+	CHECK(Hash (withNull) == Hash(withPointer));
+}
+
+TEST_CASE("StructHash: values compare by their bits")
+{
+	Sampler::CreateInfo positiveZero {}, negativeZero {};
+
+	positiveZero.MipLodBias =  0.0f;
+	negativeZero.MipLodBias = -0.0f;
+
+	CHECK_FALSE(Equal(positiveZero, negativeZero));
+	CHECK      (Hash (positiveZero) != Hash(negativeZero));
+}
+
+TEST_CASE("StructHash: unknown chained structures are identified by their address")
+{
+	Pipeline::Layout::CreateInfo first {}, second {};
+
+	VkBaseInStructure chainedFirst  { VkStructureType(1000999000), nullptr };
+	VkBaseInStructure chainedSecond { VkStructureType(1000999000), nullptr };
+
+	first .Next = &chainedFirst ;
+	second.Next = &chainedFirst ;
+
+	CHECK(Equal(first, second));
+	CHECK(Hash (first) == Hash(second));
+
+	second.Next = &chainedSecond;
+
+	CHECK_FALSE(Equal(first, second));
+}
+
+TEST_CASE("StructHash: create infos key unordered containers")
+{
+	GraphicsDescription first, second, third;
+
+	third.Attributes[0].Location = 2;
+
+	using Info = Pipeline::Graphics::CreateInfo;
+
+	std::unordered_set<Info, VV::V1::StructHash<Info>, VV::V1::StructEqual<Info>> set;
+
+	set.insert(first .Info);
+	set.insert(second.Info);
+	set.insert(third .Info);
+
+	CHECK(set.size() == 2);
+}
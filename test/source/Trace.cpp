@@ -0,0 +1,369 @@
+#include <doctest/doctest.h>
+
+#include <VaultedVulkan.hpp>
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+
+
+using namespace VV::V3;
+
+
+
+namespace
+{
+	std::string TestPath(const char* _name)
+	{
+		return (std::filesystem::temp_directory_path() / _name).string();
+	}
+
+	std::string ReadString(const std::string& _path)
+	{
+		MappedFile file;
+
+		if (!file.Open(_path.c_str())) return std::string();
+
+		return std::string(reinterpret_cast<const char*>(file.GetData()), file.GetSize());
+	}
+
+	/**
+	@brief Terminates a trace the way a viewer does: drops the trailing comma and closes the array.
+	*/
+	std::string Terminate(std::string _trace)
+	{
+		while (!_trace.empty() && (_trace.back() == '\n' || _trace.back() == ',')) _trace.pop_back();
+
+		return _trace + "\n]";
+	}
+
+	/**
+	@brief Strict JSON parser that keeps the "name" of every event of the top level array.
+	*/
+	class JSON
+	{
+	public:
+
+		explicit JSON(const std::string& _text) : text(_text), position(0)
+		{}
+
+		/**
+		@brief Parses the text as an array of objects, false if it is not valid JSON.
+		*/
+		bool ParseEvents(std::vector<std::string>& _names)
+		{
+			names = &_names;
+
+			Skip();
+
+			if (!Accept('[')) return false;
+
+			Skip();
+
+			if (Peek() != ']')
+			{
+				do
+				{
+					Skip();
+
+					if (Peek() != '{' || !Object(true)) return false;
+
+					Skip();
+				}
+				while (Accept(','));
+			}
+
+			if (!Accept(']')) return false;
+
+			Skip();
+
+			return position == text.size();
+		}
+
+	private:
+
+		char Peek() const { return position < text.size() ? text[position] : '\0'; }
+
+		bool Accept(char _character)
+		{
+			if (Peek() != _character) return false;
+
+			position++;
+
+			return true;
+		}
+
+		void Skip()
+		{
+			while (Peek() == ' ' || Peek() == '\n' || Peek() == '\r' || Peek() == '\t') position++;
+		}
+
+		bool Value()
+		{
+			Skip();
+
+			switch (Peek())
+			{
+				case '{': return Object(false);
+				case '[': return Array();
+				case '"': { std::string unused; return String(unused); }
+				case 't': return Word("true");
+				case 'f': return Word("false");
+				case 'n': return Word("null");
+				default : return Number();
+			}
+		}
+
+		bool Object(bool _event)
+		{
+			position++;
+
+			Skip();
+
+			if (Accept('}')) return true;
+
+			do
+			{
+				Skip();
+
+				std::string key;
+
+				if (!String(key)) return false;
+
+				Skip();
+
+				if (!Accept(':')) return false;
+
+				Skip();
+
+				if (_event && key == "name" && Peek() == '"')
+				{
+					std::string name;
+
+					if (!String(name)) return false;
+
+					names->push_back(name);
+				}
+				else if (!Value()) return false;
+
+				Skip();
+			}
+			while (Accept(','));
+
+			return Accept('}');
+		}
+
+		bool Array()
+		{
+			position++;
+
+			Skip();
+
+			if (Accept(']')) return true;
+
+			do
+			{
+				if (!Value()) return false;
+
+				Skip();
+			}
+			while (Accept(','));
+
+			return Accept(']');
+		}
+
+		bool String(std::string& _string)
+		{
+			if (!Accept('"')) return false;
+
+			for (;;)
+			{
+				if (position >= text.size()) return false;
+
+				const char character = text[position++];
+
+				if (character == '"') return true;
+
+				if (static_cast<unsigned char>(character) < 0x20) return false;
+
+				if (character != '\\')
+				{
+					_string += character;
+
+					continue;
+				}
+
+				switch (Peek())
+				{
+					case '"' : _string += '"' ; break;
+					case '\\': _string += '\\'; break;
+					case '/' : _string += '/' ; break;
+					case 'b' : _string += '\b'; break;
+					case 'f' : _string += '\f'; break;
+					case 'n' : _string += '\n'; break;
+					case 'r' : _string += '\r'; break;
+					case 't' : _string += '\t'; break;
+					case 'u' :
+					{
+						if (position + 5 > text.size()) return false;
+
+						const std::string digits = text.substr(position + 1, 4);
+
+						if (digits.find_first_not_of("0123456789abcdefABCDEF") != std::string::npos) return false;
+
+						const unsigned long code = std::stoul(digits, nullptr, 16);
+
+						// The sink only escapes control characters this way.
+						if (code >= 0x80) return false;
+
+						_string += char(code);
+
+						position += 4;
+
+						break;
+					}
+					default: return false;
+				}
+
+				position++;
+			}
+		}
+
+		bool Number()
+		{
+			const std::size_t start = position;
+
+			Accept('-');
+
+			while (Peek() >= '0' && Peek() <= '9') position++;
+
+			if (Accept('.'))
+			{
+				while (Peek() >= '0' && Peek() <= '9') position++;
+			}
+
+			return position > start && text[position - 1] != '-' && text[position - 1] != '.';
+		}
+
+		bool Word(const char* _word)
+		{
+			const std::string word(_word);
+
+			if (text.compare(position, word.size(), word) != 0) return false;
+
+			position += word.size();
+
+			return true;
+		}
+
+		const std::string& text;
+
+		std::size_t position;
+
+		std::vector<std::string>* names = nullptr;
+	};
+}
+
+TEST_CASE("Trace: events pushed past the capacity are dropped and counted")
+{
+	const std::string path = TestPath("VV_Trace_Dropped.json");
+
+	constexpr ui32 Capacity = 4     ;
+	constexpr ui32 Pushed   = 100000;
+
+	TraceSink sink;
+
+	REQUIRE(sink.Open(path.c_str(), Capacity));
+
+	CHECK_FALSE(sink.Open(path.c_str(), Capacity));
+
+	for (ui32 event = 0; event < Pushed; event++) sink.Instant("Test", "Event");
+
+	sink.Close();
+
+	CHECK_FALSE(sink.IsOpen());
+
+	// The writer drains while events are pushed, so only the total is known.
+	CHECK(sink.GetDroppedCount() > 0);
+
+	std::vector<std::string> names;
+
+	REQUIRE(JSON(Terminate(ReadString(path))).ParseEvents(names));
+
+	std::size_t written = 0;
+
+	for (const std::string& name : names) written += name == "Event";
+
+	CHECK(written + sink.GetDroppedCount() == Pushed);
+
+	std::filesystem::remove(path);
+}
+
+TEST_CASE("Trace: a closed trace is a JSON array once terminated")
+{
+	const std::string path = TestPath("VV_Trace_Closed.json");
+
+	TraceSink sink;
+
+	REQUIRE(sink.Open(path.c_str(), 64));
+
+	{
+		TraceSink::Scope scope(sink, "Test", "Scope");
+
+		sink.Instant("Test", "Instant");
+	}
+
+	sink.Close();
+
+	// Recording once closed does nothing.
+	sink.Instant("Test", "Late");
+
+	CHECK(sink.GetDroppedCount() == 0);
+
+	const std::string trace = ReadString(path);
+
+	// The array is left open, so a trace cut short remains readable.
+	REQUIRE(trace.size() > 2);
+	CHECK(trace.compare(0, 2, "[\n") == 0);
+	CHECK(trace.compare(trace.size() - 2, 2, ",\n") == 0);
+
+	std::vector<std::string> names;
+
+	REQUIRE(JSON(Terminate(trace)).ParseEvents(names));
+
+	// The process names, then the events in the order they were pushed.
+	REQUIRE(names.size() == 4);
+
+	CHECK(names[0] == "process_name");
+	CHECK(names[1] == "process_name");
+	CHECK(names[2] == "Instant"     );
+	CHECK(names[3] == "Scope"       );
+
+	std::filesystem::remove(path);
+}
+
+TEST_CASE("Trace: names are escaped")
+{
+	const std::string path = TestPath("VV_Trace_Escaped.json");
+
+	const char name[] = "Say \"hi\" \\ tab\t line\n bell\x07 end";
+
+	TraceSink sink;
+
+	REQUIRE(sink.Open(path.c_str(), 8));
+
+	sink.Instant("Test", name);
+
+	sink.Close();
+
+	std::vector<std::string> names;
+
+	REQUIRE(JSON(Terminate(ReadString(path))).ParseEvents(names));
+
+	REQUIRE(names.size() == 3);
+
+	CHECK(names[2] == name);
+
+	std::filesystem::remove(path);
+}